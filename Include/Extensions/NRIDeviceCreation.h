@@ -23,10 +23,49 @@ NriStruct(AllocationCallbacks) {
     bool disable3rdPartyAllocationCallbacks; // to use "AllocationCallbacks" only for NRI needs
 };
 
+// Device fault report (VK: "VK_EXT_device_fault"), all pointers are valid only during "DeviceFaultCallback"
+NriEnum(DeviceFaultAddressType, uint8_t,
+    NONE,
+    READ_INVALID,
+    WRITE_INVALID,
+    EXECUTE_INVALID,
+    INSTRUCTION_POINTER_UNKNOWN,
+    INSTRUCTION_POINTER_INVALID,
+    INSTRUCTION_POINTER_FAULT
+);
+
+NriStruct(DeviceFaultAddress) {
+    uint64_t address;                   // the fault is in "[address; address + precision)"
+    uint64_t precision;
+    Nri(DeviceFaultAddressType) type;
+
+    // A live buffer or texture, which memory contains "address"
+    const char* resourceName;           // NULL - not found, "" - found, but unnamed
+    uint64_t resourceOffset;
+    bool isTexture;
+};
+
+NriStruct(DeviceFaultVendorInfo) {
+    const char* description;
+    uint64_t code;
+    uint64_t data;
+};
+
+NriStruct(DeviceFaultDesc) {
+    const char* description;
+    const NriPtr(DeviceFaultAddress) addresses;
+    uint32_t addressNum;
+    const NriPtr(DeviceFaultVendorInfo) vendorInfos;
+    uint32_t vendorInfoNum;
+    NriOptional const void* vendorBinary; // vendor specific crash dump (VK: starts with "VkDeviceFaultVendorBinaryHeaderVersionOneEXT")
+    uint64_t vendorBinarySize;
+};
+
 NriStruct(CallbackInterface) {
     void (*MessageCallback)(Nri(Message) messageType, const char* file, uint32_t line, const char* message, void* userArg);
     NriOptional void (*AbortExecution)(void* userArg); // break on "Message::ERROR" if provided
     NriOptional void* userArg;
+    NriOptional void (*DeviceFaultCallback)(const NriRef(DeviceFaultDesc) deviceFaultDesc, void* userArg); // VK: called once on "DEVICE_LOST", if "VK_EXT_device_fault" is supported. If provided, live resources get tracked to resolve faulting addresses
 };
 
 // Use largest offset for the resource type planned to be used as an unbounded array
@@ -76,6 +115,7 @@ NriStruct(DeviceCreationDesc) {
     bool enableD3D11CommandBufferEmulation;     // enable? but why? (auto-enabled if deferred contexts are not supported)
     bool enableD3D12RayTracingValidation;       // slow but useful, can only be enabled if envvar "NV_ALLOW_RAYTRACING_VALIDATION" is set to "1"
     bool enableMemoryZeroInitialization;        // page-clears are fast, but memory is not cleared by default in VK
+    bool enableBreadcrumbs;                     // VK: annotations write GPU markers, the last completed and in-flight ones are reported on "DEVICE_LOST" (only the last 4096 recorded annotations are kept)
 
     // Switches (enabled by default)
     bool disableVKRayTracing;                   // to save CPU memory in some implementations
@@ -42,6 +42,57 @@ NriStruct(ResourceGroupDesc) {
     uint64_t preferredMemorySize; // desired chunk size (but can be greater if a resource doesn't fit), 256 Mb if 0
 };
 
+NriStruct(ResourceGroupCreationDesc) {
+    Nri(MemoryLocation) memoryLocation;
+    const NriPtr(TextureDesc) textureDescs;
+    uint32_t textureNum;
+    const NriPtr(BufferDesc) bufferDescs;
+    uint32_t bufferNum;
+    uint64_t preferredMemorySize; // see "ResourceGroupDesc"
+};
+
+NriForwardStruct(MemoryPool);
+
+static const uint32_t NriConstant(MEMORY_POOL_NULL) = (uint32_t)(-1); // invalid allocation handle
+
+NriStruct(MemoryPoolDesc) {
+    NriOptional uint64_t blockSize; // size of "Memory" blocks allocated per memory type, 64 Mb if 0
+};
+
+NriStruct(MemoryPoolStatistics) {
+    uint64_t blockSize;             // total size of blocks
+    uint64_t allocationSize;        // used in blocks
+    uint64_t largestFreeRangeSize;  // in blocks
+    uint64_t dedicatedSize;         // total size of dedicated allocations
+    uint32_t blockNum;
+    uint32_t allocationNum;         // placed in blocks
+    uint32_t dedicatedNum;
+};
+
+NriForwardStruct(TexturePool);
+
+static const uint32_t NriConstant(TEXTURE_POOL_NULL) = (uint32_t)(-1); // invalid texture handle
+
+NriStruct(TexturePoolDesc) {
+    NriOptional uint64_t budgetSize; // max size of unused textures kept alive, 0 - unlimited
+};
+
+NriStruct(PooledTexture) {
+    NriPtr(Texture) texture;        // bound to "DEVICE" memory
+    NriPtr(Descriptor) view;        // the default view (can be NULL)
+    uint32_t handle;
+};
+
+NriStruct(TexturePoolStatistics) {
+    uint64_t size;                  // all textures
+    uint64_t unusedSize;            // released textures kept alive
+    uint64_t hitNum;                // acquisitions served by recycled textures
+    uint64_t missNum;               // acquisitions, which created a new texture
+    uint64_t evictedNum;            // destroyed unused textures
+    uint32_t textureNum;
+    uint32_t unusedTextureNum;
+};
+
 NriStruct(FormatProps) {
     const char* name;            // format name
     Nri(Format) format;          // self
@@ -78,6 +129,38 @@ NriStruct(HelperInterface) {
 
     // Information about video memory
     Nri(Result) (NRI_CALL *QueryVideoMemoryInfo)        (const NriRef(Device) device, Nri(MemoryLocation) memoryLocation, NriOut NriRef(VideoMemoryInfo) videoMemoryInfo);
+
+    // Pooled memory allocation without VMA (TLSF suballocation of per-memory-type blocks):
+    // - allocation binds the resource to memory and returns a handle, which must be freed before destruction of the resource
+    // - resources larger than "blockSize / 2" and "mustBeDedicated" resources get their own memory
+    // - an empty block gets freed, except the last one of the memory type
+    Nri(Result) (NRI_CALL *CreateMemoryPool)            (NriRef(Device) device, const NriRef(MemoryPoolDesc) memoryPoolDesc, NriOut NriRef(MemoryPool*) memoryPool);
+    void        (NRI_CALL *DestroyMemoryPool)           (NriPtr(MemoryPool) memoryPool); // frees all memory
+    Nri(Result) (NRI_CALL *AllocatePooledBufferMemory)  (NriRef(MemoryPool) memoryPool, NriRef(Buffer) buffer, Nri(MemoryLocation) memoryLocation, NriOut NonNriRef(uint32_t) allocation);
+    Nri(Result) (NRI_CALL *AllocatePooledTextureMemory) (NriRef(MemoryPool) memoryPool, NriRef(Texture) texture, Nri(MemoryLocation) memoryLocation, NriOut NonNriRef(uint32_t) allocation);
+    void        (NRI_CALL *FreePooledMemory)            (NriRef(MemoryPool) memoryPool, uint32_t allocation); // the GPU must not use the resource anymore
+    void        (NRI_CALL *GetMemoryPoolStatistics)     (const NriRef(MemoryPool) memoryPool, NriOut NriRef(MemoryPoolStatistics) memoryPoolStatistics);
+
+    // Transient texture pool (recycling of same-shaped intermediate textures and their default views):
+    // - "AcquirePooledTexture" returns an unused texture with exactly the same "TextureDesc" or creates a new one
+    // - the default view is for the first usage in order: "SHADER_RESOURCE" (all mips and layers), "SHADER_RESOURCE_STORAGE",
+    //   "COLOR_ATTACHMENT", "DEPTH_STENCIL_ATTACHMENT" (mip 0, all layers), or none
+    // - "ReleasePooledTexture" returns a texture to the pool, it becomes reusable once "fence" reaches "value" (immediately if "fence" is NULL)
+    // - if "unusedSize > budgetSize" the least recently released textures, which are no longer in use by the GPU, get destroyed
+    //   (checked in "AcquirePooledTexture" and "ReleasePooledTexture")
+    Nri(Result) (NRI_CALL *CreateTexturePool)           (NriRef(Device) device, const NriRef(TexturePoolDesc) texturePoolDesc, NriOut NriRef(TexturePool*) texturePool);
+    void        (NRI_CALL *DestroyTexturePool)          (NriPtr(TexturePool) texturePool); // destroys all textures, the GPU must not use them anymore
+    Nri(Result) (NRI_CALL *AcquirePooledTexture)        (NriRef(TexturePool) texturePool, const NriRef(TextureDesc) textureDesc, NriOut NriRef(PooledTexture) pooledTexture);
+    void        (NRI_CALL *ReleasePooledTexture)        (NriRef(TexturePool) texturePool, uint32_t handle, NriPtr(Fence) fence, uint64_t value);
+    void        (NRI_CALL *GetTexturePoolStatistics)    (const NriRef(TexturePool) texturePool, NriOut NriRef(TexturePoolStatistics) texturePoolStatistics);
+
+    // Bulk creation of resources bound to memory: all buffers and all textures get bound by a single "Bind[Resource]Memory" call
+    // - "textures" and "buffers" must have "textureNum" and "bufferNum" entries, "allocations" must have "textureNum + bufferNum" entries
+    // - returns the number of used "allocations" and their total size in bytes
+    // - on failure nothing is created
+    // - resources must be destroyed before freeing "allocations"
+    Nri(Result) (NRI_CALL *CreateResourceGroup)         (NriRef(Device) device, const NriRef(ResourceGroupCreationDesc) resourceGroupCreationDesc, NriOut NriPtr(Texture)* textures, NriOut NriPtr(Buffer)* buffers,
+                                                            NriOut NriPtr(Memory)* allocations, NriOut NonNriRef(uint32_t) allocationNum, NriOut NonNriRef(uint64_t) allocationSize);
 };
 
 // Format utilities
@@ -0,0 +1,111 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: device generated commands ("ExecuteIndirect" with per-command root constants, vertex and index buffers), for GPU-driven rendering
+// https://microsoft.github.io/DirectX-Specs/d3d/IndirectDrawing.html
+// https://registry.khronos.org/vulkan/specs/latest/man/html/VK_EXT_device_generated_commands.html
+
+#pragma once
+
+#define NRI_INDIRECT_COMMANDS_H 1
+
+/*
+Command layout:
+- a command signature describes a command in an argument buffer: a sequence of state changes, ending with an action (draw or dispatch)
+- arguments are tightly packed in declaration order (all sizes are multiples of 4), "CommandSignatureDesc::stride" can only add padding
+- argument sizes: "ROOT_CONSTANTS" - "size", "VERTEX_BUFFER" - "IndirectVertexBufferDesc", "INDEX_BUFFER" - "IndirectIndexBufferDesc",
+  "DRAW" - "DrawDesc", "DRAW_INDEXED" - "DrawIndexedDesc", "DRAW_MESH_TASKS" - "DrawMeshTasksDesc", "DISPATCH" - "DispatchDesc"
+- "GetCommandSignatureStride" and "GetIndirectArgumentOffset" return the final layout, which should be used by shaders filling commands
+Notes:
+- state changes are visible to the following commands of the same "CmdExecuteIndirect" only, the state is undefined after execution
+- the pipeline and the pipeline layout are not changed, use the bound ones (must be compatible with "CommandSignatureDesc::pipelineLayout")
+- "ROOT_CONSTANTS" requires "pipelineLayout"
+- "VERTEX_BUFFER" and "INDEX_BUFFER" take device addresses (see "GetBufferDeviceAddress"), "IndirectVertexBufferDesc::stride" overrides
+  the pipeline stride
+- draw parameters emulation (see "DrawBaseDesc") is not applied, pass base vertex/instance via "ROOT_CONSTANTS" if needed
+- VK: the driver needs a preprocess buffer ("BufferUsageBits::PREPROCESS_BUFFER") of "GetCommandSignaturePreprocessSize" bytes,
+  executions in flight must use non-overlapping regions
+- D3D12: preprocessing is implicit, "GetCommandSignaturePreprocessSize" returns 0 and "preprocessBuffer" is ignored
+- NONE: command signatures are real objects following the same layout rules (can be used to test layouts), "CmdExecuteIndirect" does nothing
+*/
+
+NriNamespaceBegin
+
+NriForwardStruct(CommandSignature);
+
+// "IndirectIndexBufferDesc::indexFormat" values (DXGI formats, VK uses the same encoding)
+static const uint32_t NriConstant(INDIRECT_INDEX_FORMAT_UINT16) = 57; // DXGI_FORMAT_R16_UINT
+static const uint32_t NriConstant(INDIRECT_INDEX_FORMAT_UINT32) = 42; // DXGI_FORMAT_R32_UINT
+
+NriEnum(IndirectArgumentType, uint8_t,
+    // State
+    ROOT_CONSTANTS,     // "size" bytes, see "SetRootConstantsDesc"
+    VERTEX_BUFFER,      // "IndirectVertexBufferDesc"
+    INDEX_BUFFER,       // "IndirectIndexBufferDesc"
+
+    // Action (must be the last one)
+    DRAW,               // "DrawDesc"
+    DRAW_INDEXED,       // "DrawIndexedDesc"
+    DRAW_MESH_TASKS,    // "DrawMeshTasksDesc" (requires "features.meshShader")
+    DISPATCH            // "DispatchDesc"
+);
+
+// Same as "D3D12_VERTEX_BUFFER_VIEW" and "VkBindVertexBufferIndirectCommandEXT"
+NriStruct(IndirectVertexBufferDesc) {
+    uint64_t deviceAddress;
+    uint32_t size;
+    uint32_t stride;
+};
+
+// Same as "D3D12_INDEX_BUFFER_VIEW" and "VkBindIndexBufferIndirectCommandEXT" (in "DXGI" mode)
+NriStruct(IndirectIndexBufferDesc) {
+    uint64_t deviceAddress;
+    uint32_t size;
+    uint32_t indexFormat;   // "INDIRECT_INDEX_FORMAT_UINT16" or "INDIRECT_INDEX_FORMAT_UINT32"
+};
+
+NriStruct(IndirectArgumentDesc) {
+    Nri(IndirectArgumentType) type;
+    uint32_t index;         // "ROOT_CONSTANTS" - root constant index, "VERTEX_BUFFER" - vertex buffer slot ("CmdSetVertexBuffers::baseSlot")
+    uint32_t offset;        // "ROOT_CONSTANTS" - offset in the root constant block, bytes (multiple of 4)
+    uint32_t size;          // "ROOT_CONSTANTS" - number of bytes to set (multiple of 4)
+};
+
+NriStruct(CommandSignatureDesc) {
+    const NriPtr(IndirectArgumentDesc) arguments;
+    uint32_t argumentNum;
+    NriOptional const NriPtr(PipelineLayout) pipelineLayout; // required for "ROOT_CONSTANTS"
+    NriOptional uint32_t stride;                            // bytes, multiple of 4, 0 - packed
+};
+
+NriStruct(ExecuteIndirectDesc) {
+    const NriPtr(CommandSignature) commandSignature;
+    const NriPtr(Buffer) buffer;                            // "ARGUMENT_BUFFER", contains commands
+    uint64_t offset;
+    uint32_t commandMaxNum;
+    NriOptional const NriPtr(Buffer) countBuffer;           // "ARGUMENT_BUFFER", the actual number of commands is "min(commandMaxNum, count)"
+    uint64_t countBufferOffset;
+    NriOptional const NriPtr(Buffer) preprocessBuffer;      // VK: required
+    uint64_t preprocessBufferOffset;
+};
+
+// Threadsafe: yes (command buffers - no)
+NriStruct(IndirectCommandsInterface) {
+    // Create
+    Nri(Result)     (NRI_CALL *CreateCommandSignature)              (NriRef(Device) device, const NriRef(CommandSignatureDesc) commandSignatureDesc, NriOut NriRef(CommandSignature*) commandSignature);
+    void            (NRI_CALL *DestroyCommandSignature)             (NriPtr(CommandSignature) commandSignature);
+
+    // Layout
+    uint32_t        (NRI_CALL *GetCommandSignatureStride)           (const NriRef(CommandSignature) commandSignature);
+    uint32_t        (NRI_CALL *GetIndirectArgumentOffset)           (const NriRef(CommandSignature) commandSignature, uint32_t argumentIndex);
+
+    // Preprocess buffer size for executions with the pipeline (the pipeline is used at execution time)
+    uint64_t        (NRI_CALL *GetCommandSignaturePreprocessSize)   (const NriRef(CommandSignature) commandSignature, const NriRef(Pipeline) pipeline, uint32_t commandMaxNum);
+
+    // Command buffer
+    // {
+            // Requires a bound pipeline (and a pipeline layout if there are "ROOT_CONSTANTS"), "buffer" and "countBuffer" must be in "AccessBits::ARGUMENT_BUFFER" state
+            void    (NRI_CALL *CmdExecuteIndirect)                  (NriRef(CommandBuffer) commandBuffer, const NriRef(ExecuteIndirectDesc) executeIndirectDesc);
+    // }
+};
+
+NriNamespaceEnd
@@ -0,0 +1,86 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: CPU baking of opacity micromaps (OMM) from alpha-tested textures
+
+#pragma once
+
+#define NRI_MICROMAP_BAKER_H 1
+
+/*
+Requirements:
+- "NRIRayTracing.h" must be included before
+
+Expected usage:
+- the baker is CPU-only, doesn't touch the device and works on any backend (including NONE)
+- results are deterministic: they don't depend on "threadNum"
+- "MicromapBakeResult" arrays are owned by the baker and stay valid until the next "BakeMicromap" or "DestroyMicromapBaker" call
+- data can be directly used for micromap creation and building:
+    MicromapDesc::usages                  = MicromapBakeResult::usages
+    BuildMicromapDesc::dataBuffer         <= MicromapBakeResult::data
+    BuildMicromapDesc::triangleBuffer     <= MicromapBakeResult::triangles
+    BottomLevelMicromapDesc::indexBuffer  <= MicromapBakeResult::indices ("IndexType::UINT32", one index per geometry triangle)
+*/
+
+NriNamespaceBegin
+
+NriForwardStruct(MicromapBaker);
+
+NriStruct(MicromapBakerDesc) {
+    NriOptional uint32_t threadNum;                 // max number of worker threads, "std::thread::hardware_concurrency()" if 0
+};
+
+NriStruct(MicromapBakeDesc) {
+    // Geometry
+    const float* texcoords;                         // "float2" per vertex
+    NriOptional uint32_t texcoordStride;            // in bytes, "2 * sizeof(float)" if 0
+    uint32_t vertexNum;
+    NriOptional const void* indices;                // if not provided, "vertexNum / 3" triangles are assumed
+    uint32_t indexNum;
+    Nri(IndexType) indexType;
+
+    // Alpha texture (mip 0 only)
+    const void* alphaData;
+    uint32_t alphaWidth;
+    uint32_t alphaHeight;
+    NriOptional uint32_t alphaRowPitch;             // in bytes, tightly packed "alphaWidth * texelSize" if 0
+    Nri(Format) alphaFormat;                        // non-packed UNORM (8/16 bits) or SFLOAT (16/32 bits) format, alpha is taken from "A" if present, from "R" otherwise
+    Nri(AddressMode) addressMode;                   // REPEAT, MIRRORED_REPEAT or CLAMP_TO_EDGE
+    float alphaCutoff;                              // texels with "alpha >= alphaCutoff" are opaque
+
+    // Micromap
+    Nri(MicromapFormat) format;
+    uint16_t subdivisionLevel;                      // micro triangles count = 4 ^ subdivisionLevel, [0; 12]
+    NriOptional bool disableSpecialIndices;         // don't replace uniform triangles with "MicromapSpecialIndex" values
+    NriOptional bool disableReuse;                  // don't share identical micromap triangles between geometry triangles
+};
+
+NriStruct(MicromapBakeResult) {
+    // Micromap
+    const uint8_t* data;                            // packed 1 or 2 bits per micro triangle
+    uint64_t dataSize;
+    const NriPtr(MicromapTriangle) triangles;       // unique micromap triangles
+    uint32_t triangleNum;
+    const NriPtr(MicromapUsageDesc) usages;
+    uint32_t usageNum;
+
+    // Geometry triangle to micromap triangle mapping
+    const uint32_t* indices;                        // micromap triangle index or the unsigned cast of "MicromapSpecialIndex"
+    uint32_t indexNum;                              // = geometry triangle count
+
+    // Statistics
+    uint32_t fullyOpaqueNum;
+    uint32_t fullyTransparentNum;
+    uint32_t fullyUnknownNum;
+    uint32_t reusedNum;
+};
+
+// Threadsafe: no
+NriStruct(MicromapBakerInterface) {
+    Nri(Result) (NRI_CALL *CreateMicromapBaker)     (NriRef(Device) device, const NriRef(MicromapBakerDesc) micromapBakerDesc, NriOut NriRef(MicromapBaker*) micromapBaker);
+    void        (NRI_CALL *DestroyMicromapBaker)    (NriPtr(MicromapBaker) micromapBaker);
+
+    // (HOST) Bake micromaps for a single geometry
+    Nri(Result) (NRI_CALL *BakeMicromap)            (NriRef(MicromapBaker) micromapBaker, const NriRef(MicromapBakeDesc) micromapBakeDesc, NriOut NriRef(MicromapBakeResult) micromapBakeResult);
+};
+
+NriNamespaceEnd
@@ -0,0 +1,89 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: GPU profiling of annotated ranges (timings and pipeline statistics)
+
+#pragma once
+
+#define NRI_PROFILER_H 1
+
+/*
+Expected usage:
+- a frame is enclosed into "CmdBeginProfilerFrame" and "CmdEndProfilerFrame", which must be recorded outside of rendering
+- ranges can be nested, they form a tree (ranges with the same name and parent are merged, both within a frame and across frames)
+- ranges are recorded in submission order (i.e. command buffers recorded in parallel must not interleave ranges)
+- "EndProfilerFrame" must be called once at the very end of the frame
+- timings of frame N are resolved in "EndProfilerFrame" of frame "N + queuedFrameNum", i.e. it's assumed that
+  the app waits for completion of the frame "N - queuedFrameNum" before recording frame N (as for "StreamerDesc::queuedFrameNum")
+- only GRAPHICS and COMPUTE queues are supported
+- pipeline statistics ranges are independent of annotated ranges, can't be nested and must begin and end in the same scope
+  (either both inside or both outside of "CmdBeginRendering/CmdEndRendering"), ranges with the same name are merged
+*/
+
+NriNamespaceBegin
+
+NriForwardStruct(Profiler);
+
+static const uint32_t NriConstant(PROFILER_NO_PARENT) = (uint32_t)(-1);
+
+NriStruct(ProfilerDesc) {
+    uint32_t queuedFrameNum;                    // number of frames "in-flight" (usually 1-3), adds 1 under the hood for the current "not-yet-committed" frame
+    uint32_t rangeMaxNum;                       // max ranges per frame (excessive ranges are annotated, but not timed)
+    NriOptional uint32_t historyFrameNum;       // "min/avg/max" window size in frames, 60 if 0
+    NriOptional uint32_t statisticsRangeMaxNum; // max pipeline statistics ranges per frame, requires "features.pipelineStatistics"
+    NriOptional bool disableAnnotations;        // don't emit "CmdBeginAnnotation/CmdEndAnnotation" for ranges
+};
+
+NriStruct(ProfilerRange) {
+    const char* name;
+    uint32_t parentIndex;                       // index in the returned array or "PROFILER_NO_PARENT"
+    uint32_t depth;                             // 0 for top level ranges
+    uint32_t sampleNum;                         // number of frames in the history window where the range has been seen
+
+    // Time in milliseconds
+    double time;                                // last resolved frame
+    double timeMin;
+    double timeAvg;
+    double timeMax;
+};
+
+NriStruct(ProfilerStatistics) {
+    const char* name;
+    uint32_t sampleNum;                         // number of frames in the history window where the range has been seen
+
+    // Per frame (ranges with the same name are summed up)
+    Nri(PipelineStatisticsDesc) last;           // last resolved frame (zeroed if not seen)
+    Nri(PipelineStatisticsDesc) avg;            // over frames where the range has been seen
+    Nri(PipelineStatisticsDesc) max;
+};
+
+// Threadsafe: no
+NriStruct(ProfilerInterface) {
+    Nri(Result)                         (NRI_CALL *CreateProfiler)              (NriRef(Device) device, const NriRef(ProfilerDesc) profilerDesc, NriOut NriRef(Profiler*) profiler);
+    void                                (NRI_CALL *DestroyProfiler)             (NriPtr(Profiler) profiler);
+
+    // Command buffer
+    // {
+            // Frame (outside of rendering)
+            void                        (NRI_CALL *CmdBeginProfilerFrame)       (NriRef(CommandBuffer) commandBuffer, NriRef(Profiler) profiler);
+            void                        (NRI_CALL *CmdEndProfilerFrame)         (NriRef(CommandBuffer) commandBuffer, NriRef(Profiler) profiler);
+
+            // Range (an annotation paired with a couple of timestamps)
+            void                        (NRI_CALL *CmdBeginProfilerRange)       (NriRef(CommandBuffer) commandBuffer, NriRef(Profiler) profiler, const char* name, uint32_t bgra);
+            void                        (NRI_CALL *CmdEndProfilerRange)         (NriRef(CommandBuffer) commandBuffer, NriRef(Profiler) profiler);
+
+            // Pipeline statistics range (requires "statisticsRangeMaxNum > 0", excessive ranges are ignored)
+            void                        (NRI_CALL *CmdBeginProfilerStatistics)  (NriRef(CommandBuffer) commandBuffer, NriRef(Profiler) profiler, const char* name);
+            void                        (NRI_CALL *CmdEndProfilerStatistics)    (NriRef(CommandBuffer) commandBuffer, NriRef(Profiler) profiler);
+    // }
+
+    // (HOST) Must be called once at the very end of the frame
+    void                                (NRI_CALL *EndProfilerFrame)            (NriRef(Profiler) profiler);
+
+    // (HOST) The last resolved frame as a tree in depth-first order, valid until the next "EndProfilerFrame"
+    const NriPtr(ProfilerRange)         (NRI_CALL *GetProfilerRanges)           (const NriRef(Profiler) profiler, NriOut NonNriRef(uint32_t) rangeNum);
+
+    // (HOST) All pipeline statistics ranges seen so far in order of appearance, valid until the next "EndProfilerFrame"
+    const NriPtr(ProfilerStatistics)    (NRI_CALL *GetProfilerStatistics)       (const NriRef(Profiler) profiler, NriOut NonNriRef(uint32_t) statisticsNum);
+};
+
+NriNamespaceEnd
@@ -0,0 +1,157 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: a frame graph on top of the core interface (automatic barriers, pass culling, memory aliasing of transient resources)
+
+#pragma once
+
+#define NRI_RENDER_GRAPH_H 1
+
+/*
+Expected usage (every frame):
+- "BeginRenderGraph" starts a new frame, handles of the previous frame become invalid
+- resources get declared:
+    - "AddRenderGraphTexture/Buffer" - transient resources, owned by the graph, undefined at the beginning of the frame.
+      Memory gets aliased between resources with non-overlapping lifetimes. Usage bits are extended by accesses
+    - "ImportRenderGraphTexture/Buffer" - external resources with known initial and (optionally) desired final states
+- "AddRenderGraphPass" declares a pass, its resource accesses and a callback recording the pass
+- "CompileRenderGraph":
+    - culls passes, which don't contribute to imported resources or passes with side effects
+    - computes lifetimes and places transient resources into memory
+    - computes merged barriers for every pass boundary (consecutive reads in the same layout don't need barriers)
+- "GetRenderGraphTexture/Buffer" return real resources (NULL for unused transient resources)
+- "ExecuteRenderGraph" (once per frame) records alive passes in declaration order into 1 or more command buffers (in parallel),
+  which must be submitted in the returned order
+- or "SubmitRenderGraph" (once per frame) records and submits alive passes, "isAsyncCompute" passes go to "computeQueue":
+    - both queues get split into batches (1 command buffer each) at cross-queue dependencies
+    - dependencies include resource hazards, layout transitions and memory aliasing, only waits not covered by earlier waits are kept
+    - "queue" waits for "computeQueue" at the end of the frame, i.e. "signalFences" cover all work
+    - "computeQueue" waits for the end of the previous frame on "queue" only if async compute passes access imported resources
+- the app must wait for completion of the frame "N - queuedFrameNum" before "BeginRenderGraph" of frame N (as for "StreamerDesc::queuedFrameNum")
+Notes:
+- an access is a write if "AccessBits" contain any write bit (see "AccessBits"), "SHADER_RESOURCE_STORAGE" is read-write
+- a pass must not reference a resource more than once
+- passes declared after a pass are not visible to it, i.e. the declaration order is the execution order
+- resources accessed on both queues must use "SharingMode::CONCURRENT" (transient resources do)
+- layout transitions for "computeQueue" happen on "queue" after the last use, except for imported textures used by "computeQueue" first,
+  which must have an "initial" layout supported by compute queues
+*/
+
+NriNamespaceBegin
+
+NriForwardStruct(RenderGraph);
+
+static const uint32_t NriConstant(RENDER_GRAPH_NULL) = (uint32_t)(-1); // invalid handle
+
+NriStruct(RenderGraphDesc) {
+    const NriPtr(Queue) queue;                          // command buffers get created for this queue
+    NriOptional const NriPtr(Queue) computeQueue;       // a "COMPUTE" queue for "isAsyncCompute" passes (requires "SubmitRenderGraph"), if NULL such passes run on "queue"
+    uint32_t queuedFrameNum;                            // number of frames "in-flight" (usually 1-3), adds 1 under the hood for the current "not-yet-committed" frame
+    NriOptional uint32_t threadMaxNum;                  // max command buffers recorded in parallel by "ExecuteRenderGraph", 1 if 0
+    NriOptional bool enableTimestamps;                  // measure busy times of queues and their overlap (see "GetRenderGraphStatistics")
+};
+
+NriStruct(RenderGraphTextureDesc) {
+    Nri(TextureDesc) desc;
+    NriOptional const char* name;                       // must stay valid until the next "BeginRenderGraph"
+};
+
+NriStruct(RenderGraphBufferDesc) {
+    Nri(BufferDesc) desc;
+    NriOptional const char* name;
+};
+
+NriStruct(RenderGraphImportedTextureDesc) {
+    NriPtr(Texture) texture;
+    Nri(AccessLayoutStage) initial;                     // the state before the graph
+    NriOptional Nri(AccessLayoutStage) final;           // the state after the graph (ignored if "layout" is "UNDEFINED")
+    NriOptional const char* name;
+};
+
+NriStruct(RenderGraphImportedBufferDesc) {
+    NriPtr(Buffer) buffer;
+    Nri(AccessStage) initial;
+    NriOptional Nri(AccessStage) final;                 // ignored if "access" is "NONE"
+    NriOptional const char* name;
+};
+
+NriStruct(RenderGraphTextureAccess) {
+    uint32_t texture;                                   // handle
+    Nri(AccessLayoutStage) state;
+};
+
+NriStruct(RenderGraphBufferAccess) {
+    uint32_t buffer;                                    // handle
+    Nri(AccessStage) state;
+};
+
+// The callback can be called from any thread
+NriStruct(RenderGraphPassDesc) {
+    const NriPtr(RenderGraphTextureAccess) textures;
+    uint32_t textureNum;
+    const NriPtr(RenderGraphBufferAccess) buffers;
+    uint32_t bufferNum;
+    void (*Record)(NriRef(CommandBuffer) commandBuffer, void* userArg);
+    NriOptional void* userArg;
+    NriOptional const char* name;                       // also used as an annotation
+    NriOptional bool hasSideEffects;                    // never culled
+    NriOptional bool isAsyncCompute;                    // can run on "computeQueue" (only compute and copy commands)
+};
+
+NriStruct(RenderGraphExecuteDesc) {
+    NriOptional const NriPtr(DescriptorPool) descriptorPool; // passed to "BeginCommandBuffer"
+    NriOptional uint32_t threadNum;                     // 0 - "threadMaxNum"
+};
+
+NriStruct(RenderGraphSubmitDesc) {
+    NriOptional const NriPtr(DescriptorPool) descriptorPool; // passed to "BeginCommandBuffer"
+    NriOptional const NriPtr(FenceSubmitDesc) waitFences; // waited by the first submission to "queue"
+    uint32_t waitFenceNum;
+    NriOptional const NriPtr(FenceSubmitDesc) signalFences; // signaled by the last submission to "queue"
+    uint32_t signalFenceNum;
+    NriOptional const NriPtr(SwapChain) swapChain;      // passed to the last submission to "queue"
+};
+
+// All times are in milliseconds, values are zeros until the first measured frame
+NriStruct(RenderGraphStatistics) {
+    double queueTime;                                   // "queue" busy time
+    double computeQueueTime;                            // "computeQueue" busy time
+    double overlapTime;                                 // both queues are busy
+    double frameTime;                                   // from the start of the first batch to the end of the last batch
+    uint64_t frameIndex;                                // the measured frame ("queuedFrameNum" frames behind)
+    uint32_t batchNum;                                  // submissions to "queue"
+    uint32_t computeBatchNum;                           // submissions to "computeQueue"
+    uint32_t waitNum;                                   // cross-queue waits
+};
+
+// Threadsafe: no
+NriStruct(RenderGraphInterface) {
+    Nri(Result)                 (NRI_CALL *CreateRenderGraph)           (NriRef(Device) device, const NriRef(RenderGraphDesc) renderGraphDesc, NriOut NriRef(RenderGraph*) renderGraph);
+    void                        (NRI_CALL *DestroyRenderGraph)          (NriPtr(RenderGraph) renderGraph);
+
+    // Declaration (return "RENDER_GRAPH_NULL" on failure)
+    void                        (NRI_CALL *BeginRenderGraph)            (NriRef(RenderGraph) renderGraph);
+    uint32_t                    (NRI_CALL *AddRenderGraphTexture)       (NriRef(RenderGraph) renderGraph, const NriRef(RenderGraphTextureDesc) renderGraphTextureDesc);
+    uint32_t                    (NRI_CALL *AddRenderGraphBuffer)        (NriRef(RenderGraph) renderGraph, const NriRef(RenderGraphBufferDesc) renderGraphBufferDesc);
+    uint32_t                    (NRI_CALL *ImportRenderGraphTexture)    (NriRef(RenderGraph) renderGraph, const NriRef(RenderGraphImportedTextureDesc) renderGraphImportedTextureDesc);
+    uint32_t                    (NRI_CALL *ImportRenderGraphBuffer)     (NriRef(RenderGraph) renderGraph, const NriRef(RenderGraphImportedBufferDesc) renderGraphImportedBufferDesc);
+    uint32_t                    (NRI_CALL *AddRenderGraphPass)          (NriRef(RenderGraph) renderGraph, const NriRef(RenderGraphPassDesc) renderGraphPassDesc);
+
+    // Compilation
+    Nri(Result)                 (NRI_CALL *CompileRenderGraph)          (NriRef(RenderGraph) renderGraph);
+    NriPtr(Texture)             (NRI_CALL *GetRenderGraphTexture)       (const NriRef(RenderGraph) renderGraph, uint32_t texture);
+    NriPtr(Buffer)              (NRI_CALL *GetRenderGraphBuffer)        (const NriRef(RenderGraph) renderGraph, uint32_t buffer);
+
+    // Human-readable compiled schedule (passes, barriers, lifetimes and memory placement), valid until the next "CompileRenderGraph"
+    const char*                 (NRI_CALL *GetRenderGraphDump)          (const NriRef(RenderGraph) renderGraph);
+
+    // Records alive passes, returns command buffers to submit in order (NULL on failure)
+    NriPtr(CommandBuffer) const* (NRI_CALL *ExecuteRenderGraph)         (NriRef(RenderGraph) renderGraph, const NriRef(RenderGraphExecuteDesc) renderGraphExecuteDesc, NriOut NonNriRef(uint32_t) commandBufferNum);
+
+    // Records alive passes and submits them to "queue" and "computeQueue" with cross-queue waits
+    Nri(Result)                 (NRI_CALL *SubmitRenderGraph)           (NriRef(RenderGraph) renderGraph, const NriRef(RenderGraphSubmitDesc) renderGraphSubmitDesc);
+
+    // Requires "enableTimestamps"
+    void                        (NRI_CALL *GetRenderGraphStatistics)    (const NriRef(RenderGraph) renderGraph, NriOut NriRef(RenderGraphStatistics) renderGraphStatistics);
+};
+
+NriNamespaceEnd
@@ -0,0 +1,68 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: changing memory priorities after allocation and automatic demotion of allocations, which went cold
+
+#pragma once
+
+#define NRI_RESIDENCY_H 1
+
+/*
+Priorities:
+- same as "AllocateMemoryDesc::priority": [-1; 1]: low < 0, normal = 0, high > 0
+- a hint for the OS and the driver, which allocations to page out first under memory pressure
+- VK: requires "VK_EXT_pageable_device_local_memory". Allocations made by "ResourceAllocatorInterface" are supported only if
+  the memory is dedicated (VMA memory blocks are shared by allocations), use "dedicated = true" for resources to be managed
+- D3D12: memory (except "mustBeDedicated" types), committed and placed resources
+- D3D11: buffers and textures (memory is virtual)
+- unsupported objects return "UNSUPPORTED"
+Expected usage of "ResidencyManager" (LRU):
+- "AddResidencyMemory/Buffer/Texture" registers an allocation with its "hot" priority (the current priority is not changed)
+- "MarkResidencyObjectUsed" for objects used in the current frame (cheap, can be called many times)
+- "UpdateResidency" once per frame:
+    - demotes objects, which haven't been used for "coldFrameNum" frames, to "coldPriority" (least recently used first)
+    - promotes cold objects, which have been used again, back to their priority
+- objects must be removed before destruction
+*/
+
+NriNamespaceBegin
+
+NriForwardStruct(ResidencyManager);
+
+static const uint32_t NriConstant(RESIDENCY_NULL) = (uint32_t)(-1); // invalid handle
+
+NriStruct(ResidencyManagerDesc) {
+    uint32_t coldFrameNum;                              // an object goes cold if unused for this number of frames
+    float coldPriority;                                 // [-1; 1], usually "-1"
+    NriOptional float budgetUsageThreshold;             // demotion starts if "usageSize / budgetSize" of "DEVICE" memory exceeds this value, 0 - always
+    NriOptional uint32_t maxPriorityUpdateNum;          // max priority changes per "UpdateResidency" (changes are not free), 0 - unlimited
+};
+
+NriStruct(ResidencyStatistics) {
+    uint32_t objectNum;
+    uint32_t coldObjectNum;
+    uint32_t unsupportedObjectNum;                      // objects, which priority can't be changed (ignored)
+    uint32_t demotedNum;                                // by the last "UpdateResidency"
+    uint32_t promotedNum;                               // by the last "UpdateResidency"
+    float budgetUsage;                                  // "usageSize / budgetSize" seen by the last "UpdateResidency"
+};
+
+// Threadsafe: no
+NriStruct(ResidencyInterface) {
+    // Priority of an existing allocation
+    Nri(Result)     (NRI_CALL *SetMemoryPriority)           (NriRef(Memory) memory, float priority);
+    Nri(Result)     (NRI_CALL *SetBufferPriority)           (NriRef(Buffer) buffer, float priority);
+    Nri(Result)     (NRI_CALL *SetTexturePriority)          (NriRef(Texture) texture, float priority);
+
+    // LRU
+    Nri(Result)     (NRI_CALL *CreateResidencyManager)      (NriRef(Device) device, const NriRef(ResidencyManagerDesc) residencyManagerDesc, NriOut NriRef(ResidencyManager*) residencyManager);
+    void            (NRI_CALL *DestroyResidencyManager)     (NriPtr(ResidencyManager) residencyManager);
+    uint32_t        (NRI_CALL *AddResidencyMemory)          (NriRef(ResidencyManager) residencyManager, NriRef(Memory) memory, float priority);
+    uint32_t        (NRI_CALL *AddResidencyBuffer)          (NriRef(ResidencyManager) residencyManager, NriRef(Buffer) buffer, float priority);
+    uint32_t        (NRI_CALL *AddResidencyTexture)         (NriRef(ResidencyManager) residencyManager, NriRef(Texture) texture, float priority);
+    void            (NRI_CALL *RemoveResidencyObject)       (NriRef(ResidencyManager) residencyManager, uint32_t object); // the priority stays as is
+    void            (NRI_CALL *MarkResidencyObjectUsed)     (NriRef(ResidencyManager) residencyManager, uint32_t object);
+    void            (NRI_CALL *UpdateResidency)             (NriRef(ResidencyManager) residencyManager);
+    void            (NRI_CALL *GetResidencyStatistics)      (const NriRef(ResidencyManager) residencyManager, NriOut NriRef(ResidencyStatistics) residencyStatistics);
+};
+
+NriNamespaceEnd
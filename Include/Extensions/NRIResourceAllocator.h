@@ -45,12 +45,34 @@ NriStruct(AllocateMicromapDesc) {
     bool dedicated;
 };
 
+// Per memory heap (VK: "VkMemoryHeap", D3D12: local and non-local memory segment groups), sizes are in bytes
+NriStruct(ResourceAllocatorHeapStatistics) {
+    uint64_t budgetSize;                                // how much memory the process can use (an estimation)
+    uint64_t usageSize;                                 // how much memory the process uses, including memory not allocated by the allocator (an estimation)
+    uint64_t blockSize;                                 // memory allocated by the allocator (blocks and dedicated allocations)
+    uint64_t allocationSize;                            // memory occupied by allocations, "blockSize - allocationSize" is free
+    uint32_t blockNum;
+    uint32_t allocationNum;
+    float fragmentation;                                // [0; 1]: "1 - largestFreeRange / freeSize", 0 - free memory is contiguous
+    bool isDeviceLocal;
+};
+
 // Threadsafe: yes
 NriStruct(ResourceAllocatorInterface) {
     Nri(Result) (NRI_CALL *AllocateBuffer)                  (NriRef(Device) device, const NriRef(AllocateBufferDesc) allocateBufferDesc, NriOut NriRef(Buffer*) buffer);
     Nri(Result) (NRI_CALL *AllocateTexture)                 (NriRef(Device) device, const NriRef(AllocateTextureDesc) allocateTextureDesc, NriOut NriRef(Texture*) texture);
     Nri(Result) (NRI_CALL *AllocateAccelerationStructure)   (NriRef(Device) device, const NriRef(AllocateAccelerationStructureDesc) allocateAccelerationStructureDesc, NriOut NriRef(AccelerationStructure*) accelerationStructure);
     Nri(Result) (NRI_CALL *AllocateMicromap)                (NriRef(Device) device, const NriRef(AllocateMicromapDesc) allocateMicromapDesc, NriOut NriRef(Micromap*) micromap);
+
+    // Statistics (walk all allocations, not intended for per-frame usage)
+    // if "heapStatistics == NULL", then "heapStatisticsNum" is set to the number of heaps
+    // else "heapStatisticsNum" must be set to number of elements in "heapStatistics"
+    Nri(Result) (NRI_CALL *GetResourceAllocatorStatistics)  (const NriRef(Device) device, NriPtr(ResourceAllocatorHeapStatistics) heapStatistics, NonNriRef(uint32_t) heapStatisticsNum);
+
+    // Detailed JSON map of all blocks and allocations ("vmaBuildStatsString" format, can be opened in "VmaDumpVis" / "D3d12maDumpVis")
+    // if "dump == NULL", then "dumpSize" is set to the required size (including the null terminator)
+    // else "dumpSize" must be set to the size of "dump" ("FAILURE" and the required size are returned if it's not enough)
+    Nri(Result) (NRI_CALL *GetResourceAllocatorDump)        (const NriRef(Device) device, NriOptional char* dump, NonNriRef(uint64_t) dumpSize);
 };
 
 NriNamespaceEnd
@@ -0,0 +1,123 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: sparse (tiled, reserved) resources with page-granular residency (virtual texturing, terrain streaming)
+
+#pragma once
+
+#define NRI_SPARSE_H 1
+
+/*
+Expected usage:
+- sparse resources are created without memory, memory gets mapped to them tile by tile using "QueueBindSparse"
+- tiles are backed by regular memory: use "GetBufferMemoryDesc/GetTextureMemoryDesc" of the sparse resource to get "MemoryType",
+  allocate a "tile pool" with "AllocateMemory" (size and offsets must be multiples of "SparseTiling::tileSize")
+- texture tiles are addressed in tiles, not in texels, only for mips below "SparseTiling::mipTailFirst"
+- mips starting from "mipTailFirst" form a "mip tail", which can't be partially mapped
+- destruction is done via "DestroyBuffer/DestroyTexture", mapped memory must outlive mappings
+- "QueueBindSparse" requires a queue supporting sparse binding (a GRAPHICS queue usually does), otherwise "UNSUPPORTED" is returned
+- "SparsePageTable" is a CPU-side helper, which tracks tile mappings of a resource, drops redundant changes and coalesces
+  pending changes into a minimal set of bind operations, which can be submitted via "QueueBindSparse"
+*/
+
+NriNamespaceBegin
+
+NriForwardStruct(SparsePageTable);
+
+NriStruct(SparseBufferDesc) {
+    Nri(BufferDesc) desc;
+};
+
+NriStruct(SparseTextureDesc) {
+    Nri(TextureDesc) desc;      // 2D or 3D, single sample
+};
+
+NriStruct(SparseTiling) {
+    uint64_t tileSize;          // bytes (64 KB in practice), granularity of "memoryOffset"
+    uint32_t tileNum;           // tiles needed to back the whole resource
+    uint32_t tileWidth;         // texels (bytes for buffers)
+    uint32_t tileHeight;        // texels
+    uint32_t tileDepth;         // texels
+    Nri(Dim_t) mipTailFirst;    // first mip of the mip tail ("mipNum" if there is no mip tail)
+    uint32_t mipTailTileNum;    // tiles of the mip tail of a layer
+    bool isMipTailShared;       // a single mip tail for all layers
+};
+
+// "memory = NULL" unmaps tiles
+NriStruct(SparseBufferBindDesc) {
+    NriPtr(Buffer) buffer;
+    uint64_t offset;            // bytes, multiple of "tileSize"
+    uint64_t size;              // bytes, multiple of "tileSize"
+    NriOptional NriPtr(Memory) memory;
+    uint64_t memoryOffset;      // multiple of "tileSize"
+};
+
+NriStruct(SparseTextureBindDesc) {
+    NriPtr(Texture) texture;
+    Nri(TextureRegionDesc) region; // in tiles ("WHOLE_SIZE" is not allowed), "mipOffset" must be < "mipTailFirst", tiles are mapped in "x, y, z" order
+    NriOptional NriPtr(Memory) memory;
+    uint64_t memoryOffset;
+};
+
+NriStruct(SparseMipTailBindDesc) {
+    NriPtr(Texture) texture;
+    Nri(Dim_t) layer;           // ignored if "isMipTailShared"
+    NriOptional NriPtr(Memory) memory;
+    uint64_t memoryOffset;      // "mipTailTileNum" tiles get mapped
+};
+
+NriStruct(QueueBindSparseDesc) {
+    const NriPtr(FenceSubmitDesc) waitFences;
+    uint32_t waitFenceNum;
+    const NriPtr(SparseBufferBindDesc) bufferBinds;
+    uint32_t bufferBindNum;
+    const NriPtr(SparseTextureBindDesc) textureBinds;
+    uint32_t textureBindNum;
+    const NriPtr(SparseMipTailBindDesc) mipTailBinds;
+    uint32_t mipTailBindNum;
+    const NriPtr(FenceSubmitDesc) signalFences;
+    uint32_t signalFenceNum;
+};
+
+// Page table
+NriStruct(SparsePageTableDesc) {
+    NriOptional NriPtr(Buffer) buffer;      // one of
+    NriOptional NriPtr(Texture) texture;
+};
+
+NriStruct(SparseTile) {
+    uint32_t x;                 // in tiles (tile index for buffers)
+    uint32_t y;
+    uint32_t z;
+    Nri(Dim_t) mip;             // "mip >= mipTailFirst" addresses the mip tail of "layer"
+    Nri(Dim_t) layer;
+};
+
+NriStruct(SparseTileMapping) {
+    Nri(SparseTile) tile;
+    NriOptional NriPtr(Memory) memory; // NULL - unmap
+    uint64_t memoryOffset;             // multiple of "tileSize" (the mip tail needs "mipTailTileNum" tiles)
+};
+
+// Threadsafe: yes (page tables - no)
+NriStruct(SparseInterface) {
+    // Resources
+    Nri(Result)     (NRI_CALL *CreateSparseBuffer)          (NriRef(Device) device, const NriRef(SparseBufferDesc) sparseBufferDesc, NriOut NriRef(Buffer*) buffer);
+    Nri(Result)     (NRI_CALL *CreateSparseTexture)         (NriRef(Device) device, const NriRef(SparseTextureDesc) sparseTextureDesc, NriOut NriRef(Texture*) texture);
+    void            (NRI_CALL *GetSparseBufferTiling)       (const NriRef(Buffer) buffer, NriOut NriRef(SparseTiling) sparseTiling);
+    void            (NRI_CALL *GetSparseTextureTiling)      (const NriRef(Texture) texture, NriOut NriRef(SparseTiling) sparseTiling);
+
+    // Tile mapping
+    Nri(Result)     (NRI_CALL *QueueBindSparse)             (NriRef(Queue) queue, const NriRef(QueueBindSparseDesc) queueBindSparseDesc);
+
+    // Page table
+    Nri(Result)     (NRI_CALL *CreateSparsePageTable)       (NriRef(Device) device, const NriRef(SparsePageTableDesc) sparsePageTableDesc, NriOut NriRef(SparsePageTable*) sparsePageTable);
+    void            (NRI_CALL *DestroySparsePageTable)      (NriPtr(SparsePageTable) sparsePageTable);
+    void            (NRI_CALL *UpdateSparsePageTable)       (NriRef(SparsePageTable) sparsePageTable, const NriPtr(SparseTileMapping) tileMappings, uint32_t tileMappingNum);
+    uint32_t        (NRI_CALL *GetSparsePageTableMappedTileNum) (const NriRef(SparsePageTable) sparsePageTable); // a mip tail counts as 1
+
+    // Coalesces pending changes into bind operations and fills bind arrays of "queueBindSparseDesc" (other members are not touched),
+    // returned arrays are valid until the next call. Pending changes are considered submitted
+    void            (NRI_CALL *GetSparsePageTableBinds)     (NriRef(SparsePageTable) sparsePageTable, NriOut NriRef(QueueBindSparseDesc) queueBindSparseDesc);
+};
+
+NriNamespaceEnd
@@ -76,6 +76,10 @@ NriStruct(StreamerInterface) {
 
     // (HOST) Must be called once at the very end of the frame
     void                (NRI_CALL *EndStreamerFrame)            (NriRef(Streamer) streamer);
+
+    // (HOST) Stream a tightly packed "uint64_t" array of device addresses ("buffer + offset") to a constant buffer. Return the device address of the array
+    // for direct usage in the current frame, which can be passed to shaders via "CmdSetRootConstants" instead of binding descriptors (requires "features.deviceAddress")
+    uint64_t            (NRI_CALL *StreamDeviceAddresses)       (NriRef(Streamer) streamer, const NriPtr(BufferOffset) bufferOffsets, uint32_t bufferOffsetNum);
 };
 
 NriNamespaceEnd
\ No newline at end of file
@@ -68,12 +68,20 @@ NriStruct(MetalWindow) {    // Expects "APPLE" platform macro
     void* caMetalLayer;     //    CAMetalLayer
 };
 
+NriStruct(HeadlessWindow) { // Doesn't need a display (CI, render farms): textures are "presented" offscreen, "features.swapChain" is not required,
+                            // "SwapChainDesc::textureNum" is clamped to [1; 64]
+    uint32_t refreshRate;   //    simulated refresh rate in Hz (0 - unthrottled)
+    bool enable;
+    bool allowReadback;     //    allow "GetPresentedFrame"
+};
+
 NriStruct(Window) {
     // Only one entity must be initialized
     Nri(WindowsWindow) windows;
     Nri(X11Window) x11;
     Nri(WaylandWindow) wayland;
     Nri(MetalWindow) metal;
+    Nri(HeadlessWindow) headless;
 };
 
 // SwapChain textures will be created as "color attachment" resources
@@ -119,6 +127,36 @@ NriStruct(DisplayDesc) {
     bool isHDR;
 };
 
+// Frame pacing statistics, all times are in microseconds
+// Presentation feedback, if available (see "isMeasured"):
+//  - VK: "VK_GOOGLE_display_timing" or "VK_KHR_present_wait" (only for "WAITABLE" swap chains, updated in "WaitForPresent")
+//  - D3D: "IDXGISwapChain::GetFrameStatistics"
+// Otherwise display-related values are CPU-side approximations: a frame is assumed displayed when the swap chain returns the texture of the previous frame
+NriStruct(SwapChainStatistics) {
+    uint64_t presentNum;                       // "QueuePresent" calls
+    uint64_t displayedNum;                     // presents known to be displayed
+    uint64_t missedVblankNum;                  // extra refresh cycles spent on screen by displayed frames (0 if "VSYNC" is off)
+    uint64_t acquireBlockedTotalTime;          // spent in "AcquireNextTexture"
+    uint64_t waitForPresentBlockedTotalTime;   // spent in "WaitForPresent"
+    uint32_t acquireBlockedTime;               // the last "AcquireNextTexture"
+    uint32_t waitForPresentBlockedTime;        // the last "WaitForPresent"
+    uint32_t presentToDisplayLatency;          // the last displayed frame
+    uint32_t presentToDisplayLatencyAvg;       // average over displayed frames
+    uint32_t refreshInterval;                  // 0 if unknown
+    uint32_t queuedFrameNum;                   // presents not displayed yet
+    bool isMeasured;                           // "false" if presentation feedback is not available
+};
+
+// A copy of a presented texture (headless swap chains only)
+NriStruct(PresentedFrame) {
+    const void* data;                          // valid until the next "GetPresentedFrame" call
+    uint64_t presentIndex;                     // starts from 1
+    uint32_t rowPitch;
+    Nri(Dim_t) width;
+    Nri(Dim_t) height;
+    Nri(Format) format;
+};
+
 // Threadsafe: yes
 NriStruct(SwapChainInterface) {
     Nri(Result)             (NRI_CALL *CreateSwapChain)         (NriRef(Device) device, const NriRef(SwapChainDesc) swapChainDesc, NriOut NriRef(SwapChain*) swapChain);
@@ -132,6 +170,12 @@ NriStruct(SwapChainInterface) {
     Nri(Result)             (NRI_CALL *AcquireNextTexture)      (NriRef(SwapChain) swapChain, NriRef(Fence) acquireSemaphore, NriOut NonNriRef(uint32_t) textureIndex);
     Nri(Result)             (NRI_CALL *WaitForPresent)          (NriRef(SwapChain) swapChain); // call once right before input sampling (must be called starting from the 1st frame)
     Nri(Result)             (NRI_CALL *QueuePresent)            (NriRef(SwapChain) swapChain, NriRef(Fence) releaseSemaphore);
+
+    // Frame pacing
+    Nri(Result)             (NRI_CALL *GetSwapChainStatistics)  (NriRef(SwapChain) swapChain, NriOut NriRef(SwapChainStatistics) swapChainStatistics);
+
+    // Headless only (requires "allowReadback"): waits for the last presented frame and returns its contents
+    Nri(Result)             (NRI_CALL *GetPresentedFrame)       (NriRef(SwapChain) swapChain, NriOut NriRef(PresentedFrame) presentedFrame);
 };
 
 /*
@@ -0,0 +1,42 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: CPU trace events of NRI internals (submits, descriptor updates, pipeline creation, streaming, waits)
+
+#pragma once
+
+#define NRI_TRACE_H 1
+
+/*
+Expected usage:
+- requires "NRI_ENABLE_TRACE" (otherwise "StartTrace" returns "UNSUPPORTED"), the cost of a disabled trace is a pointer check per event
+- events get recorded into per-thread ring buffers, older events are overwritten
+- callbacks are called on the calling thread (can be used to forward events to an external profiler, for example, Tracy)
+- "StartTrace" and "StopTrace" must not be called concurrently with other NRI calls
+*/
+
+NriNamespaceBegin
+
+NriForwardStruct(Device);
+
+// Callbacks must be thread safe
+NriStruct(TraceCallbacks) {
+    void (*BeginEvent)(const char* name, void* userArg); // "name" is a string literal
+    void (*EndEvent)(void* userArg);
+    NriOptional void* userArg;
+};
+
+NriStruct(TraceDesc) {
+    uint32_t eventMaxNumPerThread;                      // ring buffer size per thread (0 - no recording, callbacks only)
+    NriOptional Nri(TraceCallbacks) callbacks;
+};
+
+// Threadsafe: yes (see above)
+NriStruct(TraceInterface) {
+    Nri(Result)     (NRI_CALL *StartTrace)      (NriRef(Device) device, const NriRef(TraceDesc) traceDesc);
+    void            (NRI_CALL *StopTrace)       (NriRef(Device) device);
+
+    // Recorded events in "Chrome trace event" format (chrome://tracing, Perfetto), valid until the next call or "StopTrace"
+    const char*     (NRI_CALL *GetTraceJson)    (NriRef(Device) device);
+};
+
+NriNamespaceEnd
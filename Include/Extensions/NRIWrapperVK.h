@@ -40,6 +40,7 @@ NriStruct(DeviceCreationVKDesc) {
     // Switches (disabled by default)
     bool enableNRIValidation;
     bool enableMemoryZeroInitialization;                // page-clears are fast, but memory is not cleared by default in VK
+    bool enableBreadcrumbs;                             // see "DeviceCreationDesc::enableBreadcrumbs" ("VK_AMD_buffer_marker" is used if enabled in "vkExtensions")
 };
 
 NriStruct(CommandAllocatorVKDesc) {
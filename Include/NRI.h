@@ -37,8 +37,8 @@ Implicit:
 
 #pragma once
 
-#define NRI_VERSION 174
-#define NRI_VERSION_DATE "19 August 2025"
+#define NRI_VERSION 175
+#define NRI_VERSION_DATE "18 October 2026"
 
 // C/C++ compatible interface (auto-selection or via "NRI_FORCE_C" macro)
 #include "NRIDescs.h"
@@ -115,6 +115,7 @@ NriStruct(CoreInterface) {
     //      - call "Bind[Resource]Memory" to bind resources to "Memory" objects
     //  Mid level:
     //      - "CalculateAllocationNumber" and "AllocateAndBindMemory" simplify this process for buffers and textures
+    //      - "CreateResourceGroup" additionally creates buffers and textures (a fast path for mass creation)
     //  High level:
     //      - "ResourceAllocatorInterface" allows to create resources already bound to memory
     void                (NRI_CALL *GetBufferMemoryDesc)             (const NriRef(Buffer) buffer, Nri(MemoryLocation) memoryLocation, NriOut NriRef(MemoryDesc) memoryDesc);
@@ -214,14 +215,14 @@ NriStruct(CoreInterface) {
         void                (NRI_CALL *CmdEndQuery)                 (NriRef(CommandBuffer) commandBuffer, NriRef(QueryPool) queryPool, uint32_t offset);
         void                (NRI_CALL *CmdCopyQueries)              (NriRef(CommandBuffer) commandBuffer, const NriRef(QueryPool) queryPool, uint32_t offset, uint32_t num, NriRef(Buffer) dstBuffer, uint64_t dstOffset);
 
-        // Annotations for profiling tools: command buffer
+        // Annotations for profiling tools: command buffer (also GPU crash breadcrumbs, if "enableBreadcrumbs")
         void                (NRI_CALL *CmdBeginAnnotation)          (NriRef(CommandBuffer) commandBuffer, const char* name, uint32_t bgra);
         void                (NRI_CALL *CmdEndAnnotation)            (NriRef(CommandBuffer) commandBuffer);
         void                (NRI_CALL *CmdAnnotation)               (NriRef(CommandBuffer) commandBuffer, const char* name, uint32_t bgra);
     // }                }
     Nri(Result)         (NRI_CALL *EndCommandBuffer)                (NriRef(CommandBuffer) commandBuffer); // D3D11 performs state tracking and resets it there
 
-    // Annotations for profiling tools: command queue - D3D11: NOP
+    // Annotations for profiling tools: command queue - D3D11: NOP (reported as batch names on "DEVICE_LOST", if "enableBreadcrumbs")
     void                (NRI_CALL *QueueBeginAnnotation)            (NriRef(Queue) queue, const char* name, uint32_t bgra);
     void                (NRI_CALL *QueueEndAnnotation)              (NriRef(Queue) queue);
     void                (NRI_CALL *QueueAnnotation)                 (NriRef(Queue) queue, const char* name, uint32_t bgra);
@@ -255,6 +256,19 @@ NriStruct(CoreInterface) {
     uint64_t            (NRI_CALL *GetBufferNativeObject)           (const NriPtr(Buffer) buffer);               // ID3D11Buffer*                   | ID3D12Resource*             | VkBuffer
     uint64_t            (NRI_CALL *GetTextureNativeObject)          (const NriPtr(Texture) texture);             // ID3D11Resource*                 | ID3D12Resource*             | VkImage
     uint64_t            (NRI_CALL *GetDescriptorNativeObject)       (const NriPtr(Descriptor) descriptor);       // ID3D11View/ID3D11SamplerState*  | D3D12_CPU_DESCRIPTOR_HANDLE | VkImageView/VkBufferView/VkSampler
+
+    // Since v175 (appended to not shift older members)
+    void                (NRI_CALL *GetDeviceStatistics)             (const NriRef(Device) device, NriOut NriRef(DeviceStatistics) deviceStatistics); // cheap, lock-free
+    uint64_t            (NRI_CALL *GetBufferDeviceAddress)          (const NriRef(Buffer) buffer); // requires "features.deviceAddress" and "BufferUsageBits::DEVICE_ADDRESS", valid after memory binding
+
+    // Transient attachment views: owned by the command buffer, valid until the next "BeginCommandBuffer" or destruction (must not be destroyed).
+    // Requesting the same view again while recording returns the cached one, i.e. no need to create short-lived "Descriptor" objects for "CmdBeginRendering"
+    Nri(Result)         (NRI_CALL *CreateTransientAttachmentView)   (NriRef(CommandBuffer) commandBuffer, const NriRef(Texture2DViewDesc) textureViewDesc, NriOut NriRef(Descriptor*) textureView);
+
+    // Copy, many regions in one command ("regionNum = 0" is a no-op), must be called between "BeginCommandBuffer" and "EndCommandBuffer"
+    void                (NRI_CALL *CmdCopyBufferRegions)              (NriRef(CommandBuffer) commandBuffer, NriRef(Buffer) dstBuffer, const NriRef(Buffer) srcBuffer, const NriPtr(BufferCopyRegionDesc) regions, uint32_t regionNum);
+    void                (NRI_CALL *CmdUploadBufferToTextureRegions)   (NriRef(CommandBuffer) commandBuffer, NriRef(Texture) dstTexture, const NriRef(Buffer) srcBuffer, const NriPtr(TextureBufferCopyRegionDesc) regions, uint32_t regionNum);
+    void                (NRI_CALL *CmdReadbackTextureToBufferRegions) (NriRef(CommandBuffer) commandBuffer, NriRef(Buffer) dstBuffer, const NriRef(Texture) srcTexture, const NriPtr(TextureBufferCopyRegionDesc) regions, uint32_t regionNum);
 };
 
 NriNamespaceEnd
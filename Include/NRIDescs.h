@@ -561,9 +561,17 @@ NriBits(TextureUsageBits, uint8_t,                 // Min compatible access:
     SHADER_RESOURCE_STORAGE             = NriBit(1),  // SHADER_RESOURCE_STORAGE                 Read/write shader resource (UAV)
     COLOR_ATTACHMENT                    = NriBit(2),  // COLOR_ATTACHMENT                        Color attachment (render target)
     DEPTH_STENCIL_ATTACHMENT            = NriBit(3),  // DEPTH_STENCIL_ATTACHMENT_READ/WRITE     Depth-stencil attachment (depth-stencil target)
-    SHADING_RATE_ATTACHMENT             = NriBit(4)   // SHADING_RATE_ATTACHMENT                 Shading rate attachment (source)
+    SHADING_RATE_ATTACHMENT             = NriBit(4),  // SHADING_RATE_ATTACHMENT                 Shading rate attachment (source)
+    TRANSIENT_ATTACHMENT                = NriBit(5)   // -                                       Attachment, which contents never leave a render pass (see "features.lazilyAllocatedMemory")
 );
 
+// "TRANSIENT_ATTACHMENT" (for tile-based GPUs):
+// - can be combined only with "COLOR_ATTACHMENT" or "DEPTH_STENCIL_ATTACHMENT", the contents must not be needed outside of "CmdBeginRendering/CmdEndRendering"
+// - contents are undefined after "CmdBeginRendering" (use "CmdClearAttachments") and discarded by "CmdEndRendering"
+// - can't be used in copy, resolve, upload and readback commands, only attachment views are allowed
+// - VK: "DEVICE" memory is lazily allocated (maybe never committed) if "features.lazilyAllocatedMemory", otherwise it's a regular allocation
+// - D3D: ignored
+
 // https://registry.khronos.org/vulkan/specs/latest/man/html/VkBufferUsageFlagBits.html
 NriBits(BufferUsageBits, uint16_t,                 // Min compatible access:                  Usage:
     NONE                                = 0,
@@ -578,7 +586,9 @@ NriBits(BufferUsageBits, uint16_t,                 // Min compatible access:
     ACCELERATION_STRUCTURE_BUILD_INPUT  = NriBit(8),  // SHADER_RESOURCE                         Read-only input in "CmdBuildAccelerationStructures" command
     ACCELERATION_STRUCTURE_STORAGE      = NriBit(9),  // ACCELERATION_STRUCTURE_READ/WRITE       (INTERNAL) acceleration structure storage
     MICROMAP_BUILD_INPUT                = NriBit(10), // SHADER_RESOURCE                         Read-only input in "CmdBuildMicromaps" command
-    MICROMAP_STORAGE                    = NriBit(11)  // MICROMAP_READ/WRITE                     (INTERNAL) micromap storage
+    MICROMAP_STORAGE                    = NriBit(11), // MICROMAP_READ/WRITE                     (INTERNAL) micromap storage
+    DEVICE_ADDRESS                      = NriBit(12), // SHADER_RESOURCE(_STORAGE)               Shader access via an address (see "GetBufferDeviceAddress")
+    PREPROCESS_BUFFER                   = NriBit(13)  // -                                       (VK) preprocess buffer in "CmdExecuteIndirect" command (see "NRIIndirectCommands.h")
 );
 
 NriStruct(TextureDesc) {
@@ -1512,6 +1522,18 @@ NriStruct(TextureDataLayoutDesc) {
     uint32_t slicePitch;    // must be a multiple of "uploadBufferTextureSliceAlignment"
 };
 
+// Multi-region copies (a single command with many regions)
+NriStruct(BufferCopyRegionDesc) {
+    uint64_t dstOffset;
+    uint64_t srcOffset;
+    uint64_t size;          // can be "WHOLE_SIZE"
+};
+
+NriStruct(TextureBufferCopyRegionDesc) {
+    Nri(TextureRegionDesc) textureRegion;
+    Nri(TextureDataLayoutDesc) bufferDataLayout;
+};
+
 // Work submission
 NriStruct(FenceSubmitDesc) {
     NriPtr(Fence) fence;
@@ -1854,6 +1876,7 @@ NriStruct(DeviceDesc) {
         uint32_t meshShader                                      : 1; // NRIMeshShader
         uint32_t lowLatency                                      : 1; // NRILowLatency
         uint32_t micromap                                        : 1; // see "Micromap"
+        uint32_t indirectCommands                                : 1; // NRIIndirectCommands
 
         // Smaller
         uint32_t independentFrontAndBackStencilReferenceAndMasks : 1; // see "StencilAttachmentDesc::back"
@@ -1874,6 +1897,8 @@ NriStruct(DeviceDesc) {
         uint32_t presentFromCompute                              : 1; // see "SwapChainDesc::queue"
         uint32_t waitableSwapChain                               : 1; // see "SwapChainDesc::waitable"
         uint32_t pipelineStatistics                              : 1; // see "QueryType::PIPELINE_STATISTICS"
+        uint32_t lazilyAllocatedMemory                           : 1; // see "TextureUsageBits::TRANSIENT_ATTACHMENT"
+        uint32_t deviceAddress                                   : 1; // see "GetBufferDeviceAddress" (VK only: HLSL on D3D12 can't dereference GPU virtual addresses)
     } features;
 
     // Shader features
@@ -1918,4 +1943,46 @@ NriStruct(DeviceDesc) {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region [ Device statistics ]
+//============================================================================================================================================================================================
+
+// All counters are "uint64_t" and sampled without synchronization, i.e. they are "approximately consistent" with each other
+NriStruct(ObjectStatistics) {
+    uint64_t commandAllocatorNum;
+    uint64_t commandBufferNum;
+    uint64_t descriptorPoolNum;
+    uint64_t descriptorNum;     // views and samplers
+    uint64_t pipelineLayoutNum;
+    uint64_t pipelineNum;
+    uint64_t queryPoolNum;
+    uint64_t fenceNum;
+    uint64_t memoryNum;
+    uint64_t bufferNum;
+    uint64_t textureNum;
+    uint64_t accelerationStructureNum;
+    uint64_t micromapNum;
+    uint64_t swapChainNum;
+};
+
+NriStruct(ActivityStatistics) {
+    Nri(ObjectStatistics) createdObjects;
+    uint64_t descriptorSetNum;          // allocated descriptor sets
+    uint64_t queueSubmitNum;
+    uint64_t barrierNum;                // global, buffer and texture barriers
+    uint64_t streamedBytes;             // "Streamer" extension
+    uint64_t uploadedBytes;             // "UploadData"
+    uint64_t memoryAllocationNum;       // "AllocateMemory" and "ResourceAllocator" extension
+    uint64_t hostWaitNum;               // "Wait", "QueueWaitIdle" and "DeviceWaitIdle"
+};
+
+NriStruct(DeviceStatistics) {
+    Nri(ObjectStatistics) aliveObjects;
+    Nri(ActivityStatistics) total;      // since device creation
+    Nri(ActivityStatistics) lastFrame;  // between the last two presents (of any swap chain)
+    uint64_t frameNum;                  // presents since device creation
+};
+
+#pragma endregion
+
 NriNamespaceEnd
@@ -454,6 +454,10 @@ NRI_API Result NRI_CALL nriGetInterface(const Device& device, const char* interf
         realInterfaceSize = sizeof(HelperInterface);
         if (realInterfaceSize == interfaceSize)
             result = deviceBase.FillFunctionTable(*(HelperInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(IndirectCommandsInterface))) {
+        realInterfaceSize = sizeof(IndirectCommandsInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(IndirectCommandsInterface*)interfacePtr);
     } else if (hash == Hash(NRI_STRINGIFY(LowLatencyInterface))) {
         realInterfaceSize = sizeof(LowLatencyInterface);
         if (realInterfaceSize == interfaceSize)
@@ -462,14 +466,34 @@ NRI_API Result NRI_CALL nriGetInterface(const Device& device, const char* interf
         realInterfaceSize = sizeof(MeshShaderInterface);
         if (realInterfaceSize == interfaceSize)
             result = deviceBase.FillFunctionTable(*(MeshShaderInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(MicromapBakerInterface))) {
+        realInterfaceSize = sizeof(MicromapBakerInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(MicromapBakerInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(ProfilerInterface))) {
+        realInterfaceSize = sizeof(ProfilerInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(ProfilerInterface*)interfacePtr);
     } else if (hash == Hash(NRI_STRINGIFY(RayTracingInterface))) {
         realInterfaceSize = sizeof(RayTracingInterface);
         if (realInterfaceSize == interfaceSize)
             result = deviceBase.FillFunctionTable(*(RayTracingInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(RenderGraphInterface))) {
+        realInterfaceSize = sizeof(RenderGraphInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(RenderGraphInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(ResidencyInterface))) {
+        realInterfaceSize = sizeof(ResidencyInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(ResidencyInterface*)interfacePtr);
     } else if (hash == Hash(NRI_STRINGIFY(ResourceAllocatorInterface))) {
         realInterfaceSize = sizeof(ResourceAllocatorInterface);
         if (realInterfaceSize == interfaceSize)
             result = deviceBase.FillFunctionTable(*(ResourceAllocatorInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(SparseInterface))) {
+        realInterfaceSize = sizeof(SparseInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(SparseInterface*)interfacePtr);
     } else if (hash == Hash(NRI_STRINGIFY(StreamerInterface))) {
         realInterfaceSize = sizeof(StreamerInterface);
         if (realInterfaceSize == interfaceSize)
@@ -478,6 +502,10 @@ NRI_API Result NRI_CALL nriGetInterface(const Device& device, const char* interf
         realInterfaceSize = sizeof(SwapChainInterface);
         if (realInterfaceSize == interfaceSize)
             result = deviceBase.FillFunctionTable(*(SwapChainInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(TraceInterface))) {
+        realInterfaceSize = sizeof(TraceInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(TraceInterface*)interfacePtr);
     } else if (hash == Hash(NRI_STRINGIFY(UpscalerInterface))) {
         realInterfaceSize = sizeof(UpscalerInterface);
         if (realInterfaceSize == interfaceSize)
@@ -790,6 +818,7 @@ NRI_API Result NRI_CALL nriCreateDeviceFromVKDevice(const DeviceCreationVKDesc&
     deviceCreationDesc.allocationCallbacks = deviceCreationVKDesc.allocationCallbacks;
     deviceCreationDesc.enableNRIValidation = deviceCreationVKDesc.enableNRIValidation;
     deviceCreationDesc.enableMemoryZeroInitialization = deviceCreationVKDesc.enableMemoryZeroInitialization;
+    deviceCreationDesc.enableBreadcrumbs = deviceCreationVKDesc.enableBreadcrumbs;
     deviceCreationDesc.vkBindingOffsets = deviceCreationVKDesc.vkBindingOffsets;
     deviceCreationDesc.vkExtensions = deviceCreationVKDesc.vkExtensions;
 
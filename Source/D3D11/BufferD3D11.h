@@ -59,6 +59,7 @@ struct BufferD3D11 final : public DebugNameBase {
 
     void* Map(uint64_t offset);
     void Unmap();
+    Result SetPriority(float priority);
 
 private:
     DeviceD3D11& m_Device;
@@ -122,7 +122,7 @@ TextureD3D11& BufferD3D11::RecreateReadbackTexture(const TextureD3D11& srcTextur
 
         Destroy(m_ReadbackTexture);
 
-        Result result = m_Device.CreateImplementation<TextureD3D11>(m_ReadbackTexture, textureDesc);
+        Result result = m_Device.CreateInternalImplementation<TextureD3D11>(m_ReadbackTexture, textureDesc);
         if (result == Result::SUCCESS) {
             result = m_ReadbackTexture->Create(MemoryLocation::HOST_READBACK, 0.0f);
             if (result != Result::SUCCESS)
@@ -208,3 +208,14 @@ NRI_INLINE void BufferD3D11::Unmap() {
 
     m_Device.GetImmediateContext()->Unmap(m_Buffer, 0);
 }
+
+NRI_INLINE Result BufferD3D11::SetPriority(float priority) {
+    // The resource gets created in "Bind[Buffer/Texture]Memory"
+    if (!m_Buffer)
+        return Result::UNSUPPORTED;
+
+    uint32_t evictionPriority = ConvertPriority(priority);
+    m_Buffer->SetEvictionPriority(evictionPriority ? evictionPriority : DXGI_RESOURCE_PRIORITY_NORMAL);
+
+    return Result::SUCCESS;
+}
@@ -16,6 +16,7 @@ Result nri::CreateCommandBuffer(DeviceD3D11& device, ID3D11DeviceContext* precre
     const Result result = ((CommandBufferBase*)impl)->Create(precreatedContext);
 
     if (result == Result::SUCCESS) {
+        device.OnObjectCreated<CommandBuffer>();
         commandBuffer = (CommandBuffer*)impl;
         return Result::SUCCESS;
     }
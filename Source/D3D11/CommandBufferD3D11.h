@@ -6,6 +6,7 @@ namespace nri {
 
 struct PipelineLayoutD3D11;
 struct PipelineD3D11;
+struct DescriptorD3D11;
 
 struct CommandBufferD3D11 final : public CommandBufferBase {
     CommandBufferD3D11(DeviceD3D11& device);
@@ -44,6 +45,10 @@ struct CommandBufferD3D11 final : public CommandBufferBase {
         return m_Device.GetAllocationCallbacks();
     }
 
+    inline DeviceBase& GetDeviceBase() const override {
+        return (DeviceBase&)m_Device;
+    }
+
     Result Create(ID3D11DeviceContext* precreatedContext) override;
     void Submit() override;
 
@@ -61,6 +66,7 @@ struct CommandBufferD3D11 final : public CommandBufferBase {
     void SetBlendConstants(const Color32f& color);
     void ClearAttachments(const ClearDesc* clearDescs, uint32_t clearDescNum, const Rect* rects, uint32_t rectNum);
     void ClearStorage(const ClearStorageDesc& clearDesc);
+    Result CreateTransientAttachmentView(const Texture2DViewDesc& textureViewDesc, Descriptor*& textureView);
     void BeginRendering(const AttachmentsDesc& attachmentsDesc);
     void SetVertexBuffers(uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum);
     void SetIndexBuffer(const Buffer& buffer, uint64_t offset, IndexType indexType);
@@ -101,6 +107,7 @@ private:
     PipelineD3D11* m_Pipeline = nullptr;
     const Buffer* m_IndexBuffer = nullptr;
     BindingState m_BindingState;
+    TransientViewCache<DeviceD3D11, DescriptorD3D11> m_TransientViews;
     SamplePositionsState m_SamplePositionsState = {};
     uint64_t m_IndexBufferOffset = 0;
     Color32f m_BlendFactor = {};
@@ -23,6 +23,7 @@ uint8_t QueryLatestDeviceContext(ComPtr<ID3D11DeviceContextBest>& in, ComPtr<ID3
 CommandBufferD3D11::CommandBufferD3D11(DeviceD3D11& device)
     : m_Device(device)
     , m_BindingState(device.GetStdAllocator())
+    , m_TransientViews(device)
     , m_DeferredContext(device.GetImmediateContext())
     , m_Version(device.GetImmediateContextVersion()) {
     m_DeferredContext->QueryInterface(IID_PPV_ARGS(&m_Annotation));
@@ -98,6 +99,7 @@ NRI_INLINE Result CommandBufferD3D11::Begin(const DescriptorPool* descriptorPool
     m_PipelineBindPoint = BindPoint::INHERIT;
 
     ResetAttachments();
+    m_TransientViews.Reset();
 
     // Dynamic state
     m_SamplePositionsState.Reset();
@@ -249,6 +251,10 @@ NRI_INLINE void CommandBufferD3D11::ClearStorage(const ClearStorageDesc& clearDe
         m_DeferredContext->ClearUnorderedAccessViewFloat(storage, &clearDesc.value.f.x);
 }
 
+NRI_INLINE Result CommandBufferD3D11::CreateTransientAttachmentView(const Texture2DViewDesc& textureViewDesc, Descriptor*& textureView) {
+    return m_TransientViews.Get(textureViewDesc, textureView);
+}
+
 NRI_INLINE void CommandBufferD3D11::BeginRendering(const AttachmentsDesc& attachmentsDesc) {
     // Render targets
     m_RenderTargetNum = attachmentsDesc.colors ? attachmentsDesc.colorNum : 0;
@@ -634,6 +640,8 @@ NRI_INLINE void CommandBufferD3D11::DispatchIndirect(const Buffer& buffer, uint6
 }
 
 NRI_INLINE void CommandBufferD3D11::Barrier(const BarrierDesc& barrierDesc) {
+    m_Device.Count(Counter::BARRIER, barrierDesc.globalNum + barrierDesc.bufferNum + barrierDesc.textureNum);
+
     if (barrierDesc.textureNum == 0 && barrierDesc.bufferNum == 0)
         return;
 
@@ -5,12 +5,14 @@
 namespace nri {
 
 struct PipelineD3D11;
+struct DescriptorD3D11;
 typedef Vector<uint32_t> PushBuffer;
 
 struct CommandBufferEmuD3D11 final : public CommandBufferBase {
     inline CommandBufferEmuD3D11(DeviceD3D11& device)
         : m_Device(device)
-        , m_PushBuffer(device.GetStdAllocator()) {
+        , m_PushBuffer(device.GetStdAllocator())
+        , m_TransientViews(device) {
     }
 
     inline ~CommandBufferEmuD3D11() {
@@ -32,6 +34,10 @@ struct CommandBufferEmuD3D11 final : public CommandBufferBase {
         return m_Device.GetAllocationCallbacks();
     }
 
+    inline DeviceBase& GetDeviceBase() const override {
+        return (DeviceBase&)m_Device;
+    }
+
     Result Create(ID3D11DeviceContext* precreatedContext) override;
     void Submit() override;
 
@@ -49,6 +55,7 @@ struct CommandBufferEmuD3D11 final : public CommandBufferBase {
     void SetBlendConstants(const Color32f& color);
     void ClearAttachments(const ClearDesc* clearDescs, uint32_t clearDescNum, const Rect* rects, uint32_t rectNum);
     void ClearStorage(const ClearStorageDesc& clearDesc);
+    Result CreateTransientAttachmentView(const Texture2DViewDesc& textureViewDesc, Descriptor*& textureView);
     void BeginRendering(const AttachmentsDesc& attachmentsDesc);
     void EndRendering();
     void SetVertexBuffers(uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum);
@@ -81,6 +88,7 @@ struct CommandBufferEmuD3D11 final : public CommandBufferBase {
 private:
     DeviceD3D11& m_Device;
     PushBuffer m_PushBuffer;
+    TransientViewCache<DeviceD3D11, DescriptorD3D11> m_TransientViews;
 };
 
 } // namespace nri
@@ -482,6 +482,7 @@ void CommandBufferEmuD3D11::Submit() {
 
 NRI_INLINE Result CommandBufferEmuD3D11::Begin(const DescriptorPool* descriptorPool) {
     m_PushBuffer.clear();
+    m_TransientViews.Reset();
     Push(m_PushBuffer, BEGIN);
     Push(m_PushBuffer, descriptorPool);
 
@@ -538,6 +539,10 @@ NRI_INLINE void CommandBufferEmuD3D11::ClearStorage(const ClearStorageDesc& clea
     Push(m_PushBuffer, clearDesc);
 }
 
+NRI_INLINE Result CommandBufferEmuD3D11::CreateTransientAttachmentView(const Texture2DViewDesc& textureViewDesc, Descriptor*& textureView) {
+    return m_TransientViews.Get(textureViewDesc, textureView);
+}
+
 NRI_INLINE void CommandBufferEmuD3D11::BeginRendering(const AttachmentsDesc& attachmentsDesc) {
     Push(m_PushBuffer, BEGIN_RENDERING);
     Push(m_PushBuffer, attachmentsDesc);
@@ -40,6 +40,8 @@ NRI_INLINE Result DescriptorPoolD3D11::AllocateDescriptorSets(const PipelineLayo
         descriptorSets[i] = (DescriptorSet*)descriptorSet;
     }
 
+    m_Device.Count(Counter::DESCRIPTOR_SET, instanceNum);
+
     return Result::SUCCESS;
 }
 
@@ -87,6 +87,16 @@ struct DeviceD3D11 final : public DeviceBase {
 
     template <typename Implementation, typename Interface, typename... Args>
     inline Result CreateImplementation(Interface*& entity, const Args&... args) {
+        Result result = CreateInternalImplementation<Implementation>(entity, args...);
+        if (result == Result::SUCCESS)
+            OnObjectCreated<Interface>();
+
+        return result;
+    }
+
+    // For objects not visible to the app (not counted by "DeviceStatistics", must be destroyed via "Destroy")
+    template <typename Implementation, typename Interface, typename... Args>
+    inline Result CreateInternalImplementation(Interface*& entity, const Args&... args) {
         Implementation* impl = Allocate<Implementation>(GetAllocationCallbacks(), *this);
         Result result = impl->Create(args...);
 
@@ -124,9 +134,14 @@ struct DeviceD3D11 final : public DeviceBase {
     Result FillFunctionTable(CoreInterface& table) const override;
     Result FillFunctionTable(HelperInterface& table) const override;
     Result FillFunctionTable(LowLatencyInterface& table) const override;
+    Result FillFunctionTable(MicromapBakerInterface& table) const override;
+    Result FillFunctionTable(ProfilerInterface& table) const override;
+    Result FillFunctionTable(RenderGraphInterface& table) const override;
+    Result FillFunctionTable(ResidencyInterface& table) const override;
     Result FillFunctionTable(ResourceAllocatorInterface& table) const override;
     Result FillFunctionTable(StreamerInterface& table) const override;
     Result FillFunctionTable(SwapChainInterface& table) const override;
+    Result FillFunctionTable(TraceInterface& table) const override;
     Result FillFunctionTable(UpscalerInterface& table) const override;
     Result FillFunctionTable(WrapperD3D11Interface& table) const override;
 
@@ -142,9 +157,12 @@ struct DeviceD3D11 final : public DeviceBase {
     Result WaitIdle();
     Result BindBufferMemory(const BindBufferMemoryDesc* bindBufferMemoryDescs, uint32_t bindBufferMemoryDescNum);
     Result BindTextureMemory(const BindTextureMemoryDesc* bindTextureMemoryDescs, uint32_t bindTextureMemoryDescNum);
-    FormatSupportBits GetFormatSupport(Format format) const;
+    inline FormatSupportBits GetFormatSupport(Format format) const {
+        return m_FormatSupport[(size_t)format];
+    }
 
 private:
+    FormatSupportBits QueryFormatSupport(Format format) const;
     void FillDesc();
     void InitializeNvExt(bool disableNVAPIInitialization, bool isImported);
     void InitializeAmdExt(AGSContext* agsContext, bool isImported);
@@ -166,6 +184,7 @@ private:
     ComPtr<ID3D11Buffer> m_ZeroBuffer;
     std::array<Vector<QueueD3D11*>, (size_t)QueueType::MAX_NUM> m_QueueFamilies;
     CRITICAL_SECTION m_CriticalSection = {}; // TODO: Lock?
+    std::array<FormatSupportBits, (size_t)Format::MAX_NUM> m_FormatSupport = {};
     CoreInterface m_iCore = {};
     DeviceDesc m_Desc = {};
     uint8_t m_Version = 0;
@@ -314,6 +314,10 @@ Result DeviceD3D11::Create(const DeviceCreationDesc& desc, const DeviceCreationD
     // Fill desc
     FillDesc();
 
+    // Cache format capabilities (queried per format once)
+    for (uint32_t i = 1; i < (uint32_t)Format::MAX_NUM; i++)
+        m_FormatSupport[i] = QueryFormatSupport((Format)i);
+
     return FillFunctionTable(m_iCore);
 }
 
@@ -704,7 +708,7 @@ NRI_INLINE Result DeviceD3D11::BindTextureMemory(const BindTextureMemoryDesc* bi
     if ((formatSupport2.OutFormatSupport2 & (optional)) != 0) \
         supportBits |= bit;
 
-NRI_INLINE FormatSupportBits DeviceD3D11::GetFormatSupport(Format format) const {
+NRI_INLINE FormatSupportBits DeviceD3D11::QueryFormatSupport(Format format) const {
     DXGI_FORMAT dxgiFormat = GetDxgiFormat(format).typed;
     D3D11_FEATURE_DATA_FORMAT_SUPPORT formatSupport = {dxgiFormat};
     HRESULT hr = m_Device->CheckFeatureSupport(D3D11_FEATURE_FORMAT_SUPPORT, &formatSupport, sizeof(formatSupport));
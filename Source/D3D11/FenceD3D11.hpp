@@ -46,6 +46,9 @@ NRI_INLINE void FenceD3D11::QueueWait(uint64_t value) {
 }
 
 NRI_INLINE void FenceD3D11::Wait(uint64_t value) {
+    TRACE_SCOPE(&m_Device, "FenceWait");
+    m_Device.Count(Counter::HOST_WAIT);
+
     if (m_Fence) {
         if (m_Event == 0 || m_Event == INVALID_HANDLE_VALUE) {
             while (m_Fence->GetCompletedValue() < value)
@@ -18,8 +18,13 @@
 #include "SwapChainD3D11.h"
 #include "TextureD3D11.h"
 
+#include "HeadlessSwapChain.h"
 #include "HelperInterface.h"
 #include "ImguiInterface.h"
+#include "MicromapBakerInterface.h"
+#include "ProfilerInterface.h"
+#include "RenderGraphInterface.h"
+#include "ResidencyInterface.h"
 #include "StreamerInterface.h"
 #include "UpscalerInterface.h"
 
@@ -82,6 +87,14 @@ static uint64_t NRI_CALL GetFenceValue(Fence& fence) {
     return ((FenceD3D11&)fence).GetFenceValue();
 }
 
+static uint64_t NRI_CALL GetBufferDeviceAddress(const Buffer&) {
+    return 0;
+}
+
+static void NRI_CALL GetDeviceStatistics(const Device& device, DeviceStatistics& deviceStatistics) {
+    ((const DeviceBase&)device).GetStatistics(deviceStatistics);
+}
+
 static void NRI_CALL GetBufferMemoryDesc(const Buffer& buffer, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
     const BufferD3D11& bufferD3D11 = (BufferD3D11&)buffer;
     bufferD3D11.GetDevice().GetMemoryDesc(bufferD3D11.GetDesc(), memoryLocation, memoryDesc);
@@ -107,6 +120,7 @@ static Result NRI_CALL GetQueue(Device& device, QueueType queueType, uint32_t qu
 static Result NRI_CALL CreateCommandAllocator(Queue& queue, CommandAllocator*& commandAllocator) {
     DeviceD3D11& device = ((QueueD3D11&)queue).GetDevice();
     commandAllocator = (CommandAllocator*)Allocate<CommandAllocatorD3D11>(device.GetAllocationCallbacks(), device);
+    device.OnObjectCreated<CommandAllocator>();
 
     return Result::SUCCESS;
 }
@@ -172,7 +186,7 @@ static Result NRI_CALL CreateTexture3DView(const Texture3DViewDesc& textureViewD
 }
 
 static void NRI_CALL DestroyCommandAllocator(CommandAllocator* commandAllocator) {
-    Destroy((CommandAllocatorD3D11*)commandAllocator);
+    DestroyObject<CommandAllocator>((CommandAllocatorD3D11*)commandAllocator);
 }
 
 static void NRI_CALL DestroyCommandBuffer(CommandBuffer* commandBuffer) {
@@ -180,39 +194,40 @@ static void NRI_CALL DestroyCommandBuffer(CommandBuffer* commandBuffer) {
         return;
 
     CommandBufferBase* commandBufferBase = (CommandBufferBase*)commandBuffer;
+    commandBufferBase->GetDeviceBase().OnObjectDestroyed<CommandBuffer>();
     Destroy(commandBufferBase->GetAllocationCallbacks(), commandBufferBase);
 }
 
 static void NRI_CALL DestroyDescriptorPool(DescriptorPool* descriptorPool) {
-    Destroy((DescriptorPoolD3D11*)descriptorPool);
+    DestroyObject<DescriptorPool>((DescriptorPoolD3D11*)descriptorPool);
 }
 
 static void NRI_CALL DestroyBuffer(Buffer* buffer) {
-    Destroy((BufferD3D11*)buffer);
+    DestroyObject<Buffer>((BufferD3D11*)buffer);
 }
 
 static void NRI_CALL DestroyTexture(Texture* texture) {
-    Destroy((TextureD3D11*)texture);
+    DestroyObject<Texture>((TextureD3D11*)texture);
 }
 
 static void NRI_CALL DestroyDescriptor(Descriptor* descriptor) {
-    Destroy((DescriptorD3D11*)descriptor);
+    DestroyObject<Descriptor>((DescriptorD3D11*)descriptor);
 }
 
 static void NRI_CALL DestroyPipelineLayout(PipelineLayout* pipelineLayout) {
-    Destroy((PipelineLayoutD3D11*)pipelineLayout);
+    DestroyObject<PipelineLayout>((PipelineLayoutD3D11*)pipelineLayout);
 }
 
 static void NRI_CALL DestroyPipeline(Pipeline* pipeline) {
-    Destroy((PipelineD3D11*)pipeline);
+    DestroyObject<Pipeline>((PipelineD3D11*)pipeline);
 }
 
 static void NRI_CALL DestroyQueryPool(QueryPool* queryPool) {
-    Destroy((QueryPoolD3D11*)queryPool);
+    DestroyObject<QueryPool>((QueryPoolD3D11*)queryPool);
 }
 
 static void NRI_CALL DestroyFence(Fence* fence) {
-    Destroy((FenceD3D11*)fence);
+    DestroyObject<Fence>((FenceD3D11*)fence);
 }
 
 static Result NRI_CALL AllocateMemory(Device& device, const AllocateMemoryDesc& allocateMemoryDesc, Memory*& memory) {
@@ -228,7 +243,7 @@ static Result NRI_CALL BindTextureMemory(Device& device, const BindTextureMemory
 }
 
 static void NRI_CALL FreeMemory(Memory* memory) {
-    Destroy((MemoryD3D11*)memory);
+    DestroyObject<Memory>((MemoryD3D11*)memory);
 }
 
 static Result NRI_CALL BeginCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool* descriptorPool) {
@@ -301,6 +316,10 @@ static void NRI_CALL CmdSetShadingRate(CommandBuffer&, const ShadingRateDesc&) {
 static void NRI_CALL CmdSetDepthBias(CommandBuffer&, const DepthBiasDesc&) {
 }
 
+static Result NRI_CALL CreateTransientAttachmentView(CommandBuffer& commandBuffer, const Texture2DViewDesc& textureViewDesc, Descriptor*& textureView) {
+    return ((CommandBufferD3D11&)commandBuffer).CreateTransientAttachmentView(textureViewDesc, textureView);
+}
+
 static void NRI_CALL CmdBeginRendering(CommandBuffer& commandBuffer, const AttachmentsDesc& attachmentsDesc) {
     ((CommandBufferD3D11&)commandBuffer).BeginRendering(attachmentsDesc);
 }
@@ -353,6 +372,22 @@ static void NRI_CALL CmdReadbackTextureToBuffer(CommandBuffer& commandBuffer, Bu
     ((CommandBufferD3D11&)commandBuffer).ReadbackTextureToBuffer(dstBuffer, dstDataLayout, srcTexture, srcRegion);
 }
 
+// D3D11 doesn't have multi-region copies
+static void NRI_CALL CmdCopyBufferRegions(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        ((CommandBufferD3D11&)commandBuffer).CopyBuffer(dstBuffer, regions[i].dstOffset, srcBuffer, regions[i].srcOffset, regions[i].size);
+}
+
+static void NRI_CALL CmdUploadBufferToTextureRegions(CommandBuffer& commandBuffer, Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        ((CommandBufferD3D11&)commandBuffer).UploadBufferToTexture(dstTexture, regions[i].textureRegion, srcBuffer, regions[i].bufferDataLayout);
+}
+
+static void NRI_CALL CmdReadbackTextureToBufferRegions(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        ((CommandBufferD3D11&)commandBuffer).ReadbackTextureToBuffer(dstBuffer, regions[i].bufferDataLayout, srcTexture, regions[i].textureRegion);
+}
+
 static void NRI_CALL CmdZeroBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, uint64_t size) {
     ((CommandBufferD3D11&)commandBuffer).ZeroBuffer(buffer, offset, size);
 }
@@ -589,6 +624,10 @@ static void NRI_CALL EmuCmdSetShadingRate(CommandBuffer&, const ShadingRateDesc&
 static void NRI_CALL EmuCmdSetDepthBias(CommandBuffer&, const DepthBiasDesc&) {
 }
 
+static Result NRI_CALL EmuCreateTransientAttachmentView(CommandBuffer& commandBuffer, const Texture2DViewDesc& textureViewDesc, Descriptor*& textureView) {
+    return ((CommandBufferEmuD3D11&)commandBuffer).CreateTransientAttachmentView(textureViewDesc, textureView);
+}
+
 static void NRI_CALL EmuCmdBeginRendering(CommandBuffer& commandBuffer, const AttachmentsDesc& attachmentsDesc) {
     ((CommandBufferEmuD3D11&)commandBuffer).BeginRendering(attachmentsDesc);
 }
@@ -641,6 +680,21 @@ static void NRI_CALL EmuCmdReadbackTextureToBuffer(CommandBuffer& commandBuffer,
     ((CommandBufferEmuD3D11&)commandBuffer).ReadbackTextureToBuffer(dstBuffer, dstDataLayout, srcTexture, srcRegion);
 }
 
+static void NRI_CALL EmuCmdCopyBufferRegions(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        ((CommandBufferEmuD3D11&)commandBuffer).CopyBuffer(dstBuffer, regions[i].dstOffset, srcBuffer, regions[i].srcOffset, regions[i].size);
+}
+
+static void NRI_CALL EmuCmdUploadBufferToTextureRegions(CommandBuffer& commandBuffer, Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        ((CommandBufferEmuD3D11&)commandBuffer).UploadBufferToTexture(dstTexture, regions[i].textureRegion, srcBuffer, regions[i].bufferDataLayout);
+}
+
+static void NRI_CALL EmuCmdReadbackTextureToBufferRegions(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        ((CommandBufferEmuD3D11&)commandBuffer).ReadbackTextureToBuffer(dstBuffer, regions[i].bufferDataLayout, srcTexture, regions[i].textureRegion);
+}
+
 static void NRI_CALL EmuCmdFillBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, uint64_t size) {
     ((CommandBufferEmuD3D11&)commandBuffer).ZeroBuffer(buffer, offset, size);
 }
@@ -750,6 +804,8 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
     table.QueueSubmit = ::QueueSubmit;
     table.Wait = ::Wait;
     table.GetFenceValue = ::GetFenceValue;
+    table.GetBufferDeviceAddress = ::GetBufferDeviceAddress;
+    table.GetDeviceStatistics = ::GetDeviceStatistics;
     table.UpdateDescriptorRanges = ::UpdateDescriptorRanges;
     table.UpdateDynamicConstantBuffers = ::UpdateDynamicConstantBuffers;
     table.CopyDescriptorSet = ::CopyDescriptorSet;
@@ -784,6 +840,7 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
         table.CmdSetSampleLocations = ::EmuCmdSetSampleLocations;
         table.CmdSetShadingRate = ::EmuCmdSetShadingRate;
         table.CmdSetDepthBias = ::EmuCmdSetDepthBias;
+        table.CreateTransientAttachmentView = ::EmuCreateTransientAttachmentView;
         table.CmdBeginRendering = ::EmuCmdBeginRendering;
         table.CmdClearAttachments = ::EmuCmdClearAttachments;
         table.CmdDraw = ::EmuCmdDraw;
@@ -797,6 +854,9 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
         table.CmdCopyTexture = ::EmuCmdCopyTexture;
         table.CmdUploadBufferToTexture = ::EmuCmdUploadBufferToTexture;
         table.CmdReadbackTextureToBuffer = ::EmuCmdReadbackTextureToBuffer;
+        table.CmdCopyBufferRegions = ::EmuCmdCopyBufferRegions;
+        table.CmdUploadBufferToTextureRegions = ::EmuCmdUploadBufferToTextureRegions;
+        table.CmdReadbackTextureToBufferRegions = ::EmuCmdReadbackTextureToBufferRegions;
         table.CmdZeroBuffer = ::EmuCmdFillBuffer;
         table.CmdResolveTexture = ::EmuCmdResolveTexture;
         table.CmdClearStorage = ::EmuCmdClearStorage;
@@ -828,6 +888,7 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
         table.CmdSetSampleLocations = ::CmdSetSampleLocations;
         table.CmdSetShadingRate = ::CmdSetShadingRate;
         table.CmdSetDepthBias = ::CmdSetDepthBias;
+        table.CreateTransientAttachmentView = ::CreateTransientAttachmentView;
         table.CmdBeginRendering = ::CmdBeginRendering;
         table.CmdClearAttachments = ::CmdClearAttachments;
         table.CmdDraw = ::CmdDraw;
@@ -841,6 +902,9 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
         table.CmdCopyTexture = ::CmdCopyTexture;
         table.CmdUploadBufferToTexture = ::CmdUploadBufferToTexture;
         table.CmdReadbackTextureToBuffer = ::CmdReadbackTextureToBuffer;
+        table.CmdCopyBufferRegions = ::CmdCopyBufferRegions;
+        table.CmdUploadBufferToTextureRegions = ::CmdUploadBufferToTextureRegions;
+        table.CmdReadbackTextureToBufferRegions = ::CmdReadbackTextureToBufferRegions;
         table.CmdZeroBuffer = ::CmdZeroBuffer;
         table.CmdResolveTexture = ::CmdResolveTexture;
         table.CmdClearStorage = ::CmdClearStorage;
@@ -885,17 +949,100 @@ static Result NRI_CALL AllocateAndBindMemory(Device& device, const ResourceGroup
     return allocator.AllocateAndBindMemory(resourceGroupDesc, allocations);
 }
 
+static Result NRI_CALL CreateResourceGroup(Device& device, const ResourceGroupCreationDesc& resourceGroupCreationDesc, Texture** textures, Buffer** buffers, Memory** allocations, uint32_t& allocationNum, uint64_t& allocationSize) {
+    DeviceD3D11& deviceD3D11 = (DeviceD3D11&)device;
+    HelperDeviceMemoryAllocator allocator(deviceD3D11.GetCoreInterface(), device);
+
+    return allocator.CreateResourceGroup(resourceGroupCreationDesc, textures, buffers, allocations, allocationNum, allocationSize);
+}
+
 static Result NRI_CALL QueryVideoMemoryInfo(const Device& device, MemoryLocation memoryLocation, VideoMemoryInfo& videoMemoryInfo) {
     uint64_t luid = ((DeviceD3D11&)device).GetDesc().adapterDesc.uid.low;
 
     return QueryVideoMemoryInfoDXGI(luid, memoryLocation, videoMemoryInfo);
 }
 
+static Result NRI_CALL CreateMemoryPool(Device& device, const MemoryPoolDesc& memoryPoolDesc, MemoryPool*& memoryPool) {
+    DeviceD3D11& deviceD3D11 = (DeviceD3D11&)device;
+    MemoryPoolImpl* impl = Allocate<MemoryPoolImpl>(deviceD3D11.GetAllocationCallbacks(), device, deviceD3D11.GetCoreInterface());
+    Result result = impl->Create(memoryPoolDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        memoryPool = nullptr;
+    } else
+        memoryPool = (MemoryPool*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyMemoryPool(MemoryPool* memoryPool) {
+    Destroy((MemoryPoolImpl*)memoryPool);
+}
+
+static Result NRI_CALL AllocatePooledBufferMemory(MemoryPool& memoryPool, Buffer& buffer, MemoryLocation memoryLocation, uint32_t& allocation) {
+    return ((MemoryPoolImpl&)memoryPool).AllocateBufferMemory(buffer, memoryLocation, allocation);
+}
+
+static Result NRI_CALL AllocatePooledTextureMemory(MemoryPool& memoryPool, Texture& texture, MemoryLocation memoryLocation, uint32_t& allocation) {
+    return ((MemoryPoolImpl&)memoryPool).AllocateTextureMemory(texture, memoryLocation, allocation);
+}
+
+static void NRI_CALL FreePooledMemory(MemoryPool& memoryPool, uint32_t allocation) {
+    ((MemoryPoolImpl&)memoryPool).Free(allocation);
+}
+
+static void NRI_CALL GetMemoryPoolStatistics(const MemoryPool& memoryPool, MemoryPoolStatistics& memoryPoolStatistics) {
+    ((MemoryPoolImpl&)memoryPool).GetStatistics(memoryPoolStatistics);
+}
+
+static Result NRI_CALL CreateTexturePool(Device& device, const TexturePoolDesc& texturePoolDesc, TexturePool*& texturePool) {
+    DeviceD3D11& deviceD3D11 = (DeviceD3D11&)device;
+    TexturePoolImpl* impl = Allocate<TexturePoolImpl>(deviceD3D11.GetAllocationCallbacks(), device, deviceD3D11.GetCoreInterface());
+    Result result = impl->Create(texturePoolDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        texturePool = nullptr;
+    } else
+        texturePool = (TexturePool*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyTexturePool(TexturePool* texturePool) {
+    Destroy((TexturePoolImpl*)texturePool);
+}
+
+static Result NRI_CALL AcquirePooledTexture(TexturePool& texturePool, const TextureDesc& textureDesc, PooledTexture& pooledTexture) {
+    return ((TexturePoolImpl&)texturePool).Acquire(textureDesc, pooledTexture);
+}
+
+static void NRI_CALL ReleasePooledTexture(TexturePool& texturePool, uint32_t handle, Fence* fence, uint64_t value) {
+    ((TexturePoolImpl&)texturePool).Release(handle, fence, value);
+}
+
+static void NRI_CALL GetTexturePoolStatistics(const TexturePool& texturePool, TexturePoolStatistics& texturePoolStatistics) {
+    ((TexturePoolImpl&)texturePool).GetStatistics(texturePoolStatistics);
+}
+
 Result DeviceD3D11::FillFunctionTable(HelperInterface& table) const {
     table.CalculateAllocationNumber = ::CalculateAllocationNumber;
     table.AllocateAndBindMemory = ::AllocateAndBindMemory;
+    table.CreateResourceGroup = ::CreateResourceGroup;
     table.UploadData = ::UploadData;
     table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.CreateMemoryPool = ::CreateMemoryPool;
+    table.DestroyMemoryPool = ::DestroyMemoryPool;
+    table.AllocatePooledBufferMemory = ::AllocatePooledBufferMemory;
+    table.AllocatePooledTextureMemory = ::AllocatePooledTextureMemory;
+    table.FreePooledMemory = ::FreePooledMemory;
+    table.GetMemoryPoolStatistics = ::GetMemoryPoolStatistics;
+    table.CreateTexturePool = ::CreateTexturePool;
+    table.DestroyTexturePool = ::DestroyTexturePool;
+    table.AcquirePooledTexture = ::AcquirePooledTexture;
+    table.ReleasePooledTexture = ::ReleasePooledTexture;
+    table.GetTexturePoolStatistics = ::GetTexturePoolStatistics;
 
     return Result::SUCCESS;
 }
@@ -983,6 +1130,291 @@ Result DeviceD3D11::FillFunctionTable(LowLatencyInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  MicromapBaker  ]
+
+static Result NRI_CALL CreateMicromapBaker(Device& device, const MicromapBakerDesc& micromapBakerDesc, MicromapBaker*& micromapBaker) {
+    DeviceD3D11& deviceD3D11 = (DeviceD3D11&)device;
+    MicromapBakerImpl* impl = Allocate<MicromapBakerImpl>(deviceD3D11.GetAllocationCallbacks(), device);
+    Result result = impl->Create(micromapBakerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        micromapBaker = nullptr;
+    } else
+        micromapBaker = (MicromapBaker*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyMicromapBaker(MicromapBaker* micromapBaker) {
+    Destroy((MicromapBakerImpl*)micromapBaker);
+}
+
+static Result NRI_CALL BakeMicromap(MicromapBaker& micromapBaker, const MicromapBakeDesc& micromapBakeDesc, MicromapBakeResult& micromapBakeResult) {
+    return ((MicromapBakerImpl&)micromapBaker).Bake(micromapBakeDesc, micromapBakeResult);
+}
+
+Result DeviceD3D11::FillFunctionTable(MicromapBakerInterface& table) const {
+    table.CreateMicromapBaker = ::CreateMicromapBaker;
+    table.DestroyMicromapBaker = ::DestroyMicromapBaker;
+    table.BakeMicromap = ::BakeMicromap;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Profiler  ]
+
+static Result NRI_CALL CreateProfiler(Device& device, const ProfilerDesc& profilerDesc, Profiler*& profiler) {
+    DeviceD3D11& deviceD3D11 = (DeviceD3D11&)device;
+    ProfilerImpl* impl = Allocate<ProfilerImpl>(deviceD3D11.GetAllocationCallbacks(), device, deviceD3D11.GetCoreInterface());
+    Result result = impl->Create(profilerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        profiler = nullptr;
+    } else
+        profiler = (Profiler*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyProfiler(Profiler* profiler) {
+    Destroy((ProfilerImpl*)profiler);
+}
+
+static void NRI_CALL CmdBeginProfilerFrame(CommandBuffer& commandBuffer, Profiler& profiler) {
+    ((ProfilerImpl&)profiler).CmdBeginFrame(commandBuffer);
+}
+
+static void NRI_CALL CmdEndProfilerFrame(CommandBuffer& commandBuffer, Profiler& profiler) {
+    ((ProfilerImpl&)profiler).CmdEndFrame(commandBuffer);
+}
+
+static void NRI_CALL CmdBeginProfilerRange(CommandBuffer& commandBuffer, Profiler& profiler, const char* name, uint32_t bgra) {
+    ((ProfilerImpl&)profiler).CmdBeginRange(commandBuffer, name, bgra);
+}
+
+static void NRI_CALL CmdEndProfilerRange(CommandBuffer& commandBuffer, Profiler& profiler) {
+    ((ProfilerImpl&)profiler).CmdEndRange(commandBuffer);
+}
+
+static void NRI_CALL CmdBeginProfilerStatistics(CommandBuffer& commandBuffer, Profiler& profiler, const char* name) {
+    ((ProfilerImpl&)profiler).CmdBeginStatistics(commandBuffer, name);
+}
+
+static void NRI_CALL CmdEndProfilerStatistics(CommandBuffer& commandBuffer, Profiler& profiler) {
+    ((ProfilerImpl&)profiler).CmdEndStatistics(commandBuffer);
+}
+
+static void NRI_CALL EndProfilerFrame(Profiler& profiler) {
+    ((ProfilerImpl&)profiler).EndFrame();
+}
+
+static const ProfilerRange* NRI_CALL GetProfilerRanges(const Profiler& profiler, uint32_t& rangeNum) {
+    return ((ProfilerImpl&)profiler).GetRanges(rangeNum);
+}
+
+static const ProfilerStatistics* NRI_CALL GetProfilerStatistics(const Profiler& profiler, uint32_t& statisticsNum) {
+    return ((ProfilerImpl&)profiler).GetStatistics(statisticsNum);
+}
+
+Result DeviceD3D11::FillFunctionTable(ProfilerInterface& table) const {
+    table.CreateProfiler = ::CreateProfiler;
+    table.DestroyProfiler = ::DestroyProfiler;
+    table.CmdBeginProfilerFrame = ::CmdBeginProfilerFrame;
+    table.CmdEndProfilerFrame = ::CmdEndProfilerFrame;
+    table.CmdBeginProfilerRange = ::CmdBeginProfilerRange;
+    table.CmdEndProfilerRange = ::CmdEndProfilerRange;
+    table.CmdBeginProfilerStatistics = ::CmdBeginProfilerStatistics;
+    table.CmdEndProfilerStatistics = ::CmdEndProfilerStatistics;
+    table.EndProfilerFrame = ::EndProfilerFrame;
+    table.GetProfilerRanges = ::GetProfilerRanges;
+    table.GetProfilerStatistics = ::GetProfilerStatistics;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  RenderGraph  ]
+
+static Result NRI_CALL CreateRenderGraph(Device& device, const RenderGraphDesc& renderGraphDesc, RenderGraph*& renderGraph) {
+    DeviceD3D11& deviceD3D11 = (DeviceD3D11&)device;
+    RenderGraphImpl* impl = Allocate<RenderGraphImpl>(deviceD3D11.GetAllocationCallbacks(), device, deviceD3D11.GetCoreInterface());
+    Result result = impl->Create(renderGraphDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        renderGraph = nullptr;
+    } else
+        renderGraph = (RenderGraph*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyRenderGraph(RenderGraph* renderGraph) {
+    Destroy((RenderGraphImpl*)renderGraph);
+}
+
+static void NRI_CALL BeginRenderGraph(RenderGraph& renderGraph) {
+    ((RenderGraphImpl&)renderGraph).Begin();
+}
+
+static uint32_t NRI_CALL AddRenderGraphTexture(RenderGraph& renderGraph, const RenderGraphTextureDesc& renderGraphTextureDesc) {
+    return ((RenderGraphImpl&)renderGraph).AddTexture(renderGraphTextureDesc);
+}
+
+static uint32_t NRI_CALL AddRenderGraphBuffer(RenderGraph& renderGraph, const RenderGraphBufferDesc& renderGraphBufferDesc) {
+    return ((RenderGraphImpl&)renderGraph).AddBuffer(renderGraphBufferDesc);
+}
+
+static uint32_t NRI_CALL ImportRenderGraphTexture(RenderGraph& renderGraph, const RenderGraphImportedTextureDesc& renderGraphImportedTextureDesc) {
+    return ((RenderGraphImpl&)renderGraph).ImportTexture(renderGraphImportedTextureDesc);
+}
+
+static uint32_t NRI_CALL ImportRenderGraphBuffer(RenderGraph& renderGraph, const RenderGraphImportedBufferDesc& renderGraphImportedBufferDesc) {
+    return ((RenderGraphImpl&)renderGraph).ImportBuffer(renderGraphImportedBufferDesc);
+}
+
+static uint32_t NRI_CALL AddRenderGraphPass(RenderGraph& renderGraph, const RenderGraphPassDesc& renderGraphPassDesc) {
+    return ((RenderGraphImpl&)renderGraph).AddPass(renderGraphPassDesc);
+}
+
+static Result NRI_CALL CompileRenderGraph(RenderGraph& renderGraph) {
+    return ((RenderGraphImpl&)renderGraph).Compile();
+}
+
+static Texture* NRI_CALL GetRenderGraphTexture(const RenderGraph& renderGraph, uint32_t texture) {
+    return ((RenderGraphImpl&)renderGraph).GetTexture(texture);
+}
+
+static Buffer* NRI_CALL GetRenderGraphBuffer(const RenderGraph& renderGraph, uint32_t buffer) {
+    return ((RenderGraphImpl&)renderGraph).GetBuffer(buffer);
+}
+
+static const char* NRI_CALL GetRenderGraphDump(const RenderGraph& renderGraph) {
+    return ((RenderGraphImpl&)renderGraph).GetDump();
+}
+
+static CommandBuffer* const* NRI_CALL ExecuteRenderGraph(RenderGraph& renderGraph, const RenderGraphExecuteDesc& renderGraphExecuteDesc, uint32_t& commandBufferNum) {
+    return ((RenderGraphImpl&)renderGraph).Execute(renderGraphExecuteDesc, commandBufferNum);
+}
+
+static Result NRI_CALL SubmitRenderGraph(RenderGraph& renderGraph, const RenderGraphSubmitDesc& renderGraphSubmitDesc) {
+    return ((RenderGraphImpl&)renderGraph).Submit(renderGraphSubmitDesc);
+}
+
+static void NRI_CALL GetRenderGraphStatistics(const RenderGraph& renderGraph, RenderGraphStatistics& renderGraphStatistics) {
+    ((RenderGraphImpl&)renderGraph).GetStatistics(renderGraphStatistics);
+}
+
+Result DeviceD3D11::FillFunctionTable(RenderGraphInterface& table) const {
+    table.CreateRenderGraph = ::CreateRenderGraph;
+    table.DestroyRenderGraph = ::DestroyRenderGraph;
+    table.BeginRenderGraph = ::BeginRenderGraph;
+    table.AddRenderGraphTexture = ::AddRenderGraphTexture;
+    table.AddRenderGraphBuffer = ::AddRenderGraphBuffer;
+    table.ImportRenderGraphTexture = ::ImportRenderGraphTexture;
+    table.ImportRenderGraphBuffer = ::ImportRenderGraphBuffer;
+    table.AddRenderGraphPass = ::AddRenderGraphPass;
+    table.CompileRenderGraph = ::CompileRenderGraph;
+    table.GetRenderGraphTexture = ::GetRenderGraphTexture;
+    table.GetRenderGraphBuffer = ::GetRenderGraphBuffer;
+    table.GetRenderGraphDump = ::GetRenderGraphDump;
+    table.ExecuteRenderGraph = ::ExecuteRenderGraph;
+    table.SubmitRenderGraph = ::SubmitRenderGraph;
+    table.GetRenderGraphStatistics = ::GetRenderGraphStatistics;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Residency  ]
+
+static Result NRI_CALL SetMemoryPriority(Memory&, float) {
+    return Result::UNSUPPORTED; // memory is virtual, priorities belong to resources
+}
+
+static Result NRI_CALL SetBufferPriority(Buffer& buffer, float priority) {
+    return ((BufferD3D11&)buffer).SetPriority(priority);
+}
+
+static Result NRI_CALL SetTexturePriority(Texture& texture, float priority) {
+    return ((TextureD3D11&)texture).SetPriority(priority);
+}
+
+static Result NRI_CALL CreateResidencyManager(Device& device, const ResidencyManagerDesc& residencyManagerDesc, ResidencyManager*& residencyManager) {
+    DeviceD3D11& deviceD3D11 = (DeviceD3D11&)device;
+    ResidencyManagerImpl* impl = Allocate<ResidencyManagerImpl>(deviceD3D11.GetAllocationCallbacks(), device);
+    Result result = impl->Create(residencyManagerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        residencyManager = nullptr;
+    } else
+        residencyManager = (ResidencyManager*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyResidencyManager(ResidencyManager* residencyManager) {
+    Destroy((ResidencyManagerImpl*)residencyManager);
+}
+
+static uint32_t NRI_CALL AddResidencyMemory(ResidencyManager& residencyManager, Memory& memory, float priority) {
+    return ((ResidencyManagerImpl&)residencyManager).Add(&memory, ResidencyObjectType::MEMORY, priority);
+}
+
+static uint32_t NRI_CALL AddResidencyBuffer(ResidencyManager& residencyManager, Buffer& buffer, float priority) {
+    return ((ResidencyManagerImpl&)residencyManager).Add(&buffer, ResidencyObjectType::BUFFER, priority);
+}
+
+static uint32_t NRI_CALL AddResidencyTexture(ResidencyManager& residencyManager, Texture& texture, float priority) {
+    return ((ResidencyManagerImpl&)residencyManager).Add(&texture, ResidencyObjectType::TEXTURE, priority);
+}
+
+static void NRI_CALL RemoveResidencyObject(ResidencyManager& residencyManager, uint32_t object) {
+    ((ResidencyManagerImpl&)residencyManager).Remove(object);
+}
+
+static void NRI_CALL MarkResidencyObjectUsed(ResidencyManager& residencyManager, uint32_t object) {
+    ((ResidencyManagerImpl&)residencyManager).MarkUsed(object);
+}
+
+static void NRI_CALL UpdateResidency(ResidencyManager& residencyManager) {
+    ((ResidencyManagerImpl&)residencyManager).Update();
+}
+
+static void NRI_CALL GetResidencyStatistics(const ResidencyManager& residencyManager, ResidencyStatistics& residencyStatistics) {
+    ((ResidencyManagerImpl&)residencyManager).GetStatistics(residencyStatistics);
+}
+
+Result DeviceD3D11::FillFunctionTable(ResidencyInterface& table) const {
+    table.SetMemoryPriority = ::SetMemoryPriority;
+    table.SetBufferPriority = ::SetBufferPriority;
+    table.SetTexturePriority = ::SetTexturePriority;
+    table.CreateResidencyManager = ::CreateResidencyManager;
+    table.DestroyResidencyManager = ::DestroyResidencyManager;
+    table.AddResidencyMemory = ::AddResidencyMemory;
+    table.AddResidencyBuffer = ::AddResidencyBuffer;
+    table.AddResidencyTexture = ::AddResidencyTexture;
+    table.RemoveResidencyObject = ::RemoveResidencyObject;
+    table.MarkResidencyObjectUsed = ::MarkResidencyObjectUsed;
+    table.UpdateResidency = ::UpdateResidency;
+    table.GetResidencyStatistics = ::GetResidencyStatistics;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  ResourceAllocator  ]
 
@@ -991,9 +1423,10 @@ static Result NRI_CALL AllocateBuffer(Device& device, const AllocateBufferDesc&
     if (result == Result::SUCCESS) {
         result = ((BufferD3D11*)buffer)->Create(allocateBufferDesc.memoryLocation, allocateBufferDesc.memoryPriority);
         if (result != Result::SUCCESS) {
-            Destroy((BufferD3D11*)buffer);
+            DestroyObject<Buffer>((BufferD3D11*)buffer);
             buffer = nullptr;
-        }
+        } else
+            ((DeviceD3D11&)device).Count(Counter::MEMORY_ALLOCATION);
     }
 
     return result;
@@ -1004,9 +1437,10 @@ static Result NRI_CALL AllocateTexture(Device& device, const AllocateTextureDesc
     if (result == Result::SUCCESS) {
         result = ((TextureD3D11*)texture)->Create(allocateTextureDesc.memoryLocation, allocateTextureDesc.memoryPriority);
         if (result != Result::SUCCESS) {
-            Destroy((TextureD3D11*)texture);
+            DestroyObject<Texture>((TextureD3D11*)texture);
             texture = nullptr;
-        }
+        } else
+            ((DeviceD3D11&)device).Count(Counter::MEMORY_ALLOCATION);
     }
 
     return result;
@@ -1024,11 +1458,25 @@ static Result NRI_CALL AllocateMicromap(Device&, const AllocateMicromapDesc&, Mi
     return Result::UNSUPPORTED;
 }
 
+static Result NRI_CALL GetResourceAllocatorStatistics(const Device&, ResourceAllocatorHeapStatistics*, uint32_t& heapStatisticsNum) {
+    heapStatisticsNum = 0;
+
+    return Result::UNSUPPORTED;
+}
+
+static Result NRI_CALL GetResourceAllocatorDump(const Device&, char*, uint64_t& dumpSize) {
+    dumpSize = 0;
+
+    return Result::UNSUPPORTED;
+}
+
 Result DeviceD3D11::FillFunctionTable(ResourceAllocatorInterface& table) const {
     table.AllocateBuffer = ::AllocateBuffer;
     table.AllocateTexture = ::AllocateTexture;
     table.AllocateAccelerationStructure = ::AllocateAccelerationStructure;
     table.AllocateMicromap = ::AllocateMicromap;
+    table.GetResourceAllocatorStatistics = ::GetResourceAllocatorStatistics;
+    table.GetResourceAllocatorDump = ::GetResourceAllocatorDump;
 
     return Result::SUCCESS;
 }
@@ -1064,6 +1512,10 @@ static uint32_t NRI_CALL StreamConstantData(Streamer& streamer, const void* data
     return ((StreamerImpl&)streamer).StreamConstantData(data, dataSize);
 }
 
+static uint64_t NRI_CALL StreamDeviceAddresses(Streamer& streamer, const BufferOffset* bufferOffsets, uint32_t bufferOffsetNum) {
+    return ((StreamerImpl&)streamer).StreamDeviceAddresses(bufferOffsets, bufferOffsetNum);
+}
+
 static BufferOffset NRI_CALL StreamBufferData(Streamer& streamer, const StreamBufferDataDesc& streamBufferDataDesc) {
     return ((StreamerImpl&)streamer).StreamBufferData(streamBufferDataDesc);
 }
@@ -1087,6 +1539,7 @@ Result DeviceD3D11::FillFunctionTable(StreamerInterface& table) const {
     table.StreamBufferData = ::StreamBufferData;
     table.StreamTextureData = ::StreamTextureData;
     table.StreamConstantData = ::StreamConstantData;
+    table.StreamDeviceAddresses = ::StreamDeviceAddresses;
     table.EndStreamerFrame = ::EndStreamerFrame;
     table.CmdCopyStreamedData = ::CmdCopyStreamedData;
 
@@ -1103,7 +1556,7 @@ static Result NRI_CALL CreateSwapChain(Device& device, const SwapChainDesc& swap
 }
 
 static void NRI_CALL DestroySwapChain(SwapChain* swapChain) {
-    Destroy((SwapChainD3D11*)swapChain);
+    DestroyObject<SwapChain>((SwapChainD3D11*)swapChain);
 }
 
 static Texture* const* NRI_CALL GetSwapChainTextures(const SwapChain& swapChain, uint32_t& textureNum) {
@@ -1126,10 +1579,15 @@ static Result NRI_CALL QueuePresent(SwapChain& swapChain, Fence&) {
     return ((SwapChainD3D11&)swapChain).Present();
 }
 
-Result DeviceD3D11::FillFunctionTable(SwapChainInterface& table) const {
-    if (!m_Desc.features.swapChain)
-        return Result::UNSUPPORTED;
+static Result NRI_CALL GetSwapChainStatistics(SwapChain& swapChain, SwapChainStatistics& swapChainStatistics) {
+    return ((SwapChainD3D11&)swapChain).GetStatistics(swapChainStatistics);
+}
 
+static Result NRI_CALL GetPresentedFrame(SwapChain& swapChain, PresentedFrame& presentedFrame) {
+    return ((SwapChainD3D11&)swapChain).GetPresentedFrame(presentedFrame);
+}
+
+Result DeviceD3D11::FillFunctionTable(SwapChainInterface& table) const {
     table.CreateSwapChain = ::CreateSwapChain;
     table.DestroySwapChain = ::DestroySwapChain;
     table.GetSwapChainTextures = ::GetSwapChainTextures;
@@ -1137,6 +1595,33 @@ Result DeviceD3D11::FillFunctionTable(SwapChainInterface& table) const {
     table.AcquireNextTexture = ::AcquireNextTexture;
     table.WaitForPresent = ::WaitForPresent;
     table.QueuePresent = ::QueuePresent;
+    table.GetSwapChainStatistics = ::GetSwapChainStatistics;
+    table.GetPresentedFrame = ::GetPresentedFrame;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Trace  ]
+
+static Result NRI_CALL StartTrace(Device& device, const TraceDesc& traceDesc) {
+    return ((DeviceD3D11&)device).StartTrace(traceDesc);
+}
+
+static void NRI_CALL StopTrace(Device& device) {
+    ((DeviceD3D11&)device).StopTrace();
+}
+
+static const char* NRI_CALL GetTraceJson(Device& device) {
+    return ((DeviceD3D11&)device).GetTraceJson();
+}
+
+Result DeviceD3D11::FillFunctionTable(TraceInterface& table) const {
+    table.StartTrace = ::StartTrace;
+    table.StopTrace = ::StopTrace;
+    table.GetTraceJson = ::GetTraceJson;
 
     return Result::SUCCESS;
 }
@@ -1,6 +1,8 @@
 // © 2021 NVIDIA Corporation
 
 Result PipelineD3D11::Create(const GraphicsPipelineDesc& pipelineDesc) {
+    TRACE_SCOPE(&m_Device, "CreateGraphicsPipeline");
+
     const ShaderDesc* vertexShader = nullptr;
     HRESULT hr;
 
@@ -188,6 +190,8 @@ Result PipelineD3D11::Create(const GraphicsPipelineDesc& pipelineDesc) {
 }
 
 Result PipelineD3D11::Create(const ComputePipelineDesc& pipelineDesc) {
+    TRACE_SCOPE(&m_Device, "CreateComputePipeline");
+
     if (pipelineDesc.shader.bytecode) {
         HRESULT hr = m_Device->CreateComputeShader(pipelineDesc.shader.bytecode, (size_t)pipelineDesc.shader.size, nullptr, &m_ComputeShader);
 
@@ -1,6 +1,9 @@
 // © 2021 NVIDIA Corporation
 
 NRI_INLINE Result QueueD3D11::Submit(const QueueSubmitDesc& queueSubmitDesc) {
+    TRACE_SCOPE(&m_Device, "QueueSubmit");
+    m_Device.Count(Counter::QUEUE_SUBMIT);
+
     for (uint32_t i = 0; i < queueSubmitDesc.waitFenceNum; i++) {
         const FenceSubmitDesc& fenceSubmitDesc = queueSubmitDesc.waitFences[i];
         FenceD3D11* fence = (FenceD3D11*)fenceSubmitDesc.fence;
@@ -23,7 +26,7 @@ NRI_INLINE Result QueueD3D11::Submit(const QueueSubmitDesc& queueSubmitDesc) {
 
 NRI_INLINE Result QueueD3D11::WaitIdle() {
     FenceD3D11* fence = nullptr;
-    Result result = m_Device.CreateImplementation<FenceD3D11>(fence, 0);
+    Result result = m_Device.CreateInternalImplementation<FenceD3D11>(fence, 0);
     if (result == Result::SUCCESS) {
         fence->QueueSignal(1);
         fence->Wait(1);
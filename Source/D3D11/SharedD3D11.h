@@ -152,6 +152,7 @@ struct CommandBufferBase : public DebugNameBase {
     virtual void Submit() = 0;
     virtual ID3D11DeviceContextBest* GetNativeObject() const = 0;
     virtual const AllocationCallbacks& GetAllocationCallbacks() const = 0;
+    virtual DeviceBase& GetDeviceBase() const = 0;
 };
 
 static inline uint64_t ComputeHash(const void* key, uint32_t len) {
@@ -8,6 +8,7 @@ typedef IDXGISwapChain4 IDXGISwapChainBest;
 namespace nri {
 
 struct TextureD3D11;
+struct HeadlessSwapChain;
 
 struct SwapChainD3D11 final : public DisplayDescHelper, DebugNameBase {
     inline SwapChainD3D11(DeviceD3D11& device)
@@ -34,27 +35,32 @@ struct SwapChainD3D11 final : public DisplayDescHelper, DebugNameBase {
     // NRI
     //================================================================================================================
 
-    inline Result GetDisplayDesc(DisplayDesc& displayDesc) {
-        return DisplayDescHelper::GetDisplayDesc(m_Hwnd, displayDesc);
-    }
-
+    Result GetDisplayDesc(DisplayDesc& displayDesc);
     Texture* const* GetTextures(uint32_t& textureNum) const;
     Result AcquireNextTexture(uint32_t& textureIndex);
     Result WaitForPresent();
     Result Present();
+    Result GetStatistics(SwapChainStatistics& swapChainStatistics);
+    Result GetPresentedFrame(PresentedFrame& presentedFrame);
 
     Result SetLatencySleepMode(const LatencySleepMode& latencySleepMode);
     Result SetLatencyMarker(LatencyMarker latencyMarker);
     Result LatencySleep();
     Result GetLatencyReport(LatencyReport& latencyReport);
 
+private:
+    void UpdateStatistics();
+
 private:
     DeviceD3D11& m_Device;
     ComPtr<IDXGISwapChainBest> m_SwapChain;
     TextureD3D11* m_Texture = nullptr;
+    SwapChainStatisticsHelper m_Statistics;
+    HeadlessSwapChain* m_Headless = nullptr;
     HANDLE m_FrameLatencyWaitableObject = nullptr;
     void* m_Hwnd = nullptr;
     uint64_t m_PresentId = 0;
+    UINT m_PresentCountBase = 0;
     uint8_t m_Version = 0;
     SwapChainBits m_Flags = SwapChainBits::NONE;
 };
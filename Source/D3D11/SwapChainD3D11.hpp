@@ -37,6 +37,8 @@ static uint8_t QueryLatestInterface(ComPtr<IDXGISwapChainBest>& in, ComPtr<IDXGI
 }
 
 SwapChainD3D11::~SwapChainD3D11() {
+    Destroy(m_Headless);
+
     if (m_FrameLatencyWaitableObject)
         CloseHandle(m_FrameLatencyWaitableObject);
 
@@ -44,6 +46,15 @@ SwapChainD3D11::~SwapChainD3D11() {
 }
 
 Result SwapChainD3D11::Create(const SwapChainDesc& swapChainDesc) {
+    // Headless
+    if (swapChainDesc.window.headless.enable) {
+        m_Headless = Allocate<HeadlessSwapChain>(m_Device.GetAllocationCallbacks(), (Device&)m_Device);
+
+        return m_Headless->Create(swapChainDesc);
+    }
+
+    RETURN_ON_FAILURE(&m_Device, m_Device.GetDesc().features.swapChain, Result::UNSUPPORTED, "'features.swapChain' is false");
+
     HWND hwnd = (HWND)swapChainDesc.window.windows.hwnd;
     if (!hwnd)
         return Result::INVALID_ARGUMENT;
@@ -156,6 +167,7 @@ Result SwapChainD3D11::Create(const SwapChainDesc& swapChainDesc) {
     // Finalize
     m_Hwnd = swapChainDesc.window.windows.hwnd;
     m_PresentId = GetSwapChainId();
+    m_SwapChain->GetLastPresentCount(&m_PresentCountBase);
 
     m_Flags = swapChainDesc.flags;
     if (!m_Device.HasNvExt())
@@ -165,24 +177,46 @@ Result SwapChainD3D11::Create(const SwapChainDesc& swapChainDesc) {
     if (!m_FrameLatencyWaitableObject)
         m_Flags &= ~SwapChainBits::WAITABLE;
 
+    m_Statistics.Initialize((m_Flags & SwapChainBits::VSYNC) != 0, false, 0);
+
     return Result::SUCCESS;
 }
 
+NRI_INLINE Result SwapChainD3D11::GetDisplayDesc(DisplayDesc& displayDesc) {
+    if (m_Headless)
+        return m_Headless->GetDisplayDesc(displayDesc);
+
+    return DisplayDescHelper::GetDisplayDesc(m_Hwnd, displayDesc);
+}
+
 NRI_INLINE Texture* const* SwapChainD3D11::GetTextures(uint32_t& textureNum) const {
+    if (m_Headless)
+        return m_Headless->GetTextures(textureNum);
+
     textureNum = 1;
 
     return (Texture**)&m_Texture;
 }
 
 NRI_INLINE Result SwapChainD3D11::AcquireNextTexture(uint32_t& textureIndex) {
+    if (m_Headless)
+        return m_Headless->AcquireNextTexture(nullptr, textureIndex);
+
+    uint64_t beginTime = SwapChainStatisticsHelper::GetTime();
     textureIndex = 0; // IMPORTANT: only 1 texture is available in D3D11
+    m_Statistics.OnAcquire(beginTime); // never blocks
 
     return Result::SUCCESS;
 }
 
 NRI_INLINE Result SwapChainD3D11::WaitForPresent() {
+    if (m_Headless)
+        return m_Headless->WaitForPresent();
+
     if (m_FrameLatencyWaitableObject) {
+        uint64_t beginTime = SwapChainStatisticsHelper::GetTime();
         uint32_t result = WaitForSingleObjectEx(m_FrameLatencyWaitableObject, TIMEOUT_PRESENT, TRUE);
+        m_Statistics.OnWaitForPresent(beginTime);
 
         return result == WAIT_OBJECT_0 ? Result::SUCCESS : Result::FAILURE;
     }
@@ -191,6 +225,12 @@ NRI_INLINE Result SwapChainD3D11::WaitForPresent() {
 }
 
 NRI_INLINE Result SwapChainD3D11::Present() {
+    if (m_Headless) {
+        m_PresentId++;
+
+        return m_Headless->Present(nullptr);
+    }
+
 #if NRI_ENABLE_NVAPI
     if (m_Flags & SwapChainBits::ALLOW_LOW_LATENCY)
         SetLatencyMarker((LatencyMarker)PRESENT_START);
@@ -199,6 +239,7 @@ NRI_INLINE Result SwapChainD3D11::Present() {
     bool vsync = (m_Flags & SwapChainBits::VSYNC) != 0;
     bool allowTearing = (m_Flags & SwapChainBits::ALLOW_TEARING) != 0;
     uint32_t flags = (!vsync && allowTearing) ? DXGI_PRESENT_ALLOW_TEARING : 0;
+    uint64_t beginTime = SwapChainStatisticsHelper::GetTime();
     HRESULT hr = m_SwapChain->Present(vsync ? 1 : 0, flags);
     RETURN_ON_BAD_HRESULT(&m_Device, hr, "IDXGISwapChain::Present");
 
@@ -208,11 +249,51 @@ NRI_INLINE Result SwapChainD3D11::Present() {
 #endif
 
     m_PresentId++;
+    m_Device.OnPresent();
+
+    m_Statistics.OnPresent(beginTime, 0);
+    UpdateStatistics();
 
     return Result::SUCCESS;
 }
 
+NRI_INLINE Result SwapChainD3D11::GetStatistics(SwapChainStatistics& swapChainStatistics) {
+    if (m_Headless)
+        return m_Headless->GetStatistics(swapChainStatistics);
+
+    UpdateStatistics();
+    m_Statistics.GetStatistics(swapChainStatistics);
+
+    return Result::SUCCESS;
+}
+
+void SwapChainD3D11::UpdateStatistics() {
+    // Fails until the first frame gets displayed or if statistics are not available (disjoint), the last known data is kept
+    DXGI_FRAME_STATISTICS frameStatistics = {};
+    if (FAILED(m_SwapChain->GetFrameStatistics(&frameStatistics)) || frameStatistics.PresentCount <= m_PresentCountBase)
+        return;
+
+    LARGE_INTEGER frequency = {};
+    QueryPerformanceFrequency(&frequency);
+
+    uint64_t ticks = (uint64_t)frameStatistics.SyncQPCTime.QuadPart;
+    uint64_t ticksPerSecond = (uint64_t)frequency.QuadPart;
+    uint64_t displayTime = (ticks / ticksPerSecond) * 1000000 + (ticks % ticksPerSecond) * 1000000 / ticksPerSecond;
+
+    m_Statistics.Initialize((m_Flags & SwapChainBits::VSYNC) != 0, true, 0);
+    m_Statistics.OnDisplayed(frameStatistics.PresentCount - m_PresentCountBase, displayTime, frameStatistics.PresentRefreshCount);
+}
+
+NRI_INLINE Result SwapChainD3D11::GetPresentedFrame(PresentedFrame& presentedFrame) {
+    RETURN_ON_FAILURE(&m_Device, m_Headless, Result::UNSUPPORTED, "only headless swap chains support frame readback");
+
+    return m_Headless->GetPresentedFrame(presentedFrame);
+}
+
 NRI_INLINE Result SwapChainD3D11::SetLatencySleepMode(const LatencySleepMode& latencySleepMode) {
+    if (m_Headless)
+        return m_Headless->SetLatencySleepMode(latencySleepMode);
+
 #if NRI_ENABLE_NVAPI
     NV_SET_SLEEP_MODE_PARAMS params = {NV_SET_SLEEP_MODE_PARAMS_VER};
     params.bLowLatencyMode = latencySleepMode.lowLatencyMode;
@@ -231,6 +312,9 @@ NRI_INLINE Result SwapChainD3D11::SetLatencySleepMode(const LatencySleepMode& la
 }
 
 NRI_INLINE Result SwapChainD3D11::SetLatencyMarker(LatencyMarker latencyMarker) {
+    if (m_Headless)
+        return m_Headless->SetLatencyMarker(latencyMarker);
+
 #if NRI_ENABLE_NVAPI
     NV_LATENCY_MARKER_PARAMS params = {NV_LATENCY_MARKER_PARAMS_VER};
     params.frameID = m_PresentId;
@@ -247,6 +331,9 @@ NRI_INLINE Result SwapChainD3D11::SetLatencyMarker(LatencyMarker latencyMarker)
 }
 
 NRI_INLINE Result SwapChainD3D11::LatencySleep() {
+    if (m_Headless)
+        return m_Headless->LatencySleep();
+
 #if NRI_ENABLE_NVAPI
     NvAPI_Status status = NvAPI_D3D_Sleep(m_Device.GetNativeObject());
 
@@ -257,6 +344,9 @@ NRI_INLINE Result SwapChainD3D11::LatencySleep() {
 }
 
 NRI_INLINE Result SwapChainD3D11::GetLatencyReport(LatencyReport& latencyReport) {
+    if (m_Headless)
+        return m_Headless->GetLatencyReport(latencyReport);
+
     latencyReport = {};
 #if NRI_ENABLE_NVAPI
     NV_LATENCY_RESULT_PARAMS params = {NV_LATENCY_RESULT_PARAMS_VER};
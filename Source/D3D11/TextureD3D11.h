@@ -59,6 +59,12 @@ struct TextureD3D11 final : public DebugNameBase {
         SET_D3D_DEBUG_OBJECT_NAME(m_Texture, name);
     }
 
+    //================================================================================================================
+    // NRI
+    //================================================================================================================
+
+    Result SetPriority(float priority);
+
 private:
     DeviceD3D11& m_Device;
     ComPtr<ID3D11Resource> m_Texture;
@@ -137,3 +137,14 @@ uint32_t TextureD3D11::GetMipmappedSize(const TextureDesc& textureDesc) {
 
     return size;
 }
+
+NRI_INLINE Result TextureD3D11::SetPriority(float priority) {
+    // The resource gets created in "Bind[Buffer/Texture]Memory"
+    if (!m_Texture)
+        return Result::UNSUPPORTED;
+
+    uint32_t evictionPriority = ConvertPriority(priority);
+    m_Texture->SetEvictionPriority(evictionPriority ? evictionPriority : DXGI_RESOURCE_PRIORITY_NORMAL);
+
+    return Result::SUCCESS;
+}
@@ -13,7 +13,7 @@ Result AccelerationStructureD3D12::Create(const AccelerationStructureD3D12Desc&
     BufferD3D12Desc bufferDesc = {};
     bufferDesc.d3d12Resource = accelerationStructureD3D12Desc.d3d12Resource;
 
-    return m_Device.CreateImplementation<BufferD3D12>(m_Buffer, bufferDesc);
+    return m_Device.CreateInternalImplementation<BufferD3D12>(m_Buffer, bufferDesc);
 }
 
 Result AccelerationStructureD3D12::Create(const AccelerationStructureDesc& accelerationStructureDesc) {
@@ -27,7 +27,7 @@ Result AccelerationStructureD3D12::Create(const AccelerationStructureDesc& accel
     bufferDesc.size = m_PrebuildInfo.ResultDataMaxSizeInBytes;
     bufferDesc.usage = BufferUsageBits::ACCELERATION_STRUCTURE_STORAGE;
 
-    return m_Device.CreateImplementation<BufferD3D12>(m_Buffer, bufferDesc);
+    return m_Device.CreateInternalImplementation<BufferD3D12>(m_Buffer, bufferDesc);
 }
 
 Result AccelerationStructureD3D12::BindMemory(Memory* memory, uint64_t offset) {
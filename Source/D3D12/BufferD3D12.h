@@ -41,6 +41,8 @@ struct BufferD3D12 final : public DebugNameBase {
     Result Create(const BufferDesc& bufferDesc);
     Result Create(const BufferD3D12Desc& bufferD3D12Desc);
     Result Create(const AllocateBufferDesc& allocateBufferDesc);
+    Result Create(const SparseBufferDesc& sparseBufferDesc);
+    void GetSparseTiling(SparseTiling& sparseTiling) const;
     Result BindMemory(const MemoryD3D12* memory, uint64_t offset);
 
     //================================================================================================================
@@ -57,6 +59,8 @@ struct BufferD3D12 final : public DebugNameBase {
 
     void* Map(uint64_t offset);
 
+    Result SetPriority(float priority);
+
 private:
     Result SetPriorityAndPersistentlyMap(float priority, const D3D12_HEAP_PROPERTIES& heapProps);
 
@@ -112,3 +112,11 @@ NRI_INLINE void* BufferD3D12::Map(uint64_t offset) {
 
     return m_MappedMemory + offset;
 }
+
+NRI_INLINE Result BufferD3D12::SetPriority(float priority) {
+    // The resource gets created in "Bind[Buffer/Texture]Memory"
+    if (!m_Buffer)
+        return Result::UNSUPPORTED;
+
+    return m_Device.SetResidencyPriority(m_Buffer.GetInterface(), priority);
+}
@@ -16,6 +16,7 @@ NRI_INLINE Result CommandAllocatorD3D12::CreateCommandBuffer(CommandBuffer*& com
     const Result result = commandBufferD3D12->Create(m_CommandListType, m_CommandAllocator);
 
     if (result == Result::SUCCESS) {
+        m_Device.OnObjectCreated<CommandBuffer>();
         commandBuffer = (CommandBuffer*)commandBufferD3D12;
         return Result::SUCCESS;
     }
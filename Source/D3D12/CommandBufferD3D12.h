@@ -18,10 +18,12 @@ namespace nri {
 struct PipelineD3D12;
 struct PipelineLayoutD3D12;
 struct DescriptorSetD3D12;
+struct DescriptorD3D12;
 
 struct CommandBufferD3D12 final : public DebugNameBase {
     inline CommandBufferD3D12(DeviceD3D12& device)
-        : m_Device(device) {
+        : m_Device(device)
+        , m_TransientViews(device) {
     }
 
     inline ~CommandBufferD3D12() {
@@ -74,6 +76,7 @@ struct CommandBufferD3D12 final : public DebugNameBase {
     void SetDepthBias(const DepthBiasDesc& depthBiasDesc);
     void ClearAttachments(const ClearDesc* clearDescs, uint32_t clearDescNum, const Rect* rects, uint32_t rectNum);
     void ClearStorage(const ClearStorageDesc& clearDesc);
+    Result CreateTransientAttachmentView(const Texture2DViewDesc& textureViewDesc, Descriptor*& textureView);
     void BeginRendering(const AttachmentsDesc& attachmentsDesc);
     void SetVertexBuffers(uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum);
     void SetIndexBuffer(const Buffer& buffer, uint64_t offset, IndexType indexType);
@@ -114,9 +117,11 @@ struct CommandBufferD3D12 final : public DebugNameBase {
     void DispatchRaysIndirect(const Buffer& buffer, uint64_t offset);
     void DrawMeshTasks(const DrawMeshTasksDesc& drawMeshTasksDesc);
     void DrawMeshTasksIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
+    void ExecuteIndirect(const ExecuteIndirectDesc& executeIndirectDesc);
 
 private:
     DeviceD3D12& m_Device;
+    TransientViewCache<DeviceD3D12, DescriptorD3D12> m_TransientViews;
     ComPtr<ID3D12CommandAllocator> m_CommandAllocator;
     ComPtr<ID3D12GraphicsCommandListBest> m_GraphicsCommandList;
     std::array<D3D12_CPU_DESCRIPTOR_HANDLE, D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT> m_RenderTargets = {};
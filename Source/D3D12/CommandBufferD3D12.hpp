@@ -292,6 +292,7 @@ NRI_INLINE Result CommandBufferD3D12::Begin(const DescriptorPool* descriptorPool
     m_PipelineBindPoint = BindPoint::INHERIT;
 
     ResetAttachments();
+    m_TransientViews.Reset();
 
     return Result::SUCCESS;
 }
@@ -407,6 +408,10 @@ NRI_INLINE void CommandBufferD3D12::ClearStorage(const ClearStorageDesc& clearDe
         m_GraphicsCommandList->ClearUnorderedAccessViewFloat({descriptorSet->GetPointerGPU(clearDesc.rangeIndex, clearDesc.descriptorIndex)}, {storage->GetPointerCPU()}, *storage, &clearDesc.value.f.x, 0, nullptr);
 }
 
+NRI_INLINE Result CommandBufferD3D12::CreateTransientAttachmentView(const Texture2DViewDesc& textureViewDesc, Descriptor*& textureView) {
+    return m_TransientViews.Get(textureViewDesc, textureView);
+}
+
 NRI_INLINE void CommandBufferD3D12::BeginRendering(const AttachmentsDesc& attachmentsDesc) {
     // Render targets
     m_RenderTargetNum = attachmentsDesc.colors ? attachmentsDesc.colorNum : 0;
@@ -731,6 +736,8 @@ NRI_INLINE void CommandBufferD3D12::DispatchIndirect(const Buffer& buffer, uint6
 }
 
 NRI_INLINE void CommandBufferD3D12::Barrier(const BarrierDesc& barrierDesc) {
+    m_Device.Count(Counter::BARRIER, barrierDesc.globalNum + barrierDesc.bufferNum + barrierDesc.textureNum);
+
 #if NRI_ENABLE_AGILITY_SDK_SUPPORT
     if (m_Device.GetDesc().features.enhancedBarriers) {
         // Count
@@ -1232,3 +1239,14 @@ NRI_INLINE void CommandBufferD3D12::DrawMeshTasksIndirect(const Buffer& buffer,
 
     m_GraphicsCommandList->ExecuteIndirect(m_Device.GetDrawMeshCommandSignature(stride), drawNum, (BufferD3D12&)buffer, offset, pCountBuffer, countBufferOffset);
 }
+
+NRI_INLINE void CommandBufferD3D12::ExecuteIndirect(const ExecuteIndirectDesc& executeIndirectDesc) {
+    ID3D12Resource* pCountBuffer = nullptr;
+    if (executeIndirectDesc.countBuffer)
+        pCountBuffer = *(BufferD3D12*)executeIndirectDesc.countBuffer;
+
+    const CommandSignatureD3D12& commandSignatureD3D12 = *(CommandSignatureD3D12*)executeIndirectDesc.commandSignature;
+    const BufferD3D12& bufferD3D12 = *(BufferD3D12*)executeIndirectDesc.buffer;
+
+    m_GraphicsCommandList->ExecuteIndirect(commandSignatureD3D12, executeIndirectDesc.commandMaxNum, bufferD3D12, executeIndirectDesc.offset, pCountBuffer, executeIndirectDesc.countBufferOffset);
+}
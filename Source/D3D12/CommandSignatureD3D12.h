@@ -0,0 +1,53 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct CommandSignatureD3D12 final : public DebugNameBase {
+    inline CommandSignatureD3D12(DeviceD3D12& device)
+        : m_Device(device)
+        , m_Layout(device.GetStdAllocator()) {
+    }
+
+    inline operator ID3D12CommandSignature*() const {
+        return m_CommandSignature.GetInterface();
+    }
+
+    inline DeviceD3D12& GetDevice() const {
+        return m_Device;
+    }
+
+    Result Create(const CommandSignatureDesc& commandSignatureDesc);
+
+    //================================================================================================================
+    // DebugNameBase
+    //================================================================================================================
+
+    void SetDebugName(const char* name) DEBUG_NAME_OVERRIDE {
+        SET_D3D_DEBUG_OBJECT_NAME(m_CommandSignature, name);
+    }
+
+    //================================================================================================================
+    // NRI
+    //================================================================================================================
+
+    inline uint32_t GetStride() const {
+        return m_Layout.stride;
+    }
+
+    inline uint32_t GetArgumentOffset(uint32_t argumentIndex) const {
+        return m_Layout.argumentOffsets[argumentIndex];
+    }
+
+    inline uint64_t GetPreprocessSize(const Pipeline&, uint32_t) const {
+        return 0; // preprocessing is implicit
+    }
+
+private:
+    DeviceD3D12& m_Device;
+    ComPtr<ID3D12CommandSignature> m_CommandSignature;
+    CommandSignatureLayout m_Layout;
+};
+
+} // namespace nri
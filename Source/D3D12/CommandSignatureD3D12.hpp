@@ -0,0 +1,67 @@
+// © 2025 NVIDIA Corporation
+
+Result CommandSignatureD3D12::Create(const CommandSignatureDesc& commandSignatureDesc) {
+    static_assert(sizeof(IndirectVertexBufferDesc) == sizeof(D3D12_VERTEX_BUFFER_VIEW), "Type mismatch");
+    static_assert(sizeof(IndirectIndexBufferDesc) == sizeof(D3D12_INDEX_BUFFER_VIEW), "Type mismatch");
+    static_assert(INDIRECT_INDEX_FORMAT_UINT16 == DXGI_FORMAT_R16_UINT, "Type mismatch");
+    static_assert(INDIRECT_INDEX_FORMAT_UINT32 == DXGI_FORMAT_R32_UINT, "Type mismatch");
+
+    m_Layout.Init(commandSignatureDesc);
+
+    const PipelineLayoutD3D12* pipelineLayoutD3D12 = (PipelineLayoutD3D12*)commandSignatureDesc.pipelineLayout;
+    uint32_t argumentNum = commandSignatureDesc.argumentNum;
+    bool hasRootArguments = false;
+
+    Scratch<D3D12_INDIRECT_ARGUMENT_DESC> argumentDescs = AllocateScratch(m_Device, D3D12_INDIRECT_ARGUMENT_DESC, argumentNum);
+    for (uint32_t i = 0; i < argumentNum; i++) {
+        const IndirectArgumentDesc& in = commandSignatureDesc.arguments[i];
+
+        D3D12_INDIRECT_ARGUMENT_DESC& out = argumentDescs[i];
+        out = {};
+
+        switch (in.type) {
+            case IndirectArgumentType::ROOT_CONSTANTS:
+                out.Type = D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT;
+                out.Constant.RootParameterIndex = pipelineLayoutD3D12->GetBaseRootConstant() + in.index;
+                out.Constant.DestOffsetIn32BitValues = in.offset / sizeof(uint32_t);
+                out.Constant.Num32BitValuesToSet = in.size / sizeof(uint32_t);
+                hasRootArguments = true;
+                break;
+            case IndirectArgumentType::VERTEX_BUFFER:
+                out.Type = D3D12_INDIRECT_ARGUMENT_TYPE_VERTEX_BUFFER_VIEW;
+                out.VertexBuffer.Slot = in.index;
+                break;
+            case IndirectArgumentType::INDEX_BUFFER:
+                out.Type = D3D12_INDIRECT_ARGUMENT_TYPE_INDEX_BUFFER_VIEW;
+                break;
+            case IndirectArgumentType::DRAW:
+                out.Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW;
+                break;
+            case IndirectArgumentType::DRAW_INDEXED:
+                out.Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED;
+                break;
+            case IndirectArgumentType::DRAW_MESH_TASKS:
+                out.Type = D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH_MESH;
+                break;
+            case IndirectArgumentType::DISPATCH:
+                out.Type = D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH;
+                break;
+            default:
+                return Result::INVALID_ARGUMENT;
+        }
+    }
+
+    D3D12_COMMAND_SIGNATURE_DESC commandSignatureDesc12 = {};
+    commandSignatureDesc12.ByteStride = m_Layout.stride;
+    commandSignatureDesc12.NumArgumentDescs = argumentNum;
+    commandSignatureDesc12.pArgumentDescs = argumentDescs;
+    commandSignatureDesc12.NodeMask = NODE_MASK;
+
+    // A root signature is needed only if root arguments get changed
+    ID3D12RootSignature* rootSignature = hasRootArguments ? (ID3D12RootSignature*)*pipelineLayoutD3D12 : nullptr;
+
+    HRESULT hr = m_Device->CreateCommandSignature(&commandSignatureDesc12, rootSignature, IID_PPV_ARGS(&m_CommandSignature));
+    RETURN_ON_BAD_HRESULT(&m_Device, hr, "ID3D12Device::CreateCommandSignature");
+
+    return Result::SUCCESS;
+}
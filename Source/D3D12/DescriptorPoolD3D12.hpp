@@ -129,6 +129,8 @@ NRI_INLINE Result DescriptorPoolD3D12::AllocateDescriptorSets(const PipelineLayo
         descriptorSets[i] = (DescriptorSet*)descriptorSet;
     }
 
+    m_Device.Count(Counter::DESCRIPTOR_SET, instanceNum);
+
     return Result::SUCCESS;
 }
 
@@ -38,6 +38,8 @@ DescriptorPointerGPU DescriptorSetD3D12::GetDynamicPointerGPU(uint32_t dynamicCo
 }
 
 NRI_INLINE void DescriptorSetD3D12::UpdateDescriptorRanges(uint32_t rangeOffset, uint32_t rangeNum, const DescriptorRangeUpdateDesc* rangeUpdateDescs) {
+    TRACE_SCOPE(&GetDevice(), "UpdateDescriptorRanges");
+
     for (uint32_t i = 0; i < rangeNum; i++) {
         const DescriptorRangeMapping& rangeMapping = m_DescriptorSetMapping->descriptorRangeMappings[rangeOffset + i];
 
@@ -62,6 +62,10 @@ struct DeviceD3D12 final : public DeviceBase {
         return m_TightAlignmentTier;
     }
 
+    inline uint8_t GetTiledResourcesTier() const {
+        return m_TiledResourcesTier;
+    }
+
     inline uint8_t GetVersion() const {
         return m_Version;
     }
@@ -84,6 +88,16 @@ struct DeviceD3D12 final : public DeviceBase {
 
     template <typename Implementation, typename Interface, typename... Args>
     inline Result CreateImplementation(Interface*& entity, const Args&... args) {
+        Result result = CreateInternalImplementation<Implementation>(entity, args...);
+        if (result == Result::SUCCESS)
+            OnObjectCreated<Interface>();
+
+        return result;
+    }
+
+    // For objects not visible to the app (not counted by "DeviceStatistics", must be destroyed via "Destroy")
+    template <typename Implementation, typename Interface, typename... Args>
+    inline Result CreateInternalImplementation(Interface*& entity, const Args&... args) {
         Implementation* impl = Allocate<Implementation>(GetAllocationCallbacks(), *this);
         Result result = impl->Create(args...);
 
@@ -105,6 +119,9 @@ struct DeviceD3D12 final : public DeviceBase {
     void GetMemoryDesc(MemoryLocation memoryLocation, const D3D12_RESOURCE_DESC& resourceDesc, MemoryDesc& memoryDesc) const;
     void GetAccelerationStructurePrebuildInfo(const AccelerationStructureDesc& accelerationStructureDesc, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO& prebuildInfo) const;
     void GetMicromapPrebuildInfo(const MicromapDesc& micromapDesc, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO& prebuildInfo) const;
+    Result SetResidencyPriority(ID3D12Pageable* pageable, float priority);
+    Result GetVmaStatistics(ResourceAllocatorHeapStatistics* heapStatistics, uint32_t& heapStatisticsNum) const;
+    Result GetVmaDump(char* dump, uint64_t& dumpSize) const;
     D3D12_HEAP_TYPE GetHeapType(MemoryLocation memoryLocation) const;
     DescriptorPointerCPU GetDescriptorPointerCPU(const DescriptorHandle& descriptorHandle);
     ID3D12CommandSignature* GetDrawCommandSignature(uint32_t stride, ID3D12RootSignature* rootSignature);
@@ -132,12 +149,19 @@ struct DeviceD3D12 final : public DeviceBase {
     void Destruct() override;
     Result FillFunctionTable(CoreInterface& table) const override;
     Result FillFunctionTable(HelperInterface& table) const override;
+    Result FillFunctionTable(IndirectCommandsInterface& table) const override;
     Result FillFunctionTable(LowLatencyInterface& table) const override;
     Result FillFunctionTable(MeshShaderInterface& table) const override;
+    Result FillFunctionTable(MicromapBakerInterface& table) const override;
+    Result FillFunctionTable(ProfilerInterface& table) const override;
     Result FillFunctionTable(RayTracingInterface& table) const override;
+    Result FillFunctionTable(RenderGraphInterface& table) const override;
+    Result FillFunctionTable(ResidencyInterface& table) const override;
     Result FillFunctionTable(ResourceAllocatorInterface& table) const override;
+    Result FillFunctionTable(SparseInterface& table) const override;
     Result FillFunctionTable(StreamerInterface& table) const override;
     Result FillFunctionTable(SwapChainInterface& table) const override;
+    Result FillFunctionTable(TraceInterface& table) const override;
     Result FillFunctionTable(UpscalerInterface& table) const override;
     Result FillFunctionTable(WrapperD3D12Interface& table) const override;
 
@@ -155,9 +179,12 @@ struct DeviceD3D12 final : public DeviceBase {
     Result BindTextureMemory(const BindTextureMemoryDesc* bindTextureMemoryDescs, uint32_t bindTextureMemoryDescNum);
     Result BindAccelerationStructureMemory(const BindAccelerationStructureMemoryDesc* bindAccelerationStructureMemoryDescs, uint32_t bindAccelerationStructureMemoryDescNum);
     Result BindMicromapMemory(const BindMicromapMemoryDesc* bindMicromapMemoryDescs, uint32_t bindMicromapMemoryDescNum);
-    FormatSupportBits GetFormatSupport(Format format) const;
+    inline FormatSupportBits GetFormatSupport(Format format) const {
+        return m_FormatSupport[(size_t)format];
+    }
 
 private:
+    FormatSupportBits QueryFormatSupport(Format format) const;
     HRESULT CreateVma();
     void FillDesc(bool disableD3D12EnhancedBarrier);
     void InitializeNvExt(bool disableNVAPIInitialization, bool isImported);
@@ -189,11 +216,13 @@ private:
     UnorderedMap<uint64_t, ComPtr<ID3D12CommandSignature>> m_DrawIndexedCommandSignatures; // m_CommandSignatureLock
     UnorderedMap<uint32_t, ComPtr<ID3D12CommandSignature>> m_DrawMeshCommandSignatures;    // m_CommandSignatureLock
     std::array<Vector<QueueD3D12*>, (size_t)QueueType::MAX_NUM> m_QueueFamilies;
+    std::array<FormatSupportBits, (size_t)Format::MAX_NUM> m_FormatSupport = {};
     CoreInterface m_iCore = {};
     DeviceDesc m_Desc = {};
     void* m_CallbackHandle = nullptr;
     DWORD m_CallbackCookie = 0;
     uint8_t m_TightAlignmentTier = 0;
+    uint8_t m_TiledResourcesTier = 0;
     uint8_t m_Version = 0;
     bool m_IsWrapped = false;
     bool m_IsMemoryZeroInitializationEnabled = false;
@@ -54,7 +54,7 @@ static void __stdcall MessageCallback(D3D12_MESSAGE_CATEGORY category, D3D12_MES
         messageType = Message::WARNING;
 
     DeviceD3D12& device = *(DeviceD3D12*)context;
-    device.ReportMessage(messageType, result, __FILE__, __LINE__, "[%u] %s", id, message);
+    device.ReportMessage(messageType, result, true, __FILE__, __LINE__, "[%u] %s", id, message);
 }
 
 #else
@@ -73,8 +73,8 @@ static void __stdcall NvapiMessageCallback(void* context, NVAPI_D3D12_RAYTRACING
         messageType = Message::WARNING;
 
     DeviceD3D12& device = *(DeviceD3D12*)context;
-    device.ReportMessage(Message::WARNING, Result::SUCCESS, __FILE__, __LINE__, "Details: %s", messageDetails);
-    device.ReportMessage(messageType, result, __FILE__, __LINE__, "%s: %s (see above)", messageCode, message);
+    device.ReportMessage(Message::WARNING, Result::SUCCESS, true, __FILE__, __LINE__, "Details: %s", messageDetails);
+    device.ReportMessage(messageType, result, true, __FILE__, __LINE__, "%s: %s (see above)", messageCode, message);
 }
 
 #endif
@@ -380,6 +380,10 @@ Result DeviceD3D12::Create(const DeviceCreationDesc& desc, const DeviceCreationD
     hr = m_Device->GetDeviceRemovedReason() == S_OK ? S_OK : DXGI_ERROR_DEVICE_REMOVED;
     RETURN_ON_BAD_HRESULT(this, hr, "Create");
 
+    // Cache format capabilities (queried per format once)
+    for (uint32_t i = 1; i < (uint32_t)Format::MAX_NUM; i++)
+        m_FormatSupport[i] = QueryFormatSupport((Format)i);
+
     return FillFunctionTable(m_iCore);
 }
 
@@ -391,6 +395,7 @@ void DeviceD3D12::FillDesc(bool disableD3D12EnhancedBarrier) {
     if (FAILED(hr))
         REPORT_WARNING(this, "ID3D12Device::CheckFeatureSupport(options) failed, result = 0x%08X!", hr);
     m_Desc.tiers.memory = options.ResourceHeapTier == D3D12_RESOURCE_HEAP_TIER_2 ? 1 : 0;
+    m_TiledResourcesTier = (uint8_t)options.TiledResourcesTier;
 
     D3D12_FEATURE_DATA_D3D12_OPTIONS1 options1 = {};
     hr = m_Device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS1, &options1, sizeof(options1));
@@ -749,6 +754,7 @@ void DeviceD3D12::FillDesc(bool disableD3D12EnhancedBarrier) {
     m_Desc.features.swapChain = HasOutput();
     m_Desc.features.lowLatency = HasNvExt();
     m_Desc.features.micromap = m_Desc.tiers.rayTracing >= 3;
+    m_Desc.features.indirectCommands = true;
 
     m_Desc.features.textureFilterMinMax = levels.MaxSupportedFeatureLevel >= D3D_FEATURE_LEVEL_11_1 ? true : false;
     m_Desc.features.logicOp = options.OutputMergerLogicOp != 0;
@@ -1125,6 +1131,18 @@ void DeviceD3D12::GetMicromapPrebuildInfo(const MicromapDesc& micromapDesc, D3D1
 #endif
 }
 
+Result DeviceD3D12::SetResidencyPriority(ID3D12Pageable* pageable, float priority) {
+    // "0" means "don't touch" at creation time, but here "normal" must be restored explicitly
+    D3D12_RESIDENCY_PRIORITY residencyPriority = ConvertPriority(priority);
+    if (residencyPriority == 0)
+        residencyPriority = D3D12_RESIDENCY_PRIORITY_NORMAL;
+
+    HRESULT hr = m_Device->SetResidencyPriority(1, &pageable, &residencyPriority);
+    RETURN_ON_BAD_HRESULT(this, hr, "ID3D12Device1::SetResidencyPriority");
+
+    return Result::SUCCESS;
+}
+
 ComPtr<ID3D12CommandSignature> DeviceD3D12::CreateCommandSignature(D3D12_INDIRECT_ARGUMENT_TYPE type, uint32_t stride, ID3D12RootSignature* rootSignature, bool enableDrawParametersEmulation) {
     const bool isDrawArgument = enableDrawParametersEmulation && (type == D3D12_INDIRECT_ARGUMENT_TYPE_DRAW || type == D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED);
 
@@ -1308,7 +1326,7 @@ NRI_INLINE Result DeviceD3D12::BindMicromapMemory(const BindMicromapMemoryDesc*
     if ((formatSupport.Support2 & (optional)) != 0) \
         supportBits |= bit;
 
-NRI_INLINE FormatSupportBits DeviceD3D12::GetFormatSupport(Format format) const {
+NRI_INLINE FormatSupportBits DeviceD3D12::QueryFormatSupport(Format format) const {
     DXGI_FORMAT dxgiFormat = GetDxgiFormat(format).typed;
     D3D12_FEATURE_DATA_FORMAT_SUPPORT formatSupport = {dxgiFormat};
     HRESULT hr = m_Device->CheckFeatureSupport(D3D12_FEATURE_FORMAT_SUPPORT, &formatSupport, sizeof(formatSupport));
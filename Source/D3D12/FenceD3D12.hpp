@@ -37,6 +37,9 @@ NRI_INLINE void FenceD3D12::QueueWait(QueueD3D12& queue, uint64_t value) {
 }
 
 NRI_INLINE void FenceD3D12::Wait(uint64_t value) {
+    TRACE_SCOPE(&m_Device, "FenceWait");
+    m_Device.Count(Counter::HOST_WAIT);
+
     if (!m_Fence)
         return;
 
@@ -43,6 +43,12 @@ struct MemoryD3D12 final : public DebugNameBase {
         SET_D3D_DEBUG_OBJECT_NAME(m_Heap, name);
     }
 
+    //================================================================================================================
+    // NRI
+    //================================================================================================================
+
+    Result SetPriority(float priority);
+
 private:
     DeviceD3D12& m_Device;
     ComPtr<ID3D12Heap> m_Heap;
@@ -22,6 +22,8 @@ Result MemoryD3D12::Create(const AllocateMemoryDesc& allocateMemoryDesc) {
         HRESULT hr = m_Device->CreateHeap(&heapDesc, IID_PPV_ARGS(&m_Heap));
         RETURN_ON_BAD_HRESULT(&m_Device, hr, "ID3D12Device::CreateHeap");
 
+        m_Device.Count(Counter::MEMORY_ALLOCATION);
+
         D3D12_RESIDENCY_PRIORITY residencyPriority = (D3D12_RESIDENCY_PRIORITY)ConvertPriority(allocateMemoryDesc.priority);
         if (residencyPriority != 0) {
             ID3D12Pageable* obj = m_Heap.GetInterface();
@@ -42,3 +44,15 @@ Result MemoryD3D12::Create(const MemoryD3D12Desc& memoryD3D12Desc) {
 
     return Result::SUCCESS;
 }
+
+NRI_INLINE Result MemoryD3D12::SetPriority(float priority) {
+    // Resources bound to a dummy memory are committed, they don't know about the memory anymore
+    if (IsDummy())
+        return Result::UNSUPPORTED;
+
+    Result result = m_Device.SetResidencyPriority(m_Heap.GetInterface(), priority);
+    if (result == Result::SUCCESS)
+        m_Priority = priority;
+
+    return result;
+}
@@ -33,7 +33,7 @@ Result MicromapD3D12::Create(const MicromapDesc& micromapDesc) {
     bufferDesc.size = m_PrebuildInfo.ResultDataMaxSizeInBytes;
     bufferDesc.usage = BufferUsageBits::MICROMAP_STORAGE;
 
-    return m_Device.CreateImplementation<BufferD3D12>(m_Buffer, bufferDesc);
+    return m_Device.CreateInternalImplementation<BufferD3D12>(m_Buffer, bufferDesc);
 #else
     MaybeUnused(micromapDesc);
 
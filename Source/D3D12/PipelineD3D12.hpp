@@ -310,12 +310,16 @@ Result PipelineD3D12::CreateFromStream(const GraphicsPipelineDesc& graphicsPipel
 }
 
 Result PipelineD3D12::Create(const GraphicsPipelineDesc& graphicsPipelineDesc) {
+    TRACE_SCOPE(&m_Device, "CreateGraphicsPipeline");
+
     m_PipelineLayout = (PipelineLayoutD3D12*)graphicsPipelineDesc.pipelineLayout;
 
     return CreateFromStream(graphicsPipelineDesc);
 }
 
 Result PipelineD3D12::Create(const ComputePipelineDesc& computePipelineDesc) {
+    TRACE_SCOPE(&m_Device, "CreateComputePipeline");
+
     m_PipelineLayout = (PipelineLayoutD3D12*)computePipelineDesc.pipelineLayout;
 
     D3D12_COMPUTE_PIPELINE_STATE_DESC computePipleineStateDesc = {};
@@ -331,6 +335,8 @@ Result PipelineD3D12::Create(const ComputePipelineDesc& computePipelineDesc) {
 }
 
 Result PipelineD3D12::Create(const RayTracingPipelineDesc& rayTracingPipelineDesc) {
+    TRACE_SCOPE(&m_Device, "CreateRayTracingPipeline");
+
     m_PipelineLayout = (PipelineLayoutD3D12*)rayTracingPipelineDesc.pipelineLayout;
 
     ID3D12RootSignature* rootSignature = *m_PipelineLayout;
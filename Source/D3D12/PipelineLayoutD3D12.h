@@ -52,6 +52,10 @@ struct PipelineLayoutD3D12 final : public DebugNameBase {
         return m_Device;
     }
 
+    inline uint32_t GetBaseRootConstant() const {
+        return m_BaseRootConstant;
+    }
+
     inline bool IsDrawParametersEmulationEnabled() const {
         return m_DrawParametersEmulation;
     }
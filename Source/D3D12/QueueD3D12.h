@@ -47,6 +47,7 @@ struct QueueD3D12 final : public DebugNameBase {
     void EndAnnotation();
     void Annotation(const char* name, uint32_t bgra);
     Result Submit(const QueueSubmitDesc& queueSubmitDesc);
+    Result BindSparse(const QueueBindSparseDesc& queueBindSparseDesc);
     Result WaitIdle();
 
 private:
@@ -49,6 +49,9 @@ NRI_INLINE void QueueD3D12::Annotation(const char* name, uint32_t bgra) {
 }
 
 NRI_INLINE Result QueueD3D12::Submit(const QueueSubmitDesc& queueSubmitDesc) {
+    TRACE_SCOPE(&m_Device, "QueueSubmit");
+    m_Device.Count(Counter::QUEUE_SUBMIT);
+
     for (uint32_t i = 0; i < queueSubmitDesc.waitFenceNum; i++) {
         const FenceSubmitDesc& fenceSubmitDesc = queueSubmitDesc.waitFences[i];
         FenceD3D12* fence = (FenceD3D12*)fenceSubmitDesc.fence;
@@ -78,7 +81,7 @@ NRI_INLINE Result QueueD3D12::Submit(const QueueSubmitDesc& queueSubmitDesc) {
 
 NRI_INLINE Result QueueD3D12::WaitIdle() {
     FenceD3D12* fence = nullptr;
-    Result result = m_Device.CreateImplementation<FenceD3D12>(fence, 0);
+    Result result = m_Device.CreateInternalImplementation<FenceD3D12>(fence, 0);
     if (result == Result::SUCCESS) {
         fence->QueueSignal(*this, 1);
         fence->Wait(1);
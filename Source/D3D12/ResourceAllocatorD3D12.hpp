@@ -74,6 +74,61 @@ HRESULT DeviceD3D12::CreateVma() {
     return D3D12MA::CreateAllocator(&allocatorDesc, &m_Vma);
 }
 
+Result DeviceD3D12::GetVmaStatistics(ResourceAllocatorHeapStatistics* heapStatistics, uint32_t& heapStatisticsNum) const {
+    // Memory segment groups: local and non-local (not used on UMA)
+    uint32_t heapNum = m_Vma->IsUMA() ? 1 : 2;
+    if (!heapStatistics) {
+        heapStatisticsNum = heapNum;
+        return Result::SUCCESS;
+    }
+
+    std::array<D3D12MA::Budget, 2> budgets = {};
+    m_Vma->GetBudget(&budgets[0], &budgets[1]);
+
+    D3D12MA::TotalStatistics totalStatistics = {};
+    m_Vma->CalculateStatistics(&totalStatistics);
+
+    heapStatisticsNum = std::min(heapStatisticsNum, heapNum);
+    for (uint32_t i = 0; i < heapStatisticsNum; i++) {
+        const D3D12MA::DetailedStatistics& detailedStatistics = totalStatistics.MemorySegmentGroup[i];
+        const D3D12MA::Statistics& statistics = detailedStatistics.Stats;
+        uint64_t freeSize = statistics.BlockBytes - statistics.AllocationBytes;
+
+        ResourceAllocatorHeapStatistics& heapStatistic = heapStatistics[i];
+        heapStatistic = {};
+        heapStatistic.budgetSize = budgets[i].BudgetBytes;
+        heapStatistic.usageSize = budgets[i].UsageBytes;
+        heapStatistic.blockSize = statistics.BlockBytes;
+        heapStatistic.allocationSize = statistics.AllocationBytes;
+        heapStatistic.blockNum = statistics.BlockCount;
+        heapStatistic.allocationNum = statistics.AllocationCount;
+        heapStatistic.fragmentation = freeSize ? std::max(1.0f - float(double(detailedStatistics.UnusedRangeSizeMax) / double(freeSize)), 0.0f) : 0.0f;
+        heapStatistic.isDeviceLocal = i == 0;
+    }
+
+    return Result::SUCCESS;
+}
+
+Result DeviceD3D12::GetVmaDump(char* dump, uint64_t& dumpSize) const {
+    WCHAR* statsString = nullptr;
+    m_Vma->BuildStatsString(&statsString, TRUE);
+
+    uint64_t size = wcslen(statsString) + 1;
+
+    Result result = Result::SUCCESS;
+    if (dump) {
+        if (dumpSize >= size)
+            ConvertWcharToChar(statsString, dump, (size_t)size); // JSON is ASCII
+        else
+            result = Result::FAILURE;
+    }
+
+    dumpSize = size;
+    m_Vma->FreeStatsString(statsString);
+
+    return result;
+}
+
 Result BufferD3D12::Create(const AllocateBufferDesc& allocateBufferDesc) {
     uint32_t flags = D3D12MA::ALLOCATION_FLAG_CAN_ALIAS | D3D12MA::ALLOCATION_FLAG_STRATEGY_MIN_MEMORY;
     if (allocateBufferDesc.dedicated)
@@ -114,6 +169,8 @@ Result BufferD3D12::Create(const AllocateBufferDesc& allocateBufferDesc) {
     RETURN_ON_BAD_HRESULT(&m_Device, hr, "D3D12MA::CreateResource");
 #endif
 
+    m_Device.Count(Counter::MEMORY_ALLOCATION);
+
     m_Desc = allocateBufferDesc.desc;
 
     D3D12_HEAP_PROPERTIES heapProps = {};
@@ -172,6 +229,8 @@ Result TextureD3D12::Create(const AllocateTextureDesc& allocateTextureDesc) {
     RETURN_ON_BAD_HRESULT(&m_Device, hr, "D3D12MA::CreateResource");
 #endif
 
+    m_Device.Count(Counter::MEMORY_ALLOCATION);
+
     // Priority
     D3D12_RESIDENCY_PRIORITY residencyPriority = (D3D12_RESIDENCY_PRIORITY)ConvertPriority(allocateTextureDesc.memoryPriority);
     if (residencyPriority != 0) {
@@ -195,7 +254,7 @@ Result AccelerationStructureD3D12::Create(const AllocateAccelerationStructureDes
     bufferDesc.desc.size = m_PrebuildInfo.ResultDataMaxSizeInBytes;
     bufferDesc.desc.usage = BufferUsageBits::ACCELERATION_STRUCTURE_STORAGE;
 
-    return m_Device.CreateImplementation<BufferD3D12>(m_Buffer, bufferDesc);
+    return m_Device.CreateInternalImplementation<BufferD3D12>(m_Buffer, bufferDesc);
 }
 
 Result MicromapD3D12::Create(const AllocateMicromapDesc& allocateMicromapDesc) {
@@ -208,5 +267,5 @@ Result MicromapD3D12::Create(const AllocateMicromapDesc& allocateMicromapDesc) {
     bufferDesc.desc.size = m_PrebuildInfo.ResultDataMaxSizeInBytes;
     bufferDesc.desc.usage = BufferUsageBits::MICROMAP_STORAGE;
 
-    return m_Device.CreateImplementation<BufferD3D12>(m_Buffer, bufferDesc);
+    return m_Device.CreateInternalImplementation<BufferD3D12>(m_Buffer, bufferDesc);
 }
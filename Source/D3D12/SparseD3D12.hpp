@@ -0,0 +1,168 @@
+// © 2025 NVIDIA Corporation
+
+constexpr uint64_t SPARSE_TILE_SIZE = D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+
+Result BufferD3D12::Create(const SparseBufferDesc& sparseBufferDesc) {
+    RETURN_ON_FAILURE(&m_Device, m_Device.GetTiledResourcesTier(), Result::UNSUPPORTED, "tiled resources are not supported");
+
+    m_Desc = sparseBufferDesc.desc;
+
+#if NRI_ENABLE_AGILITY_SDK_SUPPORT
+    D3D12_RESOURCE_DESC desc = {};
+    m_Device.GetResourceDesc(m_Desc, desc);
+
+    HRESULT hr = m_Device->CreateReservedResource2(&desc, D3D12_BARRIER_LAYOUT_UNDEFINED, nullptr, nullptr, NO_CASTABLE_FORMATS, IID_PPV_ARGS(&m_Buffer));
+    RETURN_ON_BAD_HRESULT(&m_Device, hr, "ID3D12Device10::CreateReservedResource2");
+#else
+    D3D12_RESOURCE_DESC desc = {};
+    m_Device.GetResourceDesc(m_Desc, desc);
+
+    D3D12_RESOURCE_STATES initialState = D3D12_RESOURCE_STATE_COMMON;
+    if (m_Desc.usage & BufferUsageBits::ACCELERATION_STRUCTURE_STORAGE)
+        initialState |= D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE;
+
+    HRESULT hr = m_Device->CreateReservedResource(&desc, initialState, nullptr, IID_PPV_ARGS(&m_Buffer));
+    RETURN_ON_BAD_HRESULT(&m_Device, hr, "ID3D12Device::CreateReservedResource");
+#endif
+
+    return Result::SUCCESS;
+}
+
+void BufferD3D12::GetSparseTiling(SparseTiling& sparseTiling) const {
+    sparseTiling = {};
+    sparseTiling.tileSize = SPARSE_TILE_SIZE;
+    sparseTiling.tileNum = (uint32_t)((m_Desc.size + SPARSE_TILE_SIZE - 1) / SPARSE_TILE_SIZE);
+    sparseTiling.tileWidth = (uint32_t)SPARSE_TILE_SIZE;
+    sparseTiling.tileHeight = 1;
+    sparseTiling.tileDepth = 1;
+}
+
+Result TextureD3D12::Create(const SparseTextureDesc& sparseTextureDesc) {
+    RETURN_ON_FAILURE(&m_Device, m_Device.GetTiledResourcesTier(), Result::UNSUPPORTED, "tiled resources are not supported");
+    RETURN_ON_FAILURE(&m_Device, sparseTextureDesc.desc.type != TextureType::TEXTURE_3D || m_Device.GetTiledResourcesTier() >= D3D12_TILED_RESOURCES_TIER_3, Result::UNSUPPORTED, "tiled 3D textures require 'D3D12_TILED_RESOURCES_TIER_3'");
+
+    m_Desc = FixTextureDesc(sparseTextureDesc.desc);
+
+    D3D12_RESOURCE_DESC desc = {};
+    m_Device.GetResourceDesc(m_Desc, desc);
+    desc.Layout = D3D12_TEXTURE_LAYOUT_64KB_UNDEFINED_SWIZZLE;
+
+#ifdef NRI_D3D12_HAS_TIGHT_ALIGNMENT
+    desc.Flags &= ~D3D12_RESOURCE_FLAG_USE_TIGHT_ALIGNMENT;
+#endif
+
+#if NRI_ENABLE_AGILITY_SDK_SUPPORT
+    HRESULT hr = m_Device->CreateReservedResource2(&desc, D3D12_BARRIER_LAYOUT_COMMON, nullptr, nullptr, NO_CASTABLE_FORMATS, IID_PPV_ARGS(&m_Texture));
+    RETURN_ON_BAD_HRESULT(&m_Device, hr, "ID3D12Device10::CreateReservedResource2");
+#else
+    HRESULT hr = m_Device->CreateReservedResource(&desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&m_Texture));
+    RETURN_ON_BAD_HRESULT(&m_Device, hr, "ID3D12Device::CreateReservedResource");
+#endif
+
+    // Tiling
+    UINT tileNum = 0;
+    UINT subresourceTilingNum = 0;
+    D3D12_PACKED_MIP_INFO packedMipInfo = {};
+    D3D12_TILE_SHAPE tileShape = {};
+    m_Device->GetResourceTiling(m_Texture, &tileNum, &packedMipInfo, &tileShape, &subresourceTilingNum, 0, nullptr);
+
+    m_SparseTiling.tileSize = SPARSE_TILE_SIZE;
+    m_SparseTiling.tileNum = tileNum;
+    m_SparseTiling.tileWidth = tileShape.WidthInTexels;
+    m_SparseTiling.tileHeight = tileShape.HeightInTexels;
+    m_SparseTiling.tileDepth = tileShape.DepthInTexels;
+    m_SparseTiling.mipTailFirst = packedMipInfo.NumPackedMips ? packedMipInfo.NumStandardMips : m_Desc.mipNum;
+    m_SparseTiling.mipTailTileNum = packedMipInfo.NumTilesForPackedMips;
+    m_SparseTiling.isMipTailShared = false; // packed mips are per array slice
+
+    return Result::SUCCESS;
+}
+
+NRI_INLINE Result QueueD3D12::BindSparse(const QueueBindSparseDesc& queueBindSparseDesc) {
+    TRACE_SCOPE(&m_Device, "QueueBindSparse");
+    m_Device.Count(Counter::QUEUE_SUBMIT);
+
+    for (uint32_t i = 0; i < queueBindSparseDesc.waitFenceNum; i++) {
+        const FenceSubmitDesc& fenceSubmitDesc = queueBindSparseDesc.waitFences[i];
+        FenceD3D12* fence = (FenceD3D12*)fenceSubmitDesc.fence;
+        fence->QueueWait(*this, fenceSubmitDesc.value);
+    }
+
+    // A single range per bind: tiles get mapped to consecutive tiles in the heap
+    const D3D12_TILE_RANGE_FLAGS nullRangeFlags = D3D12_TILE_RANGE_FLAG_NULL;
+
+    for (uint32_t i = 0; i < queueBindSparseDesc.bufferBindNum; i++) {
+        const SparseBufferBindDesc& bufferBindDesc = queueBindSparseDesc.bufferBinds[i];
+        const MemoryD3D12* memory = (MemoryD3D12*)bufferBindDesc.memory;
+        CHECK(!memory || !memory->IsDummy(), "Tiles can't be mapped to a committed memory");
+
+        D3D12_TILED_RESOURCE_COORDINATE coordinate = {};
+        coordinate.X = (UINT)(bufferBindDesc.offset / SPARSE_TILE_SIZE);
+
+        D3D12_TILE_REGION_SIZE regionSize = {};
+        regionSize.NumTiles = (UINT)(bufferBindDesc.size / SPARSE_TILE_SIZE);
+
+        UINT heapRangeStartOffset = (UINT)(bufferBindDesc.memoryOffset / SPARSE_TILE_SIZE);
+        ID3D12Resource* resource = *(BufferD3D12*)bufferBindDesc.buffer;
+
+        m_Queue->UpdateTileMappings(resource, 1, &coordinate, &regionSize, memory ? (ID3D12Heap*)*memory : nullptr, 1, memory ? nullptr : &nullRangeFlags, &heapRangeStartOffset, &regionSize.NumTiles, D3D12_TILE_MAPPING_FLAG_NONE);
+    }
+
+    for (uint32_t i = 0; i < queueBindSparseDesc.textureBindNum; i++) {
+        const SparseTextureBindDesc& textureBindDesc = queueBindSparseDesc.textureBinds[i];
+        const TextureD3D12& texture = *(TextureD3D12*)textureBindDesc.texture;
+        const TextureRegionDesc& region = textureBindDesc.region;
+        const MemoryD3D12* memory = (MemoryD3D12*)textureBindDesc.memory;
+        CHECK(!memory || !memory->IsDummy(), "Tiles can't be mapped to a committed memory");
+
+        D3D12_TILED_RESOURCE_COORDINATE coordinate = {};
+        coordinate.X = region.x;
+        coordinate.Y = region.y;
+        coordinate.Z = region.z;
+        coordinate.Subresource = region.mipOffset + region.layerOffset * texture.GetDesc().mipNum;
+
+        D3D12_TILE_REGION_SIZE regionSize = {};
+        regionSize.NumTiles = region.width * region.height * region.depth;
+        regionSize.UseBox = TRUE;
+        regionSize.Width = region.width;
+        regionSize.Height = region.height;
+        regionSize.Depth = region.depth;
+
+        UINT heapRangeStartOffset = (UINT)(textureBindDesc.memoryOffset / SPARSE_TILE_SIZE);
+        ID3D12Resource* resource = texture;
+
+        m_Queue->UpdateTileMappings(resource, 1, &coordinate, &regionSize, memory ? (ID3D12Heap*)*memory : nullptr, 1, memory ? nullptr : &nullRangeFlags, &heapRangeStartOffset, &regionSize.NumTiles, D3D12_TILE_MAPPING_FLAG_NONE);
+    }
+
+    for (uint32_t i = 0; i < queueBindSparseDesc.mipTailBindNum; i++) {
+        const SparseMipTailBindDesc& mipTailBindDesc = queueBindSparseDesc.mipTailBinds[i];
+        const TextureD3D12& texture = *(TextureD3D12*)mipTailBindDesc.texture;
+        const SparseTiling& tiling = texture.GetSparseTiling();
+        const MemoryD3D12* memory = (MemoryD3D12*)mipTailBindDesc.memory;
+        CHECK(!memory || !memory->IsDummy(), "Tiles can't be mapped to a committed memory");
+
+        // Packed mips are addressed by the first packed subresource of the slice and a tile index
+        D3D12_TILED_RESOURCE_COORDINATE coordinate = {};
+        coordinate.Subresource = tiling.mipTailFirst + mipTailBindDesc.layer * texture.GetDesc().mipNum;
+
+        D3D12_TILE_REGION_SIZE regionSize = {};
+        regionSize.NumTiles = tiling.mipTailTileNum;
+
+        UINT heapRangeStartOffset = (UINT)(mipTailBindDesc.memoryOffset / SPARSE_TILE_SIZE);
+        ID3D12Resource* resource = texture;
+
+        m_Queue->UpdateTileMappings(resource, 1, &coordinate, &regionSize, memory ? (ID3D12Heap*)*memory : nullptr, 1, memory ? nullptr : &nullRangeFlags, &heapRangeStartOffset, &regionSize.NumTiles, D3D12_TILE_MAPPING_FLAG_NONE);
+    }
+
+    for (uint32_t i = 0; i < queueBindSparseDesc.signalFenceNum; i++) {
+        const FenceSubmitDesc& fenceSubmitDesc = queueBindSparseDesc.signalFences[i];
+        FenceD3D12* fence = (FenceD3D12*)fenceSubmitDesc.fence;
+        fence->QueueSignal(*this, fenceSubmitDesc.value);
+    }
+
+    // Is device lost?
+    HRESULT hr = m_Device->GetDeviceRemovedReason() == S_OK ? S_OK : DXGI_ERROR_DEVICE_REMOVED;
+    RETURN_ON_BAD_HRESULT(&m_Device, hr, "BindSparse");
+
+    return Result::SUCCESS;
+}
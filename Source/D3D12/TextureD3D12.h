@@ -51,9 +51,14 @@ struct TextureD3D12 final : public DebugNameBase {
         return GetDimension(GraphicsAPI::D3D12, m_Desc, dimensionIndex, mip);
     }
 
+    inline const SparseTiling& GetSparseTiling() const {
+        return m_SparseTiling;
+    }
+
     Result Create(const TextureDesc& textureDesc);
     Result Create(const TextureD3D12Desc& textureD3D12Desc);
     Result Create(const AllocateTextureDesc& allocateTextureDesc);
+    Result Create(const SparseTextureDesc& sparseTextureDesc);
     Result BindMemory(const MemoryD3D12* memory, uint64_t offset);
 
     //================================================================================================================
@@ -64,11 +69,18 @@ struct TextureD3D12 final : public DebugNameBase {
         SET_D3D_DEBUG_OBJECT_NAME(m_Texture, name);
     }
 
+    //================================================================================================================
+    // NRI
+    //================================================================================================================
+
+    Result SetPriority(float priority);
+
 private:
     DeviceD3D12& m_Device;
     ComPtr<ID3D12ResourceBest> m_Texture;
     ComPtr<D3D12MA::Allocation> m_VmaAllocation = nullptr;
     TextureDesc m_Desc = {};
+    SparseTiling m_SparseTiling = {}; // only for sparse textures
 };
 
 } // namespace nri
@@ -80,3 +80,11 @@ Result TextureD3D12::BindMemory(const MemoryD3D12* memory, uint64_t offset) {
 
     return Result::SUCCESS;
 }
+
+NRI_INLINE Result TextureD3D12::SetPriority(float priority) {
+    // The resource gets created in "Bind[Buffer/Texture]Memory"
+    if (!m_Texture)
+        return Result::UNSUPPORTED;
+
+    return m_Device.SetResidencyPriority(m_Texture.GetInterface(), priority);
+}
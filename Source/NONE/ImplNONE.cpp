@@ -2,6 +2,13 @@
 
 #include "SharedExternal.h"
 
+#include "HeadlessSwapChain.h"
+#include "HelperInterface.h"
+#include "MicromapBakerInterface.h"
+#include "RenderGraphInterface.h"
+#include "ResidencyInterface.h"
+#include "SparseInterface.h"
+
 using namespace nri;
 
 template <typename T>
@@ -157,11 +164,17 @@ struct DeviceNONE final : public DeviceBase {
         memset(&m_Desc.tiers, 0xFF, sizeof(m_Desc.tiers));
         memset(&m_Desc.features, 0xFF, sizeof(m_Desc.features));
         memset(&m_Desc.shaderFeatures, 0xFF, sizeof(m_Desc.shaderFeatures));
+
+        FillFunctionTable(m_iCore);
     }
 
     inline ~DeviceNONE() {
     }
 
+    inline const CoreInterface& GetCoreInterface() const {
+        return m_iCore;
+    }
+
     //================================================================================================================
     // DeviceBase
     //================================================================================================================
@@ -176,12 +189,19 @@ struct DeviceNONE final : public DeviceBase {
 
     Result FillFunctionTable(CoreInterface& table) const override;
     Result FillFunctionTable(HelperInterface& table) const override;
+    Result FillFunctionTable(IndirectCommandsInterface& table) const override;
     Result FillFunctionTable(LowLatencyInterface& table) const override;
     Result FillFunctionTable(MeshShaderInterface& table) const override;
+    Result FillFunctionTable(MicromapBakerInterface& table) const override;
+    Result FillFunctionTable(ProfilerInterface& table) const override;
     Result FillFunctionTable(RayTracingInterface& table) const override;
+    Result FillFunctionTable(RenderGraphInterface& table) const override;
+    Result FillFunctionTable(ResidencyInterface& table) const override;
     Result FillFunctionTable(ResourceAllocatorInterface& table) const override;
+    Result FillFunctionTable(SparseInterface& table) const override;
     Result FillFunctionTable(StreamerInterface& table) const override;
     Result FillFunctionTable(SwapChainInterface& table) const override;
+    Result FillFunctionTable(TraceInterface& table) const override;
     Result FillFunctionTable(UpscalerInterface& table) const override;
 
 #if NRI_ENABLE_IMGUI_EXTENSION
@@ -190,6 +210,99 @@ struct DeviceNONE final : public DeviceBase {
 
 private:
     DeviceDesc m_Desc = {};
+    CoreInterface m_iCore = {}; // for shared implementations
+};
+
+// Sparse resources are real objects, which makes "SparsePageTable" testable on CPU
+constexpr uint64_t SPARSE_TILE_SIZE_NONE = 64 * 1024;
+constexpr uint32_t SPARSE_TILE_DIM_NONE = 128;
+constexpr uint32_t SPARSE_BUFFER_TAG_NONE = 0x53425546;  // "SBUF"
+constexpr uint32_t SPARSE_TEXTURE_TAG_NONE = 0x53544558; // "STEX"
+
+struct SparseBufferNONE {
+    inline SparseBufferNONE(DeviceNONE& device, const BufferDesc& desc)
+        : m_Device(device)
+        , m_Desc(desc) {
+    }
+
+    inline DeviceNONE& GetDevice() const {
+        return m_Device;
+    }
+
+    inline const BufferDesc& GetDesc() const {
+        return m_Desc;
+    }
+
+    inline bool IsSparse() const {
+        return m_Tag == SPARSE_BUFFER_TAG_NONE;
+    }
+
+private:
+    uint32_t m_Tag = SPARSE_BUFFER_TAG_NONE; // must be the 1st member
+    DeviceNONE& m_Device;
+    BufferDesc m_Desc = {};
+};
+
+struct SparseTextureNONE {
+    inline SparseTextureNONE(DeviceNONE& device, const TextureDesc& desc)
+        : m_Device(device)
+        , m_Desc(FixTextureDesc(desc)) {
+    }
+
+    inline DeviceNONE& GetDevice() const {
+        return m_Device;
+    }
+
+    inline const TextureDesc& GetDesc() const {
+        return m_Desc;
+    }
+
+    inline bool IsSparse() const {
+        return m_Tag == SPARSE_TEXTURE_TAG_NONE;
+    }
+
+private:
+    uint32_t m_Tag = SPARSE_TEXTURE_TAG_NONE; // must be the 1st member
+    DeviceNONE& m_Device;
+    TextureDesc m_Desc = {};
+};
+
+// Buffers and textures are "DummyObject"s (can't be dereferenced), unless created by "CreateSparse[Resource]"
+static inline const SparseBufferNONE* GetSparseBuffer(const Buffer* buffer) {
+    const SparseBufferNONE* sparseBuffer = (const SparseBufferNONE*)buffer;
+    if (!buffer || buffer == DummyObject<Buffer>() || !sparseBuffer->IsSparse())
+        return nullptr;
+
+    return sparseBuffer;
+}
+
+static inline const SparseTextureNONE* GetSparseTexture(const Texture* texture) {
+    const SparseTextureNONE* sparseTexture = (const SparseTextureNONE*)texture;
+    if (!texture || texture == DummyObject<Texture>() || !sparseTexture->IsSparse())
+        return nullptr;
+
+    return sparseTexture;
+}
+
+// Command signatures are real objects with the same layout rules, i.e. argument buffer layouts can be tested on CPU
+struct CommandSignatureNONE {
+    inline CommandSignatureNONE(DeviceNONE& device, const CommandSignatureDesc& commandSignatureDesc)
+        : m_Device(device)
+        , m_Layout(device.GetStdAllocator()) {
+        m_Layout.Init(commandSignatureDesc);
+    }
+
+    inline DeviceNONE& GetDevice() const {
+        return m_Device;
+    }
+
+    inline const CommandSignatureLayout& GetLayout() const {
+        return m_Layout;
+    }
+
+private:
+    DeviceNONE& m_Device;
+    CommandSignatureLayout m_Layout;
 };
 
 Result CreateDeviceNONE(const DeviceCreationDesc& desc, DeviceBase*& device) {
@@ -214,16 +327,20 @@ static const DeviceDesc& NRI_CALL GetDeviceDesc(const Device& device) {
     return ((DeviceNONE&)device).GetDesc();
 }
 
-static const BufferDesc& NRI_CALL GetBufferDesc(const Buffer&) {
+static const BufferDesc& NRI_CALL GetBufferDesc(const Buffer& buffer) {
     static const BufferDesc bufferDesc = {1};
 
-    return bufferDesc;
+    const SparseBufferNONE* sparseBuffer = GetSparseBuffer(&buffer);
+
+    return sparseBuffer ? sparseBuffer->GetDesc() : bufferDesc;
 }
 
-static const TextureDesc& NRI_CALL GetTextureDesc(const Texture&) {
+static const TextureDesc& NRI_CALL GetTextureDesc(const Texture& texture) {
     static const TextureDesc textureDesc = {TextureType::TEXTURE_1D, TextureUsageBits::NONE, Format::R8_UNORM, 1, 1, 1, 1, 1, 1};
 
-    return textureDesc;
+    const SparseTextureNONE* sparseTexture = GetSparseTexture(&texture);
+
+    return sparseTexture ? sparseTexture->GetDesc() : textureDesc;
 }
 
 static FormatSupportBits NRI_CALL GetFormatSupport(const Device&, Format) {
@@ -238,6 +355,14 @@ static uint64_t NRI_CALL GetFenceValue(Fence&) {
     return 0;
 }
 
+static uint64_t NRI_CALL GetBufferDeviceAddress(const Buffer&) {
+    return 0;
+}
+
+static void NRI_CALL GetDeviceStatistics(const Device& device, DeviceStatistics& deviceStatistics) {
+    ((const DeviceBase&)device).GetStatistics(deviceStatistics);
+}
+
 static void NRI_CALL GetBufferMemoryDesc(const Buffer&, MemoryLocation, MemoryDesc& memoryDesc) {
     memoryDesc = {1};
 }
@@ -359,10 +484,16 @@ static void NRI_CALL DestroyCommandBuffer(CommandBuffer*) {
 static void NRI_CALL DestroyDescriptorPool(DescriptorPool*) {
 }
 
-static void NRI_CALL DestroyBuffer(Buffer*) {
+static void NRI_CALL DestroyBuffer(Buffer* buffer) {
+    const SparseBufferNONE* sparseBuffer = GetSparseBuffer(buffer);
+    if (sparseBuffer)
+        Destroy((SparseBufferNONE*)sparseBuffer);
 }
 
-static void NRI_CALL DestroyTexture(Texture*) {
+static void NRI_CALL DestroyTexture(Texture* texture) {
+    const SparseTextureNONE* sparseTexture = GetSparseTexture(texture);
+    if (sparseTexture)
+        Destroy((SparseTextureNONE*)sparseTexture);
 }
 
 static void NRI_CALL DestroyDescriptor(Descriptor*) {
@@ -452,6 +583,12 @@ static void NRI_CALL CmdSetShadingRate(CommandBuffer&, const ShadingRateDesc&) {
 static void NRI_CALL CmdSetDepthBias(CommandBuffer&, const DepthBiasDesc&) {
 }
 
+static Result NRI_CALL CreateTransientAttachmentView(CommandBuffer&, const Texture2DViewDesc&, Descriptor*& textureView) {
+    textureView = DummyObject<Descriptor>();
+
+    return Result::SUCCESS;
+}
+
 static void NRI_CALL CmdBeginRendering(CommandBuffer&, const AttachmentsDesc&) {
 }
 
@@ -491,6 +628,15 @@ static void NRI_CALL CmdUploadBufferToTexture(CommandBuffer&, Texture&, const Te
 static void NRI_CALL CmdReadbackTextureToBuffer(CommandBuffer&, Buffer&, const TextureDataLayoutDesc&, const Texture&, const TextureRegionDesc&) {
 }
 
+static void NRI_CALL CmdCopyBufferRegions(CommandBuffer&, Buffer&, const Buffer&, const BufferCopyRegionDesc*, uint32_t) {
+}
+
+static void NRI_CALL CmdUploadBufferToTextureRegions(CommandBuffer&, Texture&, const Buffer&, const TextureBufferCopyRegionDesc*, uint32_t) {
+}
+
+static void NRI_CALL CmdReadbackTextureToBufferRegions(CommandBuffer&, Buffer&, const Texture&, const TextureBufferCopyRegionDesc*, uint32_t) {
+}
+
 static void NRI_CALL CmdZeroBuffer(CommandBuffer&, Buffer&, uint64_t, uint64_t) {
 }
 
@@ -663,6 +809,7 @@ Result DeviceNONE::FillFunctionTable(CoreInterface& table) const {
     table.CmdSetSampleLocations = ::CmdSetSampleLocations;
     table.CmdSetShadingRate = ::CmdSetShadingRate;
     table.CmdSetDepthBias = ::CmdSetDepthBias;
+    table.CreateTransientAttachmentView = ::CreateTransientAttachmentView;
     table.CmdBeginRendering = ::CmdBeginRendering;
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
@@ -676,6 +823,9 @@ Result DeviceNONE::FillFunctionTable(CoreInterface& table) const {
     table.CmdCopyTexture = ::CmdCopyTexture;
     table.CmdUploadBufferToTexture = ::CmdUploadBufferToTexture;
     table.CmdReadbackTextureToBuffer = ::CmdReadbackTextureToBuffer;
+    table.CmdCopyBufferRegions = ::CmdCopyBufferRegions;
+    table.CmdUploadBufferToTextureRegions = ::CmdUploadBufferToTextureRegions;
+    table.CmdReadbackTextureToBufferRegions = ::CmdReadbackTextureToBufferRegions;
     table.CmdZeroBuffer = ::CmdZeroBuffer;
     table.CmdResolveTexture = ::CmdResolveTexture;
     table.CmdClearStorage = ::CmdClearStorage;
@@ -696,6 +846,8 @@ Result DeviceNONE::FillFunctionTable(CoreInterface& table) const {
     table.QueueSubmit = ::QueueSubmit;
     table.Wait = ::Wait;
     table.GetFenceValue = ::GetFenceValue;
+    table.GetBufferDeviceAddress = ::GetBufferDeviceAddress;
+    table.GetDeviceStatistics = ::GetDeviceStatistics;
     table.UpdateDescriptorRanges = ::UpdateDescriptorRanges;
     table.UpdateDynamicConstantBuffers = ::UpdateDynamicConstantBuffers;
     table.CopyDescriptorSet = ::CopyDescriptorSet;
@@ -728,6 +880,19 @@ static Result NRI_CALL AllocateAndBindMemory(Device&, const ResourceGroupDesc&,
     return Result::SUCCESS;
 }
 
+static Result NRI_CALL CreateResourceGroup(Device&, const ResourceGroupCreationDesc& resourceGroupCreationDesc, Texture** textures, Buffer** buffers, Memory**, uint32_t& allocationNum, uint64_t& allocationSize) {
+    for (uint32_t i = 0; i < resourceGroupCreationDesc.textureNum; i++)
+        textures[i] = DummyObject<Texture>();
+
+    for (uint32_t i = 0; i < resourceGroupCreationDesc.bufferNum; i++)
+        buffers[i] = DummyObject<Buffer>();
+
+    allocationNum = 0;
+    allocationSize = 0;
+
+    return Result::SUCCESS;
+}
+
 static Result NRI_CALL UploadData(Queue&, const TextureUploadDesc*, uint32_t, const BufferUploadDesc*, uint32_t) {
     return Result::SUCCESS;
 }
@@ -738,11 +903,87 @@ static Result NRI_CALL QueryVideoMemoryInfo(const Device&, MemoryLocation, Video
     return Result::SUCCESS;
 }
 
+static Result NRI_CALL CreateMemoryPool(Device& device, const MemoryPoolDesc& memoryPoolDesc, MemoryPool*& memoryPool) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    MemoryPoolImpl* impl = Allocate<MemoryPoolImpl>(deviceNONE.GetAllocationCallbacks(), device, deviceNONE.GetCoreInterface());
+    Result result = impl->Create(memoryPoolDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        memoryPool = nullptr;
+    } else
+        memoryPool = (MemoryPool*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyMemoryPool(MemoryPool* memoryPool) {
+    Destroy((MemoryPoolImpl*)memoryPool);
+}
+
+static Result NRI_CALL AllocatePooledBufferMemory(MemoryPool& memoryPool, Buffer& buffer, MemoryLocation memoryLocation, uint32_t& allocation) {
+    return ((MemoryPoolImpl&)memoryPool).AllocateBufferMemory(buffer, memoryLocation, allocation);
+}
+
+static Result NRI_CALL AllocatePooledTextureMemory(MemoryPool& memoryPool, Texture& texture, MemoryLocation memoryLocation, uint32_t& allocation) {
+    return ((MemoryPoolImpl&)memoryPool).AllocateTextureMemory(texture, memoryLocation, allocation);
+}
+
+static void NRI_CALL FreePooledMemory(MemoryPool& memoryPool, uint32_t allocation) {
+    ((MemoryPoolImpl&)memoryPool).Free(allocation);
+}
+
+static void NRI_CALL GetMemoryPoolStatistics(const MemoryPool& memoryPool, MemoryPoolStatistics& memoryPoolStatistics) {
+    ((MemoryPoolImpl&)memoryPool).GetStatistics(memoryPoolStatistics);
+}
+
+static Result NRI_CALL CreateTexturePool(Device& device, const TexturePoolDesc& texturePoolDesc, TexturePool*& texturePool) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    TexturePoolImpl* impl = Allocate<TexturePoolImpl>(deviceNONE.GetAllocationCallbacks(), device, deviceNONE.GetCoreInterface());
+    Result result = impl->Create(texturePoolDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        texturePool = nullptr;
+    } else
+        texturePool = (TexturePool*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyTexturePool(TexturePool* texturePool) {
+    Destroy((TexturePoolImpl*)texturePool);
+}
+
+static Result NRI_CALL AcquirePooledTexture(TexturePool& texturePool, const TextureDesc& textureDesc, PooledTexture& pooledTexture) {
+    return ((TexturePoolImpl&)texturePool).Acquire(textureDesc, pooledTexture);
+}
+
+static void NRI_CALL ReleasePooledTexture(TexturePool& texturePool, uint32_t handle, Fence* fence, uint64_t value) {
+    ((TexturePoolImpl&)texturePool).Release(handle, fence, value);
+}
+
+static void NRI_CALL GetTexturePoolStatistics(const TexturePool& texturePool, TexturePoolStatistics& texturePoolStatistics) {
+    ((TexturePoolImpl&)texturePool).GetStatistics(texturePoolStatistics);
+}
+
 Result DeviceNONE::FillFunctionTable(HelperInterface& table) const {
     table.CalculateAllocationNumber = ::CalculateAllocationNumber;
     table.AllocateAndBindMemory = ::AllocateAndBindMemory;
+    table.CreateResourceGroup = ::CreateResourceGroup;
     table.UploadData = ::UploadData;
     table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.CreateMemoryPool = ::CreateMemoryPool;
+    table.DestroyMemoryPool = ::DestroyMemoryPool;
+    table.AllocatePooledBufferMemory = ::AllocatePooledBufferMemory;
+    table.AllocatePooledTextureMemory = ::AllocatePooledTextureMemory;
+    table.FreePooledMemory = ::FreePooledMemory;
+    table.GetMemoryPoolStatistics = ::GetMemoryPoolStatistics;
+    table.CreateTexturePool = ::CreateTexturePool;
+    table.DestroyTexturePool = ::DestroyTexturePool;
+    table.AcquirePooledTexture = ::AcquirePooledTexture;
+    table.ReleasePooledTexture = ::ReleasePooledTexture;
+    table.GetTexturePoolStatistics = ::GetTexturePoolStatistics;
 
     return Result::SUCCESS;
 }
@@ -782,22 +1023,78 @@ Result DeviceNONE::FillFunctionTable(ImguiInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  IndirectCommands  ]
+
+static Result NRI_CALL CreateCommandSignature(Device& device, const CommandSignatureDesc& commandSignatureDesc, CommandSignature*& commandSignature) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    commandSignature = (CommandSignature*)Allocate<CommandSignatureNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE, commandSignatureDesc);
+
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL DestroyCommandSignature(CommandSignature* commandSignature) {
+    Destroy((CommandSignatureNONE*)commandSignature);
+}
+
+static uint32_t NRI_CALL GetCommandSignatureStride(const CommandSignature& commandSignature) {
+    return ((CommandSignatureNONE&)commandSignature).GetLayout().stride;
+}
+
+static uint32_t NRI_CALL GetIndirectArgumentOffset(const CommandSignature& commandSignature, uint32_t argumentIndex) {
+    return ((CommandSignatureNONE&)commandSignature).GetLayout().argumentOffsets[argumentIndex];
+}
+
+static uint64_t NRI_CALL GetCommandSignaturePreprocessSize(const CommandSignature&, const Pipeline&, uint32_t) {
+    return 0;
+}
+
+static void NRI_CALL CmdExecuteIndirect(CommandBuffer&, const ExecuteIndirectDesc&) {
+}
+
+Result DeviceNONE::FillFunctionTable(IndirectCommandsInterface& table) const {
+    table.CreateCommandSignature = ::CreateCommandSignature;
+    table.DestroyCommandSignature = ::DestroyCommandSignature;
+    table.GetCommandSignatureStride = ::GetCommandSignatureStride;
+    table.GetIndirectArgumentOffset = ::GetIndirectArgumentOffset;
+    table.GetCommandSignaturePreprocessSize = ::GetCommandSignaturePreprocessSize;
+    table.CmdExecuteIndirect = ::CmdExecuteIndirect;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  LowLatency  ]
 
-static Result NRI_CALL SetLatencySleepMode(SwapChain&, const LatencySleepMode&) {
+static Result NRI_CALL SetLatencySleepMode(SwapChain& swapChain, const LatencySleepMode& latencySleepMode) {
+    if (&swapChain != DummyObject<SwapChain>())
+        return ((HeadlessSwapChain&)swapChain).SetLatencySleepMode(latencySleepMode);
+
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL SetLatencyMarker(SwapChain&, LatencyMarker) {
+static Result NRI_CALL SetLatencyMarker(SwapChain& swapChain, LatencyMarker latencyMarker) {
+    if (&swapChain != DummyObject<SwapChain>())
+        return ((HeadlessSwapChain&)swapChain).SetLatencyMarker(latencyMarker);
+
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL LatencySleep(SwapChain&) {
+static Result NRI_CALL LatencySleep(SwapChain& swapChain) {
+    if (&swapChain != DummyObject<SwapChain>())
+        return ((HeadlessSwapChain&)swapChain).LatencySleep();
+
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL GetLatencyReport(const SwapChain&, LatencyReport&) {
+static Result NRI_CALL GetLatencyReport(const SwapChain& swapChain, LatencyReport& latencyReport) {
+    if (&swapChain != DummyObject<SwapChain>())
+        return ((HeadlessSwapChain&)swapChain).GetLatencyReport(latencyReport);
+
+    latencyReport = {};
+
     return Result::SUCCESS;
 }
 
@@ -830,6 +1127,104 @@ Result DeviceNONE::FillFunctionTable(MeshShaderInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  MicromapBaker  ]
+
+static Result NRI_CALL CreateMicromapBaker(Device& device, const MicromapBakerDesc& micromapBakerDesc, MicromapBaker*& micromapBaker) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    MicromapBakerImpl* impl = Allocate<MicromapBakerImpl>(deviceNONE.GetAllocationCallbacks(), device);
+    Result result = impl->Create(micromapBakerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        micromapBaker = nullptr;
+    } else
+        micromapBaker = (MicromapBaker*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyMicromapBaker(MicromapBaker* micromapBaker) {
+    Destroy((MicromapBakerImpl*)micromapBaker);
+}
+
+static Result NRI_CALL BakeMicromap(MicromapBaker& micromapBaker, const MicromapBakeDesc& micromapBakeDesc, MicromapBakeResult& micromapBakeResult) {
+    return ((MicromapBakerImpl&)micromapBaker).Bake(micromapBakeDesc, micromapBakeResult);
+}
+
+Result DeviceNONE::FillFunctionTable(MicromapBakerInterface& table) const {
+    table.CreateMicromapBaker = ::CreateMicromapBaker;
+    table.DestroyMicromapBaker = ::DestroyMicromapBaker;
+    table.BakeMicromap = ::BakeMicromap;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Profiler  ]
+
+static Result NRI_CALL CreateProfiler(Device&, const ProfilerDesc&, Profiler*& profiler) {
+    profiler = DummyObject<Profiler>();
+
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL DestroyProfiler(Profiler*) {
+}
+
+static void NRI_CALL CmdBeginProfilerFrame(CommandBuffer&, Profiler&) {
+}
+
+static void NRI_CALL CmdEndProfilerFrame(CommandBuffer&, Profiler&) {
+}
+
+static void NRI_CALL CmdBeginProfilerRange(CommandBuffer&, Profiler&, const char*, uint32_t) {
+}
+
+static void NRI_CALL CmdEndProfilerRange(CommandBuffer&, Profiler&) {
+}
+
+static void NRI_CALL CmdBeginProfilerStatistics(CommandBuffer&, Profiler&, const char*) {
+}
+
+static void NRI_CALL CmdEndProfilerStatistics(CommandBuffer&, Profiler&) {
+}
+
+static void NRI_CALL EndProfilerFrame(Profiler&) {
+}
+
+static const ProfilerRange* NRI_CALL GetProfilerRanges(const Profiler&, uint32_t& rangeNum) {
+    rangeNum = 0;
+
+    return nullptr;
+}
+
+static const ProfilerStatistics* NRI_CALL GetProfilerStatistics(const Profiler&, uint32_t& statisticsNum) {
+    statisticsNum = 0;
+
+    return nullptr;
+}
+
+Result DeviceNONE::FillFunctionTable(ProfilerInterface& table) const {
+    table.CreateProfiler = ::CreateProfiler;
+    table.DestroyProfiler = ::DestroyProfiler;
+    table.CmdBeginProfilerFrame = ::CmdBeginProfilerFrame;
+    table.CmdEndProfilerFrame = ::CmdEndProfilerFrame;
+    table.CmdBeginProfilerRange = ::CmdBeginProfilerRange;
+    table.CmdEndProfilerRange = ::CmdEndProfilerRange;
+    table.CmdBeginProfilerStatistics = ::CmdBeginProfilerStatistics;
+    table.CmdEndProfilerStatistics = ::CmdEndProfilerStatistics;
+    table.EndProfilerFrame = ::EndProfilerFrame;
+    table.GetProfilerRanges = ::GetProfilerRanges;
+    table.GetProfilerStatistics = ::GetProfilerStatistics;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  RayTracing  ]
 
@@ -983,6 +1378,182 @@ Result DeviceNONE::FillFunctionTable(RayTracingInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  RenderGraph  ]
+
+// The shared implementation on top of no-op core functions, which makes culling, aliasing and barriers testable on CPU
+static Result NRI_CALL CreateRenderGraph(Device& device, const RenderGraphDesc& renderGraphDesc, RenderGraph*& renderGraph) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    RenderGraphImpl* impl = Allocate<RenderGraphImpl>(deviceNONE.GetAllocationCallbacks(), device, deviceNONE.GetCoreInterface());
+    Result result = impl->Create(renderGraphDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        renderGraph = nullptr;
+    } else
+        renderGraph = (RenderGraph*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyRenderGraph(RenderGraph* renderGraph) {
+    Destroy((RenderGraphImpl*)renderGraph);
+}
+
+static void NRI_CALL BeginRenderGraph(RenderGraph& renderGraph) {
+    ((RenderGraphImpl&)renderGraph).Begin();
+}
+
+static uint32_t NRI_CALL AddRenderGraphTexture(RenderGraph& renderGraph, const RenderGraphTextureDesc& renderGraphTextureDesc) {
+    return ((RenderGraphImpl&)renderGraph).AddTexture(renderGraphTextureDesc);
+}
+
+static uint32_t NRI_CALL AddRenderGraphBuffer(RenderGraph& renderGraph, const RenderGraphBufferDesc& renderGraphBufferDesc) {
+    return ((RenderGraphImpl&)renderGraph).AddBuffer(renderGraphBufferDesc);
+}
+
+static uint32_t NRI_CALL ImportRenderGraphTexture(RenderGraph& renderGraph, const RenderGraphImportedTextureDesc& renderGraphImportedTextureDesc) {
+    return ((RenderGraphImpl&)renderGraph).ImportTexture(renderGraphImportedTextureDesc);
+}
+
+static uint32_t NRI_CALL ImportRenderGraphBuffer(RenderGraph& renderGraph, const RenderGraphImportedBufferDesc& renderGraphImportedBufferDesc) {
+    return ((RenderGraphImpl&)renderGraph).ImportBuffer(renderGraphImportedBufferDesc);
+}
+
+static uint32_t NRI_CALL AddRenderGraphPass(RenderGraph& renderGraph, const RenderGraphPassDesc& renderGraphPassDesc) {
+    return ((RenderGraphImpl&)renderGraph).AddPass(renderGraphPassDesc);
+}
+
+static Result NRI_CALL CompileRenderGraph(RenderGraph& renderGraph) {
+    return ((RenderGraphImpl&)renderGraph).Compile();
+}
+
+static Texture* NRI_CALL GetRenderGraphTexture(const RenderGraph& renderGraph, uint32_t texture) {
+    return ((RenderGraphImpl&)renderGraph).GetTexture(texture);
+}
+
+static Buffer* NRI_CALL GetRenderGraphBuffer(const RenderGraph& renderGraph, uint32_t buffer) {
+    return ((RenderGraphImpl&)renderGraph).GetBuffer(buffer);
+}
+
+static const char* NRI_CALL GetRenderGraphDump(const RenderGraph& renderGraph) {
+    return ((RenderGraphImpl&)renderGraph).GetDump();
+}
+
+static CommandBuffer* const* NRI_CALL ExecuteRenderGraph(RenderGraph& renderGraph, const RenderGraphExecuteDesc& renderGraphExecuteDesc, uint32_t& commandBufferNum) {
+    return ((RenderGraphImpl&)renderGraph).Execute(renderGraphExecuteDesc, commandBufferNum);
+}
+
+static Result NRI_CALL SubmitRenderGraph(RenderGraph& renderGraph, const RenderGraphSubmitDesc& renderGraphSubmitDesc) {
+    return ((RenderGraphImpl&)renderGraph).Submit(renderGraphSubmitDesc);
+}
+
+static void NRI_CALL GetRenderGraphStatistics(const RenderGraph& renderGraph, RenderGraphStatistics& renderGraphStatistics) {
+    ((RenderGraphImpl&)renderGraph).GetStatistics(renderGraphStatistics);
+}
+
+Result DeviceNONE::FillFunctionTable(RenderGraphInterface& table) const {
+    table.CreateRenderGraph = ::CreateRenderGraph;
+    table.DestroyRenderGraph = ::DestroyRenderGraph;
+    table.BeginRenderGraph = ::BeginRenderGraph;
+    table.AddRenderGraphTexture = ::AddRenderGraphTexture;
+    table.AddRenderGraphBuffer = ::AddRenderGraphBuffer;
+    table.ImportRenderGraphTexture = ::ImportRenderGraphTexture;
+    table.ImportRenderGraphBuffer = ::ImportRenderGraphBuffer;
+    table.AddRenderGraphPass = ::AddRenderGraphPass;
+    table.CompileRenderGraph = ::CompileRenderGraph;
+    table.GetRenderGraphTexture = ::GetRenderGraphTexture;
+    table.GetRenderGraphBuffer = ::GetRenderGraphBuffer;
+    table.GetRenderGraphDump = ::GetRenderGraphDump;
+    table.ExecuteRenderGraph = ::ExecuteRenderGraph;
+    table.SubmitRenderGraph = ::SubmitRenderGraph;
+    table.GetRenderGraphStatistics = ::GetRenderGraphStatistics;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Residency  ]
+
+static Result NRI_CALL SetMemoryPriority(Memory&, float) {
+    return Result::SUCCESS;
+}
+
+static Result NRI_CALL SetBufferPriority(Buffer&, float) {
+    return Result::SUCCESS;
+}
+
+static Result NRI_CALL SetTexturePriority(Texture&, float) {
+    return Result::SUCCESS;
+}
+
+static Result NRI_CALL CreateResidencyManager(Device& device, const ResidencyManagerDesc& residencyManagerDesc, ResidencyManager*& residencyManager) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    ResidencyManagerImpl* impl = Allocate<ResidencyManagerImpl>(deviceNONE.GetAllocationCallbacks(), device);
+    Result result = impl->Create(residencyManagerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        residencyManager = nullptr;
+    } else
+        residencyManager = (ResidencyManager*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyResidencyManager(ResidencyManager* residencyManager) {
+    Destroy((ResidencyManagerImpl*)residencyManager);
+}
+
+static uint32_t NRI_CALL AddResidencyMemory(ResidencyManager& residencyManager, Memory& memory, float priority) {
+    return ((ResidencyManagerImpl&)residencyManager).Add(&memory, ResidencyObjectType::MEMORY, priority);
+}
+
+static uint32_t NRI_CALL AddResidencyBuffer(ResidencyManager& residencyManager, Buffer& buffer, float priority) {
+    return ((ResidencyManagerImpl&)residencyManager).Add(&buffer, ResidencyObjectType::BUFFER, priority);
+}
+
+static uint32_t NRI_CALL AddResidencyTexture(ResidencyManager& residencyManager, Texture& texture, float priority) {
+    return ((ResidencyManagerImpl&)residencyManager).Add(&texture, ResidencyObjectType::TEXTURE, priority);
+}
+
+static void NRI_CALL RemoveResidencyObject(ResidencyManager& residencyManager, uint32_t object) {
+    ((ResidencyManagerImpl&)residencyManager).Remove(object);
+}
+
+static void NRI_CALL MarkResidencyObjectUsed(ResidencyManager& residencyManager, uint32_t object) {
+    ((ResidencyManagerImpl&)residencyManager).MarkUsed(object);
+}
+
+static void NRI_CALL UpdateResidency(ResidencyManager& residencyManager) {
+    ((ResidencyManagerImpl&)residencyManager).Update();
+}
+
+static void NRI_CALL GetResidencyStatistics(const ResidencyManager& residencyManager, ResidencyStatistics& residencyStatistics) {
+    ((ResidencyManagerImpl&)residencyManager).GetStatistics(residencyStatistics);
+}
+
+Result DeviceNONE::FillFunctionTable(ResidencyInterface& table) const {
+    table.SetMemoryPriority = ::SetMemoryPriority;
+    table.SetBufferPriority = ::SetBufferPriority;
+    table.SetTexturePriority = ::SetTexturePriority;
+    table.CreateResidencyManager = ::CreateResidencyManager;
+    table.DestroyResidencyManager = ::DestroyResidencyManager;
+    table.AddResidencyMemory = ::AddResidencyMemory;
+    table.AddResidencyBuffer = ::AddResidencyBuffer;
+    table.AddResidencyTexture = ::AddResidencyTexture;
+    table.RemoveResidencyObject = ::RemoveResidencyObject;
+    table.MarkResidencyObjectUsed = ::MarkResidencyObjectUsed;
+    table.UpdateResidency = ::UpdateResidency;
+    table.GetResidencyStatistics = ::GetResidencyStatistics;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  ResourceAllocator  ]
 
@@ -1010,11 +1581,127 @@ static Result NRI_CALL AllocateMicromap(Device&, const AllocateMicromapDesc&, Mi
     return Result::FAILURE;
 }
 
+static Result NRI_CALL GetResourceAllocatorStatistics(const Device&, ResourceAllocatorHeapStatistics*, uint32_t& heapStatisticsNum) {
+    heapStatisticsNum = 0;
+
+    return Result::SUCCESS;
+}
+
+static Result NRI_CALL GetResourceAllocatorDump(const Device&, char* dump, uint64_t& dumpSize) {
+    if (dump && dumpSize)
+        dump[0] = '\0';
+
+    dumpSize = 1;
+
+    return Result::SUCCESS;
+}
+
 Result DeviceNONE::FillFunctionTable(ResourceAllocatorInterface& table) const {
     table.AllocateBuffer = ::AllocateBuffer;
     table.AllocateTexture = ::AllocateTexture;
     table.AllocateAccelerationStructure = ::AllocateAccelerationStructure;
     table.AllocateMicromap = ::AllocateMicromap;
+    table.GetResourceAllocatorStatistics = ::GetResourceAllocatorStatistics;
+    table.GetResourceAllocatorDump = ::GetResourceAllocatorDump;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Sparse  ]
+
+static Result NRI_CALL CreateSparseBuffer(Device& device, const SparseBufferDesc& sparseBufferDesc, Buffer*& buffer) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    buffer = (Buffer*)Allocate<SparseBufferNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE, sparseBufferDesc.desc);
+
+    return buffer ? Result::SUCCESS : Result::OUT_OF_MEMORY;
+}
+
+static Result NRI_CALL CreateSparseTexture(Device& device, const SparseTextureDesc& sparseTextureDesc, Texture*& texture) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    texture = (Texture*)Allocate<SparseTextureNONE>(deviceNONE.GetAllocationCallbacks(), deviceNONE, sparseTextureDesc.desc);
+
+    return texture ? Result::SUCCESS : Result::OUT_OF_MEMORY;
+}
+
+static void NRI_CALL GetSparseBufferTiling(const Buffer& buffer, SparseTiling& sparseTiling) {
+    const BufferDesc& bufferDesc = GetBufferDesc(buffer);
+
+    sparseTiling = {};
+    sparseTiling.tileSize = SPARSE_TILE_SIZE_NONE;
+    sparseTiling.tileNum = (uint32_t)((bufferDesc.size + SPARSE_TILE_SIZE_NONE - 1) / SPARSE_TILE_SIZE_NONE);
+    sparseTiling.tileWidth = (uint32_t)SPARSE_TILE_SIZE_NONE;
+    sparseTiling.tileHeight = 1;
+    sparseTiling.tileDepth = 1;
+}
+
+// A fixed tiling without a mip tail (NONE doesn't have formats with a size)
+static void NRI_CALL GetSparseTextureTiling(const Texture& texture, SparseTiling& sparseTiling) {
+    const TextureDesc& textureDesc = GetTextureDesc(texture);
+
+    sparseTiling = {};
+    sparseTiling.tileSize = SPARSE_TILE_SIZE_NONE;
+    sparseTiling.tileWidth = SPARSE_TILE_DIM_NONE;
+    sparseTiling.tileHeight = SPARSE_TILE_DIM_NONE;
+    sparseTiling.tileDepth = 1;
+    sparseTiling.mipTailFirst = textureDesc.mipNum;
+
+    for (Dim_t mip = 0; mip < textureDesc.mipNum; mip++) {
+        uint32_t w = (std::max(textureDesc.width >> mip, 1) + SPARSE_TILE_DIM_NONE - 1) / SPARSE_TILE_DIM_NONE;
+        uint32_t h = (std::max(textureDesc.height >> mip, 1) + SPARSE_TILE_DIM_NONE - 1) / SPARSE_TILE_DIM_NONE;
+        uint32_t d = std::max(textureDesc.depth >> mip, 1);
+
+        sparseTiling.tileNum += w * h * d * textureDesc.layerNum;
+    }
+}
+
+static Result NRI_CALL QueueBindSparse(Queue&, const QueueBindSparseDesc&) {
+    return Result::SUCCESS;
+}
+
+static Result NRI_CALL CreateSparsePageTable(Device& device, const SparsePageTableDesc& sparsePageTableDesc, SparsePageTable*& sparsePageTable) {
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    SparsePageTableImpl* impl = Allocate<SparsePageTableImpl>(deviceNONE.GetAllocationCallbacks(), device);
+    Result result = impl->Create(sparsePageTableDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        sparsePageTable = nullptr;
+    } else
+        sparsePageTable = (SparsePageTable*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroySparsePageTable(SparsePageTable* sparsePageTable) {
+    Destroy((SparsePageTableImpl*)sparsePageTable);
+}
+
+static void NRI_CALL UpdateSparsePageTable(SparsePageTable& sparsePageTable, const SparseTileMapping* tileMappings, uint32_t tileMappingNum) {
+    ((SparsePageTableImpl&)sparsePageTable).Update(tileMappings, tileMappingNum);
+}
+
+static uint32_t NRI_CALL GetSparsePageTableMappedTileNum(const SparsePageTable& sparsePageTable) {
+    return ((SparsePageTableImpl&)sparsePageTable).GetMappedTileNum();
+}
+
+static void NRI_CALL GetSparsePageTableBinds(SparsePageTable& sparsePageTable, QueueBindSparseDesc& queueBindSparseDesc) {
+    ((SparsePageTableImpl&)sparsePageTable).GetBinds(queueBindSparseDesc);
+}
+
+Result DeviceNONE::FillFunctionTable(SparseInterface& table) const {
+    table.CreateSparseBuffer = ::CreateSparseBuffer;
+    table.CreateSparseTexture = ::CreateSparseTexture;
+    table.GetSparseBufferTiling = ::GetSparseBufferTiling;
+    table.GetSparseTextureTiling = ::GetSparseTextureTiling;
+    table.QueueBindSparse = ::QueueBindSparse;
+    table.CreateSparsePageTable = ::CreateSparsePageTable;
+    table.DestroySparsePageTable = ::DestroySparsePageTable;
+    table.UpdateSparsePageTable = ::UpdateSparsePageTable;
+    table.GetSparsePageTableMappedTileNum = ::GetSparsePageTableMappedTileNum;
+    table.GetSparsePageTableBinds = ::GetSparsePageTableBinds;
 
     return Result::SUCCESS;
 }
@@ -1041,6 +1728,10 @@ static uint32_t NRI_CALL StreamConstantData(Streamer&, const void*, uint32_t) {
     return 0;
 }
 
+static uint64_t NRI_CALL StreamDeviceAddresses(Streamer&, const BufferOffset*, uint32_t) {
+    return 0;
+}
+
 static BufferOffset NRI_CALL StreamBufferData(Streamer&, const StreamBufferDataDesc&) {
     return {};
 }
@@ -1062,6 +1753,7 @@ Result DeviceNONE::FillFunctionTable(StreamerInterface& table) const {
     table.StreamBufferData = ::StreamBufferData;
     table.StreamTextureData = ::StreamTextureData;
     table.StreamConstantData = ::StreamConstantData;
+    table.StreamDeviceAddresses = ::StreamDeviceAddresses;
     table.EndStreamerFrame = ::EndStreamerFrame;
     table.CmdCopyStreamedData = ::CmdCopyStreamedData;
 
@@ -1073,42 +1765,90 @@ Result DeviceNONE::FillFunctionTable(StreamerInterface& table) const {
 //============================================================================================================================================================================================
 #pragma region[  SwapChain  ]
 
-static Result NRI_CALL CreateSwapChain(Device&, const SwapChainDesc&, SwapChain*& swapChain) {
+static Result NRI_CALL CreateSwapChain(Device& device, const SwapChainDesc& swapChainDesc, SwapChain*& swapChain) {
     swapChain = DummyObject<SwapChain>();
 
-    return Result::SUCCESS;
+    if (!swapChainDesc.window.headless.enable)
+        return Result::SUCCESS;
+
+    DeviceNONE& deviceNONE = (DeviceNONE&)device;
+    HeadlessSwapChain* impl = Allocate<HeadlessSwapChain>(deviceNONE.GetAllocationCallbacks(), device);
+    Result result = impl->Create(swapChainDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        swapChain = nullptr;
+    } else
+        swapChain = (SwapChain*)impl;
+
+    return result;
 }
 
-static void NRI_CALL DestroySwapChain(SwapChain*) {
+static void NRI_CALL DestroySwapChain(SwapChain* swapChain) {
+    if (swapChain != DummyObject<SwapChain>())
+        Destroy((HeadlessSwapChain*)swapChain);
 }
 
-static Texture* const* NRI_CALL GetSwapChainTextures(const SwapChain&, uint32_t& textureNum) {
+static Texture* const* NRI_CALL GetSwapChainTextures(const SwapChain& swapChain, uint32_t& textureNum) {
+    if (&swapChain != DummyObject<SwapChain>())
+        return ((HeadlessSwapChain&)swapChain).GetTextures(textureNum);
+
     static const void* textures[1] = {};
     textureNum = 1;
 
     return (Texture**)textures;
 }
 
-static Result NRI_CALL GetDisplayDesc(SwapChain&, DisplayDesc& displayDesc) {
+static Result NRI_CALL GetDisplayDesc(SwapChain& swapChain, DisplayDesc& displayDesc) {
+    if (&swapChain != DummyObject<SwapChain>())
+        return ((HeadlessSwapChain&)swapChain).GetDisplayDesc(displayDesc);
+
     displayDesc = {};
 
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL AcquireNextTexture(SwapChain&, Fence&, uint32_t& textureIndex) {
+static Result NRI_CALL AcquireNextTexture(SwapChain& swapChain, Fence&, uint32_t& textureIndex) {
+    if (&swapChain != DummyObject<SwapChain>())
+        return ((HeadlessSwapChain&)swapChain).AcquireNextTexture(nullptr, textureIndex);
+
     textureIndex = 0;
 
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL WaitForPresent(SwapChain&) {
+static Result NRI_CALL WaitForPresent(SwapChain& swapChain) {
+    if (&swapChain != DummyObject<SwapChain>())
+        return ((HeadlessSwapChain&)swapChain).WaitForPresent();
+
     return Result::SUCCESS;
 }
 
-static Result NRI_CALL QueuePresent(SwapChain&, Fence&) {
+static Result NRI_CALL QueuePresent(SwapChain& swapChain, Fence&) {
+    if (&swapChain != DummyObject<SwapChain>())
+        return ((HeadlessSwapChain&)swapChain).Present(nullptr);
+
     return Result::SUCCESS;
 }
 
+static Result NRI_CALL GetSwapChainStatistics(SwapChain& swapChain, SwapChainStatistics& swapChainStatistics) {
+    if (&swapChain != DummyObject<SwapChain>())
+        return ((HeadlessSwapChain&)swapChain).GetStatistics(swapChainStatistics);
+
+    swapChainStatistics = {};
+
+    return Result::SUCCESS;
+}
+
+static Result NRI_CALL GetPresentedFrame(SwapChain& swapChain, PresentedFrame& presentedFrame) {
+    if (&swapChain != DummyObject<SwapChain>())
+        return ((HeadlessSwapChain&)swapChain).GetPresentedFrame(presentedFrame);
+
+    presentedFrame = {};
+
+    return Result::UNSUPPORTED;
+}
+
 Result DeviceNONE::FillFunctionTable(SwapChainInterface& table) const {
     table.CreateSwapChain = ::CreateSwapChain;
     table.DestroySwapChain = ::DestroySwapChain;
@@ -1117,6 +1857,33 @@ Result DeviceNONE::FillFunctionTable(SwapChainInterface& table) const {
     table.AcquireNextTexture = ::AcquireNextTexture;
     table.WaitForPresent = ::WaitForPresent;
     table.QueuePresent = ::QueuePresent;
+    table.GetSwapChainStatistics = ::GetSwapChainStatistics;
+    table.GetPresentedFrame = ::GetPresentedFrame;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Trace  ]
+
+static Result NRI_CALL StartTrace(Device& device, const TraceDesc& traceDesc) {
+    return ((DeviceNONE&)device).StartTrace(traceDesc);
+}
+
+static void NRI_CALL StopTrace(Device& device) {
+    ((DeviceNONE&)device).StopTrace();
+}
+
+static const char* NRI_CALL GetTraceJson(Device& device) {
+    return ((DeviceNONE&)device).GetTraceJson();
+}
+
+Result DeviceNONE::FillFunctionTable(TraceInterface& table) const {
+    table.StartTrace = ::StartTrace;
+    table.StopTrace = ::StopTrace;
+    table.GetTraceJson = ::GetTraceJson;
 
     return Result::SUCCESS;
 }
@@ -4,6 +4,73 @@
 
 namespace nri {
 
+struct Tracer;
+
+// See "ActivityStatistics"
+enum class Counter : uint32_t {
+    DESCRIPTOR_SET,
+    QUEUE_SUBMIT,
+    BARRIER,
+    STREAMED_BYTES,
+    UPLOADED_BYTES,
+    MEMORY_ALLOCATION,
+    HOST_WAIT,
+
+    MAX_NUM
+};
+
+constexpr uint32_t OBJECT_STATISTICS_NUM = sizeof(ObjectStatistics) / sizeof(uint64_t);
+constexpr uint32_t ACTIVITY_STATISTICS_NUM = sizeof(ActivityStatistics) / sizeof(uint64_t);
+constexpr uint32_t UNTRACKED_OBJECT = uint32_t(-1);
+
+static_assert(offsetof(ActivityStatistics, descriptorSetNum) == OBJECT_STATISTICS_NUM * sizeof(uint64_t), "Unexpected layout");
+static_assert(ACTIVITY_STATISTICS_NUM == OBJECT_STATISTICS_NUM + (uint32_t)Counter::MAX_NUM, "Unexpected layout");
+
+// Index in "ObjectStatistics"
+template <typename Interface>
+constexpr uint32_t OBJECT_STATISTICS_INDEX = UNTRACKED_OBJECT;
+
+template <>
+constexpr uint32_t OBJECT_STATISTICS_INDEX<CommandAllocator> = 0;
+template <>
+constexpr uint32_t OBJECT_STATISTICS_INDEX<CommandBuffer> = 1;
+template <>
+constexpr uint32_t OBJECT_STATISTICS_INDEX<DescriptorPool> = 2;
+template <>
+constexpr uint32_t OBJECT_STATISTICS_INDEX<Descriptor> = 3;
+template <>
+constexpr uint32_t OBJECT_STATISTICS_INDEX<PipelineLayout> = 4;
+template <>
+constexpr uint32_t OBJECT_STATISTICS_INDEX<Pipeline> = 5;
+template <>
+constexpr uint32_t OBJECT_STATISTICS_INDEX<QueryPool> = 6;
+template <>
+constexpr uint32_t OBJECT_STATISTICS_INDEX<Fence> = 7;
+template <>
+constexpr uint32_t OBJECT_STATISTICS_INDEX<Memory> = 8;
+template <>
+constexpr uint32_t OBJECT_STATISTICS_INDEX<Buffer> = 9;
+template <>
+constexpr uint32_t OBJECT_STATISTICS_INDEX<Texture> = 10;
+template <>
+constexpr uint32_t OBJECT_STATISTICS_INDEX<AccelerationStructure> = 11;
+template <>
+constexpr uint32_t OBJECT_STATISTICS_INDEX<Micromap> = 12;
+template <>
+constexpr uint32_t OBJECT_STATISTICS_INDEX<SwapChain> = 13;
+
+static_assert(offsetof(ObjectStatistics, swapChainNum) == OBJECT_STATISTICS_INDEX<SwapChain> * sizeof(uint64_t), "Unexpected layout");
+
+// Relaxed atomics, validation shares the storage of the implementation
+struct DeviceStatisticsStorage {
+    std::atomic_uint64_t aliveObjects[OBJECT_STATISTICS_NUM] = {};
+    std::atomic_uint64_t total[ACTIVITY_STATISTICS_NUM] = {};
+    std::atomic_uint64_t lastFrame[ACTIVITY_STATISTICS_NUM] = {};
+    uint64_t frameBegin[ACTIVITY_STATISTICS_NUM] = {}; // "total" at the last present
+    std::atomic_uint64_t frameNum = 0;
+    Lock frameLock;
+};
+
 /*
 TODO: inheritance is a bit tricky:
 - "Objects => DebugNameBase"
@@ -59,15 +126,49 @@ struct DeviceBase : public DebugNameBaseVal {
         return m_AllocationCallbacks;
     }
 
-    void ReportMessage(Message messageType, Result result, const char* file, uint32_t line, const char* format, ...) const;
+    inline Tracer* GetTracer() const {
+        return m_Tracer.load(std::memory_order_relaxed);
+    }
+
+    template <typename Interface>
+    inline void OnObjectCreated() {
+        constexpr uint32_t index = OBJECT_STATISTICS_INDEX<Interface>;
+        if constexpr (index != UNTRACKED_OBJECT) {
+            m_Statistics->aliveObjects[index].fetch_add(1, std::memory_order_relaxed);
+            m_Statistics->total[index].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename Interface>
+    inline void OnObjectDestroyed() {
+        constexpr uint32_t index = OBJECT_STATISTICS_INDEX<Interface>;
+        if constexpr (index != UNTRACKED_OBJECT)
+            m_Statistics->aliveObjects[index].fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    inline void Count(Counter counter, uint64_t value = 1) {
+        m_Statistics->total[OBJECT_STATISTICS_NUM + (uint32_t)counter].fetch_add(value, std::memory_order_relaxed);
+    }
+
+    void ReportMessage(Message messageType, Result result, bool canAbort, const char* file, uint32_t line, const char* format, ...) const;
+
+    // Trace
+    Result StartTrace(const TraceDesc& traceDesc);
+    void ShareTrace(const DeviceBase& owner); // validation shares the tracer of the implementation
+    void StopTrace();
+    const char* GetTraceJson();
+
+    // Statistics
+    void GetStatistics(DeviceStatistics& deviceStatistics) const;
+    void ShareStatistics(DeviceBase& owner); // validation shares the statistics of the implementation
+    void OnPresent();                        // frame boundary
 
     // Pure virtual
     virtual const DeviceDesc& GetDesc() const = 0;
     virtual void Destruct() = 0;
 
     // Virtual
-    virtual ~DeviceBase() {
-    }
+    virtual ~DeviceBase();
 
     virtual Result FillFunctionTable(CoreInterface&) const {
         return Result::UNSUPPORTED;
@@ -81,6 +182,10 @@ struct DeviceBase : public DebugNameBaseVal {
         return Result::UNSUPPORTED;
     }
 
+    virtual Result FillFunctionTable(IndirectCommandsInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
     virtual Result FillFunctionTable(LowLatencyInterface&) const {
         return Result::UNSUPPORTED;
     }
@@ -89,14 +194,34 @@ struct DeviceBase : public DebugNameBaseVal {
         return Result::UNSUPPORTED;
     }
 
+    virtual Result FillFunctionTable(MicromapBakerInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
+    virtual Result FillFunctionTable(ProfilerInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
     virtual Result FillFunctionTable(RayTracingInterface&) const {
         return Result::UNSUPPORTED;
     }
 
+    virtual Result FillFunctionTable(RenderGraphInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
+    virtual Result FillFunctionTable(ResidencyInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
     virtual Result FillFunctionTable(ResourceAllocatorInterface&) const {
         return Result::UNSUPPORTED;
     }
 
+    virtual Result FillFunctionTable(SparseInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
     virtual Result FillFunctionTable(StreamerInterface&) const {
         return Result::UNSUPPORTED;
     }
@@ -105,6 +230,10 @@ struct DeviceBase : public DebugNameBaseVal {
         return Result::UNSUPPORTED;
     }
 
+    virtual Result FillFunctionTable(TraceInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
     virtual Result FillFunctionTable(UpscalerInterface&) const {
         return Result::UNSUPPORTED;
     }
@@ -128,6 +257,10 @@ protected:
     CallbackInterface m_CallbackInterface = {};
     AllocationCallbacks m_AllocationCallbacks = {};
     StdAllocator<uint8_t> m_StdAllocator;
+    DeviceStatisticsStorage m_StatisticsStorage;
+    DeviceStatisticsStorage* m_Statistics = &m_StatisticsStorage;
+    std::atomic<Tracer*> m_Tracer = nullptr;
+    bool m_IsTraceShared = false;
 };
 
 } // namespace nri
@@ -0,0 +1,72 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct HeadlessReadback {
+    Buffer* buffer;
+    CommandAllocator* commandAllocator;
+    CommandBuffer* commandBuffer;
+};
+
+// Presentation into regular textures, used by all backends for "window.headless". Presented frames are "displayed" on a simulated vblank grid:
+// a frame shows up at the first vblank after "QueuePresent", but not earlier than 1 refresh interval after the previous frame
+struct HeadlessSwapChain {
+    inline HeadlessSwapChain(Device& device)
+        : m_Device(device)
+        , m_Textures(((DeviceBase&)device).GetStdAllocator())
+        , m_Readbacks(((DeviceBase&)device).GetStdAllocator())
+        , m_FrameData(((DeviceBase&)device).GetStdAllocator()) {
+    }
+
+    ~HeadlessSwapChain();
+
+    inline Device& GetDevice() const {
+        return m_Device;
+    }
+
+    Result Create(const SwapChainDesc& swapChainDesc);
+    Texture* const* GetTextures(uint32_t& textureNum) const;
+    Result GetDisplayDesc(DisplayDesc& displayDesc) const;
+    Result AcquireNextTexture(Fence* acquireSemaphore, uint32_t& textureIndex); // "acquireSemaphore" is optional (D3D)
+    Result WaitForPresent();
+    Result Present(Fence* releaseSemaphore); // "releaseSemaphore" is optional (D3D)
+    Result GetStatistics(SwapChainStatistics& swapChainStatistics);
+    Result GetPresentedFrame(PresentedFrame& presentedFrame);
+
+    // Low latency emulation: markers are only recorded, "LatencySleep" limits the frame rate
+    Result SetLatencySleepMode(const LatencySleepMode& latencySleepMode);
+    Result SetLatencyMarker(LatencyMarker latencyMarker);
+    Result LatencySleep();
+    Result GetLatencyReport(LatencyReport& latencyReport) const;
+
+private:
+    void WaitForDisplay(uint64_t presentIndex);
+
+private:
+    Device& m_Device;
+    CoreInterface m_iCore = {};
+    ResourceAllocatorInterface m_iResourceAllocator = {};
+    Vector<Texture*> m_Textures;
+    Vector<HeadlessReadback> m_Readbacks; // per texture
+    Vector<uint8_t> m_FrameData;
+    SwapChainStatisticsHelper m_Statistics;
+    LatencyReport m_LatencyReport = {};     // the current frame
+    LatencyReport m_LatencyReportLast = {}; // the last presented frame
+    std::array<uint64_t, PRESENT_HISTORY_NUM> m_DisplayTimes = {};
+    TextureDesc m_TextureDesc = {};
+    Queue* m_Queue = nullptr;
+    Fence* m_Fence = nullptr; // signaled with the present index
+    uint64_t m_PresentNum = 0;
+    uint64_t m_DisplayedNum = 0;
+    uint64_t m_FirstVblankTime = 0;
+    uint64_t m_ReadbackSize = 0;
+    uint64_t m_LatencySleepTime = 0;
+    uint32_t m_RefreshInterval = 0;
+    uint32_t m_RowPitch = 0;
+    uint32_t m_MinFrameInterval = 0;
+    uint32_t m_TextureIndex = 0;
+};
+
+} // namespace nri
@@ -0,0 +1,390 @@
+// © 2025 NVIDIA Corporation
+
+constexpr std::array<Format, (size_t)SwapChainFormat::MAX_NUM> g_HeadlessFormats = {
+    Format::RGBA16_SFLOAT,        // BT709_G10_16BIT
+    Format::RGBA8_UNORM,          // BT709_G22_8BIT
+    Format::R10_G10_B10_A2_UNORM, // BT709_G22_10BIT
+    Format::R10_G10_B10_A2_UNORM, // BT2020_G2084_10BIT
+};
+VALIDATE_ARRAY(g_HeadlessFormats);
+
+HeadlessSwapChain::~HeadlessSwapChain() {
+    if (!m_Fence)
+        return;
+
+    // Presents must be finished before destroying resources
+    m_iCore.Wait(*m_Fence, m_PresentNum);
+
+    for (HeadlessReadback& readback : m_Readbacks) {
+        m_iCore.DestroyCommandBuffer(readback.commandBuffer);
+        m_iCore.DestroyCommandAllocator(readback.commandAllocator);
+        m_iCore.DestroyBuffer(readback.buffer);
+    }
+
+    for (Texture* texture : m_Textures)
+        m_iCore.DestroyTexture(texture);
+
+    m_iCore.DestroyFence(m_Fence);
+}
+
+Result HeadlessSwapChain::Create(const SwapChainDesc& swapChainDesc) {
+    const HeadlessWindow& headless = swapChainDesc.window.headless;
+
+    Result result = nriGetInterface(m_Device, NRI_INTERFACE(CoreInterface), &m_iCore);
+    if (result != Result::SUCCESS)
+        return result;
+
+    result = nriGetInterface(m_Device, NRI_INTERFACE(ResourceAllocatorInterface), &m_iResourceAllocator);
+    if (result != Result::SUCCESS)
+        return result;
+
+    result = m_iCore.CreateFence(m_Device, 0, m_Fence);
+    if (result != Result::SUCCESS)
+        return result;
+
+    m_Queue = (Queue*)swapChainDesc.queue;
+    m_RefreshInterval = headless.refreshRate ? 1000000 / headless.refreshRate : 0;
+
+    // Textures
+    static_assert(PRESENT_HISTORY_NUM == 64, "Update the 'textureNum' clamp documented in 'HeadlessWindow'");
+
+    uint32_t textureNum = swapChainDesc.textureNum ? swapChainDesc.textureNum : 1;
+    if (textureNum > PRESENT_HISTORY_NUM)
+        textureNum = PRESENT_HISTORY_NUM;
+
+    AllocateTextureDesc allocateTextureDesc = {};
+    allocateTextureDesc.desc.type = TextureType::TEXTURE_2D;
+    allocateTextureDesc.desc.usage = TextureUsageBits::COLOR_ATTACHMENT;
+    allocateTextureDesc.desc.format = g_HeadlessFormats[(size_t)swapChainDesc.format];
+    allocateTextureDesc.desc.width = swapChainDesc.width;
+    allocateTextureDesc.desc.height = swapChainDesc.height;
+    allocateTextureDesc.desc.depth = 1;
+    allocateTextureDesc.desc.mipNum = 1;
+    allocateTextureDesc.desc.layerNum = 1;
+    allocateTextureDesc.desc.sampleNum = 1;
+    allocateTextureDesc.memoryLocation = MemoryLocation::DEVICE;
+
+    for (uint32_t i = 0; i < textureNum; i++) {
+        Texture* texture = nullptr;
+        result = m_iResourceAllocator.AllocateTexture(m_Device, allocateTextureDesc, texture);
+        if (result != Result::SUCCESS)
+            return result;
+
+        m_Textures.push_back(texture);
+    }
+
+    m_TextureDesc = allocateTextureDesc.desc;
+
+    // Readback
+    if (headless.allowReadback) {
+        const DeviceDesc& deviceDesc = m_iCore.GetDeviceDesc(m_Device);
+        const FormatProps& formatProps = GetFormatProps(m_TextureDesc.format);
+
+        m_RowPitch = Align(swapChainDesc.width * formatProps.stride, deviceDesc.memoryAlignment.uploadBufferTextureRow);
+        m_ReadbackSize = (uint64_t)m_RowPitch * swapChainDesc.height;
+
+        AllocateBufferDesc allocateBufferDesc = {};
+        allocateBufferDesc.desc.size = m_ReadbackSize;
+        allocateBufferDesc.memoryLocation = MemoryLocation::HOST_READBACK;
+
+        for (uint32_t i = 0; i < textureNum; i++) {
+            HeadlessReadback& readback = m_Readbacks.emplace_back();
+            readback = {};
+
+            result = m_iResourceAllocator.AllocateBuffer(m_Device, allocateBufferDesc, readback.buffer);
+            if (result != Result::SUCCESS)
+                return result;
+
+            result = m_iCore.CreateCommandAllocator(*m_Queue, readback.commandAllocator);
+            if (result != Result::SUCCESS)
+                return result;
+
+            result = m_iCore.CreateCommandBuffer(*readback.commandAllocator, readback.commandBuffer);
+            if (result != Result::SUCCESS)
+                return result;
+        }
+    }
+
+    // Statistics are always "measured", since the display is simulated
+    m_Statistics.Initialize(m_RefreshInterval != 0, true, m_RefreshInterval);
+    m_FirstVblankTime = SwapChainStatisticsHelper::GetTime();
+
+    return Result::SUCCESS;
+}
+
+Texture* const* HeadlessSwapChain::GetTextures(uint32_t& textureNum) const {
+    textureNum = (uint32_t)m_Textures.size();
+
+    return m_Textures.data();
+}
+
+Result HeadlessSwapChain::GetDisplayDesc(DisplayDesc& displayDesc) const {
+    // A virtual SDR display with BT.709 primaries
+    displayDesc = {};
+    displayDesc.redPrimary = {0.64f, 0.33f};
+    displayDesc.greenPrimary = {0.30f, 0.60f};
+    displayDesc.bluePrimary = {0.15f, 0.06f};
+    displayDesc.whitePoint = {0.3127f, 0.3290f};
+    displayDesc.maxLuminance = 80.0f;
+    displayDesc.maxFullFrameLuminance = 80.0f;
+    displayDesc.sdrLuminance = 80.0f;
+
+    return Result::SUCCESS;
+}
+
+void HeadlessSwapChain::WaitForDisplay(uint64_t presentIndex) {
+    if (!presentIndex)
+        return;
+
+    m_iCore.Wait(*m_Fence, presentIndex);
+
+    uint64_t displayTime = m_DisplayTimes[presentIndex % PRESENT_HISTORY_NUM];
+    uint64_t time = SwapChainStatisticsHelper::GetTime();
+    if (displayTime > time)
+        std::this_thread::sleep_for(std::chrono::microseconds(displayTime - time));
+
+    if (presentIndex > m_DisplayedNum) {
+        m_Statistics.OnDisplayed(presentIndex, displayTime, 0);
+        m_DisplayedNum = presentIndex;
+    }
+}
+
+Result HeadlessSwapChain::AcquireNextTexture(Fence* acquireSemaphore, uint32_t& textureIndex) {
+    uint64_t beginTime = SwapChainStatisticsHelper::GetTime();
+
+    // Textures are used in order. A texture gets released once the frame following its previous present is displayed
+    uint32_t textureNum = (uint32_t)m_Textures.size();
+    uint64_t presentIndex = m_PresentNum + 1;
+
+    if (presentIndex > textureNum)
+        WaitForDisplay(std::min(presentIndex - textureNum + 1, m_PresentNum));
+
+    m_TextureIndex = (uint32_t)((presentIndex - 1) % textureNum);
+    textureIndex = m_TextureIndex;
+
+    // The texture is ready, signal the semaphore right away
+    if (acquireSemaphore) {
+        FenceSubmitDesc signalFence = {};
+        signalFence.fence = acquireSemaphore;
+        signalFence.stages = StageBits::ALL;
+
+        QueueSubmitDesc queueSubmitDesc = {};
+        queueSubmitDesc.signalFences = &signalFence;
+        queueSubmitDesc.signalFenceNum = 1;
+
+        Result result = m_iCore.QueueSubmit(*m_Queue, queueSubmitDesc);
+        if (result != Result::SUCCESS)
+            return result;
+    }
+
+    m_Statistics.OnAcquire(beginTime);
+
+    return Result::SUCCESS;
+}
+
+Result HeadlessSwapChain::WaitForPresent() {
+    uint64_t beginTime = SwapChainStatisticsHelper::GetTime();
+
+    // Like a real swap chain, wait for the previous frame
+    if (m_PresentNum > 1)
+        WaitForDisplay(m_PresentNum - 1);
+
+    m_Statistics.OnWaitForPresent(beginTime);
+
+    return Result::SUCCESS;
+}
+
+Result HeadlessSwapChain::Present(Fence* releaseSemaphore) {
+    uint64_t beginTime = SwapChainStatisticsHelper::GetTime();
+    uint64_t presentIndex = m_PresentNum + 1;
+
+    FenceSubmitDesc waitFence = {};
+    waitFence.fence = releaseSemaphore;
+    waitFence.stages = StageBits::ALL;
+
+    FenceSubmitDesc signalFence = {};
+    signalFence.fence = m_Fence;
+    signalFence.value = presentIndex;
+
+    QueueSubmitDesc queueSubmitDesc = {};
+    queueSubmitDesc.waitFences = &waitFence;
+    queueSubmitDesc.waitFenceNum = releaseSemaphore ? 1 : 0;
+    queueSubmitDesc.signalFences = &signalFence;
+    queueSubmitDesc.signalFenceNum = 1;
+
+    // Copy the presented texture to the readback buffer. The command buffer is free, since the texture has been acquired
+    if (!m_Readbacks.empty()) {
+        const HeadlessReadback& readback = m_Readbacks[m_TextureIndex];
+        CommandBuffer& commandBuffer = *readback.commandBuffer;
+
+        m_iCore.ResetCommandAllocator(*readback.commandAllocator);
+
+        Result result = m_iCore.BeginCommandBuffer(commandBuffer, nullptr);
+        if (result != Result::SUCCESS)
+            return result;
+
+        {
+            TextureBarrierDesc textureBarrier = {};
+            textureBarrier.texture = m_Textures[m_TextureIndex];
+            textureBarrier.before = {AccessBits::NONE, Layout::PRESENT, StageBits::NONE};
+            textureBarrier.after = {AccessBits::COPY_SOURCE, Layout::COPY_SOURCE, StageBits::COPY};
+
+            BarrierDesc barrierDesc = {};
+            barrierDesc.textures = &textureBarrier;
+            barrierDesc.textureNum = 1;
+
+            m_iCore.CmdBarrier(commandBuffer, barrierDesc);
+
+            TextureDataLayoutDesc dstDataLayout = {};
+            dstDataLayout.rowPitch = m_RowPitch;
+            dstDataLayout.slicePitch = (uint32_t)m_ReadbackSize;
+
+            TextureRegionDesc srcRegion = {};
+            m_iCore.CmdReadbackTextureToBuffer(commandBuffer, *readback.buffer, dstDataLayout, *m_Textures[m_TextureIndex], srcRegion);
+
+            std::swap(textureBarrier.before, textureBarrier.after);
+            m_iCore.CmdBarrier(commandBuffer, barrierDesc);
+        }
+
+        result = m_iCore.EndCommandBuffer(commandBuffer);
+        if (result != Result::SUCCESS)
+            return result;
+
+        queueSubmitDesc.commandBuffers = &readback.commandBuffer;
+        queueSubmitDesc.commandBufferNum = 1;
+    }
+
+    m_LatencyReport.presentStartTimeUs = SwapChainStatisticsHelper::GetTime();
+
+    Result result = m_iCore.QueueSubmit(*m_Queue, queueSubmitDesc);
+    if (result != Result::SUCCESS)
+        return result;
+
+    m_LatencyReport.presentEndTimeUs = SwapChainStatisticsHelper::GetTime();
+    m_LatencyReportLast = m_LatencyReport;
+    m_LatencyReport = {};
+
+    m_PresentNum = presentIndex;
+
+    // Simulated display time: the next vblank, but not earlier than 1 refresh interval after the previous frame
+    uint64_t displayTime = beginTime;
+    if (m_RefreshInterval) {
+        uint64_t vblankNum = (beginTime - m_FirstVblankTime + m_RefreshInterval - 1) / m_RefreshInterval;
+        displayTime = m_FirstVblankTime + vblankNum * m_RefreshInterval;
+
+        if (presentIndex > 1)
+            displayTime = std::max(displayTime, m_DisplayTimes[(presentIndex - 1) % PRESENT_HISTORY_NUM] + m_RefreshInterval);
+    }
+
+    m_DisplayTimes[presentIndex % PRESENT_HISTORY_NUM] = displayTime;
+    m_Statistics.OnPresent(beginTime, m_TextureIndex);
+
+    ((DeviceBase&)m_Device).OnPresent();
+
+    return Result::SUCCESS;
+}
+
+Result HeadlessSwapChain::GetStatistics(SwapChainStatistics& swapChainStatistics) {
+    // Register frames, which are already on the "screen"
+    uint64_t completedValue = m_iCore.GetFenceValue(*m_Fence);
+    uint64_t time = SwapChainStatisticsHelper::GetTime();
+
+    uint64_t presentIndex = m_DisplayedNum + 1;
+    if (m_PresentNum > PRESENT_HISTORY_NUM)
+        presentIndex = std::max(presentIndex, m_PresentNum - PRESENT_HISTORY_NUM + 1);
+
+    for (; presentIndex <= m_PresentNum && presentIndex <= completedValue; presentIndex++) {
+        uint64_t displayTime = m_DisplayTimes[presentIndex % PRESENT_HISTORY_NUM];
+        if (displayTime > time)
+            break;
+
+        m_Statistics.OnDisplayed(presentIndex, displayTime, 0);
+        m_DisplayedNum = presentIndex;
+    }
+
+    m_Statistics.GetStatistics(swapChainStatistics);
+
+    return Result::SUCCESS;
+}
+
+Result HeadlessSwapChain::GetPresentedFrame(PresentedFrame& presentedFrame) {
+    presentedFrame = {};
+
+    RETURN_ON_FAILURE((DeviceBase*)&m_Device, !m_Readbacks.empty(), Result::UNSUPPORTED, "'allowReadback' is false");
+    RETURN_ON_FAILURE((DeviceBase*)&m_Device, m_PresentNum != 0, Result::FAILURE, "nothing has been presented yet");
+
+    m_iCore.Wait(*m_Fence, m_PresentNum);
+
+    uint32_t textureIndex = (uint32_t)((m_PresentNum - 1) % m_Textures.size());
+    const HeadlessReadback& readback = m_Readbacks[textureIndex];
+
+    m_FrameData.resize((size_t)m_ReadbackSize);
+
+    const uint8_t* data = (uint8_t*)m_iCore.MapBuffer(*readback.buffer, 0, m_ReadbackSize);
+    if (data) {
+        memcpy(m_FrameData.data(), data, (size_t)m_ReadbackSize);
+        m_iCore.UnmapBuffer(*readback.buffer);
+    } else
+        memset(m_FrameData.data(), 0, (size_t)m_ReadbackSize);
+
+    presentedFrame.data = m_FrameData.data();
+    presentedFrame.presentIndex = m_PresentNum;
+    presentedFrame.rowPitch = m_RowPitch;
+    presentedFrame.width = m_TextureDesc.width;
+    presentedFrame.height = m_TextureDesc.height;
+    presentedFrame.format = m_TextureDesc.format;
+
+    return Result::SUCCESS;
+}
+
+Result HeadlessSwapChain::SetLatencySleepMode(const LatencySleepMode& latencySleepMode) {
+    m_MinFrameInterval = latencySleepMode.minIntervalUs;
+
+    return Result::SUCCESS;
+}
+
+Result HeadlessSwapChain::SetLatencyMarker(LatencyMarker latencyMarker) {
+    uint64_t time = SwapChainStatisticsHelper::GetTime();
+
+    switch (latencyMarker) {
+        case LatencyMarker::SIMULATION_START:
+            m_LatencyReport.simulationStartTimeUs = time;
+            break;
+        case LatencyMarker::SIMULATION_END:
+            m_LatencyReport.simulationEndTimeUs = time;
+            break;
+        case LatencyMarker::RENDER_SUBMIT_START:
+            m_LatencyReport.renderSubmitStartTimeUs = time;
+            break;
+        case LatencyMarker::RENDER_SUBMIT_END:
+            m_LatencyReport.renderSubmitEndTimeUs = time;
+            break;
+        case LatencyMarker::INPUT_SAMPLE:
+            m_LatencyReport.inputSampleTimeUs = time;
+            break;
+        default:
+            return Result::INVALID_ARGUMENT;
+    }
+
+    return Result::SUCCESS;
+}
+
+Result HeadlessSwapChain::LatencySleep() {
+    uint64_t time = SwapChainStatisticsHelper::GetTime();
+    uint64_t wakeUpTime = m_LatencySleepTime + m_MinFrameInterval;
+
+    if (m_MinFrameInterval && wakeUpTime > time) {
+        std::this_thread::sleep_for(std::chrono::microseconds(wakeUpTime - time));
+        time = wakeUpTime;
+    }
+
+    m_LatencySleepTime = time;
+
+    return Result::SUCCESS;
+}
+
+Result HeadlessSwapChain::GetLatencyReport(LatencyReport& latencyReport) const {
+    latencyReport = m_LatencyReportLast;
+
+    return Result::SUCCESS;
+}
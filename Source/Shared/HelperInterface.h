@@ -43,6 +43,7 @@ struct HelperDeviceMemoryAllocator {
 
     uint32_t CalculateAllocationNumber(const ResourceGroupDesc& resourceGroupDesc);
     Result AllocateAndBindMemory(const ResourceGroupDesc& resourceGroupDesc, Memory** allocations);
+    Result CreateResourceGroup(const ResourceGroupCreationDesc& resourceGroupCreationDesc, Texture** textures, Buffer** buffers, Memory** allocations, uint32_t& allocationNum, uint64_t& allocationSize);
 
 private:
     struct MemoryHeap {
@@ -71,6 +72,178 @@ private:
     Vector<Texture*> m_DedicatedTextures;
     Vector<BindBufferMemoryDesc> m_BufferBindingDescs;
     Vector<BindTextureMemoryDesc> m_TextureBindingDescs;
+    uint64_t m_AllocationSize = 0;
+};
+
+// TLSF: a free range is found in O(1) using 2-level segregated lists (power-of-2 classes, split linearly into sub-classes)
+constexpr uint32_t MEMORY_POOL_FL_NUM = 64;
+constexpr uint32_t MEMORY_POOL_SL_LOG2 = 4;
+constexpr uint32_t MEMORY_POOL_SL_NUM = 1 << MEMORY_POOL_SL_LOG2;
+
+struct MemoryPoolRange {
+    uint64_t offset;
+    uint64_t size;
+    uint32_t block;
+    uint32_t prevPhysical; // neighbors in the block
+    uint32_t nextPhysical;
+    uint32_t prevFree; // neighbors in the free list
+    uint32_t nextFree;
+    bool isFree;
+};
+
+struct MemoryPoolBlock {
+    Memory* memory;
+    uint64_t size;
+    uint32_t heap; // index in "m_Heaps"
+    uint32_t allocationNum;
+};
+
+// Free lists of a memory type
+struct MemoryPoolHeap {
+    std::array<std::array<uint32_t, MEMORY_POOL_SL_NUM>, MEMORY_POOL_FL_NUM> freeLists;
+    std::array<uint32_t, MEMORY_POOL_FL_NUM> slBitmaps;
+    uint64_t flBitmap;
+    MemoryType type;
+    uint32_t emptyBlockNum;
+};
+
+struct MemoryPoolAllocation {
+    Memory* dedicatedMemory;
+    uint64_t size;
+    uint32_t range; // "MEMORY_POOL_NULL" if dedicated or unused
+};
+
+struct MemoryPoolImpl : public DebugNameBase {
+    inline MemoryPoolImpl(Device& device, const CoreInterface& NRI)
+        : m_Device(device)
+        , m_iCore(NRI)
+        , m_Heaps(((DeviceBase&)device).GetStdAllocator())
+        , m_Blocks(((DeviceBase&)device).GetStdAllocator())
+        , m_FreeBlocks(((DeviceBase&)device).GetStdAllocator())
+        , m_Ranges(((DeviceBase&)device).GetStdAllocator())
+        , m_FreeRanges(((DeviceBase&)device).GetStdAllocator())
+        , m_Allocations(((DeviceBase&)device).GetStdAllocator())
+        , m_FreeAllocations(((DeviceBase&)device).GetStdAllocator()) {
+    }
+
+    inline Device& GetDevice() {
+        return m_Device;
+    }
+
+    ~MemoryPoolImpl();
+
+    Result Create(const MemoryPoolDesc& desc);
+    Result AllocateBufferMemory(Buffer& buffer, MemoryLocation memoryLocation, uint32_t& allocation);
+    Result AllocateTextureMemory(Texture& texture, MemoryLocation memoryLocation, uint32_t& allocation);
+    void Free(uint32_t allocation);
+    void GetStatistics(MemoryPoolStatistics& statistics);
+
+    //================================================================================================================
+    // DebugNameBase
+    //================================================================================================================
+
+    void SetDebugName(const char* name) DEBUG_NAME_OVERRIDE {
+        ExclusiveScope lock(m_Lock);
+
+        for (const MemoryPoolBlock& block : m_Blocks)
+            m_iCore.SetDebugName(block.memory, name);
+    }
+
+private:
+    Result Allocate(const MemoryDesc& memoryDesc, bool isTexture, uint32_t& allocation, Memory*& memory, uint64_t& offset);
+    Result CreateBlock(uint32_t heap);
+    uint32_t FindOrCreateHeap(MemoryType memoryType);
+    uint32_t FindFreeRange(const MemoryPoolHeap& heap, uint64_t size) const;
+    uint32_t NewRange();
+    void InsertFreeRange(MemoryPoolHeap& heap, uint32_t range);
+    void RemoveFreeRange(MemoryPoolHeap& heap, uint32_t range);
+    void PlaceInRange(MemoryPoolHeap& heap, uint32_t range, uint64_t size, uint64_t alignment);
+    void FreeRange(uint32_t range);
+
+private:
+    Device& m_Device;
+    const CoreInterface& m_iCore;
+    MemoryPoolDesc m_Desc = {};
+    Vector<MemoryPoolHeap> m_Heaps;
+    Vector<MemoryPoolBlock> m_Blocks;
+    Vector<uint32_t> m_FreeBlocks; // unused entries in "m_Blocks"
+    Vector<MemoryPoolRange> m_Ranges;
+    Vector<uint32_t> m_FreeRanges; // unused entries in "m_Ranges"
+    Vector<MemoryPoolAllocation> m_Allocations; // handles are indices
+    Vector<uint32_t> m_FreeAllocations;
+    Lock m_Lock;
+    uint64_t m_TextureGranularity = 1; // "bufferTextureGranularity"
+    uint64_t m_BlockSize = 0;
+    uint64_t m_AllocationSize = 0;
+    uint64_t m_DedicatedSize = 0;
+    uint32_t m_AllocationNum = 0;
+    uint32_t m_DedicatedNum = 0;
+};
+
+struct TexturePoolEntry {
+    TextureDesc desc;
+    Texture* texture;
+    Descriptor* view;
+    Fence* fence; // the last GPU work using the texture
+    uint64_t fenceValue;
+    uint64_t size;
+    bool isUsed;
+};
+
+struct TexturePoolImpl : public DebugNameBase {
+    inline TexturePoolImpl(Device& device, const CoreInterface& NRI)
+        : m_Device(device)
+        , m_iCore(NRI)
+        , m_Entries(((DeviceBase&)device).GetStdAllocator())
+        , m_FreeEntries(((DeviceBase&)device).GetStdAllocator())
+        , m_UnusedEntries(((DeviceBase&)device).GetStdAllocator()) {
+    }
+
+    inline Device& GetDevice() {
+        return m_Device;
+    }
+
+    ~TexturePoolImpl();
+
+    Result Create(const TexturePoolDesc& desc);
+    Result Acquire(const TextureDesc& textureDesc, PooledTexture& pooledTexture);
+    void Release(uint32_t handle, Fence* fence, uint64_t value);
+    void GetStatistics(TexturePoolStatistics& statistics);
+
+    //================================================================================================================
+    // DebugNameBase
+    //================================================================================================================
+
+    void SetDebugName(const char* name) DEBUG_NAME_OVERRIDE {
+        ExclusiveScope lock(m_Lock);
+
+        for (const TexturePoolEntry& entry : m_Entries) {
+            m_iCore.SetDebugName(entry.texture, name);
+            m_iCore.SetDebugName(entry.view, name);
+        }
+    }
+
+private:
+    Result CreateEntry(const TextureDesc& textureDesc, TexturePoolEntry& entry);
+    void DestroyEntry(uint32_t handle);
+    void Evict();
+    bool IsIdle(const TexturePoolEntry& entry);
+
+private:
+    Device& m_Device;
+    const CoreInterface& m_iCore;
+    TexturePoolDesc m_Desc = {};
+    ResourceAllocatorInterface m_iResourceAllocator = {};
+    Vector<TexturePoolEntry> m_Entries; // handles are indices
+    Vector<uint32_t> m_FreeEntries;     // unused entries in "m_Entries"
+    Vector<uint32_t> m_UnusedEntries;   // released textures, least recently released first
+    Lock m_Lock;
+    uint64_t m_Size = 0;
+    uint64_t m_UnusedSize = 0;
+    uint64_t m_HitNum = 0;
+    uint64_t m_MissNum = 0;
+    uint64_t m_EvictedNum = 0;
+    uint32_t m_TextureNum = 0;
 };
 
 } // namespace nri
\ No newline at end of file
@@ -1,5 +1,9 @@
 // © 2021 NVIDIA Corporation
 
+#ifdef _MSC_VER
+#    include <intrin.h>
+#endif
+
 // Helper data upload
 constexpr uint32_t BARRIERS_PER_PASS = 256;
 constexpr uint64_t MAX_UPLOAD_BUFFER_SIZE = 64 * 1024 * 1024;
@@ -81,6 +85,8 @@ static void DoTransition(const CoreInterface& m_iCore, CommandBuffer* commandBuf
 }
 
 Result HelperDataUpload::UploadData(const TextureUploadDesc* textureUploadDescs, uint32_t textureUploadDescNum, const BufferUploadDesc* bufferUploadDescs, uint32_t bufferUploadDescNum) {
+    TRACE_SCOPE((DeviceBase*)&m_Device, "UploadData");
+
     Result result = Create(textureUploadDescs, textureUploadDescNum, bufferUploadDescs, bufferUploadDescNum);
 
     if (result == Result::SUCCESS)
@@ -357,6 +363,7 @@ bool HelperDataUpload::CopyTextureContent(const TextureUploadDesc& textureUpload
 
             // Increment buffer offset
             m_UploadBufferOffset += alignedSize;
+            ((DeviceBase&)m_Device).Count(Counter::UPLOADED_BYTES, alignedSize);
         }
         mipOffset = 0;
     }
@@ -383,6 +390,7 @@ bool HelperDataUpload::CopyBufferContent(const BufferUploadDesc& bufferUploadDes
 
     bufferContentOffset += copySize;
     m_UploadBufferOffset += copySize;
+    ((DeviceBase&)m_Device).Count(Counter::UPLOADED_BYTES, copySize);
 
     if (bufferContentOffset != bufferDesc.size)
         return false;
@@ -434,6 +442,68 @@ Result HelperDeviceMemoryAllocator::AllocateAndBindMemory(const ResourceGroupDes
     return result;
 }
 
+Result HelperDeviceMemoryAllocator::CreateResourceGroup(const ResourceGroupCreationDesc& resourceGroupCreationDesc, Texture** textures, Buffer** buffers, Memory** allocations, uint32_t& allocationNum, uint64_t& allocationSize) {
+    allocationNum = 0;
+    allocationSize = 0;
+
+    // Create resources
+    Result result = Result::SUCCESS;
+    uint32_t textureNum = 0;
+    uint32_t bufferNum = 0;
+
+    for (; textureNum < resourceGroupCreationDesc.textureNum; textureNum++) {
+        result = m_iCore.CreateTexture(m_Device, resourceGroupCreationDesc.textureDescs[textureNum], textures[textureNum]);
+        if (result != Result::SUCCESS)
+            break;
+    }
+
+    for (; bufferNum < resourceGroupCreationDesc.bufferNum && result == Result::SUCCESS; bufferNum++) {
+        result = m_iCore.CreateBuffer(m_Device, resourceGroupCreationDesc.bufferDescs[bufferNum], buffers[bufferNum]);
+        if (result != Result::SUCCESS)
+            break;
+    }
+
+    // Place them into memory and bind everything at once
+    size_t usedAllocationNum = 0;
+    if (result == Result::SUCCESS) {
+        m_TextureBindingDescs.reserve(textureNum);
+        m_BufferBindingDescs.reserve(bufferNum);
+
+        ResourceGroupDesc resourceGroupDesc = {};
+        resourceGroupDesc.memoryLocation = resourceGroupCreationDesc.memoryLocation;
+        resourceGroupDesc.textures = textures;
+        resourceGroupDesc.textureNum = textureNum;
+        resourceGroupDesc.buffers = buffers;
+        resourceGroupDesc.bufferNum = bufferNum;
+        resourceGroupDesc.preferredMemorySize = resourceGroupCreationDesc.preferredMemorySize;
+
+        result = TryToAllocateAndBindMemory(resourceGroupDesc, allocations, usedAllocationNum);
+    }
+
+    // Roll back on failure
+    if (result != Result::SUCCESS) {
+        for (uint32_t i = 0; i < textureNum; i++)
+            m_iCore.DestroyTexture(textures[i]);
+
+        for (uint32_t i = 0; i < bufferNum; i++)
+            m_iCore.DestroyBuffer(buffers[i]);
+
+        for (size_t i = 0; i < usedAllocationNum; i++)
+            m_iCore.FreeMemory(allocations[i]);
+
+        memset(textures, 0, resourceGroupCreationDesc.textureNum * sizeof(Texture*));
+        memset(buffers, 0, resourceGroupCreationDesc.bufferNum * sizeof(Buffer*));
+        memset(allocations, 0, usedAllocationNum * sizeof(Memory*));
+
+        return result;
+    }
+
+    allocationNum = (uint32_t)usedAllocationNum;
+    allocationSize = m_AllocationSize;
+
+    return Result::SUCCESS;
+}
+
 Result HelperDeviceMemoryAllocator::TryToAllocateAndBindMemory(const ResourceGroupDesc& resourceGroupDesc, Memory** allocations, size_t& allocationNum) {
     GroupByMemoryType(resourceGroupDesc.memoryLocation, resourceGroupDesc);
 
@@ -448,6 +518,8 @@ Result HelperDeviceMemoryAllocator::TryToAllocateAndBindMemory(const ResourceGro
         if (result != Result::SUCCESS)
             return result;
 
+        m_AllocationSize += allocateMemoryDesc.size;
+
         FillMemoryBindingDescs(heap.buffers.data(), heap.bufferOffsets.data(), (uint32_t)heap.buffers.size(), *memory);
         FillMemoryBindingDescs(heap.textures.data(), heap.textureOffsets.data(), (uint32_t)heap.textures.size(), *memory);
 
@@ -484,6 +556,8 @@ Result HelperDeviceMemoryAllocator::ProcessDedicatedResources(MemoryLocation mem
         if (result != Result::SUCCESS)
             return result;
 
+        m_AllocationSize += allocateMemoryDesc.size;
+
         FillMemoryBindingDescs(m_DedicatedBuffers.data() + i, &zeroOffset, 1, *memory);
 
         allocationNum++;
@@ -502,6 +576,8 @@ Result HelperDeviceMemoryAllocator::ProcessDedicatedResources(MemoryLocation mem
         if (result != Result::SUCCESS)
             return result;
 
+        m_AllocationSize += allocateMemoryDesc.size;
+
         FillMemoryBindingDescs(m_DedicatedTextures.data() + i, &zeroOffset, 1, *memory);
 
         allocationNum++;
@@ -597,3 +673,721 @@ void HelperDeviceMemoryAllocator::FillMemoryBindingDescs(Texture* const* texture
         m_TextureBindingDescs.push_back(desc);
     }
 }
+
+// Memory pool
+constexpr uint64_t MEMORY_POOL_DEFAULT_BLOCK_SIZE = 64 * 1024 * 1024;
+
+static inline uint32_t FindLsb(uint64_t x) {
+#ifdef _MSC_VER
+    unsigned long index = 0;
+    _BitScanForward64(&index, x);
+
+    return (uint32_t)index;
+#else
+    return (uint32_t)__builtin_ctzll(x);
+#endif
+}
+
+static inline uint32_t FindMsb(uint64_t x) {
+#ifdef _MSC_VER
+    unsigned long index = 0;
+    _BitScanReverse64(&index, x);
+
+    return (uint32_t)index;
+#else
+    return 63 - (uint32_t)__builtin_clzll(x);
+#endif
+}
+
+// "size" must be > 0
+static inline void GetMemoryPoolListIndices(uint64_t size, uint32_t& fl, uint32_t& sl) {
+    fl = FindMsb(size);
+
+    if (fl < MEMORY_POOL_SL_LOG2)
+        sl = (uint32_t)(size << (MEMORY_POOL_SL_LOG2 - fl)) - MEMORY_POOL_SL_NUM;
+    else
+        sl = (uint32_t)(size >> (fl - MEMORY_POOL_SL_LOG2)) - MEMORY_POOL_SL_NUM;
+}
+
+MemoryPoolImpl::~MemoryPoolImpl() {
+    for (const MemoryPoolAllocation& allocation : m_Allocations) {
+        if (allocation.dedicatedMemory)
+            m_iCore.FreeMemory(allocation.dedicatedMemory);
+    }
+
+    for (const MemoryPoolBlock& block : m_Blocks) {
+        if (block.memory)
+            m_iCore.FreeMemory(block.memory);
+    }
+}
+
+Result MemoryPoolImpl::Create(const MemoryPoolDesc& desc) {
+    m_Desc = desc;
+    if (m_Desc.blockSize == 0)
+        m_Desc.blockSize = MEMORY_POOL_DEFAULT_BLOCK_SIZE;
+
+    const DeviceDesc& deviceDesc = m_iCore.GetDeviceDesc(m_Device);
+    if (deviceDesc.memory.bufferTextureGranularity > 1)
+        m_TextureGranularity = deviceDesc.memory.bufferTextureGranularity;
+
+    return Result::SUCCESS;
+}
+
+Result MemoryPoolImpl::AllocateBufferMemory(Buffer& buffer, MemoryLocation memoryLocation, uint32_t& allocation) {
+    MemoryDesc memoryDesc = {};
+    m_iCore.GetBufferMemoryDesc(buffer, memoryLocation, memoryDesc);
+
+    Memory* memory = nullptr;
+    uint64_t offset = 0;
+    Result result = Allocate(memoryDesc, false, allocation, memory, offset);
+    if (result != Result::SUCCESS)
+        return result;
+
+    BindBufferMemoryDesc bindBufferMemoryDesc = {};
+    bindBufferMemoryDesc.buffer = &buffer;
+    bindBufferMemoryDesc.memory = memory;
+    bindBufferMemoryDesc.offset = offset;
+
+    result = m_iCore.BindBufferMemory(m_Device, &bindBufferMemoryDesc, 1);
+    if (result != Result::SUCCESS) {
+        Free(allocation);
+        allocation = MEMORY_POOL_NULL;
+    }
+
+    return result;
+}
+
+Result MemoryPoolImpl::AllocateTextureMemory(Texture& texture, MemoryLocation memoryLocation, uint32_t& allocation) {
+    MemoryDesc memoryDesc = {};
+    m_iCore.GetTextureMemoryDesc(texture, memoryLocation, memoryDesc);
+
+    Memory* memory = nullptr;
+    uint64_t offset = 0;
+    Result result = Allocate(memoryDesc, true, allocation, memory, offset);
+    if (result != Result::SUCCESS)
+        return result;
+
+    BindTextureMemoryDesc bindTextureMemoryDesc = {};
+    bindTextureMemoryDesc.texture = &texture;
+    bindTextureMemoryDesc.memory = memory;
+    bindTextureMemoryDesc.offset = offset;
+
+    result = m_iCore.BindTextureMemory(m_Device, &bindTextureMemoryDesc, 1);
+    if (result != Result::SUCCESS) {
+        Free(allocation);
+        allocation = MEMORY_POOL_NULL;
+    }
+
+    return result;
+}
+
+Result MemoryPoolImpl::Allocate(const MemoryDesc& memoryDesc, bool isTexture, uint32_t& allocation, Memory*& memory, uint64_t& offset) {
+    allocation = MEMORY_POOL_NULL;
+
+    uint64_t size = std::max(memoryDesc.size, (uint64_t)1);
+    uint64_t alignment = std::max((uint64_t)memoryDesc.alignment, (uint64_t)1);
+
+    // Buffers and textures must not share a "bufferTextureGranularity" page
+    if (isTexture) {
+        alignment = std::max(alignment, m_TextureGranularity);
+        size = Align(size, m_TextureGranularity);
+    }
+
+    // Worst case, which fits regardless of the alignment of the found range
+    uint64_t paddedSize = size + alignment - 1;
+
+    ExclusiveScope lock(m_Lock);
+
+    MemoryPoolAllocation newAllocation = {};
+    newAllocation.size = size;
+    newAllocation.range = MEMORY_POOL_NULL;
+
+    if (memoryDesc.mustBeDedicated || paddedSize > m_Desc.blockSize / 2) {
+        AllocateMemoryDesc allocateMemoryDesc = {};
+        allocateMemoryDesc.size = memoryDesc.size;
+        allocateMemoryDesc.type = memoryDesc.type;
+
+        Result result = m_iCore.AllocateMemory(m_Device, allocateMemoryDesc, newAllocation.dedicatedMemory);
+        if (result != Result::SUCCESS)
+            return result;
+
+        memory = newAllocation.dedicatedMemory;
+        offset = 0;
+
+        m_DedicatedSize += size;
+        m_DedicatedNum++;
+    } else {
+        uint32_t heapIndex = FindOrCreateHeap(memoryDesc.type);
+
+        uint32_t range = FindFreeRange(m_Heaps[heapIndex], paddedSize);
+        if (range == MEMORY_POOL_NULL) {
+            Result result = CreateBlock(heapIndex);
+            if (result != Result::SUCCESS)
+                return result;
+
+            range = FindFreeRange(m_Heaps[heapIndex], paddedSize);
+        }
+
+        PlaceInRange(m_Heaps[heapIndex], range, size, alignment);
+
+        const MemoryPoolRange& placedRange = m_Ranges[range];
+        memory = m_Blocks[placedRange.block].memory;
+        offset = placedRange.offset;
+
+        newAllocation.range = range;
+
+        m_AllocationSize += size;
+        m_AllocationNum++;
+    }
+
+    if (!m_FreeAllocations.empty()) {
+        allocation = m_FreeAllocations.back();
+        m_FreeAllocations.pop_back();
+    } else {
+        allocation = (uint32_t)m_Allocations.size();
+        m_Allocations.emplace_back();
+    }
+
+    m_Allocations[allocation] = newAllocation;
+
+    return Result::SUCCESS;
+}
+
+void MemoryPoolImpl::Free(uint32_t allocation) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    if (allocation == MEMORY_POOL_NULL)
+        return;
+
+    ExclusiveScope lock(m_Lock);
+
+    RETURN_ON_FAILURE(&deviceBase, allocation < m_Allocations.size(), ReturnVoid(), "'allocation' is out of bounds");
+
+    MemoryPoolAllocation& poolAllocation = m_Allocations[allocation];
+    RETURN_ON_FAILURE(&deviceBase, poolAllocation.dedicatedMemory || poolAllocation.range != MEMORY_POOL_NULL, ReturnVoid(), "'allocation' is already freed");
+
+    if (poolAllocation.dedicatedMemory) {
+        m_iCore.FreeMemory(poolAllocation.dedicatedMemory);
+
+        m_DedicatedSize -= poolAllocation.size;
+        m_DedicatedNum--;
+    } else {
+        FreeRange(poolAllocation.range);
+
+        m_AllocationSize -= poolAllocation.size;
+        m_AllocationNum--;
+    }
+
+    poolAllocation = {};
+    poolAllocation.range = MEMORY_POOL_NULL;
+
+    m_FreeAllocations.push_back(allocation);
+}
+
+void MemoryPoolImpl::GetStatistics(MemoryPoolStatistics& statistics) {
+    ExclusiveScope lock(m_Lock);
+
+    statistics = {};
+    statistics.blockSize = m_BlockSize;
+    statistics.allocationSize = m_AllocationSize;
+    statistics.dedicatedSize = m_DedicatedSize;
+    statistics.blockNum = (uint32_t)(m_Blocks.size() - m_FreeBlocks.size());
+    statistics.allocationNum = m_AllocationNum;
+    statistics.dedicatedNum = m_DedicatedNum;
+
+    // The largest free range is in the highest non-empty list
+    for (const MemoryPoolHeap& heap : m_Heaps) {
+        if (!heap.flBitmap)
+            continue;
+
+        uint32_t fl = FindMsb(heap.flBitmap);
+        uint32_t sl = FindMsb(heap.slBitmaps[fl]);
+
+        for (uint32_t i = heap.freeLists[fl][sl]; i != MEMORY_POOL_NULL; i = m_Ranges[i].nextFree)
+            statistics.largestFreeRangeSize = std::max(statistics.largestFreeRangeSize, m_Ranges[i].size);
+    }
+}
+
+Result MemoryPoolImpl::CreateBlock(uint32_t heapIndex) {
+    MemoryPoolHeap& heap = m_Heaps[heapIndex];
+
+    AllocateMemoryDesc allocateMemoryDesc = {};
+    allocateMemoryDesc.size = m_Desc.blockSize;
+    allocateMemoryDesc.type = heap.type;
+
+    Memory* memory = nullptr;
+    Result result = m_iCore.AllocateMemory(m_Device, allocateMemoryDesc, memory);
+    if (result != Result::SUCCESS)
+        return result;
+
+    uint32_t blockIndex = 0;
+    if (!m_FreeBlocks.empty()) {
+        blockIndex = m_FreeBlocks.back();
+        m_FreeBlocks.pop_back();
+    } else {
+        blockIndex = (uint32_t)m_Blocks.size();
+        m_Blocks.emplace_back();
+    }
+
+    MemoryPoolBlock& block = m_Blocks[blockIndex];
+    block.memory = memory;
+    block.size = m_Desc.blockSize;
+    block.heap = heapIndex;
+    block.allocationNum = 0;
+
+    // The whole block is a single free range
+    uint32_t range = NewRange();
+
+    MemoryPoolRange& freeRange = m_Ranges[range];
+    freeRange.offset = 0;
+    freeRange.size = m_Desc.blockSize;
+    freeRange.block = blockIndex;
+    freeRange.prevPhysical = MEMORY_POOL_NULL;
+    freeRange.nextPhysical = MEMORY_POOL_NULL;
+
+    InsertFreeRange(heap, range);
+
+    heap.emptyBlockNum++;
+    m_BlockSize += m_Desc.blockSize;
+
+    return Result::SUCCESS;
+}
+
+uint32_t MemoryPoolImpl::FindOrCreateHeap(MemoryType memoryType) {
+    for (uint32_t i = 0; i < (uint32_t)m_Heaps.size(); i++) {
+        if (m_Heaps[i].type == memoryType)
+            return i;
+    }
+
+    MemoryPoolHeap& heap = m_Heaps.emplace_back();
+    for (auto& freeLists : heap.freeLists)
+        freeLists.fill(MEMORY_POOL_NULL);
+    heap.slBitmaps.fill(0);
+    heap.flBitmap = 0;
+    heap.type = memoryType;
+    heap.emptyBlockNum = 0;
+
+    return (uint32_t)m_Heaps.size() - 1;
+}
+
+uint32_t MemoryPoolImpl::FindFreeRange(const MemoryPoolHeap& heap, uint64_t size) const {
+    // Round up to the next sub-class, i.e. any range in the found list fits
+    uint32_t fl = FindMsb(size);
+    if (fl >= MEMORY_POOL_SL_LOG2)
+        size += (1ull << (fl - MEMORY_POOL_SL_LOG2)) - 1;
+
+    uint32_t sl = 0;
+    GetMemoryPoolListIndices(size, fl, sl);
+
+    uint32_t slBitmap = heap.slBitmaps[fl] & (~0u << sl);
+    if (!slBitmap) {
+        uint64_t flBitmap = fl + 1 < MEMORY_POOL_FL_NUM ? heap.flBitmap & (~0ull << (fl + 1)) : 0;
+        if (!flBitmap)
+            return MEMORY_POOL_NULL;
+
+        fl = FindLsb(flBitmap);
+        slBitmap = heap.slBitmaps[fl];
+    }
+
+    sl = FindLsb(slBitmap);
+
+    return heap.freeLists[fl][sl];
+}
+
+uint32_t MemoryPoolImpl::NewRange() {
+    uint32_t range = 0;
+    if (!m_FreeRanges.empty()) {
+        range = m_FreeRanges.back();
+        m_FreeRanges.pop_back();
+    } else {
+        range = (uint32_t)m_Ranges.size();
+        m_Ranges.emplace_back();
+    }
+
+    m_Ranges[range] = {};
+
+    return range;
+}
+
+void MemoryPoolImpl::InsertFreeRange(MemoryPoolHeap& heap, uint32_t range) {
+    MemoryPoolRange& freeRange = m_Ranges[range];
+
+    uint32_t fl = 0;
+    uint32_t sl = 0;
+    GetMemoryPoolListIndices(freeRange.size, fl, sl);
+
+    uint32_t head = heap.freeLists[fl][sl];
+    if (head != MEMORY_POOL_NULL)
+        m_Ranges[head].prevFree = range;
+
+    freeRange.prevFree = MEMORY_POOL_NULL;
+    freeRange.nextFree = head;
+    freeRange.isFree = true;
+
+    heap.freeLists[fl][sl] = range;
+    heap.slBitmaps[fl] |= 1u << sl;
+    heap.flBitmap |= 1ull << fl;
+}
+
+void MemoryPoolImpl::RemoveFreeRange(MemoryPoolHeap& heap, uint32_t range) {
+    MemoryPoolRange& freeRange = m_Ranges[range];
+
+    if (freeRange.nextFree != MEMORY_POOL_NULL)
+        m_Ranges[freeRange.nextFree].prevFree = freeRange.prevFree;
+
+    if (freeRange.prevFree != MEMORY_POOL_NULL)
+        m_Ranges[freeRange.prevFree].nextFree = freeRange.nextFree;
+    else {
+        uint32_t fl = 0;
+        uint32_t sl = 0;
+        GetMemoryPoolListIndices(freeRange.size, fl, sl);
+
+        heap.freeLists[fl][sl] = freeRange.nextFree;
+        if (freeRange.nextFree == MEMORY_POOL_NULL) {
+            heap.slBitmaps[fl] &= ~(1u << sl);
+            if (!heap.slBitmaps[fl])
+                heap.flBitmap &= ~(1ull << fl);
+        }
+    }
+
+    freeRange.prevFree = MEMORY_POOL_NULL;
+    freeRange.nextFree = MEMORY_POOL_NULL;
+    freeRange.isFree = false;
+}
+
+void MemoryPoolImpl::PlaceInRange(MemoryPoolHeap& heap, uint32_t range, uint64_t size, uint64_t alignment) {
+    RemoveFreeRange(heap, range);
+
+    MemoryPoolBlock& block = m_Blocks[m_Ranges[range].block];
+    if (block.allocationNum++ == 0)
+        heap.emptyBlockNum--;
+
+    // Split off the padding in front
+    uint64_t offset = m_Ranges[range].offset;
+    uint64_t padding = Align(offset, alignment) - offset;
+
+    if (padding) {
+        uint32_t front = NewRange();
+        MemoryPoolRange& placedRange = m_Ranges[range];
+        MemoryPoolRange& frontRange = m_Ranges[front];
+
+        frontRange.offset = placedRange.offset;
+        frontRange.size = padding;
+        frontRange.block = placedRange.block;
+        frontRange.prevPhysical = placedRange.prevPhysical;
+        frontRange.nextPhysical = range;
+
+        if (placedRange.prevPhysical != MEMORY_POOL_NULL)
+            m_Ranges[placedRange.prevPhysical].nextPhysical = front;
+
+        placedRange.prevPhysical = front;
+        placedRange.offset += padding;
+        placedRange.size -= padding;
+
+        InsertFreeRange(heap, front);
+    }
+
+    // Split off the tail
+    if (m_Ranges[range].size > size) {
+        uint32_t back = NewRange();
+        MemoryPoolRange& placedRange = m_Ranges[range];
+        MemoryPoolRange& backRange = m_Ranges[back];
+
+        backRange.offset = placedRange.offset + size;
+        backRange.size = placedRange.size - size;
+        backRange.block = placedRange.block;
+        backRange.prevPhysical = range;
+        backRange.nextPhysical = placedRange.nextPhysical;
+
+        if (placedRange.nextPhysical != MEMORY_POOL_NULL)
+            m_Ranges[placedRange.nextPhysical].prevPhysical = back;
+
+        placedRange.nextPhysical = back;
+        placedRange.size = size;
+
+        InsertFreeRange(heap, back);
+    }
+}
+
+void MemoryPoolImpl::FreeRange(uint32_t range) {
+    uint32_t blockIndex = m_Ranges[range].block;
+    MemoryPoolBlock& block = m_Blocks[blockIndex];
+    MemoryPoolHeap& heap = m_Heaps[block.heap];
+
+    // Merge with free neighbors (adjacent free ranges never exist)
+    uint32_t prev = m_Ranges[range].prevPhysical;
+    if (prev != MEMORY_POOL_NULL && m_Ranges[prev].isFree) {
+        RemoveFreeRange(heap, prev);
+
+        MemoryPoolRange& prevRange = m_Ranges[prev];
+        prevRange.size += m_Ranges[range].size;
+        prevRange.nextPhysical = m_Ranges[range].nextPhysical;
+
+        if (prevRange.nextPhysical != MEMORY_POOL_NULL)
+            m_Ranges[prevRange.nextPhysical].prevPhysical = prev;
+
+        m_FreeRanges.push_back(range);
+        range = prev;
+    }
+
+    uint32_t next = m_Ranges[range].nextPhysical;
+    if (next != MEMORY_POOL_NULL && m_Ranges[next].isFree) {
+        RemoveFreeRange(heap, next);
+
+        MemoryPoolRange& mergedRange = m_Ranges[range];
+        mergedRange.size += m_Ranges[next].size;
+        mergedRange.nextPhysical = m_Ranges[next].nextPhysical;
+
+        if (mergedRange.nextPhysical != MEMORY_POOL_NULL)
+            m_Ranges[mergedRange.nextPhysical].prevPhysical = range;
+
+        m_FreeRanges.push_back(next);
+    }
+
+    // Keep only one empty block per memory type to avoid allocation churn
+    if (--block.allocationNum == 0) {
+        if (heap.emptyBlockNum) {
+            m_iCore.FreeMemory(block.memory);
+
+            m_BlockSize -= block.size;
+            block = {};
+
+            m_FreeRanges.push_back(range);
+            m_FreeBlocks.push_back(blockIndex);
+
+            return;
+        }
+
+        heap.emptyBlockNum++;
+    }
+
+    InsertFreeRange(heap, range);
+}
+
+// Texture pool
+static inline bool IsTextureDescEqual(const TextureDesc& a, const TextureDesc& b) {
+    return a.type == b.type
+        && a.usage == b.usage
+        && a.format == b.format
+        && a.width == b.width
+        && a.height == b.height
+        && a.depth == b.depth
+        && a.mipNum == b.mipNum
+        && a.layerNum == b.layerNum
+        && a.sampleNum == b.sampleNum
+        && a.sharingMode == b.sharingMode
+        && !memcmp(&a.optimizedClearValue, &b.optimizedClearValue, sizeof(a.optimizedClearValue));
+}
+
+TexturePoolImpl::~TexturePoolImpl() {
+    for (const TexturePoolEntry& entry : m_Entries) {
+        m_iCore.DestroyDescriptor(entry.view);
+        m_iCore.DestroyTexture(entry.texture);
+    }
+}
+
+Result TexturePoolImpl::Create(const TexturePoolDesc& desc) {
+    m_Desc = desc;
+
+    return nriGetInterface(m_Device, NRI_INTERFACE(ResourceAllocatorInterface), &m_iResourceAllocator);
+}
+
+Result TexturePoolImpl::Acquire(const TextureDesc& textureDesc, PooledTexture& pooledTexture) {
+    ExclusiveScope lock(m_Lock);
+
+    pooledTexture = {};
+    pooledTexture.handle = TEXTURE_POOL_NULL;
+
+    // Recycle the most recently released texture, which is no longer in use by the GPU
+    uint32_t handle = TEXTURE_POOL_NULL;
+    for (size_t i = m_UnusedEntries.size(); i > 0; i--) {
+        TexturePoolEntry& entry = m_Entries[m_UnusedEntries[i - 1]];
+
+        if (IsTextureDescEqual(entry.desc, textureDesc) && IsIdle(entry)) {
+            handle = m_UnusedEntries[i - 1];
+            m_UnusedEntries.erase(m_UnusedEntries.begin() + (i - 1));
+            m_UnusedSize -= entry.size;
+            m_HitNum++;
+
+            break;
+        }
+    }
+
+    // Textures released with pending fences may have kept the pool over budget since the last "Release"
+    Evict();
+
+    // Or create a new one
+    if (handle == TEXTURE_POOL_NULL) {
+        TexturePoolEntry entry = {};
+        Result result = CreateEntry(textureDesc, entry);
+        if (result != Result::SUCCESS)
+            return result;
+
+        if (m_FreeEntries.empty()) {
+            handle = (uint32_t)m_Entries.size();
+            m_Entries.push_back(entry);
+        } else {
+            handle = m_FreeEntries.back();
+            m_FreeEntries.pop_back();
+            m_Entries[handle] = entry;
+        }
+
+        m_Size += entry.size;
+        m_TextureNum++;
+        m_MissNum++;
+    }
+
+    TexturePoolEntry& entry = m_Entries[handle];
+    entry.isUsed = true;
+    entry.fence = nullptr;
+
+    pooledTexture.texture = entry.texture;
+    pooledTexture.view = entry.view;
+    pooledTexture.handle = handle;
+
+    return Result::SUCCESS;
+}
+
+void TexturePoolImpl::Release(uint32_t handle, Fence* fence, uint64_t value) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    if (handle == TEXTURE_POOL_NULL)
+        return;
+
+    ExclusiveScope lock(m_Lock);
+
+    RETURN_ON_FAILURE(&deviceBase, handle < m_Entries.size(), ReturnVoid(), "'handle' is out of bounds");
+
+    TexturePoolEntry& entry = m_Entries[handle];
+    RETURN_ON_FAILURE(&deviceBase, entry.isUsed, ReturnVoid(), "'handle' is already released");
+
+    entry.isUsed = false;
+    entry.fence = fence;
+    entry.fenceValue = value;
+
+    m_UnusedEntries.push_back(handle);
+    m_UnusedSize += entry.size;
+
+    Evict();
+}
+
+void TexturePoolImpl::GetStatistics(TexturePoolStatistics& statistics) {
+    ExclusiveScope lock(m_Lock);
+
+    statistics = {};
+    statistics.size = m_Size;
+    statistics.unusedSize = m_UnusedSize;
+    statistics.hitNum = m_HitNum;
+    statistics.missNum = m_MissNum;
+    statistics.evictedNum = m_EvictedNum;
+    statistics.textureNum = m_TextureNum;
+    statistics.unusedTextureNum = (uint32_t)m_UnusedEntries.size();
+}
+
+Result TexturePoolImpl::CreateEntry(const TextureDesc& textureDesc, TexturePoolEntry& entry) {
+    entry.desc = textureDesc;
+
+    AllocateTextureDesc allocateTextureDesc = {};
+    allocateTextureDesc.desc = textureDesc;
+    allocateTextureDesc.memoryLocation = MemoryLocation::DEVICE;
+
+    Result result = m_iResourceAllocator.AllocateTexture(m_Device, allocateTextureDesc, entry.texture);
+    if (result != Result::SUCCESS)
+        return result;
+
+    MemoryDesc memoryDesc = {};
+    m_iCore.GetTextureMemoryDesc(*entry.texture, MemoryLocation::DEVICE, memoryDesc);
+    entry.size = memoryDesc.size;
+
+    // The default view ("REMAINING" mips and layers if not specified)
+    bool isArray = textureDesc.layerNum > 1;
+
+    if (textureDesc.type == TextureType::TEXTURE_1D) {
+        Texture1DViewDesc viewDesc = {entry.texture, Texture1DViewType::SHADER_RESOURCE_1D, textureDesc.format, 0, 1, 0, textureDesc.layerNum};
+        if (textureDesc.usage & TextureUsageBits::SHADER_RESOURCE) {
+            viewDesc.viewType = isArray ? Texture1DViewType::SHADER_RESOURCE_1D_ARRAY : Texture1DViewType::SHADER_RESOURCE_1D;
+            viewDesc.mipNum = textureDesc.mipNum;
+        } else if (textureDesc.usage & TextureUsageBits::SHADER_RESOURCE_STORAGE)
+            viewDesc.viewType = isArray ? Texture1DViewType::SHADER_RESOURCE_STORAGE_1D_ARRAY : Texture1DViewType::SHADER_RESOURCE_STORAGE_1D;
+        else if (textureDesc.usage & TextureUsageBits::COLOR_ATTACHMENT)
+            viewDesc.viewType = Texture1DViewType::COLOR_ATTACHMENT;
+        else if (textureDesc.usage & TextureUsageBits::DEPTH_STENCIL_ATTACHMENT)
+            viewDesc.viewType = Texture1DViewType::DEPTH_STENCIL_ATTACHMENT;
+        else
+            return Result::SUCCESS;
+
+        result = m_iCore.CreateTexture1DView(viewDesc, entry.view);
+    } else if (textureDesc.type == TextureType::TEXTURE_2D) {
+        Texture2DViewDesc viewDesc = {entry.texture, Texture2DViewType::SHADER_RESOURCE_2D, textureDesc.format, 0, 1, 0, textureDesc.layerNum};
+        if (textureDesc.usage & TextureUsageBits::SHADER_RESOURCE) {
+            viewDesc.viewType = isArray ? Texture2DViewType::SHADER_RESOURCE_2D_ARRAY : Texture2DViewType::SHADER_RESOURCE_2D;
+            viewDesc.mipNum = textureDesc.mipNum;
+        } else if (textureDesc.usage & TextureUsageBits::SHADER_RESOURCE_STORAGE)
+            viewDesc.viewType = isArray ? Texture2DViewType::SHADER_RESOURCE_STORAGE_2D_ARRAY : Texture2DViewType::SHADER_RESOURCE_STORAGE_2D;
+        else if (textureDesc.usage & TextureUsageBits::COLOR_ATTACHMENT)
+            viewDesc.viewType = Texture2DViewType::COLOR_ATTACHMENT;
+        else if (textureDesc.usage & TextureUsageBits::DEPTH_STENCIL_ATTACHMENT)
+            viewDesc.viewType = Texture2DViewType::DEPTH_STENCIL_ATTACHMENT;
+        else
+            return Result::SUCCESS;
+
+        result = m_iCore.CreateTexture2DView(viewDesc, entry.view);
+    } else {
+        Texture3DViewDesc viewDesc = {entry.texture, Texture3DViewType::SHADER_RESOURCE_3D, textureDesc.format, 0, 1, 0, textureDesc.depth};
+        if (textureDesc.usage & TextureUsageBits::SHADER_RESOURCE) {
+            viewDesc.viewType = Texture3DViewType::SHADER_RESOURCE_3D;
+            viewDesc.mipNum = textureDesc.mipNum;
+        } else if (textureDesc.usage & TextureUsageBits::SHADER_RESOURCE_STORAGE)
+            viewDesc.viewType = Texture3DViewType::SHADER_RESOURCE_STORAGE_3D;
+        else if (textureDesc.usage & TextureUsageBits::COLOR_ATTACHMENT)
+            viewDesc.viewType = Texture3DViewType::COLOR_ATTACHMENT;
+        else
+            return Result::SUCCESS;
+
+        result = m_iCore.CreateTexture3DView(viewDesc, entry.view);
+    }
+
+    if (result != Result::SUCCESS) {
+        m_iCore.DestroyTexture(entry.texture);
+        entry = {};
+    }
+
+    return result;
+}
+
+void TexturePoolImpl::DestroyEntry(uint32_t handle) {
+    TexturePoolEntry& entry = m_Entries[handle];
+
+    m_iCore.DestroyDescriptor(entry.view);
+    m_iCore.DestroyTexture(entry.texture);
+
+    m_Size -= entry.size;
+    m_TextureNum--;
+    m_EvictedNum++;
+
+    entry = {};
+    m_FreeEntries.push_back(handle);
+}
+
+void TexturePoolImpl::Evict() {
+    if (!m_Desc.budgetSize)
+        return;
+
+    // Least recently released first, skipping textures still in use by the GPU
+    for (size_t i = 0; i < m_UnusedEntries.size() && m_UnusedSize > m_Desc.budgetSize;) {
+        uint32_t handle = m_UnusedEntries[i];
+        const TexturePoolEntry& entry = m_Entries[handle];
+
+        if (IsIdle(entry)) {
+            m_UnusedSize -= entry.size;
+            m_UnusedEntries.erase(m_UnusedEntries.begin() + i);
+
+            DestroyEntry(handle);
+        } else
+            i++;
+    }
+}
+
+bool TexturePoolImpl::IsIdle(const TexturePoolEntry& entry) {
+    return !entry.fence || m_iCore.GetFenceValue(*entry.fence) >= entry.fenceValue;
+}
@@ -0,0 +1,52 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct AlphaTexture {
+    const uint8_t* data;
+    uint32_t width;
+    uint32_t height;
+    uint32_t rowPitch;
+    uint32_t stride;
+    uint32_t alphaOffset;
+    uint32_t alphaBytes;
+    AddressMode addressMode;
+    bool isFloat;
+};
+
+struct MicromapBakerImpl : public DebugNameBase {
+    inline MicromapBakerImpl(Device& device)
+        : m_Device(device)
+        , m_Blocks(((DeviceBase&)device).GetStdAllocator())
+        , m_BlockStates(((DeviceBase&)device).GetStdAllocator())
+        , m_Data(((DeviceBase&)device).GetStdAllocator())
+        , m_Triangles(((DeviceBase&)device).GetStdAllocator())
+        , m_Indices(((DeviceBase&)device).GetStdAllocator())
+        , m_BlockHashes(((DeviceBase&)device).GetStdAllocator()) {
+    }
+
+    inline Device& GetDevice() {
+        return m_Device;
+    }
+
+    Result Create(const MicromapBakerDesc& desc);
+    Result Bake(const MicromapBakeDesc& micromapBakeDesc, MicromapBakeResult& micromapBakeResult);
+
+private:
+    void BakeTriangles(const MicromapBakeDesc& micromapBakeDesc, const AlphaTexture& alphaTexture, uint32_t triangleBegin, uint32_t triangleEnd);
+
+private:
+    Device& m_Device;
+    Vector<uint8_t> m_Blocks;      // per geometry triangle, packed micro triangle states
+    Vector<uint8_t> m_BlockStates; // per geometry triangle, state if uniform
+    Vector<uint8_t> m_Data;
+    Vector<MicromapTriangle> m_Triangles;
+    Vector<uint32_t> m_Indices;
+    UnorderedMap<uint64_t, uint32_t> m_BlockHashes;
+    MicromapUsageDesc m_Usage = {};
+    uint32_t m_ThreadNum = 1;
+};
+
+} // namespace nri
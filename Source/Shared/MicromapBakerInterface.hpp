@@ -0,0 +1,477 @@
+// © 2025 NVIDIA Corporation
+
+constexpr uint32_t MICROMAP_MAX_SUBDIVISION_LEVEL = 12;
+constexpr uint32_t MICROMAP_TRIANGLES_PER_JOB = 64;
+constexpr uint32_t MICROMAP_MAX_TEXELS_PER_MICRO_TRIANGLE = 4096; // larger footprints are point-sampled
+constexpr uint32_t MICROMAP_SAMPLE_GRID_SIZE = 64;
+constexpr uint8_t MICROMAP_STATE_MIXED = 0xFF;
+
+// States match "VkOpacityMicromapStateEXT" and "D3D12_RAYTRACING_OPACITY_MICROMAP_STATE"
+constexpr uint8_t MICROMAP_STATE_TRANSPARENT = 0;
+constexpr uint8_t MICROMAP_STATE_OPAQUE = 1;
+constexpr uint8_t MICROMAP_STATE_UNKNOWN_TRANSPARENT = 2;
+constexpr uint8_t MICROMAP_STATE_UNKNOWN_OPAQUE = 3;
+
+struct Float2 {
+    float x, y;
+};
+
+// https://registry.khronos.org/vulkan/specs/latest/html/vkspec.html#micromap-barycentric
+static inline uint32_t ExtractEvenBits(uint32_t x) {
+    x &= 0x55555555;
+    x = (x | (x >> 1)) & 0x33333333;
+    x = (x | (x >> 2)) & 0x0f0f0f0f;
+    x = (x | (x >> 4)) & 0x00ff00ff;
+    x = (x | (x >> 8)) & 0x0000ffff;
+
+    return x;
+}
+
+static inline uint32_t PrefixEor(uint32_t x) {
+    x ^= (x >> 1);
+    x ^= (x >> 2);
+    x ^= (x >> 4);
+    x ^= (x >> 8);
+
+    return x;
+}
+
+static void MicroTriangleIndexToBarycentrics(uint32_t index, uint32_t subdivisionLevel, Float2 bary[3]) {
+    if (subdivisionLevel == 0) {
+        bary[0] = {0.0f, 0.0f};
+        bary[1] = {1.0f, 0.0f};
+        bary[2] = {0.0f, 1.0f};
+
+        return;
+    }
+
+    // Distance along the "bird" curve to discrete barycentrics
+    uint32_t b0 = ExtractEvenBits(index);
+    uint32_t b1 = ExtractEvenBits(index >> 1);
+
+    uint32_t fx = PrefixEor(b0);
+    uint32_t fy = PrefixEor(b0 & ~b1);
+    uint32_t t = fy ^ b1;
+
+    uint32_t mask = (1u << subdivisionLevel) - 1;
+    uint32_t iu = ((fx & ~t) | (b0 & ~t) | (~b0 & ~fx & t)) & mask;
+    uint32_t iv = (fy ^ b0) & mask;
+    uint32_t iw = ((~fx & ~t) | (b0 & ~t) | (~b0 & fx & t)) & mask;
+
+    bool upright = ((iu & 1) ^ (iv & 1) ^ (iw & 1)) != 0;
+    if (!upright) {
+        iu++;
+        iv++;
+    }
+
+    float scale = 1.0f / float(1u << subdivisionLevel);
+    float u = float(iu) * scale;
+    float v = float(iv) * scale;
+
+    if (upright) {
+        bary[0] = {u, v};
+        bary[1] = {u + scale, v};
+        bary[2] = {u, v + scale};
+    } else {
+        bary[0] = {u, v};
+        bary[1] = {u - scale, v};
+        bary[2] = {u, v - scale};
+    }
+}
+
+static inline float HalfToFloat(uint16_t h) {
+    uint32_t sign = uint32_t(h & 0x8000) << 16;
+    uint32_t exponent = (h >> 10) & 0x1F;
+    uint32_t mantissa = h & 0x3FF;
+
+    uint32_t bits;
+    if (exponent == 0) {
+        if (mantissa == 0)
+            bits = sign;
+        else { // denormal
+            exponent = 127 - 14;
+            while (!(mantissa & 0x400)) {
+                mantissa <<= 1;
+                exponent--;
+            }
+            bits = sign | (exponent << 23) | ((mantissa & 0x3FF) << 13);
+        }
+    } else if (exponent == 0x1F)
+        bits = sign | 0x7F800000 | (mantissa << 13);
+    else
+        bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+
+    return f;
+}
+
+static inline int32_t ApplyAddressMode(int32_t x, int32_t size, AddressMode addressMode) {
+    if (addressMode == AddressMode::REPEAT) {
+        x %= size;
+        return x < 0 ? x + size : x;
+    }
+
+    if (addressMode == AddressMode::MIRRORED_REPEAT) {
+        int32_t period = size * 2;
+        x %= period;
+        x = x < 0 ? x + period : x;
+
+        return x < size ? x : period - 1 - x;
+    }
+
+    return std::min(std::max(x, 0), size - 1);
+}
+
+static inline float FetchAlpha(const AlphaTexture& alphaTexture, int32_t x, int32_t y) {
+    x = ApplyAddressMode(x, (int32_t)alphaTexture.width, alphaTexture.addressMode);
+    y = ApplyAddressMode(y, (int32_t)alphaTexture.height, alphaTexture.addressMode);
+
+    const uint8_t* texel = alphaTexture.data + (size_t)y * alphaTexture.rowPitch + (size_t)x * alphaTexture.stride + alphaTexture.alphaOffset;
+
+    if (alphaTexture.alphaBytes == 1)
+        return float(*texel) / 255.0f;
+
+    if (alphaTexture.alphaBytes == 2) {
+        uint16_t value;
+        memcpy(&value, texel, sizeof(value));
+
+        return alphaTexture.isFloat ? HalfToFloat(value) : float(value) / 65535.0f;
+    }
+
+    float value;
+    memcpy(&value, texel, sizeof(value));
+
+    return value;
+}
+
+static inline bool IsTexelOverlapped(const Float2 p[3], int32_t x, int32_t y) {
+    // Separating axis test: box axes are covered by the bounding box, triangle edge normals are checked here
+    float cx = float(x) + 0.5f;
+    float cy = float(y) + 0.5f;
+
+    for (uint32_t i = 0; i < 3; i++) {
+        const Float2& a = p[i];
+        const Float2& b = p[(i + 1) % 3];
+
+        float nx = a.y - b.y;
+        float ny = b.x - a.x;
+
+        float d0 = nx * p[0].x + ny * p[0].y;
+        float d1 = nx * p[1].x + ny * p[1].y;
+        float d2 = nx * p[2].x + ny * p[2].y;
+        float triMin = std::min(d0, std::min(d1, d2));
+        float triMax = std::max(d0, std::max(d1, d2));
+
+        float c = nx * cx + ny * cy;
+        float r = 0.5f * (std::abs(nx) + std::abs(ny));
+
+        if (c + r < triMin || c - r > triMax)
+            return false;
+    }
+
+    return true;
+}
+
+static uint8_t ClassifyMicroTriangle(const AlphaTexture& alphaTexture, const Float2 uv[3], float alphaCutoff, MicromapFormat format) {
+    Float2 p[3];
+    for (uint32_t i = 0; i < 3; i++)
+        p[i] = {uv[i].x * float(alphaTexture.width), uv[i].y * float(alphaTexture.height)};
+
+    float minX = std::min(p[0].x, std::min(p[1].x, p[2].x));
+    float minY = std::min(p[0].y, std::min(p[1].y, p[2].y));
+    float maxX = std::max(p[0].x, std::max(p[1].x, p[2].x));
+    float maxY = std::max(p[0].y, std::max(p[1].y, p[2].y));
+
+    // Texel space can be huge for tiled textures
+    constexpr float maxCoord = float(1 << 30);
+    minX = std::max(minX, -maxCoord);
+    minY = std::max(minY, -maxCoord);
+    maxX = std::min(maxX, maxCoord);
+    maxY = std::min(maxY, maxCoord);
+
+    int32_t x0 = (int32_t)std::floor(minX);
+    int32_t y0 = (int32_t)std::floor(minY);
+    int32_t x1 = (int32_t)std::floor(maxX);
+    int32_t y1 = (int32_t)std::floor(maxY);
+
+    uint32_t opaqueNum = 0;
+    uint32_t transparentNum = 0;
+
+    uint64_t texelNum = uint64_t(int64_t(x1) - x0 + 1) * uint64_t(int64_t(y1) - y0 + 1);
+    if (texelNum <= MICROMAP_MAX_TEXELS_PER_MICRO_TRIANGLE) {
+        // Conservative: all overlapped texels
+        for (int32_t y = y0; y <= y1; y++) {
+            for (int32_t x = x0; x <= x1; x++) {
+                if (!IsTexelOverlapped(p, x, y))
+                    continue;
+
+                if (FetchAlpha(alphaTexture, x, y) >= alphaCutoff)
+                    opaqueNum++;
+                else
+                    transparentNum++;
+            }
+        }
+    } else {
+        // Approximate: a regular grid of samples
+        constexpr float invSize = 1.0f / float(MICROMAP_SAMPLE_GRID_SIZE);
+
+        for (uint32_t j = 0; j < MICROMAP_SAMPLE_GRID_SIZE; j++) {
+            for (uint32_t i = 0; i < MICROMAP_SAMPLE_GRID_SIZE - j; i++) {
+                float u = (float(i) + 1.0f / 3.0f) * invSize;
+                float v = (float(j) + 1.0f / 3.0f) * invSize;
+                float w = 1.0f - u - v;
+
+                float x = p[0].x * w + p[1].x * u + p[2].x * v;
+                float y = p[0].y * w + p[1].y * u + p[2].y * v;
+
+                if (FetchAlpha(alphaTexture, (int32_t)std::floor(x), (int32_t)std::floor(y)) >= alphaCutoff)
+                    opaqueNum++;
+                else
+                    transparentNum++;
+            }
+        }
+    }
+
+    // Degenerate footprint: use the centroid
+    if (opaqueNum + transparentNum == 0) {
+        float x = (p[0].x + p[1].x + p[2].x) / 3.0f;
+        float y = (p[0].y + p[1].y + p[2].y) / 3.0f;
+
+        return FetchAlpha(alphaTexture, (int32_t)std::floor(x), (int32_t)std::floor(y)) >= alphaCutoff ? MICROMAP_STATE_OPAQUE : MICROMAP_STATE_TRANSPARENT;
+    }
+
+    if (transparentNum == 0)
+        return MICROMAP_STATE_OPAQUE;
+
+    if (opaqueNum == 0)
+        return MICROMAP_STATE_TRANSPARENT;
+
+    if (format == MicromapFormat::OPACITY_4_STATE)
+        return opaqueNum >= transparentNum ? MICROMAP_STATE_UNKNOWN_OPAQUE : MICROMAP_STATE_UNKNOWN_TRANSPARENT;
+
+    return opaqueNum >= transparentNum ? MICROMAP_STATE_OPAQUE : MICROMAP_STATE_TRANSPARENT;
+}
+
+static inline uint64_t HashBlock(const uint8_t* data, size_t size) {
+    uint64_t hash = 14695981039346656037ull; // FNV-1a
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+static inline MicromapSpecialIndex GetSpecialIndex(uint8_t state) {
+    switch (state) {
+        case MICROMAP_STATE_TRANSPARENT:
+            return MicromapSpecialIndex::FULLY_TRANSPARENT;
+        case MICROMAP_STATE_OPAQUE:
+            return MicromapSpecialIndex::FULLY_OPAQUE;
+        case MICROMAP_STATE_UNKNOWN_TRANSPARENT:
+            return MicromapSpecialIndex::FULLY_UNKNOWN_TRANSPARENT;
+        default:
+            return MicromapSpecialIndex::FULLY_UNKNOWN_OPAQUE;
+    }
+}
+
+Result MicromapBakerImpl::Create(const MicromapBakerDesc& desc) {
+    m_ThreadNum = desc.threadNum ? desc.threadNum : std::thread::hardware_concurrency();
+    m_ThreadNum = std::max(m_ThreadNum, 1u);
+
+    return Result::SUCCESS;
+}
+
+void MicromapBakerImpl::BakeTriangles(const MicromapBakeDesc& desc, const AlphaTexture& alphaTexture, uint32_t triangleBegin, uint32_t triangleEnd) {
+    uint32_t microTriangleNum = 1u << (desc.subdivisionLevel * 2);
+    uint32_t bitsPerState = desc.format == MicromapFormat::OPACITY_4_STATE ? 2 : 1;
+    size_t blockSize = ((size_t)microTriangleNum * bitsPerState + 7) / 8;
+    uint32_t texcoordStride = desc.texcoordStride ? desc.texcoordStride : sizeof(Float2);
+
+    for (uint32_t i = triangleBegin; i < triangleEnd; i++) {
+        // Fetch texcoords
+        Float2 uv[3];
+        for (uint32_t j = 0; j < 3; j++) {
+            uint32_t vertex = i * 3 + j;
+            if (desc.indices)
+                vertex = desc.indexType == IndexType::UINT16 ? ((const uint16_t*)desc.indices)[vertex] : ((const uint32_t*)desc.indices)[vertex];
+
+            const float* texcoord = (const float*)((const uint8_t*)desc.texcoords + (size_t)vertex * texcoordStride);
+            uv[j] = {texcoord[0], texcoord[1]};
+        }
+
+        // Classify micro triangles
+        uint8_t* block = m_Blocks.data() + i * blockSize;
+        memset(block, 0, blockSize);
+
+        uint8_t uniformState = MICROMAP_STATE_MIXED;
+        for (uint32_t m = 0; m < microTriangleNum; m++) {
+            Float2 bary[3];
+            MicroTriangleIndexToBarycentrics(m, desc.subdivisionLevel, bary);
+
+            Float2 microUv[3];
+            for (uint32_t j = 0; j < 3; j++) {
+                float u = bary[j].x;
+                float v = bary[j].y;
+                float w = 1.0f - u - v;
+
+                microUv[j] = {uv[0].x * w + uv[1].x * u + uv[2].x * v, uv[0].y * w + uv[1].y * u + uv[2].y * v};
+            }
+
+            uint8_t state = ClassifyMicroTriangle(alphaTexture, microUv, desc.alphaCutoff, desc.format);
+
+            uint32_t bit = m * bitsPerState;
+            block[bit >> 3] |= (uint8_t)(state << (bit & 7));
+
+            if (m == 0)
+                uniformState = state;
+            else if (uniformState != state)
+                uniformState = MICROMAP_STATE_MIXED;
+        }
+
+        m_BlockStates[i] = uniformState;
+    }
+}
+
+Result MicromapBakerImpl::Bake(const MicromapBakeDesc& desc, MicromapBakeResult& result) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+    result = {};
+
+    RETURN_ON_FAILURE(&deviceBase, desc.texcoords, Result::INVALID_ARGUMENT, "'texcoords' is NULL");
+    RETURN_ON_FAILURE(&deviceBase, desc.alphaData, Result::INVALID_ARGUMENT, "'alphaData' is NULL");
+    RETURN_ON_FAILURE(&deviceBase, desc.alphaWidth && desc.alphaHeight, Result::INVALID_ARGUMENT, "'alphaWidth' and 'alphaHeight' must be > 0");
+    RETURN_ON_FAILURE(&deviceBase, desc.subdivisionLevel <= MICROMAP_MAX_SUBDIVISION_LEVEL, Result::INVALID_ARGUMENT, "'subdivisionLevel' must be <= %u", MICROMAP_MAX_SUBDIVISION_LEVEL);
+    RETURN_ON_FAILURE(&deviceBase, desc.format == MicromapFormat::OPACITY_2_STATE || desc.format == MicromapFormat::OPACITY_4_STATE, Result::INVALID_ARGUMENT, "'format' is invalid");
+    RETURN_ON_FAILURE(&deviceBase, desc.addressMode == AddressMode::REPEAT || desc.addressMode == AddressMode::MIRRORED_REPEAT || desc.addressMode == AddressMode::CLAMP_TO_EDGE,
+        Result::INVALID_ARGUMENT, "'addressMode' must be REPEAT, MIRRORED_REPEAT or CLAMP_TO_EDGE");
+
+    // Alpha texture
+    const FormatProps& formatProps = GetFormatProps(desc.alphaFormat);
+    uint32_t channelNum = (formatProps.redBits ? 1 : 0) + (formatProps.greenBits ? 1 : 0) + (formatProps.blueBits ? 1 : 0) + (formatProps.alphaBits ? 1 : 0);
+    bool isSupported = channelNum && !formatProps.isCompressed && !formatProps.isPacked && !formatProps.isDepth && !formatProps.isExpShared && !formatProps.isInteger;
+    isSupported = isSupported && (formatProps.isFloat ? (formatProps.redBits == 16 || formatProps.redBits == 32) : (formatProps.isNorm && !formatProps.isSigned && (formatProps.redBits == 8 || formatProps.redBits == 16)));
+    RETURN_ON_FAILURE(&deviceBase, isSupported, Result::INVALID_ARGUMENT, "'alphaFormat=%s' is not supported", formatProps.name);
+
+    AlphaTexture alphaTexture = {};
+    alphaTexture.data = (const uint8_t*)desc.alphaData;
+    alphaTexture.width = desc.alphaWidth;
+    alphaTexture.height = desc.alphaHeight;
+    alphaTexture.stride = formatProps.stride;
+    alphaTexture.alphaBytes = formatProps.stride / channelNum;
+    alphaTexture.alphaOffset = formatProps.alphaBits ? alphaTexture.alphaBytes * (channelNum - 1) : 0;
+    alphaTexture.rowPitch = desc.alphaRowPitch ? desc.alphaRowPitch : desc.alphaWidth * formatProps.stride;
+    alphaTexture.addressMode = desc.addressMode;
+    alphaTexture.isFloat = formatProps.isFloat;
+
+    // Geometry
+    uint32_t triangleNum = (desc.indices ? desc.indexNum : desc.vertexNum) / 3;
+    if (desc.indices) {
+        for (uint32_t i = 0; i < triangleNum * 3; i++) {
+            uint32_t index = desc.indexType == IndexType::UINT16 ? ((const uint16_t*)desc.indices)[i] : ((const uint32_t*)desc.indices)[i];
+            RETURN_ON_FAILURE(&deviceBase, index < desc.vertexNum, Result::INVALID_ARGUMENT, "'indices[%u]=%u' is out of bounds", i, index);
+        }
+    }
+
+    uint32_t microTriangleNum = 1u << (desc.subdivisionLevel * 2);
+    uint32_t bitsPerState = desc.format == MicromapFormat::OPACITY_4_STATE ? 2 : 1;
+    size_t blockSize = ((size_t)microTriangleNum * bitsPerState + 7) / 8;
+
+    m_Blocks.resize(triangleNum * blockSize);
+    m_BlockStates.resize(triangleNum);
+    m_Indices.resize(triangleNum);
+    m_Data.clear();
+    m_Triangles.clear();
+    m_BlockHashes.clear();
+
+    { // Bake in parallel: jobs are independent and write to disjoint memory, thus results don't depend on the thread count
+        uint32_t jobNum = (triangleNum + MICROMAP_TRIANGLES_PER_JOB - 1) / MICROMAP_TRIANGLES_PER_JOB;
+        uint32_t threadNum = std::min(m_ThreadNum, jobNum);
+        std::atomic_uint32_t nextJob = 0;
+
+        auto worker = [&]() {
+            for (uint32_t job = nextJob.fetch_add(1, std::memory_order_relaxed); job < jobNum; job = nextJob.fetch_add(1, std::memory_order_relaxed)) {
+                uint32_t triangleBegin = job * MICROMAP_TRIANGLES_PER_JOB;
+                uint32_t triangleEnd = std::min(triangleBegin + MICROMAP_TRIANGLES_PER_JOB, triangleNum);
+
+                BakeTriangles(desc, alphaTexture, triangleBegin, triangleEnd);
+            }
+        };
+
+        Vector<std::thread> threads(((DeviceBase&)m_Device).GetStdAllocator());
+        for (uint32_t i = 1; i < threadNum; i++)
+            threads.emplace_back(worker);
+
+        worker();
+
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+
+    // Gather in the geometry order
+    for (uint32_t i = 0; i < triangleNum; i++) {
+        uint8_t state = m_BlockStates[i];
+        if (state != MICROMAP_STATE_MIXED && !desc.disableSpecialIndices) {
+            m_Indices[i] = (uint32_t)(int32_t)GetSpecialIndex(state);
+
+            if (state == MICROMAP_STATE_OPAQUE)
+                result.fullyOpaqueNum++;
+            else if (state == MICROMAP_STATE_TRANSPARENT)
+                result.fullyTransparentNum++;
+            else
+                result.fullyUnknownNum++;
+
+            continue;
+        }
+
+        const uint8_t* block = m_Blocks.data() + i * blockSize;
+
+        uint64_t hash = 0;
+        if (!desc.disableReuse) {
+            hash = HashBlock(block, blockSize);
+
+            auto entry = m_BlockHashes.find(hash);
+            if (entry != m_BlockHashes.end()) {
+                const MicromapTriangle& triangle = m_Triangles[entry->second];
+                if (!memcmp(m_Data.data() + triangle.dataOffset, block, blockSize)) {
+                    m_Indices[i] = entry->second;
+                    result.reusedNum++;
+
+                    continue;
+                }
+            }
+        }
+
+        RETURN_ON_FAILURE(&deviceBase, m_Data.size() + blockSize <= UINT32_MAX, Result::OUT_OF_MEMORY, "micromap data exceeds 4 Gb");
+
+        uint32_t triangleIndex = (uint32_t)m_Triangles.size();
+
+        MicromapTriangle& triangle = m_Triangles.emplace_back();
+        triangle.dataOffset = (uint32_t)m_Data.size();
+        triangle.subdivisionLevel = desc.subdivisionLevel;
+        triangle.format = desc.format;
+
+        m_Data.insert(m_Data.end(), block, block + blockSize);
+        m_Indices[i] = triangleIndex;
+
+        if (!desc.disableReuse)
+            m_BlockHashes.emplace(hash, triangleIndex);
+    }
+
+    m_Usage.triangleNum = (uint32_t)m_Triangles.size();
+    m_Usage.subdivisionLevel = desc.subdivisionLevel;
+    m_Usage.format = desc.format;
+
+    // Output
+    result.data = m_Data.data();
+    result.dataSize = m_Data.size();
+    result.triangles = m_Triangles.data();
+    result.triangleNum = (uint32_t)m_Triangles.size();
+    result.usages = &m_Usage;
+    result.usageNum = m_Triangles.empty() ? 0 : 1;
+    result.indices = m_Indices.data();
+    result.indexNum = triangleNum;
+
+    return Result::SUCCESS;
+}
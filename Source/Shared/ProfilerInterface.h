@@ -0,0 +1,143 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct ProfilerRangeRecord {
+    uint64_t key;       // hash of the path
+    uint32_t parent;    // index in the frame or "PROFILER_NO_PARENT"
+    uint32_t depth;
+    uint32_t queryIndex; // begin timestamp, end is "+1", relative to the frame
+};
+
+struct ProfilerNode {
+    uint64_t key;
+    uint32_t parent;        // node index, "PROFILER_NO_PARENT" for top level nodes
+    uint32_t firstChild;
+    uint32_t lastChild;
+    uint32_t nextSibling;
+    uint32_t outIndex;      // in "m_Ranges"
+};
+
+struct ProfilerFrame {
+    inline ProfilerFrame(StdAllocator<uint8_t>& stdAllocator)
+        : ranges(stdAllocator)
+        , statistics(stdAllocator) {
+    }
+
+    Vector<ProfilerRangeRecord> ranges;
+    Vector<uint32_t> statistics; // index in "m_StatisticsHistory", the query index is the index in this array
+    uint32_t queryNum = 0;
+    bool isRecorded = false;
+};
+
+struct ProfilerRangeHistory {
+    inline ProfilerRangeHistory(StdAllocator<uint8_t>& stdAllocator)
+        : name(stdAllocator)
+        , times(stdAllocator) {
+    }
+
+    String name;
+    Vector<double> times; // ring buffer, negative if not seen
+    uint32_t head = 0;
+    uint32_t lastFrameIndex = 0; // the last frame where the range has been recorded
+};
+
+struct ProfilerStatisticsHistory {
+    inline ProfilerStatisticsHistory(StdAllocator<uint8_t>& stdAllocator)
+        : name(stdAllocator)
+        , samples(stdAllocator)
+        , isSeen(stdAllocator) {
+    }
+
+    String name;
+    Vector<PipelineStatisticsDesc> samples; // ring buffer
+    Vector<bool> isSeen;
+};
+
+struct ProfilerImpl : public DebugNameBase {
+    inline ProfilerImpl(Device& device, const CoreInterface& NRI)
+        : m_Device(device)
+        , m_iCore(NRI)
+        , m_Frames(((DeviceBase&)device).GetStdAllocator())
+        , m_History(((DeviceBase&)device).GetStdAllocator())
+        , m_Ranges(((DeviceBase&)device).GetStdAllocator())
+        , m_Stack(((DeviceBase&)device).GetStdAllocator())
+        , m_Nodes(((DeviceBase&)device).GetStdAllocator())
+        , m_NodeMap(((DeviceBase&)device).GetStdAllocator())
+        , m_RecordToNode(((DeviceBase&)device).GetStdAllocator())
+        , m_StatisticsHistory(((DeviceBase&)device).GetStdAllocator())
+        , m_StatisticsMap(((DeviceBase&)device).GetStdAllocator())
+        , m_Statistics(((DeviceBase&)device).GetStdAllocator()) {
+    }
+
+    inline Device& GetDevice() {
+        return m_Device;
+    }
+
+    inline const ProfilerRange* GetRanges(uint32_t& rangeNum) const {
+        rangeNum = (uint32_t)m_Ranges.size();
+
+        return m_Ranges.data();
+    }
+
+    inline const ProfilerStatistics* GetStatistics(uint32_t& statisticsNum) const {
+        statisticsNum = (uint32_t)m_Statistics.size();
+
+        return m_Statistics.data();
+    }
+
+    ~ProfilerImpl();
+
+    Result Create(const ProfilerDesc& desc);
+    void CmdBeginFrame(CommandBuffer& commandBuffer);
+    void CmdEndFrame(CommandBuffer& commandBuffer);
+    void CmdBeginRange(CommandBuffer& commandBuffer, const char* name, uint32_t bgra);
+    void CmdEndRange(CommandBuffer& commandBuffer);
+    void CmdBeginStatistics(CommandBuffer& commandBuffer, const char* name);
+    void CmdEndStatistics(CommandBuffer& commandBuffer);
+    void EndFrame();
+
+    //================================================================================================================
+    // DebugNameBase
+    //================================================================================================================
+
+    void SetDebugName(const char* name) DEBUG_NAME_OVERRIDE {
+        m_iCore.SetDebugName(m_QueryPool, name);
+        m_iCore.SetDebugName(m_StatisticsQueryPool, name);
+        m_iCore.SetDebugName(m_ReadbackBuffer, name);
+    }
+
+private:
+    void Resolve(ProfilerFrame& frame, uint32_t frameSlot);
+    void BuildTree(const ProfilerFrame& frame);
+    void ResolveStatistics(ProfilerFrame& frame, uint32_t frameSlot);
+
+private:
+    Device& m_Device;
+    const CoreInterface& m_iCore;
+    ProfilerDesc m_Desc = {};
+    ResourceAllocatorInterface m_iResourceAllocator = {};
+    Vector<ProfilerFrame> m_Frames;
+    UnorderedMap<uint64_t, ProfilerRangeHistory> m_History;
+    Vector<ProfilerRange> m_Ranges;
+    Vector<uint32_t> m_Stack;
+    Vector<ProfilerNode> m_Nodes;                  // scratch for "Resolve"
+    UnorderedMap<uint64_t, uint32_t> m_NodeMap;    // scratch for "Resolve"
+    Vector<uint32_t> m_RecordToNode;               // scratch for "Resolve"
+    Vector<ProfilerStatisticsHistory> m_StatisticsHistory;
+    UnorderedMap<uint64_t, uint32_t> m_StatisticsMap;
+    Vector<ProfilerStatistics> m_Statistics;
+    QueryPool* m_QueryPool = nullptr;
+    QueryPool* m_StatisticsQueryPool = nullptr;
+    Buffer* m_ReadbackBuffer = nullptr;
+    double m_TicksToMs = 0.0;
+    uint64_t m_StatisticsOffset = 0; // in "m_ReadbackBuffer"
+    uint32_t m_StatisticsQuerySize = 0;
+    uint32_t m_FrameIndex = 0;
+    uint32_t m_QueriesPerFrame = 0;
+    bool m_IsStatisticsActive = false;
+};
+
+} // namespace nri
@@ -0,0 +1,441 @@
+// © 2025 NVIDIA Corporation
+
+constexpr uint32_t PROFILER_DEFAULT_HISTORY_FRAME_NUM = 60;
+constexpr uint32_t PROFILER_NO_QUERY = uint32_t(-1);
+constexpr uint32_t PROFILER_STATISTICS_NUM = sizeof(PipelineStatisticsDesc) / sizeof(uint64_t);
+
+static inline uint64_t HashRangePath(uint64_t parentKey, const char* name) {
+    uint64_t hash = parentKey ^ 14695981039346656037ull; // FNV-1a
+    for (const char* c = name; *c; c++) {
+        hash ^= (uint8_t)*c;
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+ProfilerImpl::~ProfilerImpl() {
+    m_iCore.DestroyQueryPool(m_QueryPool);
+    m_iCore.DestroyQueryPool(m_StatisticsQueryPool);
+    m_iCore.DestroyBuffer(m_ReadbackBuffer);
+}
+
+Result ProfilerImpl::Create(const ProfilerDesc& desc) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    const DeviceDesc& deviceDesc = m_iCore.GetDeviceDesc(m_Device);
+
+    RETURN_ON_FAILURE(&deviceBase, desc.rangeMaxNum, Result::INVALID_ARGUMENT, "'rangeMaxNum' must be > 0");
+    RETURN_ON_FAILURE(&deviceBase, !desc.statisticsRangeMaxNum || deviceDesc.features.pipelineStatistics, Result::UNSUPPORTED, "'features.pipelineStatistics' is not supported");
+
+    Result result = nriGetInterface(m_Device, NRI_INTERFACE(ResourceAllocatorInterface), &m_iResourceAllocator);
+    if (result != Result::SUCCESS)
+        return result;
+
+    m_Desc = desc;
+    if (!m_Desc.historyFrameNum)
+        m_Desc.historyFrameNum = PROFILER_DEFAULT_HISTORY_FRAME_NUM;
+
+    uint32_t frameNum = m_Desc.queuedFrameNum + 1;
+    m_QueriesPerFrame = m_Desc.rangeMaxNum * 2;
+
+    // Query pool
+    QueryPoolDesc queryPoolDesc = {};
+    queryPoolDesc.queryType = QueryType::TIMESTAMP;
+    queryPoolDesc.capacity = m_QueriesPerFrame * frameNum;
+
+    result = m_iCore.CreateQueryPool(m_Device, queryPoolDesc, m_QueryPool);
+    if (result != Result::SUCCESS)
+        return result;
+
+    m_StatisticsOffset = queryPoolDesc.capacity * sizeof(uint64_t);
+
+    // Pipeline statistics query pool
+    uint64_t statisticsSize = 0;
+    if (m_Desc.statisticsRangeMaxNum) {
+        queryPoolDesc.queryType = QueryType::PIPELINE_STATISTICS;
+        queryPoolDesc.capacity = m_Desc.statisticsRangeMaxNum * frameNum;
+
+        result = m_iCore.CreateQueryPool(m_Device, queryPoolDesc, m_StatisticsQueryPool);
+        if (result != Result::SUCCESS)
+            return result;
+
+        m_StatisticsQuerySize = m_iCore.GetQuerySize(*m_StatisticsQueryPool);
+        statisticsSize = queryPoolDesc.capacity * m_StatisticsQuerySize;
+    }
+
+    // Readback buffer
+    AllocateBufferDesc allocateBufferDesc = {};
+    allocateBufferDesc.desc.size = m_StatisticsOffset + statisticsSize;
+    allocateBufferDesc.memoryLocation = MemoryLocation::HOST_READBACK;
+
+    result = m_iResourceAllocator.AllocateBuffer(m_Device, allocateBufferDesc, m_ReadbackBuffer);
+    if (result != Result::SUCCESS)
+        return result;
+
+    // Frames
+    m_Frames.reserve(frameNum);
+    for (uint32_t i = 0; i < frameNum; i++)
+        m_Frames.emplace_back(deviceBase.GetStdAllocator());
+
+    m_TicksToMs = deviceDesc.other.timestampFrequencyHz ? 1000.0 / double(deviceDesc.other.timestampFrequencyHz) : 0.0;
+
+    return Result::SUCCESS;
+}
+
+void ProfilerImpl::CmdBeginFrame(CommandBuffer& commandBuffer) {
+    uint32_t frameSlot = m_FrameIndex % m_Frames.size();
+    ProfilerFrame& frame = m_Frames[frameSlot];
+
+    frame.ranges.clear();
+    frame.statistics.clear();
+    frame.queryNum = 0;
+    frame.isRecorded = false;
+
+    m_Stack.clear();
+    m_IsStatisticsActive = false;
+
+    m_iCore.CmdResetQueries(commandBuffer, *m_QueryPool, frameSlot * m_QueriesPerFrame, m_QueriesPerFrame);
+
+    if (m_StatisticsQueryPool)
+        m_iCore.CmdResetQueries(commandBuffer, *m_StatisticsQueryPool, frameSlot * m_Desc.statisticsRangeMaxNum, m_Desc.statisticsRangeMaxNum);
+}
+
+void ProfilerImpl::CmdEndFrame(CommandBuffer& commandBuffer) {
+    uint32_t frameSlot = m_FrameIndex % m_Frames.size();
+    ProfilerFrame& frame = m_Frames[frameSlot];
+
+    CHECK(m_Stack.empty(), "Unbalanced 'CmdBeginProfilerRange/CmdEndProfilerRange' calls");
+
+    if (frame.queryNum) {
+        uint32_t offset = frameSlot * m_QueriesPerFrame;
+        m_iCore.CmdCopyQueries(commandBuffer, *m_QueryPool, offset, frame.queryNum, *m_ReadbackBuffer, offset * sizeof(uint64_t));
+    }
+
+    CHECK(!m_IsStatisticsActive, "Unbalanced 'CmdBeginProfilerStatistics/CmdEndProfilerStatistics' calls");
+
+    if (!frame.statistics.empty()) {
+        uint32_t offset = frameSlot * m_Desc.statisticsRangeMaxNum;
+        uint64_t dstOffset = m_StatisticsOffset + offset * m_StatisticsQuerySize;
+        m_iCore.CmdCopyQueries(commandBuffer, *m_StatisticsQueryPool, offset, (uint32_t)frame.statistics.size(), *m_ReadbackBuffer, dstOffset);
+    }
+
+    frame.isRecorded = true;
+}
+
+void ProfilerImpl::CmdBeginRange(CommandBuffer& commandBuffer, const char* name, uint32_t bgra) {
+    uint32_t frameSlot = m_FrameIndex % m_Frames.size();
+    ProfilerFrame& frame = m_Frames[frameSlot];
+
+    if (!m_Desc.disableAnnotations)
+        m_iCore.CmdBeginAnnotation(commandBuffer, name, bgra);
+
+    uint32_t parent = m_Stack.empty() ? PROFILER_NO_PARENT : m_Stack.back();
+    uint64_t parentKey = parent == PROFILER_NO_PARENT ? 0 : frame.ranges[parent].key;
+
+    ProfilerRangeRecord& range = frame.ranges.emplace_back();
+    range.key = HashRangePath(parentKey, name);
+    range.parent = parent;
+    range.depth = (uint32_t)m_Stack.size();
+    range.queryIndex = PROFILER_NO_QUERY;
+
+    if (frame.queryNum + 2 <= m_QueriesPerFrame) {
+        range.queryIndex = frame.queryNum;
+        frame.queryNum += 2;
+
+        m_iCore.CmdEndQuery(commandBuffer, *m_QueryPool, frameSlot * m_QueriesPerFrame + range.queryIndex);
+    }
+
+    // Remember the name (once per path)
+    auto entry = m_History.find(range.key);
+    if (entry == m_History.end()) {
+        DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+        entry = m_History.emplace(range.key, ProfilerRangeHistory(deviceBase.GetStdAllocator())).first;
+
+        ProfilerRangeHistory& history = entry->second;
+        history.name = name;
+        history.times.resize(m_Desc.historyFrameNum, -1.0);
+    }
+
+    entry->second.lastFrameIndex = m_FrameIndex;
+
+    m_Stack.push_back((uint32_t)frame.ranges.size() - 1);
+}
+
+void ProfilerImpl::CmdEndRange(CommandBuffer& commandBuffer) {
+    uint32_t frameSlot = m_FrameIndex % m_Frames.size();
+    ProfilerFrame& frame = m_Frames[frameSlot];
+
+    CHECK(!m_Stack.empty(), "'CmdEndProfilerRange' without 'CmdBeginProfilerRange'");
+    if (m_Stack.empty())
+        return;
+
+    const ProfilerRangeRecord& range = frame.ranges[m_Stack.back()];
+    m_Stack.pop_back();
+
+    if (range.queryIndex != PROFILER_NO_QUERY)
+        m_iCore.CmdEndQuery(commandBuffer, *m_QueryPool, frameSlot * m_QueriesPerFrame + range.queryIndex + 1);
+
+    if (!m_Desc.disableAnnotations)
+        m_iCore.CmdEndAnnotation(commandBuffer);
+}
+
+void ProfilerImpl::CmdBeginStatistics(CommandBuffer& commandBuffer, const char* name) {
+    uint32_t frameSlot = m_FrameIndex % m_Frames.size();
+    ProfilerFrame& frame = m_Frames[frameSlot];
+
+    CHECK(!m_IsStatisticsActive, "Pipeline statistics ranges can't be nested");
+    if (m_IsStatisticsActive || frame.statistics.size() >= m_Desc.statisticsRangeMaxNum)
+        return;
+
+    uint64_t key = HashRangePath(0, name);
+
+    auto entry = m_StatisticsMap.find(key);
+    if (entry == m_StatisticsMap.end()) {
+        DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+        entry = m_StatisticsMap.emplace(key, (uint32_t)m_StatisticsHistory.size()).first;
+
+        ProfilerStatisticsHistory& history = m_StatisticsHistory.emplace_back(deviceBase.GetStdAllocator());
+        history.name = name;
+        history.samples.resize(m_Desc.historyFrameNum, {});
+        history.isSeen.resize(m_Desc.historyFrameNum, false);
+    }
+
+    uint32_t queryIndex = (uint32_t)frame.statistics.size();
+    frame.statistics.push_back(entry->second);
+
+    m_iCore.CmdBeginQuery(commandBuffer, *m_StatisticsQueryPool, frameSlot * m_Desc.statisticsRangeMaxNum + queryIndex);
+    m_IsStatisticsActive = true;
+}
+
+void ProfilerImpl::CmdEndStatistics(CommandBuffer& commandBuffer) {
+    uint32_t frameSlot = m_FrameIndex % m_Frames.size();
+    ProfilerFrame& frame = m_Frames[frameSlot];
+
+    // Ignored (excessive) ranges end silently
+    if (!m_IsStatisticsActive)
+        return;
+
+    uint32_t queryIndex = (uint32_t)frame.statistics.size() - 1;
+    m_iCore.CmdEndQuery(commandBuffer, *m_StatisticsQueryPool, frameSlot * m_Desc.statisticsRangeMaxNum + queryIndex);
+
+    m_IsStatisticsActive = false;
+}
+
+void ProfilerImpl::EndFrame() {
+    m_FrameIndex++;
+
+    // The oldest frame is complete
+    uint32_t frameSlot = m_FrameIndex % m_Frames.size();
+    ProfilerFrame& frame = m_Frames[frameSlot];
+
+    if (frame.isRecorded) {
+        Resolve(frame, frameSlot);
+        ResolveStatistics(frame, frameSlot);
+        frame.isRecorded = false;
+    }
+}
+
+void ProfilerImpl::Resolve(ProfilerFrame& frame, uint32_t frameSlot) {
+    const uint64_t* timestamps = nullptr;
+    if (frame.queryNum) {
+        uint64_t offset = frameSlot * m_QueriesPerFrame * sizeof(uint64_t);
+        timestamps = (const uint64_t*)m_iCore.MapBuffer(*m_ReadbackBuffer, offset, frame.queryNum * sizeof(uint64_t));
+    }
+
+    // Advance history, forgetting ranges, which are out of the window and can't be referenced by frames in flight
+    uint32_t pruneFrameNum = m_Desc.historyFrameNum + (uint32_t)m_Frames.size();
+    for (auto it = m_History.begin(); it != m_History.end();) {
+        ProfilerRangeHistory& history = it->second;
+        if (m_FrameIndex - history.lastFrameIndex > pruneFrameNum) {
+            it = m_History.erase(it);
+            continue;
+        }
+
+        history.head = (history.head + 1) % m_Desc.historyFrameNum;
+        history.times[history.head] = -1.0;
+
+        it++;
+    }
+
+    // Gather times (the same path can be seen several times per frame)
+    for (const ProfilerRangeRecord& range : frame.ranges) {
+        if (range.queryIndex == PROFILER_NO_QUERY || !timestamps)
+            continue;
+
+        uint64_t begin = timestamps[range.queryIndex];
+        uint64_t end = timestamps[range.queryIndex + 1];
+        double time = end > begin ? double(end - begin) * m_TicksToMs : 0.0;
+
+        ProfilerRangeHistory& history = m_History.find(range.key)->second;
+        double& slot = history.times[history.head];
+        slot = slot < 0.0 ? time : slot + time;
+    }
+
+    if (timestamps)
+        m_iCore.UnmapBuffer(*m_ReadbackBuffer);
+
+    BuildTree(frame);
+}
+
+void ProfilerImpl::BuildTree(const ProfilerFrame& frame) {
+    // Merge ranges with the same path (their times are already summed up), keeping the order of first appearance
+    m_Nodes.clear();
+    m_NodeMap.clear();
+    m_RecordToNode.resize(frame.ranges.size());
+
+    uint32_t firstRoot = PROFILER_NO_PARENT;
+    uint32_t lastRoot = PROFILER_NO_PARENT;
+
+    for (size_t i = 0; i < frame.ranges.size(); i++) {
+        const ProfilerRangeRecord& range = frame.ranges[i];
+
+        auto entry = m_NodeMap.find(range.key);
+        if (entry != m_NodeMap.end()) {
+            m_RecordToNode[i] = entry->second;
+            continue;
+        }
+
+        uint32_t nodeIndex = (uint32_t)m_Nodes.size();
+        uint32_t parent = range.parent == PROFILER_NO_PARENT ? PROFILER_NO_PARENT : m_RecordToNode[range.parent];
+
+        ProfilerNode& node = m_Nodes.emplace_back();
+        node.key = range.key;
+        node.parent = parent;
+        node.firstChild = PROFILER_NO_PARENT;
+        node.lastChild = PROFILER_NO_PARENT;
+        node.nextSibling = PROFILER_NO_PARENT;
+        node.outIndex = 0;
+
+        uint32_t& first = parent == PROFILER_NO_PARENT ? firstRoot : m_Nodes[parent].firstChild;
+        uint32_t& last = parent == PROFILER_NO_PARENT ? lastRoot : m_Nodes[parent].lastChild;
+        if (last == PROFILER_NO_PARENT)
+            first = nodeIndex;
+        else
+            m_Nodes[last].nextSibling = nodeIndex;
+        last = nodeIndex;
+
+        m_NodeMap.emplace(range.key, nodeIndex);
+        m_RecordToNode[i] = nodeIndex;
+    }
+
+    // Emit the tree in depth-first order
+    m_Ranges.clear();
+
+    uint32_t depth = 0;
+    uint32_t nodeIndex = firstRoot;
+    while (nodeIndex != PROFILER_NO_PARENT) {
+        ProfilerNode& node = m_Nodes[nodeIndex];
+        node.outIndex = (uint32_t)m_Ranges.size();
+
+        const ProfilerRangeHistory& history = m_History.find(node.key)->second;
+
+        ProfilerRange& out = m_Ranges.emplace_back();
+        out = {};
+        out.name = history.name.c_str();
+        out.parentIndex = node.parent == PROFILER_NO_PARENT ? PROFILER_NO_PARENT : m_Nodes[node.parent].outIndex;
+        out.depth = depth;
+        out.time = std::max(history.times[history.head], 0.0);
+        out.timeMin = 1e30;
+
+        double sum = 0.0;
+        for (double time : history.times) {
+            if (time < 0.0)
+                continue;
+
+            out.timeMin = std::min(out.timeMin, time);
+            out.timeMax = std::max(out.timeMax, time);
+            sum += time;
+            out.sampleNum++;
+        }
+
+        if (out.sampleNum)
+            out.timeAvg = sum / out.sampleNum;
+        else
+            out.timeMin = 0.0;
+
+        // Next node: the first child, or the next sibling of the node or of the closest ancestor
+        if (node.firstChild != PROFILER_NO_PARENT) {
+            nodeIndex = node.firstChild;
+            depth++;
+        } else {
+            while (nodeIndex != PROFILER_NO_PARENT && m_Nodes[nodeIndex].nextSibling == PROFILER_NO_PARENT) {
+                nodeIndex = m_Nodes[nodeIndex].parent;
+                depth--;
+            }
+
+            if (nodeIndex != PROFILER_NO_PARENT)
+                nodeIndex = m_Nodes[nodeIndex].nextSibling;
+        }
+    }
+}
+
+void ProfilerImpl::ResolveStatistics(ProfilerFrame& frame, uint32_t frameSlot) {
+    if (m_StatisticsHistory.empty())
+        return;
+
+    const uint8_t* data = nullptr;
+    if (!frame.statistics.empty() && m_StatisticsQuerySize) {
+        uint64_t offset = m_StatisticsOffset + frameSlot * m_Desc.statisticsRangeMaxNum * m_StatisticsQuerySize;
+        data = (const uint8_t*)m_iCore.MapBuffer(*m_ReadbackBuffer, offset, frame.statistics.size() * m_StatisticsQuerySize);
+    }
+
+    // Advance history
+    uint32_t head = m_FrameIndex % m_Desc.historyFrameNum;
+    for (ProfilerStatisticsHistory& history : m_StatisticsHistory) {
+        history.samples[head] = {};
+        history.isSeen[head] = false;
+    }
+
+    // Gather (the layout of a query is a prefix of "PipelineStatisticsDesc", which depends on the backend and the device)
+    uint32_t copySize = std::min(m_StatisticsQuerySize, (uint32_t)sizeof(PipelineStatisticsDesc));
+
+    for (size_t i = 0; i < frame.statistics.size() && data; i++) {
+        uint64_t query[PROFILER_STATISTICS_NUM] = {};
+        memcpy(query, data + i * m_StatisticsQuerySize, copySize);
+
+        ProfilerStatisticsHistory& history = m_StatisticsHistory[frame.statistics[i]];
+        uint64_t* sample = (uint64_t*)&history.samples[head];
+        for (uint32_t j = 0; j < PROFILER_STATISTICS_NUM; j++)
+            sample[j] += query[j];
+
+        history.isSeen[head] = true;
+    }
+
+    if (data)
+        m_iCore.UnmapBuffer(*m_ReadbackBuffer);
+
+    // Aggregate
+    m_Statistics.resize(m_StatisticsHistory.size());
+
+    for (size_t i = 0; i < m_StatisticsHistory.size(); i++) {
+        const ProfilerStatisticsHistory& history = m_StatisticsHistory[i];
+
+        ProfilerStatistics& out = m_Statistics[i];
+        out = {};
+        out.name = history.name.c_str();
+        out.last = history.samples[head];
+
+        uint64_t* avg = (uint64_t*)&out.avg;
+        uint64_t* max = (uint64_t*)&out.max;
+        for (uint32_t n = 0; n < m_Desc.historyFrameNum; n++) {
+            if (!history.isSeen[n])
+                continue;
+
+            const uint64_t* sample = (const uint64_t*)&history.samples[n];
+            for (uint32_t j = 0; j < PROFILER_STATISTICS_NUM; j++) {
+                avg[j] += sample[j];
+                max[j] = std::max(max[j], sample[j]);
+            }
+
+            out.sampleNum++;
+        }
+
+        if (out.sampleNum) {
+            for (uint32_t j = 0; j < PROFILER_STATISTICS_NUM; j++)
+                avg[j] /= out.sampleNum;
+        }
+    }
+}
@@ -0,0 +1,283 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+constexpr uint32_t RENDER_GRAPH_QUEUE_MAIN = 0;
+constexpr uint32_t RENDER_GRAPH_QUEUE_COMPUTE = 1;
+constexpr uint32_t RENDER_GRAPH_QUEUE_MAX_NUM = 2;
+constexpr uint32_t RENDER_GRAPH_MEMORY_DESC_CACHE_MAX_NUM = 1024; // the cache is flushed if exceeded
+
+struct RenderGraphResource {
+    TextureDesc textureDesc;
+    BufferDesc bufferDesc;
+    MemoryDesc memoryDesc;
+    AccessLayoutStage initial; // buffers: "layout" is "UNDEFINED"
+    AccessLayoutStage final;
+    const char* name;
+    Texture* texture;
+    Buffer* buffer;
+    uint64_t offset;   // in the heap
+    uint32_t heap;     // index in "RenderGraphFrame::heaps"
+    uint32_t firstPass; // index in "m_Passes" (alive only), "RENDER_GRAPH_NULL" if unused
+    uint32_t lastPass;
+    bool isBuffer;
+    bool isImported;
+    bool hasFinalState;
+};
+
+struct RenderGraphAccess {
+    AccessLayoutStage state;
+    uint32_t resource;
+};
+
+struct RenderGraphBarrier {
+    AccessLayoutStage before;
+    AccessLayoutStage after;
+    uint32_t resource;
+    uint32_t pass; // "m_Passes.size()" for final barriers
+    bool isAfterPass;
+};
+
+struct RenderGraphBarrierRange {
+    uint32_t textureOffset; // in "m_TextureBarrierDescs"
+    uint32_t textureNum;
+    uint32_t bufferOffset; // in "m_BufferBarrierDescs"
+    uint32_t bufferNum;
+};
+
+struct RenderGraphPass {
+    RenderGraphBarrierRange barriers;
+    RenderGraphBarrierRange barriersAfter; // layout transitions for the other queue
+    void (*Record)(CommandBuffer& commandBuffer, void* userArg);
+    void* userArg;
+    const char* name;
+    uint32_t accessOffset; // in "m_Accesses"
+    uint32_t accessNum;
+    uint32_t queue; // "RENDER_GRAPH_QUEUE_XXX"
+    bool hasSideEffects;
+    bool isAsyncCompute;
+    bool isAlive;
+};
+
+// A submission: a sequence of passes on one queue, which can wait for a batch of the other queue only at the beginning and signal only at the end
+struct RenderGraphBatch {
+    uint64_t signalValue; // assigned in "Submit"
+    uint32_t passOffset;  // in "m_BatchPasses"
+    uint32_t passNum;
+    uint32_t firstPass;   // for ordering ("m_Passes.size()" for the final batch without passes)
+    uint32_t waitPass;    // a pass on the other queue, "RENDER_GRAPH_NULL" if none
+    uint32_t waitBatch;
+    uint32_t queue;
+    bool hasSignal;
+    bool isFinal;         // records final barriers and finishes the frame
+    bool waitsPreviousFrame;
+};
+
+struct RenderGraphHeap {
+    Memory* memory;
+    uint64_t size;
+    MemoryType type;
+};
+
+struct RenderGraphPhysicalResource {
+    TextureDesc textureDesc;
+    BufferDesc bufferDesc;
+    Texture* texture;
+    Buffer* buffer;
+    Memory* memory;
+    uint64_t offset;
+    bool isBuffer;
+    bool isUsed;
+};
+
+struct RenderGraphCommandPool {
+    inline RenderGraphCommandPool(StdAllocator<uint8_t>& stdAllocator)
+        : commandBuffers(stdAllocator) {
+    }
+
+    CommandAllocator* commandAllocator = nullptr;
+    Vector<CommandBuffer*> commandBuffers;
+};
+
+struct RenderGraphMemoryDesc {
+    TextureDesc textureDesc;
+    BufferDesc bufferDesc;
+    MemoryDesc memoryDesc;
+    bool isBuffer;
+};
+
+// Owned by a frame slot, reused when the frame "queuedFrameNum + 1" frames later begins (at this point the GPU is done with it)
+struct RenderGraphFrame {
+    inline RenderGraphFrame(StdAllocator<uint8_t>& stdAllocator)
+        : heaps(stdAllocator)
+        , resources(stdAllocator)
+        , commandPools(stdAllocator)
+        , timestampQueues(stdAllocator) {
+    }
+
+    Vector<RenderGraphHeap> heaps;
+    Vector<RenderGraphPhysicalResource> resources;
+    Vector<RenderGraphCommandPool> commandPools; // "queue * threadMaxNum + thread"
+    Vector<uint32_t> timestampQueues;            // per measured batch
+    uint64_t frameIndex = 0;
+    uint32_t waitNum = 0;
+};
+
+// Persistent threads for parallel recording: "Run" executes task 0 on the calling thread and others on workers
+struct RenderGraphWorkers {
+    inline RenderGraphWorkers(StdAllocator<uint8_t>& stdAllocator)
+        : m_Threads(stdAllocator) {
+    }
+
+    ~RenderGraphWorkers();
+
+    void Start(uint32_t workerNum);
+
+    template <typename Task>
+    inline void Run(uint32_t taskNum, Task& task) {
+        Run(taskNum, [](void* context, uint32_t taskIndex) { (*(Task*)context)(taskIndex); }, &task);
+    }
+
+private:
+    void Run(uint32_t taskNum, void (*func)(void* context, uint32_t taskIndex), void* context);
+    void Loop(uint32_t workerIndex);
+
+private:
+    Vector<std::thread> m_Threads;
+    std::mutex m_Mutex;
+    std::condition_variable m_WakeUp;
+    std::condition_variable m_Done;
+    void (*m_Func)(void* context, uint32_t taskIndex) = nullptr;
+    void* m_Context = nullptr;
+    uint64_t m_Generation = 0;
+    uint32_t m_TaskNum = 0;
+    uint32_t m_PendingNum = 0;
+    bool m_IsStopped = false;
+};
+
+struct RenderGraphImpl : public DebugNameBase {
+    inline RenderGraphImpl(Device& device, const CoreInterface& NRI)
+        : m_Device(device)
+        , m_iCore(NRI)
+        , m_Frames(((DeviceBase&)device).GetStdAllocator())
+        , m_Resources(((DeviceBase&)device).GetStdAllocator())
+        , m_Passes(((DeviceBase&)device).GetStdAllocator())
+        , m_Accesses(((DeviceBase&)device).GetStdAllocator())
+        , m_AlivePasses(((DeviceBase&)device).GetStdAllocator())
+        , m_Barriers(((DeviceBase&)device).GetStdAllocator())
+        , m_TextureBarrierDescs(((DeviceBase&)device).GetStdAllocator())
+        , m_BufferBarrierDescs(((DeviceBase&)device).GetStdAllocator())
+        , m_MemoryDescCache(((DeviceBase&)device).GetStdAllocator())
+        , m_HeapSizes(((DeviceBase&)device).GetStdAllocator())
+        , m_HeapTypes(((DeviceBase&)device).GetStdAllocator())
+        , m_WaitPasses(((DeviceBase&)device).GetStdAllocator())
+        , m_Batches(((DeviceBase&)device).GetStdAllocator())
+        , m_BatchPasses(((DeviceBase&)device).GetStdAllocator())
+        , m_CommandBuffers(((DeviceBase&)device).GetStdAllocator())
+        , m_Dump(((DeviceBase&)device).GetStdAllocator())
+        , m_Workers(((DeviceBase&)device).GetStdAllocator()) {
+    }
+
+    inline Device& GetDevice() {
+        return m_Device;
+    }
+
+    inline const char* GetDump() const {
+        return m_Dump.c_str();
+    }
+
+    inline void GetStatistics(RenderGraphStatistics& statistics) const {
+        statistics = m_Statistics;
+    }
+
+    ~RenderGraphImpl();
+
+    Result Create(const RenderGraphDesc& desc);
+    void Begin();
+    uint32_t AddTexture(const RenderGraphTextureDesc& desc);
+    uint32_t AddBuffer(const RenderGraphBufferDesc& desc);
+    uint32_t ImportTexture(const RenderGraphImportedTextureDesc& desc);
+    uint32_t ImportBuffer(const RenderGraphImportedBufferDesc& desc);
+    uint32_t AddPass(const RenderGraphPassDesc& desc);
+    Result Compile();
+    Texture* GetTexture(uint32_t texture) const;
+    Buffer* GetBuffer(uint32_t buffer) const;
+    CommandBuffer* const* Execute(const RenderGraphExecuteDesc& desc, uint32_t& commandBufferNum);
+    Result Submit(const RenderGraphSubmitDesc& desc);
+
+    //================================================================================================================
+    // DebugNameBase
+    //================================================================================================================
+
+    void SetDebugName(const char* name) DEBUG_NAME_OVERRIDE {
+        for (RenderGraphFrame& frame : m_Frames) {
+            for (RenderGraphCommandPool& commandPool : frame.commandPools) {
+                for (CommandBuffer* commandBuffer : commandPool.commandBuffers)
+                    m_iCore.SetDebugName(commandBuffer, name);
+            }
+        }
+
+        m_iCore.SetDebugName(m_Fences[RENDER_GRAPH_QUEUE_MAIN], name);
+        m_iCore.SetDebugName(m_Fences[RENDER_GRAPH_QUEUE_COMPUTE], name);
+        m_iCore.SetDebugName(m_QueryPool, name);
+        m_iCore.SetDebugName(m_ReadbackBuffer, name);
+    }
+
+private:
+    void Cull();
+    Result PlaceResources();
+    Result CreatePhysicalResources(RenderGraphFrame& frame);
+    void ComputeBarriers();
+    void Schedule();
+    void BuildBarrierDescs();
+    void BuildDump();
+    void ResolveStatistics(RenderGraphFrame& frame, uint32_t frameSlot);
+    Result GetMemoryDesc(RenderGraphResource& resource);
+    Result GetCommandBuffer(RenderGraphCommandPool& commandPool, uint32_t index, CommandBuffer*& commandBuffer);
+    void CmdBarriers(CommandBuffer& commandBuffer, const RenderGraphBarrierRange& range);
+    void RecordPass(CommandBuffer& commandBuffer, const RenderGraphPass& pass);
+    void RecordBatch(CommandBuffer& commandBuffer, const RenderGraphBatch& batch, uint32_t queryOffset);
+    void DestroyPhysicalResource(RenderGraphPhysicalResource& physicalResource);
+    void DestroyFrame(RenderGraphFrame& frame);
+
+private:
+    Device& m_Device;
+    const CoreInterface& m_iCore;
+    RenderGraphDesc m_Desc = {};
+    Vector<RenderGraphFrame> m_Frames;
+    Vector<RenderGraphResource> m_Resources; // a texture or a buffer, handles are indices
+    Vector<RenderGraphPass> m_Passes;
+    Vector<RenderGraphAccess> m_Accesses;
+    Vector<uint32_t> m_AlivePasses;
+    Vector<RenderGraphBarrier> m_Barriers; // sorted by pass
+    Vector<TextureBarrierDesc> m_TextureBarrierDescs;
+    Vector<BufferBarrierDesc> m_BufferBarrierDescs;
+    UnorderedMap<uint64_t, RenderGraphMemoryDesc> m_MemoryDescCache; // desc hash -> memory desc
+    Vector<uint64_t> m_HeapSizes; // computed by "PlaceResources"
+    Vector<MemoryType> m_HeapTypes;
+    Vector<uint32_t> m_WaitPasses; // per pass (+1 for the final barriers), a pass on the other queue to wait for
+    Vector<RenderGraphBatch> m_Batches; // in submission order
+    Vector<uint32_t> m_BatchPasses;
+    Vector<CommandBuffer*> m_CommandBuffers; // returned by "Execute"
+    String m_Dump;
+    RenderGraphWorkers m_Workers;
+    ResourceAllocatorInterface m_iResourceAllocator = {};
+    RenderGraphStatistics m_Statistics = {};
+    RenderGraphBarrierRange m_FinalBarriers = {};
+    std::array<Queue*, RENDER_GRAPH_QUEUE_MAX_NUM> m_Queues = {};
+    std::array<Fence*, RENDER_GRAPH_QUEUE_MAX_NUM> m_Fences = {}; // timelines for cross-queue waits
+    std::array<uint64_t, RENDER_GRAPH_QUEUE_MAX_NUM> m_FenceValues = {};
+    QueryPool* m_QueryPool = nullptr;
+    Buffer* m_ReadbackBuffer = nullptr;
+    double m_TicksToMs = 0.0;
+    uint64_t m_FrameIndex = 0; // number of "Begin" calls
+    uint64_t m_PreviousFrameValue = 0; // the last value signaled by the main queue in the previous frame
+    uint32_t m_QueueNum = 1;
+    uint32_t m_FrameSlot = 0;
+    bool m_IsCompiled = false;
+    bool m_IsExecuted = false;
+};
+
+} // namespace nri
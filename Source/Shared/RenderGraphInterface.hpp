@@ -0,0 +1,1619 @@
+// © 2025 NVIDIA Corporation
+
+#include <algorithm>
+
+constexpr AccessBits RENDER_GRAPH_WRITE_ACCESS = AccessBits::SCRATCH_BUFFER | AccessBits::COLOR_ATTACHMENT | AccessBits::DEPTH_STENCIL_ATTACHMENT_WRITE
+    | AccessBits::ACCELERATION_STRUCTURE_WRITE | AccessBits::MICROMAP_WRITE | AccessBits::SHADER_RESOURCE_STORAGE
+    | AccessBits::COPY_DESTINATION | AccessBits::RESOLVE_DESTINATION | AccessBits::CLEAR_STORAGE;
+
+constexpr std::array<const char*, (size_t)Layout::MAX_NUM> g_RenderGraphLayoutNames = {
+    "UNDEFINED",                // UNDEFINED
+    "GENERAL",                  // GENERAL
+    "PRESENT",                  // PRESENT
+    "COLOR_ATTACHMENT",         // COLOR_ATTACHMENT
+    "SHADING_RATE_ATTACHMENT",  // SHADING_RATE_ATTACHMENT
+    "DEPTH_STENCIL_ATTACHMENT", // DEPTH_STENCIL_ATTACHMENT
+    "DEPTH_STENCIL_READONLY",   // DEPTH_STENCIL_READONLY
+    "SHADER_RESOURCE",          // SHADER_RESOURCE
+    "SHADER_RESOURCE_STORAGE",  // SHADER_RESOURCE_STORAGE
+    "COPY_SOURCE",              // COPY_SOURCE
+    "COPY_DESTINATION",         // COPY_DESTINATION
+    "RESOLVE_SOURCE",           // RESOLVE_SOURCE
+    "RESOLVE_DESTINATION",      // RESOLVE_DESTINATION
+};
+VALIDATE_ARRAY_BY_PTR(g_RenderGraphLayoutNames);
+
+constexpr uint32_t RENDER_GRAPH_TIMESTAMP_BATCH_MAX_NUM = 64; // per frame, excessive batches are not measured
+constexpr uint32_t RENDER_GRAPH_TIMESTAMPS_PER_FRAME = RENDER_GRAPH_TIMESTAMP_BATCH_MAX_NUM * 2;
+
+static inline bool IsWriteAccess(AccessBits access) {
+    return (access & RENDER_GRAPH_WRITE_ACCESS) != 0;
+}
+
+static inline StageBits MergeStages(StageBits stages0, StageBits stages1) {
+    if (stages0 == StageBits::NONE)
+        return stages1;
+    if (stages1 == StageBits::NONE)
+        return stages0;
+    if (stages0 == StageBits::ALL || stages1 == StageBits::ALL)
+        return StageBits::ALL;
+
+    return stages0 | stages1;
+}
+
+// "true" if a read in "after" is already synchronized by the barrier, which has led to "state"
+static inline bool IsCovered(const AccessLayoutStage& state, const AccessLayoutStage& after) {
+    if ((~state.access & after.access) != 0)
+        return false;
+
+    if (state.stages == StageBits::ALL || after.stages == StageBits::NONE)
+        return true;
+
+    return after.stages != StageBits::ALL && state.stages != StageBits::NONE && (~state.stages & after.stages) == 0;
+}
+
+static inline bool IsLifetimeOverlapped(const RenderGraphResource& resource0, const RenderGraphResource& resource1) {
+    return resource0.firstPass <= resource1.lastPass && resource1.firstPass <= resource0.lastPass;
+}
+
+static inline bool IsMemoryOverlapped(const RenderGraphResource& resource0, const RenderGraphResource& resource1) {
+    return resource0.heap == resource1.heap && resource0.offset < resource1.offset + resource1.memoryDesc.size && resource1.offset < resource0.offset + resource0.memoryDesc.size;
+}
+
+static inline bool IsEqual(const TextureDesc& desc0, const TextureDesc& desc1) {
+    return desc0.type == desc1.type
+        && desc0.usage == desc1.usage
+        && desc0.format == desc1.format
+        && desc0.width == desc1.width
+        && desc0.height == desc1.height
+        && desc0.depth == desc1.depth
+        && desc0.mipNum == desc1.mipNum
+        && desc0.layerNum == desc1.layerNum
+        && desc0.sampleNum == desc1.sampleNum
+        && desc0.sharingMode == desc1.sharingMode
+        && !memcmp(&desc0.optimizedClearValue, &desc1.optimizedClearValue, sizeof(ClearValue));
+}
+
+static inline bool IsEqual(const BufferDesc& desc0, const BufferDesc& desc1) {
+    return desc0.size == desc1.size && desc0.structureStride == desc1.structureStride && desc0.usage == desc1.usage;
+}
+
+static inline TextureUsageBits GetTextureUsage(AccessBits access) {
+    TextureUsageBits usage = TextureUsageBits::NONE;
+    if (access & AccessBits::COLOR_ATTACHMENT)
+        usage |= TextureUsageBits::COLOR_ATTACHMENT;
+    if (access & (AccessBits::DEPTH_STENCIL_ATTACHMENT_READ | AccessBits::DEPTH_STENCIL_ATTACHMENT_WRITE))
+        usage |= TextureUsageBits::DEPTH_STENCIL_ATTACHMENT;
+    if (access & AccessBits::SHADING_RATE_ATTACHMENT)
+        usage |= TextureUsageBits::SHADING_RATE_ATTACHMENT;
+    if (access & AccessBits::SHADER_RESOURCE)
+        usage |= TextureUsageBits::SHADER_RESOURCE;
+    if (access & (AccessBits::SHADER_RESOURCE_STORAGE | AccessBits::CLEAR_STORAGE))
+        usage |= TextureUsageBits::SHADER_RESOURCE_STORAGE;
+
+    return usage;
+}
+
+static inline BufferUsageBits GetBufferUsage(AccessBits access) {
+    BufferUsageBits usage = BufferUsageBits::NONE;
+    if (access & AccessBits::INDEX_BUFFER)
+        usage |= BufferUsageBits::INDEX_BUFFER;
+    if (access & AccessBits::VERTEX_BUFFER)
+        usage |= BufferUsageBits::VERTEX_BUFFER;
+    if (access & AccessBits::CONSTANT_BUFFER)
+        usage |= BufferUsageBits::CONSTANT_BUFFER;
+    if (access & AccessBits::ARGUMENT_BUFFER)
+        usage |= BufferUsageBits::ARGUMENT_BUFFER;
+    if (access & AccessBits::SCRATCH_BUFFER)
+        usage |= BufferUsageBits::SCRATCH_BUFFER;
+    if (access & AccessBits::SHADER_RESOURCE)
+        usage |= BufferUsageBits::SHADER_RESOURCE;
+    if (access & (AccessBits::SHADER_RESOURCE_STORAGE | AccessBits::CLEAR_STORAGE))
+        usage |= BufferUsageBits::SHADER_RESOURCE_STORAGE;
+    if (access & AccessBits::SHADER_BINDING_TABLE)
+        usage |= BufferUsageBits::SHADER_BINDING_TABLE;
+
+    return usage;
+}
+
+template <typename T>
+static inline void HashValue(uint64_t& hash, const T& value) { // FNV-1a
+    const uint8_t* bytes = (const uint8_t*)&value;
+    for (size_t i = 0; i < sizeof(T); i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+}
+
+// Hashes fields compared by "IsEqual"
+static inline uint64_t HashResourceDesc(const RenderGraphResource& resource) {
+    uint64_t hash = 14695981039346656037ull;
+    HashValue(hash, resource.isBuffer);
+
+    if (resource.isBuffer) {
+        const BufferDesc& desc = resource.bufferDesc;
+        HashValue(hash, desc.size);
+        HashValue(hash, desc.structureStride);
+        HashValue(hash, desc.usage);
+    } else {
+        const TextureDesc& desc = resource.textureDesc;
+        HashValue(hash, desc.type);
+        HashValue(hash, desc.usage);
+        HashValue(hash, desc.format);
+        HashValue(hash, desc.width);
+        HashValue(hash, desc.height);
+        HashValue(hash, desc.depth);
+        HashValue(hash, desc.mipNum);
+        HashValue(hash, desc.layerNum);
+        HashValue(hash, desc.sampleNum);
+        HashValue(hash, desc.sharingMode);
+        HashValue(hash, desc.optimizedClearValue);
+    }
+
+    return hash;
+}
+
+static inline const char* GetResourceName(const RenderGraphResource& resource) {
+    return resource.name ? resource.name : "unnamed";
+}
+
+RenderGraphWorkers::~RenderGraphWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_IsStopped = true;
+    }
+
+    m_WakeUp.notify_all();
+
+    for (std::thread& thread : m_Threads)
+        thread.join();
+}
+
+void RenderGraphWorkers::Start(uint32_t workerNum) {
+    m_Threads.reserve(workerNum);
+    for (uint32_t i = 0; i < workerNum; i++)
+        m_Threads.emplace_back(&RenderGraphWorkers::Loop, this, i);
+}
+
+void RenderGraphWorkers::Run(uint32_t taskNum, void (*func)(void* context, uint32_t taskIndex), void* context) {
+    if (taskNum > 1) {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+
+            m_Func = func;
+            m_Context = context;
+            m_TaskNum = taskNum;
+            m_PendingNum = taskNum - 1;
+            m_Generation++;
+        }
+
+        m_WakeUp.notify_all();
+    }
+
+    func(context, 0);
+
+    if (taskNum > 1) {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Done.wait(lock, [&] { return m_PendingNum == 0; });
+    }
+}
+
+void RenderGraphWorkers::Loop(uint32_t workerIndex) {
+    uint64_t generation = 0;
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true) {
+        m_WakeUp.wait(lock, [&] { return m_IsStopped || m_Generation != generation; });
+        if (m_IsStopped)
+            return;
+
+        generation = m_Generation;
+
+        // Task 0 is executed by the caller
+        uint32_t taskIndex = workerIndex + 1;
+        if (taskIndex >= m_TaskNum)
+            continue;
+
+        auto func = m_Func;
+        void* context = m_Context;
+
+        lock.unlock();
+        func(context, taskIndex);
+        lock.lock();
+
+        if (--m_PendingNum == 0)
+            m_Done.notify_one();
+    }
+}
+
+RenderGraphImpl::~RenderGraphImpl() {
+    for (RenderGraphFrame& frame : m_Frames)
+        DestroyFrame(frame);
+
+    for (Fence* fence : m_Fences)
+        m_iCore.DestroyFence(fence);
+
+    m_iCore.DestroyQueryPool(m_QueryPool);
+    m_iCore.DestroyBuffer(m_ReadbackBuffer);
+}
+
+void RenderGraphImpl::DestroyPhysicalResource(RenderGraphPhysicalResource& physicalResource) {
+    if (physicalResource.isBuffer)
+        m_iCore.DestroyBuffer(physicalResource.buffer);
+    else
+        m_iCore.DestroyTexture(physicalResource.texture);
+
+    physicalResource.texture = nullptr;
+    physicalResource.buffer = nullptr;
+    physicalResource.memory = nullptr;
+}
+
+void RenderGraphImpl::DestroyFrame(RenderGraphFrame& frame) {
+    for (RenderGraphPhysicalResource& physicalResource : frame.resources)
+        DestroyPhysicalResource(physicalResource);
+
+    for (RenderGraphHeap& heap : frame.heaps)
+        m_iCore.FreeMemory(heap.memory);
+
+    for (RenderGraphCommandPool& commandPool : frame.commandPools) {
+        for (CommandBuffer* commandBuffer : commandPool.commandBuffers)
+            m_iCore.DestroyCommandBuffer(commandBuffer);
+
+        m_iCore.DestroyCommandAllocator(commandPool.commandAllocator);
+    }
+
+    frame.resources.clear();
+    frame.heaps.clear();
+    frame.commandPools.clear();
+}
+
+Result RenderGraphImpl::Create(const RenderGraphDesc& desc) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    RETURN_ON_FAILURE(&deviceBase, desc.queue, Result::INVALID_ARGUMENT, "'queue' is NULL");
+
+    m_Desc = desc;
+    if (!m_Desc.threadMaxNum)
+        m_Desc.threadMaxNum = 1;
+
+    m_Workers.Start(m_Desc.threadMaxNum - 1);
+
+    m_Queues[RENDER_GRAPH_QUEUE_MAIN] = (Queue*)desc.queue;
+    m_Queues[RENDER_GRAPH_QUEUE_COMPUTE] = (Queue*)desc.computeQueue;
+    m_QueueNum = desc.computeQueue ? 2 : 1;
+
+    // Cross-queue timelines
+    if (desc.computeQueue) {
+        for (Fence*& fence : m_Fences) {
+            Result result = m_iCore.CreateFence(m_Device, 0, fence);
+            if (result != Result::SUCCESS)
+                return result;
+        }
+    }
+
+    uint32_t frameNum = m_Desc.queuedFrameNum + 1;
+
+    // Timestamps
+    if (desc.enableTimestamps) {
+        Result result = nriGetInterface(m_Device, NRI_INTERFACE(ResourceAllocatorInterface), &m_iResourceAllocator);
+        if (result != Result::SUCCESS)
+            return result;
+
+        QueryPoolDesc queryPoolDesc = {};
+        queryPoolDesc.queryType = QueryType::TIMESTAMP;
+        queryPoolDesc.capacity = RENDER_GRAPH_TIMESTAMPS_PER_FRAME * frameNum;
+
+        result = m_iCore.CreateQueryPool(m_Device, queryPoolDesc, m_QueryPool);
+        if (result != Result::SUCCESS)
+            return result;
+
+        AllocateBufferDesc allocateBufferDesc = {};
+        allocateBufferDesc.desc.size = queryPoolDesc.capacity * sizeof(uint64_t);
+        allocateBufferDesc.memoryLocation = MemoryLocation::HOST_READBACK;
+
+        result = m_iResourceAllocator.AllocateBuffer(m_Device, allocateBufferDesc, m_ReadbackBuffer);
+        if (result != Result::SUCCESS)
+            return result;
+
+        const DeviceDesc& deviceDesc = m_iCore.GetDeviceDesc(m_Device);
+        m_TicksToMs = deviceDesc.other.timestampFrequencyHz ? 1000.0 / double(deviceDesc.other.timestampFrequencyHz) : 0.0;
+    }
+
+    // Frames
+    m_Frames.reserve(frameNum);
+
+    for (uint32_t i = 0; i < frameNum; i++) {
+        m_Frames.emplace_back(deviceBase.GetStdAllocator());
+        RenderGraphFrame& frame = m_Frames.back();
+
+        frame.commandPools.reserve(m_QueueNum * m_Desc.threadMaxNum);
+        for (uint32_t j = 0; j < m_QueueNum * m_Desc.threadMaxNum; j++) {
+            RenderGraphCommandPool& commandPool = frame.commandPools.emplace_back(deviceBase.GetStdAllocator());
+
+            Result result = m_iCore.CreateCommandAllocator(*m_Queues[j / m_Desc.threadMaxNum], commandPool.commandAllocator);
+            if (result != Result::SUCCESS)
+                return result;
+        }
+    }
+
+    return Result::SUCCESS;
+}
+
+Result RenderGraphImpl::GetCommandBuffer(RenderGraphCommandPool& commandPool, uint32_t index, CommandBuffer*& commandBuffer) {
+    while (index >= commandPool.commandBuffers.size()) {
+        Result result = m_iCore.CreateCommandBuffer(*commandPool.commandAllocator, commandBuffer);
+        if (result != Result::SUCCESS)
+            return result;
+
+        commandPool.commandBuffers.push_back(commandBuffer);
+    }
+
+    commandBuffer = commandPool.commandBuffers[index];
+
+    return Result::SUCCESS;
+}
+
+void RenderGraphImpl::Begin() {
+    m_FrameSlot = uint32_t(m_FrameIndex % m_Frames.size());
+    m_FrameIndex++;
+
+    // The GPU is done with this slot (see "queuedFrameNum")
+    RenderGraphFrame& frame = m_Frames[m_FrameSlot];
+    for (RenderGraphCommandPool& commandPool : frame.commandPools)
+        m_iCore.ResetCommandAllocator(*commandPool.commandAllocator);
+
+    ResolveStatistics(frame, m_FrameSlot);
+
+    m_Resources.clear();
+    m_Passes.clear();
+    m_Accesses.clear();
+    m_AlivePasses.clear();
+    m_Barriers.clear();
+    m_TextureBarrierDescs.clear();
+    m_BufferBarrierDescs.clear();
+    m_Batches.clear();
+    m_BatchPasses.clear();
+    m_Dump.clear();
+
+    m_FinalBarriers = {};
+    m_IsCompiled = false;
+    m_IsExecuted = false;
+}
+
+uint32_t RenderGraphImpl::AddTexture(const RenderGraphTextureDesc& desc) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    RETURN_ON_FAILURE(&deviceBase, m_FrameIndex, RENDER_GRAPH_NULL, "'BeginRenderGraph' has not been called");
+    RETURN_ON_FAILURE(&deviceBase, desc.desc.width, RENDER_GRAPH_NULL, "'desc.width' is 0");
+
+    RenderGraphResource resource = {};
+    resource.textureDesc = FixTextureDesc(desc.desc);
+    resource.initial = {AccessBits::NONE, Layout::UNDEFINED, StageBits::NONE};
+    resource.name = desc.name;
+    resource.heap = RENDER_GRAPH_NULL;
+    resource.firstPass = RENDER_GRAPH_NULL;
+    resource.lastPass = RENDER_GRAPH_NULL;
+
+    m_Resources.push_back(resource);
+    m_IsCompiled = false;
+
+    return (uint32_t)m_Resources.size() - 1;
+}
+
+uint32_t RenderGraphImpl::AddBuffer(const RenderGraphBufferDesc& desc) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    RETURN_ON_FAILURE(&deviceBase, m_FrameIndex, RENDER_GRAPH_NULL, "'BeginRenderGraph' has not been called");
+    RETURN_ON_FAILURE(&deviceBase, desc.desc.size, RENDER_GRAPH_NULL, "'desc.size' is 0");
+
+    RenderGraphResource resource = {};
+    resource.bufferDesc = desc.desc;
+    resource.initial = {AccessBits::NONE, Layout::UNDEFINED, StageBits::NONE};
+    resource.name = desc.name;
+    resource.heap = RENDER_GRAPH_NULL;
+    resource.firstPass = RENDER_GRAPH_NULL;
+    resource.lastPass = RENDER_GRAPH_NULL;
+    resource.isBuffer = true;
+
+    m_Resources.push_back(resource);
+    m_IsCompiled = false;
+
+    return (uint32_t)m_Resources.size() - 1;
+}
+
+uint32_t RenderGraphImpl::ImportTexture(const RenderGraphImportedTextureDesc& desc) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    RETURN_ON_FAILURE(&deviceBase, m_FrameIndex, RENDER_GRAPH_NULL, "'BeginRenderGraph' has not been called");
+    RETURN_ON_FAILURE(&deviceBase, desc.texture, RENDER_GRAPH_NULL, "'texture' is NULL");
+
+    RenderGraphResource resource = {};
+    resource.textureDesc = m_iCore.GetTextureDesc(*desc.texture);
+    resource.initial = desc.initial;
+    resource.final = desc.final;
+    resource.name = desc.name;
+    resource.texture = desc.texture;
+    resource.heap = RENDER_GRAPH_NULL;
+    resource.firstPass = RENDER_GRAPH_NULL;
+    resource.lastPass = RENDER_GRAPH_NULL;
+    resource.isImported = true;
+    resource.hasFinalState = desc.final.layout != Layout::UNDEFINED;
+
+    m_Resources.push_back(resource);
+    m_IsCompiled = false;
+
+    return (uint32_t)m_Resources.size() - 1;
+}
+
+uint32_t RenderGraphImpl::ImportBuffer(const RenderGraphImportedBufferDesc& desc) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    RETURN_ON_FAILURE(&deviceBase, m_FrameIndex, RENDER_GRAPH_NULL, "'BeginRenderGraph' has not been called");
+    RETURN_ON_FAILURE(&deviceBase, desc.buffer, RENDER_GRAPH_NULL, "'buffer' is NULL");
+
+    RenderGraphResource resource = {};
+    resource.bufferDesc = m_iCore.GetBufferDesc(*desc.buffer);
+    resource.initial = {desc.initial.access, Layout::UNDEFINED, desc.initial.stages};
+    resource.final = {desc.final.access, Layout::UNDEFINED, desc.final.stages};
+    resource.name = desc.name;
+    resource.buffer = desc.buffer;
+    resource.heap = RENDER_GRAPH_NULL;
+    resource.firstPass = RENDER_GRAPH_NULL;
+    resource.lastPass = RENDER_GRAPH_NULL;
+    resource.isBuffer = true;
+    resource.isImported = true;
+    resource.hasFinalState = desc.final.access != AccessBits::NONE;
+
+    m_Resources.push_back(resource);
+    m_IsCompiled = false;
+
+    return (uint32_t)m_Resources.size() - 1;
+}
+
+uint32_t RenderGraphImpl::AddPass(const RenderGraphPassDesc& desc) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    RETURN_ON_FAILURE(&deviceBase, m_FrameIndex, RENDER_GRAPH_NULL, "'BeginRenderGraph' has not been called");
+    RETURN_ON_FAILURE(&deviceBase, desc.Record, RENDER_GRAPH_NULL, "'Record' is NULL");
+
+    uint32_t accessOffset = (uint32_t)m_Accesses.size();
+
+    for (uint32_t i = 0; i < desc.textureNum; i++) {
+        const RenderGraphTextureAccess& access = desc.textures[i];
+        if (access.texture >= m_Resources.size() || m_Resources[access.texture].isBuffer) {
+            m_Accesses.resize(accessOffset);
+            RETURN_ON_FAILURE(&deviceBase, false, RENDER_GRAPH_NULL, "'textures[%u].texture' is invalid", i);
+        }
+
+        m_Accesses.push_back({access.state, access.texture});
+    }
+
+    for (uint32_t i = 0; i < desc.bufferNum; i++) {
+        const RenderGraphBufferAccess& access = desc.buffers[i];
+        if (access.buffer >= m_Resources.size() || !m_Resources[access.buffer].isBuffer) {
+            m_Accesses.resize(accessOffset);
+            RETURN_ON_FAILURE(&deviceBase, false, RENDER_GRAPH_NULL, "'buffers[%u].buffer' is invalid", i);
+        }
+
+        m_Accesses.push_back({{access.state.access, Layout::UNDEFINED, access.state.stages}, access.buffer});
+    }
+
+    uint32_t accessNum = (uint32_t)m_Accesses.size() - accessOffset;
+    for (uint32_t i = 1; i < accessNum; i++) {
+        for (uint32_t j = 0; j < i; j++) {
+            if (m_Accesses[accessOffset + i].resource == m_Accesses[accessOffset + j].resource) {
+                m_Accesses.resize(accessOffset);
+                RETURN_ON_FAILURE(&deviceBase, false, RENDER_GRAPH_NULL, "pass '%s' references a resource more than once", desc.name ? desc.name : "unnamed");
+            }
+        }
+    }
+
+    RenderGraphPass pass = {};
+    pass.Record = desc.Record;
+    pass.userArg = desc.userArg;
+    pass.name = desc.name;
+    pass.accessOffset = accessOffset;
+    pass.accessNum = accessNum;
+    pass.queue = desc.isAsyncCompute && m_Desc.computeQueue ? RENDER_GRAPH_QUEUE_COMPUTE : RENDER_GRAPH_QUEUE_MAIN;
+    pass.hasSideEffects = desc.hasSideEffects;
+    pass.isAsyncCompute = desc.isAsyncCompute;
+
+    m_Passes.push_back(pass);
+    m_IsCompiled = false;
+
+    return (uint32_t)m_Passes.size() - 1;
+}
+
+Result RenderGraphImpl::Compile() {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    RETURN_ON_FAILURE(&deviceBase, m_FrameIndex, Result::FAILURE, "'BeginRenderGraph' has not been called");
+    RETURN_ON_FAILURE(&deviceBase, !m_IsExecuted, Result::FAILURE, "the graph has already been executed in this frame");
+
+    m_AlivePasses.clear();
+    m_Barriers.clear();
+    m_IsCompiled = false;
+
+    // Can be called again after adding more passes
+    for (RenderGraphResource& resource : m_Resources) {
+        resource.firstPass = RENDER_GRAPH_NULL;
+        resource.lastPass = RENDER_GRAPH_NULL;
+        resource.heap = RENDER_GRAPH_NULL;
+
+        if (!resource.isImported) {
+            resource.texture = nullptr;
+            resource.buffer = nullptr;
+        }
+    }
+
+    Cull();
+
+    // Lifetimes and usages
+    for (uint32_t passIndex : m_AlivePasses) {
+        const RenderGraphPass& pass = m_Passes[passIndex];
+
+        for (uint32_t i = 0; i < pass.accessNum; i++) {
+            const RenderGraphAccess& access = m_Accesses[pass.accessOffset + i];
+            RenderGraphResource& resource = m_Resources[access.resource];
+
+            if (resource.firstPass == RENDER_GRAPH_NULL)
+                resource.firstPass = passIndex;
+            resource.lastPass = passIndex;
+
+            if (!resource.isImported) {
+                if (resource.isBuffer)
+                    resource.bufferDesc.usage |= GetBufferUsage(access.state.access);
+                else
+                    resource.textureDesc.usage |= GetTextureUsage(access.state.access);
+            }
+        }
+    }
+
+    Result result = PlaceResources();
+    if (result != Result::SUCCESS)
+        return result;
+
+    result = CreatePhysicalResources(m_Frames[m_FrameSlot]);
+    if (result != Result::SUCCESS)
+        return result;
+
+    ComputeBarriers();
+    Schedule();
+    BuildBarrierDescs();
+    BuildDump();
+
+    m_IsCompiled = true;
+
+    return Result::SUCCESS;
+}
+
+void RenderGraphImpl::Cull() {
+    // Walk backwards: a pass is alive if it has side effects or writes something needed later
+    Vector<bool> isNeeded(((DeviceBase&)m_Device).GetStdAllocator());
+    isNeeded.resize(m_Resources.size());
+
+    for (size_t i = 0; i < m_Resources.size(); i++)
+        isNeeded[i] = m_Resources[i].isImported;
+
+    for (size_t i = m_Passes.size(); i > 0; i--) {
+        RenderGraphPass& pass = m_Passes[i - 1];
+
+        pass.isAlive = pass.hasSideEffects;
+        for (uint32_t j = 0; j < pass.accessNum && !pass.isAlive; j++) {
+            const RenderGraphAccess& access = m_Accesses[pass.accessOffset + j];
+            pass.isAlive = IsWriteAccess(access.state.access) && isNeeded[access.resource];
+        }
+
+        if (pass.isAlive) {
+            for (uint32_t j = 0; j < pass.accessNum; j++)
+                isNeeded[m_Accesses[pass.accessOffset + j].resource] = true;
+        }
+    }
+
+    for (uint32_t i = 0; i < (uint32_t)m_Passes.size(); i++) {
+        if (m_Passes[i].isAlive)
+            m_AlivePasses.push_back(i);
+    }
+}
+
+Result RenderGraphImpl::GetMemoryDesc(RenderGraphResource& resource) {
+    uint64_t hash = HashResourceDesc(resource);
+
+    auto entry = m_MemoryDescCache.find(hash);
+    if (entry != m_MemoryDescCache.end()) {
+        const RenderGraphMemoryDesc& cached = entry->second;
+        if (cached.isBuffer == resource.isBuffer && (resource.isBuffer ? IsEqual(cached.bufferDesc, resource.bufferDesc) : IsEqual(cached.textureDesc, resource.textureDesc))) {
+            resource.memoryDesc = cached.memoryDesc;
+            return Result::SUCCESS;
+        }
+    }
+
+    // A temporary resource is needed if "GetXxxMemoryDesc2" is not supported
+    const DeviceDesc& deviceDesc = m_iCore.GetDeviceDesc(m_Device);
+    if (resource.isBuffer) {
+        if (deviceDesc.features.getMemoryDesc2)
+            m_iCore.GetBufferMemoryDesc2(m_Device, resource.bufferDesc, MemoryLocation::DEVICE, resource.memoryDesc);
+        else {
+            Buffer* buffer = nullptr;
+            Result result = m_iCore.CreateBuffer(m_Device, resource.bufferDesc, buffer);
+            if (result != Result::SUCCESS)
+                return result;
+
+            m_iCore.GetBufferMemoryDesc(*buffer, MemoryLocation::DEVICE, resource.memoryDesc);
+            m_iCore.DestroyBuffer(buffer);
+        }
+    } else {
+        if (deviceDesc.features.getMemoryDesc2)
+            m_iCore.GetTextureMemoryDesc2(m_Device, resource.textureDesc, MemoryLocation::DEVICE, resource.memoryDesc);
+        else {
+            Texture* texture = nullptr;
+            Result result = m_iCore.CreateTexture(m_Device, resource.textureDesc, texture);
+            if (result != Result::SUCCESS)
+                return result;
+
+            m_iCore.GetTextureMemoryDesc(*texture, MemoryLocation::DEVICE, resource.memoryDesc);
+            m_iCore.DestroyTexture(texture);
+        }
+    }
+
+    if (!resource.memoryDesc.alignment)
+        resource.memoryDesc.alignment = 1;
+
+    RenderGraphMemoryDesc cached = {};
+    cached.textureDesc = resource.textureDesc;
+    cached.bufferDesc = resource.bufferDesc;
+    cached.memoryDesc = resource.memoryDesc;
+    cached.isBuffer = resource.isBuffer;
+
+    // Descs can be unique per frame (i.e. dynamic resolution), keep the cache bounded (a collision just replaces the entry)
+    if (m_MemoryDescCache.size() >= RENDER_GRAPH_MEMORY_DESC_CACHE_MAX_NUM)
+        m_MemoryDescCache.clear();
+
+    m_MemoryDescCache[hash] = cached;
+
+    return Result::SUCCESS;
+}
+
+Result RenderGraphImpl::PlaceResources() {
+    m_HeapSizes.clear();
+    m_HeapTypes.clear();
+
+    Vector<uint32_t> order(((DeviceBase&)m_Device).GetStdAllocator());
+    for (uint32_t i = 0; i < (uint32_t)m_Resources.size(); i++) {
+        RenderGraphResource& resource = m_Resources[i];
+        if (resource.isImported || resource.firstPass == RENDER_GRAPH_NULL)
+            continue;
+
+        Result result = GetMemoryDesc(resource);
+        if (result != Result::SUCCESS)
+            return result;
+
+        order.push_back(i);
+    }
+
+    // Greedy placement: bigger resources first, each one goes to the lowest offset not overlapping with placed resources of overlapping lifetimes
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        const MemoryDesc& memoryDescA = m_Resources[a].memoryDesc;
+        const MemoryDesc& memoryDescB = m_Resources[b].memoryDesc;
+
+        if (memoryDescA.type != memoryDescB.type)
+            return memoryDescA.type < memoryDescB.type;
+
+        return memoryDescA.size > memoryDescB.size;
+    });
+
+    Vector<uint32_t> placed(((DeviceBase&)m_Device).GetStdAllocator());
+    uint32_t sharedHeap = RENDER_GRAPH_NULL;
+
+    for (uint32_t i : order) {
+        RenderGraphResource& resource = m_Resources[i];
+        const MemoryDesc& memoryDesc = resource.memoryDesc;
+
+        if (memoryDesc.mustBeDedicated) {
+            resource.heap = (uint32_t)m_HeapSizes.size();
+            resource.offset = 0;
+
+            m_HeapSizes.push_back(memoryDesc.size);
+            m_HeapTypes.push_back(memoryDesc.type);
+
+            continue;
+        }
+
+        // One shared heap per memory type
+        if (sharedHeap == RENDER_GRAPH_NULL || m_HeapTypes[sharedHeap] != memoryDesc.type) {
+            sharedHeap = (uint32_t)m_HeapSizes.size();
+            placed.clear();
+
+            m_HeapSizes.push_back(0);
+            m_HeapTypes.push_back(memoryDesc.type);
+        }
+
+        resource.heap = sharedHeap;
+        resource.offset = 0;
+
+        for (bool isMoved = true; isMoved;) {
+            isMoved = false;
+
+            for (uint32_t j : placed) {
+                const RenderGraphResource& other = m_Resources[j];
+                if (IsLifetimeOverlapped(resource, other) && IsMemoryOverlapped(resource, other)) {
+                    resource.offset = Align(other.offset + other.memoryDesc.size, memoryDesc.alignment);
+                    isMoved = true;
+                }
+            }
+        }
+
+        m_HeapSizes[sharedHeap] = std::max(m_HeapSizes[sharedHeap], resource.offset + memoryDesc.size);
+        placed.push_back(i);
+    }
+
+    return Result::SUCCESS;
+}
+
+Result RenderGraphImpl::CreatePhysicalResources(RenderGraphFrame& frame) {
+    // Heaps ("Memory" objects) persist across frames and only grow
+    auto releaseHeap = [&](RenderGraphHeap& heap) {
+        for (RenderGraphPhysicalResource& physicalResource : frame.resources) {
+            if (physicalResource.memory == heap.memory)
+                DestroyPhysicalResource(physicalResource);
+        }
+
+        m_iCore.FreeMemory(heap.memory);
+        heap = {};
+    };
+
+    for (size_t i = m_HeapSizes.size(); i < frame.heaps.size(); i++)
+        releaseHeap(frame.heaps[i]);
+
+    frame.heaps.resize(m_HeapSizes.size(), {});
+
+    for (size_t i = 0; i < m_HeapSizes.size(); i++) {
+        RenderGraphHeap& heap = frame.heaps[i];
+        if (heap.memory && (heap.type != m_HeapTypes[i] || heap.size < m_HeapSizes[i]))
+            releaseHeap(heap);
+
+        if (!heap.memory) {
+            AllocateMemoryDesc allocateMemoryDesc = {};
+            allocateMemoryDesc.size = m_HeapSizes[i];
+            allocateMemoryDesc.type = m_HeapTypes[i];
+
+            Result result = m_iCore.AllocateMemory(m_Device, allocateMemoryDesc, heap.memory);
+            if (result != Result::SUCCESS)
+                return result;
+
+            heap.size = m_HeapSizes[i];
+            heap.type = m_HeapTypes[i];
+        }
+    }
+
+    // Resources are reused if desc, memory and offset match
+    for (RenderGraphPhysicalResource& physicalResource : frame.resources)
+        physicalResource.isUsed = false;
+
+    for (RenderGraphResource& resource : m_Resources) {
+        if (resource.heap == RENDER_GRAPH_NULL)
+            continue;
+
+        Memory* memory = frame.heaps[resource.heap].memory;
+
+        RenderGraphPhysicalResource* found = nullptr;
+        for (RenderGraphPhysicalResource& physicalResource : frame.resources) {
+            if (physicalResource.isUsed || physicalResource.memory != memory || physicalResource.offset != resource.offset || physicalResource.isBuffer != resource.isBuffer)
+                continue;
+
+            if (resource.isBuffer ? IsEqual(physicalResource.bufferDesc, resource.bufferDesc) : IsEqual(physicalResource.textureDesc, resource.textureDesc)) {
+                found = &physicalResource;
+                break;
+            }
+        }
+
+        if (!found) {
+            RenderGraphPhysicalResource physicalResource = {};
+            physicalResource.textureDesc = resource.textureDesc;
+            physicalResource.bufferDesc = resource.bufferDesc;
+            physicalResource.memory = memory;
+            physicalResource.offset = resource.offset;
+            physicalResource.isBuffer = resource.isBuffer;
+
+            if (resource.isBuffer) {
+                Result result = m_iCore.CreateBuffer(m_Device, resource.bufferDesc, physicalResource.buffer);
+                if (result != Result::SUCCESS)
+                    return result;
+
+                BindBufferMemoryDesc bindBufferMemoryDesc = {physicalResource.buffer, memory, resource.offset};
+                result = m_iCore.BindBufferMemory(m_Device, &bindBufferMemoryDesc, 1);
+                if (result != Result::SUCCESS) {
+                    m_iCore.DestroyBuffer(physicalResource.buffer);
+                    return result;
+                }
+
+                if (resource.name)
+                    m_iCore.SetDebugName(physicalResource.buffer, resource.name);
+            } else {
+                Result result = m_iCore.CreateTexture(m_Device, resource.textureDesc, physicalResource.texture);
+                if (result != Result::SUCCESS)
+                    return result;
+
+                BindTextureMemoryDesc bindTextureMemoryDesc = {physicalResource.texture, memory, resource.offset};
+                result = m_iCore.BindTextureMemory(m_Device, &bindTextureMemoryDesc, 1);
+                if (result != Result::SUCCESS) {
+                    m_iCore.DestroyTexture(physicalResource.texture);
+                    return result;
+                }
+
+                if (resource.name)
+                    m_iCore.SetDebugName(physicalResource.texture, resource.name);
+            }
+
+            frame.resources.push_back(physicalResource);
+            found = &frame.resources.back();
+        }
+
+        found->isUsed = true;
+        resource.texture = found->texture;
+        resource.buffer = found->buffer;
+    }
+
+    // Not needed anymore
+    for (RenderGraphPhysicalResource& physicalResource : frame.resources) {
+        if (!physicalResource.isUsed && physicalResource.memory)
+            DestroyPhysicalResource(physicalResource);
+    }
+
+    frame.resources.erase(std::remove_if(frame.resources.begin(), frame.resources.end(), [](const RenderGraphPhysicalResource& physicalResource) {
+        return !physicalResource.memory;
+    }),
+        frame.resources.end());
+
+    return Result::SUCCESS;
+}
+
+void RenderGraphImpl::ComputeBarriers() {
+    StdAllocator<uint8_t>& stdAllocator = ((DeviceBase&)m_Device).GetStdAllocator();
+    uint32_t resourceNum = (uint32_t)m_Resources.size();
+    uint32_t finalPass = (uint32_t)m_Passes.size();
+
+    // Uses of each resource in the execution order
+    Vector<uint32_t> useOffsets(stdAllocator);
+    useOffsets.resize(resourceNum + 1, 0);
+
+    for (uint32_t passIndex : m_AlivePasses) {
+        const RenderGraphPass& pass = m_Passes[passIndex];
+        for (uint32_t i = 0; i < pass.accessNum; i++)
+            useOffsets[m_Accesses[pass.accessOffset + i].resource + 1]++;
+    }
+
+    for (uint32_t i = 0; i < resourceNum; i++)
+        useOffsets[i + 1] += useOffsets[i];
+
+    Vector<uint32_t> usePasses(stdAllocator);
+    usePasses.resize(useOffsets[resourceNum]);
+
+    Vector<uint32_t> useAccesses(stdAllocator);
+    useAccesses.resize(useOffsets[resourceNum]);
+
+    Vector<uint32_t> cursors(useOffsets.begin(), useOffsets.end() - 1, stdAllocator);
+    for (uint32_t passIndex : m_AlivePasses) {
+        const RenderGraphPass& pass = m_Passes[passIndex];
+        for (uint32_t i = 0; i < pass.accessNum; i++) {
+            uint32_t accessIndex = pass.accessOffset + i;
+            uint32_t& cursor = cursors[m_Accesses[accessIndex].resource];
+
+            usePasses[cursor] = passIndex;
+            useAccesses[cursor] = accessIndex;
+            cursor++;
+        }
+    }
+
+    // Resources in the order of the first use, needed to know final states of aliased resources
+    Vector<uint32_t> order(stdAllocator);
+    for (uint32_t i = 0; i < resourceNum; i++) {
+        const RenderGraphResource& resource = m_Resources[i];
+        if (resource.firstPass != RENDER_GRAPH_NULL || resource.hasFinalState)
+            order.push_back(i);
+    }
+
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return m_Resources[a].firstPass < m_Resources[b].firstPass;
+    });
+
+    Vector<StageBits> lastStages(stdAllocator);
+    lastStages.resize(resourceNum, StageBits::NONE);
+
+    Vector<uint32_t> lastQueues(stdAllocator);
+    lastQueues.resize(resourceNum, RENDER_GRAPH_QUEUE_MAIN);
+
+    // Cross-queue dependencies: the latest pass on the other queue to wait for
+    m_WaitPasses.clear();
+    m_WaitPasses.resize(finalPass + 1, RENDER_GRAPH_NULL);
+
+    auto addDependency = [&](uint32_t pass, uint32_t dependency) {
+        if (m_WaitPasses[pass] == RENDER_GRAPH_NULL || m_WaitPasses[pass] < dependency)
+            m_WaitPasses[pass] = dependency;
+    };
+
+    for (uint32_t i : order) {
+        const RenderGraphResource& resource = m_Resources[i];
+
+        AccessLayoutStage state = resource.initial;
+        AccessLayoutStage writeState = resource.initial;
+        uint32_t stateQueue = RENDER_GRAPH_QUEUE_MAIN;
+        uint32_t writeQueue = RENDER_GRAPH_QUEUE_MAIN;
+        uint32_t writePass = RENDER_GRAPH_NULL;
+        uint32_t statePass = RENDER_GRAPH_NULL; // the last pass using "state"
+        std::array<uint32_t, RENDER_GRAPH_QUEUE_MAX_NUM> readPasses = {RENDER_GRAPH_NULL, RENDER_GRAPH_NULL}; // since the last write
+        bool isFirst = !resource.isImported;
+
+        // A group of passes on the same queue using the resource in the same state
+        auto useGroup = [&](uint32_t firstPass, uint32_t lastPass, const AccessLayoutStage& after, uint32_t queue) {
+            AccessLayoutStage before = state;
+            bool isWrite = IsWriteAccess(after.access);
+            bool isBarrierNeeded = true;
+            bool isLayoutChanged = false;
+
+            if (isFirst) {
+                // Contents are undefined, but previous users of the same memory must be done
+                before.stages = StageBits::NONE;
+
+                for (uint32_t j = 0; j < resourceNum; j++) {
+                    const RenderGraphResource& other = m_Resources[j];
+                    if (j == i || other.heap == RENDER_GRAPH_NULL || other.lastPass >= resource.firstPass || !IsMemoryOverlapped(resource, other))
+                        continue;
+
+                    if (lastQueues[j] == queue)
+                        before.stages = MergeStages(before.stages, lastStages[j]);
+                    else
+                        addDependency(firstPass, other.lastPass);
+                }
+
+                isBarrierNeeded = !resource.isBuffer || before.stages != StageBits::NONE;
+            } else if (stateQueue != queue) {
+                // Compute queues don't support graphics layouts, so the main queue makes the transition right after the last use
+                if (before.layout != after.layout && stateQueue == RENDER_GRAPH_QUEUE_MAIN && statePass != RENDER_GRAPH_NULL) {
+                    m_Barriers.push_back({state, {AccessBits::NONE, after.layout, StageBits::NONE}, i, statePass, true});
+                    addDependency(firstPass, statePass);
+
+                    before.layout = after.layout;
+                    isLayoutChanged = true;
+                }
+
+                // The other queue is synchronized by a wait, only a layout transition or a write made on this queue need a barrier
+                bool isWrittenOnThisQueue = writePass != RENDER_GRAPH_NULL && writeQueue == queue;
+                before.access = isWrittenOnThisQueue ? writeState.access : AccessBits::NONE;
+                before.stages = isWrittenOnThisQueue ? writeState.stages : StageBits::NONE;
+
+                isBarrierNeeded = isWrittenOnThisQueue || before.layout != after.layout;
+            } else if (!IsWriteAccess(state.access) && !isWrite && state.layout == after.layout)
+                isBarrierNeeded = !IsCovered(state, after);
+
+            if (isBarrierNeeded)
+                m_Barriers.push_back({before, after, i, firstPass, false});
+
+            // A layout transition is a write
+            isWrite = isWrite || isLayoutChanged || (isBarrierNeeded && before.layout != after.layout);
+
+            uint32_t otherQueue = queue ^ 1;
+            if (writePass != RENDER_GRAPH_NULL && writeQueue != queue)
+                addDependency(firstPass, writePass);
+            if (isWrite && readPasses[otherQueue] != RENDER_GRAPH_NULL)
+                addDependency(firstPass, readPasses[otherQueue]);
+
+            if (isWrite) {
+                writeState = after;
+                writeQueue = queue;
+                writePass = lastPass;
+                readPasses = {RENDER_GRAPH_NULL, RENDER_GRAPH_NULL};
+            } else
+                readPasses[queue] = lastPass;
+
+            state = after;
+            stateQueue = queue;
+            statePass = lastPass;
+            isFirst = false;
+        };
+
+        uint32_t useEnd = useOffsets[i + 1];
+        for (uint32_t use = useOffsets[i]; use < useEnd;) {
+            AccessLayoutStage after = m_Accesses[useAccesses[use]].state;
+            uint32_t firstPass = usePasses[use++];
+            uint32_t lastPass = firstPass;
+            uint32_t queue = m_Passes[firstPass].queue;
+
+            // Consecutive reads in the same layout on the same queue are covered by a single barrier
+            if (!IsWriteAccess(after.access)) {
+                for (; use < useEnd; use++) {
+                    const AccessLayoutStage& next = m_Accesses[useAccesses[use]].state;
+                    if (IsWriteAccess(next.access) || next.layout != after.layout || m_Passes[usePasses[use]].queue != queue)
+                        break;
+
+                    after.access |= next.access;
+                    after.stages = MergeStages(after.stages, next.stages);
+                    lastPass = usePasses[use];
+                }
+            }
+
+            useGroup(firstPass, lastPass, after, queue);
+        }
+
+        if (resource.hasFinalState)
+            useGroup(finalPass, finalPass, resource.final, RENDER_GRAPH_QUEUE_MAIN);
+
+        lastStages[i] = state.stages;
+        lastQueues[i] = stateQueue;
+    }
+
+    std::stable_sort(m_Barriers.begin(), m_Barriers.end(), [](const RenderGraphBarrier& a, const RenderGraphBarrier& b) {
+        return a.pass < b.pass || (a.pass == b.pass && !a.isAfterPass && b.isAfterPass);
+    });
+}
+
+void RenderGraphImpl::Schedule() {
+    StdAllocator<uint8_t>& stdAllocator = ((DeviceBase&)m_Device).GetStdAllocator();
+    uint32_t finalPass = (uint32_t)m_Passes.size();
+
+    m_Batches.clear();
+    m_BatchPasses.clear();
+
+    // The main queue finishes the frame, i.e. waits for the last pass on the compute queue
+    uint32_t lastComputePass = RENDER_GRAPH_NULL;
+    for (uint32_t passIndex : m_AlivePasses) {
+        if (m_Passes[passIndex].queue == RENDER_GRAPH_QUEUE_COMPUTE)
+            lastComputePass = passIndex;
+    }
+
+    if (lastComputePass != RENDER_GRAPH_NULL && (m_WaitPasses[finalPass] == RENDER_GRAPH_NULL || m_WaitPasses[finalPass] < lastComputePass))
+        m_WaitPasses[finalPass] = lastComputePass;
+
+    // Minimal waits: a wait is not needed if an earlier wait on the same queue already covers the dependency
+    Vector<bool> isWaiting(stdAllocator);
+    isWaiting.resize(finalPass + 1, false);
+
+    Vector<bool> isSignaling(stdAllocator);
+    isSignaling.resize(finalPass + 1, false);
+
+    std::array<uint32_t, RENDER_GRAPH_QUEUE_MAX_NUM> waitedPasses = {RENDER_GRAPH_NULL, RENDER_GRAPH_NULL};
+    auto markWait = [&](uint32_t passIndex, uint32_t queue) {
+        uint32_t waitPass = m_WaitPasses[passIndex];
+        uint32_t& waitedPass = waitedPasses[queue];
+
+        if (waitPass != RENDER_GRAPH_NULL && (waitedPass == RENDER_GRAPH_NULL || waitedPass < waitPass)) {
+            isWaiting[passIndex] = true;
+            isSignaling[waitPass] = true;
+            waitedPass = waitPass;
+        }
+    };
+
+    for (uint32_t passIndex : m_AlivePasses)
+        markWait(passIndex, m_Passes[passIndex].queue);
+
+    markWait(finalPass, RENDER_GRAPH_QUEUE_MAIN);
+
+    // Batches: cut before waits and after signals
+    for (uint32_t queue = 0; queue < m_QueueNum; queue++) {
+        uint32_t batchIndex = RENDER_GRAPH_NULL;
+
+        auto addPass = [&](uint32_t passIndex) {
+            if (batchIndex == RENDER_GRAPH_NULL || isWaiting[passIndex]) {
+                batchIndex = (uint32_t)m_Batches.size();
+
+                RenderGraphBatch& batch = m_Batches.emplace_back();
+                batch = {};
+                batch.passOffset = (uint32_t)m_BatchPasses.size();
+                batch.firstPass = passIndex;
+                batch.waitPass = isWaiting[passIndex] ? m_WaitPasses[passIndex] : RENDER_GRAPH_NULL;
+                batch.waitBatch = RENDER_GRAPH_NULL;
+                batch.queue = queue;
+            }
+
+            RenderGraphBatch& batch = m_Batches[batchIndex];
+            if (passIndex == finalPass)
+                batch.isFinal = true;
+            else {
+                m_BatchPasses.push_back(passIndex);
+                batch.passNum++;
+            }
+
+            if (isSignaling[passIndex]) {
+                batch.hasSignal = true;
+                batchIndex = RENDER_GRAPH_NULL;
+            }
+        };
+
+        uint32_t firstBatch = (uint32_t)m_Batches.size();
+        for (uint32_t passIndex : m_AlivePasses) {
+            if (m_Passes[passIndex].queue == queue)
+                addPass(passIndex);
+        }
+
+        if (queue == RENDER_GRAPH_QUEUE_MAIN) {
+            addPass(finalPass);
+
+            // The next frame on the compute queue may need to wait for this frame
+            if (m_QueueNum > 1)
+                m_Batches.back().hasSignal = true;
+
+            continue;
+        }
+
+        // Imported resources can be in use by the previous frame on the main queue, unless a wait on this frame's main queue comes first
+        for (uint32_t i = firstBatch; i < (uint32_t)m_Batches.size(); i++) {
+            RenderGraphBatch& batch = m_Batches[i];
+            if (batch.waitPass != RENDER_GRAPH_NULL)
+                break;
+
+            bool isImportedUsed = false;
+            for (uint32_t j = 0; j < batch.passNum; j++) {
+                const RenderGraphPass& pass = m_Passes[m_BatchPasses[batch.passOffset + j]];
+                for (uint32_t k = 0; k < pass.accessNum; k++)
+                    isImportedUsed |= m_Resources[m_Accesses[pass.accessOffset + k].resource].isImported;
+            }
+
+            if (isImportedUsed) {
+                batch.waitsPreviousFrame = true;
+                break;
+            }
+        }
+    }
+
+    // Submission order: a signal always precedes the corresponding wait, since dependencies point to earlier passes
+    std::stable_sort(m_Batches.begin(), m_Batches.end(), [](const RenderGraphBatch& a, const RenderGraphBatch& b) {
+        return a.firstPass < b.firstPass;
+    });
+
+    Vector<uint32_t> passBatches(stdAllocator);
+    passBatches.resize(finalPass + 1, RENDER_GRAPH_NULL);
+
+    for (uint32_t i = 0; i < (uint32_t)m_Batches.size(); i++) {
+        const RenderGraphBatch& batch = m_Batches[i];
+        for (uint32_t j = 0; j < batch.passNum; j++)
+            passBatches[m_BatchPasses[batch.passOffset + j]] = i;
+    }
+
+    for (RenderGraphBatch& batch : m_Batches) {
+        if (batch.waitPass != RENDER_GRAPH_NULL)
+            batch.waitBatch = passBatches[batch.waitPass];
+    }
+}
+
+void RenderGraphImpl::BuildBarrierDescs() {
+    m_TextureBarrierDescs.clear();
+    m_BufferBarrierDescs.clear();
+
+    size_t barrierIndex = 0;
+    for (uint32_t i = 0; i < (uint32_t)m_Passes.size() * 2 + 1; i++) {
+        uint32_t pass = i / 2;
+        bool isAfterPass = i % 2 != 0;
+
+        RenderGraphBarrierRange& range = pass == m_Passes.size() ? m_FinalBarriers : (isAfterPass ? m_Passes[pass].barriersAfter : m_Passes[pass].barriers);
+        range.textureOffset = (uint32_t)m_TextureBarrierDescs.size();
+        range.textureNum = 0;
+        range.bufferOffset = (uint32_t)m_BufferBarrierDescs.size();
+        range.bufferNum = 0;
+
+        for (; barrierIndex < m_Barriers.size() && m_Barriers[barrierIndex].pass == pass && m_Barriers[barrierIndex].isAfterPass == isAfterPass; barrierIndex++) {
+            const RenderGraphBarrier& barrier = m_Barriers[barrierIndex];
+            const RenderGraphResource& resource = m_Resources[barrier.resource];
+
+            if (resource.isBuffer) {
+                BufferBarrierDesc bufferBarrierDesc = {};
+                bufferBarrierDesc.buffer = resource.buffer;
+                bufferBarrierDesc.before = {barrier.before.access, barrier.before.stages};
+                bufferBarrierDesc.after = {barrier.after.access, barrier.after.stages};
+
+                m_BufferBarrierDescs.push_back(bufferBarrierDesc);
+                range.bufferNum++;
+            } else {
+                TextureBarrierDesc textureBarrierDesc = {};
+                textureBarrierDesc.texture = resource.texture;
+                textureBarrierDesc.before = barrier.before;
+                textureBarrierDesc.after = barrier.after;
+                textureBarrierDesc.mipNum = REMAINING;
+                textureBarrierDesc.layerNum = REMAINING;
+
+                m_TextureBarrierDescs.push_back(textureBarrierDesc);
+                range.textureNum++;
+            }
+        }
+    }
+}
+
+void RenderGraphImpl::BuildDump() {
+    char buf[512];
+    m_Dump.clear();
+
+    auto append = [&](const char* format, auto... args) {
+        snprintf(buf, sizeof(buf), format, args...);
+        m_Dump += buf;
+    };
+
+    auto appendBarriers = [&](uint32_t pass) {
+        for (const RenderGraphBarrier& barrier : m_Barriers) {
+            if (barrier.pass != pass)
+                continue;
+
+            const RenderGraphResource& resource = m_Resources[barrier.resource];
+            if (barrier.isAfterPass) {
+                append("    barrier after: texture '%s' %s -> %s\n", GetResourceName(resource),
+                    g_RenderGraphLayoutNames[(size_t)barrier.before.layout], g_RenderGraphLayoutNames[(size_t)barrier.after.layout]);
+            } else if (resource.isBuffer) {
+                append("    barrier: buffer '%s' access 0x%X, stages 0x%X -> access 0x%X, stages 0x%X\n", GetResourceName(resource),
+                    (uint32_t)barrier.before.access, (uint32_t)barrier.before.stages, (uint32_t)barrier.after.access, (uint32_t)barrier.after.stages);
+            } else {
+                append("    barrier: texture '%s' %s, access 0x%X, stages 0x%X -> %s, access 0x%X, stages 0x%X\n", GetResourceName(resource),
+                    g_RenderGraphLayoutNames[(size_t)barrier.before.layout], (uint32_t)barrier.before.access, (uint32_t)barrier.before.stages,
+                    g_RenderGraphLayoutNames[(size_t)barrier.after.layout], (uint32_t)barrier.after.access, (uint32_t)barrier.after.stages);
+            }
+        }
+    };
+
+    append("RenderGraph: frame %llu, passes %u (alive %u), resources %u, barriers %u, heaps %u\n", (unsigned long long)(m_FrameIndex - 1),
+        (uint32_t)m_Passes.size(), (uint32_t)m_AlivePasses.size(), (uint32_t)m_Resources.size(), (uint32_t)m_Barriers.size(), (uint32_t)m_HeapSizes.size());
+
+    // Schedule
+    append("Passes:\n");
+    for (uint32_t i = 0; i < (uint32_t)m_Passes.size(); i++) {
+        const RenderGraphPass& pass = m_Passes[i];
+        append("  #%u '%s'%s%s\n", i, pass.name ? pass.name : "unnamed", pass.queue == RENDER_GRAPH_QUEUE_COMPUTE ? " [compute]" : "", pass.isAlive ? "" : " (culled)");
+        appendBarriers(i);
+    }
+
+    append("  final\n");
+    appendBarriers((uint32_t)m_Passes.size());
+
+    // Submissions
+    if (m_QueueNum > 1) {
+        append("Batches:\n");
+        for (uint32_t i = 0; i < (uint32_t)m_Batches.size(); i++) {
+            const RenderGraphBatch& batch = m_Batches[i];
+
+            append("  #%u %s, passes", i, batch.queue == RENDER_GRAPH_QUEUE_MAIN ? "queue" : "computeQueue");
+            for (uint32_t j = 0; j < batch.passNum; j++)
+                append(" %u", m_BatchPasses[batch.passOffset + j]);
+
+            if (batch.isFinal)
+                append(" final");
+            if (batch.waitBatch != RENDER_GRAPH_NULL)
+                append(", waits for #%u", batch.waitBatch);
+            if (batch.waitsPreviousFrame)
+                append(", waits for the previous frame");
+            if (batch.hasSignal)
+                append(", signals");
+
+            append("\n");
+        }
+    }
+
+    // Lifetimes and placement
+    append("Resources:\n");
+    for (uint32_t i = 0; i < (uint32_t)m_Resources.size(); i++) {
+        const RenderGraphResource& resource = m_Resources[i];
+
+        if (resource.isBuffer)
+            append("  #%u buffer '%s' %llu bytes", i, GetResourceName(resource), (unsigned long long)resource.bufferDesc.size);
+        else {
+            append("  #%u texture '%s' %ux%ux%u %s", i, GetResourceName(resource), resource.textureDesc.width, std::max(resource.textureDesc.height, (Dim_t)1),
+                std::max(resource.textureDesc.depth, (Dim_t)1), GetFormatProps(resource.textureDesc.format).name);
+        }
+
+        if (resource.firstPass == RENDER_GRAPH_NULL)
+            append(": %s, unused\n", resource.isImported ? "imported" : "transient");
+        else if (resource.isImported)
+            append(": imported, passes [%u; %u]\n", resource.firstPass, resource.lastPass);
+        else {
+            append(": transient, passes [%u; %u], heap %u, offset %llu, size %llu\n", resource.firstPass, resource.lastPass, resource.heap,
+                (unsigned long long)resource.offset, (unsigned long long)resource.memoryDesc.size);
+        }
+    }
+
+    // Memory
+    append("Heaps:\n");
+    for (uint32_t i = 0; i < (uint32_t)m_HeapSizes.size(); i++) {
+        uint64_t resourceSize = 0;
+        for (const RenderGraphResource& resource : m_Resources) {
+            if (resource.heap == i)
+                resourceSize += resource.memoryDesc.size;
+        }
+
+        append("  #%u type %u, size %llu (resources %llu)\n", i, m_HeapTypes[i], (unsigned long long)m_HeapSizes[i], (unsigned long long)resourceSize);
+    }
+}
+
+Texture* RenderGraphImpl::GetTexture(uint32_t texture) const {
+    if (texture >= m_Resources.size() || m_Resources[texture].isBuffer)
+        return nullptr;
+
+    return m_Resources[texture].texture;
+}
+
+Buffer* RenderGraphImpl::GetBuffer(uint32_t buffer) const {
+    if (buffer >= m_Resources.size() || !m_Resources[buffer].isBuffer)
+        return nullptr;
+
+    return m_Resources[buffer].buffer;
+}
+
+void RenderGraphImpl::CmdBarriers(CommandBuffer& commandBuffer, const RenderGraphBarrierRange& range) {
+    if (!range.textureNum && !range.bufferNum)
+        return;
+
+    BarrierDesc barrierDesc = {};
+    barrierDesc.textures = m_TextureBarrierDescs.data() + range.textureOffset;
+    barrierDesc.textureNum = range.textureNum;
+    barrierDesc.buffers = m_BufferBarrierDescs.data() + range.bufferOffset;
+    barrierDesc.bufferNum = range.bufferNum;
+
+    m_iCore.CmdBarrier(commandBuffer, barrierDesc);
+}
+
+void RenderGraphImpl::RecordPass(CommandBuffer& commandBuffer, const RenderGraphPass& pass) {
+    CmdBarriers(commandBuffer, pass.barriers);
+
+    if (pass.name)
+        m_iCore.CmdBeginAnnotation(commandBuffer, pass.name, BGRA_UNUSED);
+
+    pass.Record(commandBuffer, pass.userArg);
+
+    if (pass.name)
+        m_iCore.CmdEndAnnotation(commandBuffer);
+
+    CmdBarriers(commandBuffer, pass.barriersAfter);
+}
+
+void RenderGraphImpl::RecordBatch(CommandBuffer& commandBuffer, const RenderGraphBatch& batch, uint32_t queryOffset) {
+    if (queryOffset != RENDER_GRAPH_NULL) {
+        m_iCore.CmdResetQueries(commandBuffer, *m_QueryPool, queryOffset, 2);
+        m_iCore.CmdEndQuery(commandBuffer, *m_QueryPool, queryOffset);
+    }
+
+    for (uint32_t i = 0; i < batch.passNum; i++)
+        RecordPass(commandBuffer, m_Passes[m_BatchPasses[batch.passOffset + i]]);
+
+    if (batch.isFinal)
+        CmdBarriers(commandBuffer, m_FinalBarriers);
+
+    if (queryOffset != RENDER_GRAPH_NULL) {
+        m_iCore.CmdEndQuery(commandBuffer, *m_QueryPool, queryOffset + 1);
+        m_iCore.CmdCopyQueries(commandBuffer, *m_QueryPool, queryOffset, 2, *m_ReadbackBuffer, queryOffset * sizeof(uint64_t));
+    }
+}
+
+CommandBuffer* const* RenderGraphImpl::Execute(const RenderGraphExecuteDesc& desc, uint32_t& commandBufferNum) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    commandBufferNum = 0;
+
+    RETURN_ON_FAILURE(&deviceBase, m_IsCompiled, nullptr, "'CompileRenderGraph' has not been called");
+    RETURN_ON_FAILURE(&deviceBase, !m_IsExecuted, nullptr, "the graph has already been executed in this frame");
+    RETURN_ON_FAILURE(&deviceBase, !m_Desc.computeQueue, nullptr, "'computeQueue' requires 'SubmitRenderGraph'");
+
+    RenderGraphFrame& frame = m_Frames[m_FrameSlot];
+
+    // Alive passes are split into contiguous chunks, each chunk is recorded into its own command buffer
+    uint32_t aliveNum = (uint32_t)m_AlivePasses.size();
+    uint32_t threadNum = desc.threadNum ? std::min(desc.threadNum, m_Desc.threadMaxNum) : m_Desc.threadMaxNum;
+    threadNum = std::max(std::min(threadNum, aliveNum), 1u);
+
+    m_CommandBuffers.resize(threadNum);
+    for (uint32_t i = 0; i < threadNum; i++) {
+        Result result = GetCommandBuffer(frame.commandPools[i], 0, m_CommandBuffers[i]);
+        if (result != Result::SUCCESS)
+            return nullptr;
+    }
+
+    Vector<Result> results(deviceBase.GetStdAllocator());
+    results.resize(threadNum, Result::SUCCESS);
+
+    auto worker = [&](uint32_t threadIndex) {
+        CommandBuffer& commandBuffer = *m_CommandBuffers[threadIndex];
+
+        Result result = m_iCore.BeginCommandBuffer(commandBuffer, desc.descriptorPool);
+        if (result == Result::SUCCESS) {
+            uint32_t aliveBegin = aliveNum * threadIndex / threadNum;
+            uint32_t aliveEnd = aliveNum * (threadIndex + 1) / threadNum;
+
+            for (uint32_t i = aliveBegin; i < aliveEnd; i++)
+                RecordPass(commandBuffer, m_Passes[m_AlivePasses[i]]);
+
+            if (threadIndex + 1 == threadNum)
+                CmdBarriers(commandBuffer, m_FinalBarriers);
+
+            result = m_iCore.EndCommandBuffer(commandBuffer);
+        }
+
+        results[threadIndex] = result;
+    };
+
+    m_Workers.Run(threadNum, worker);
+
+    for (Result result : results) {
+        if (result != Result::SUCCESS)
+            return nullptr;
+    }
+
+    m_IsExecuted = true;
+    commandBufferNum = threadNum;
+
+    return m_CommandBuffers.data();
+}
+
+Result RenderGraphImpl::Submit(const RenderGraphSubmitDesc& desc) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    RETURN_ON_FAILURE(&deviceBase, m_IsCompiled, Result::FAILURE, "'CompileRenderGraph' has not been called");
+    RETURN_ON_FAILURE(&deviceBase, !m_IsExecuted, Result::FAILURE, "the graph has already been executed in this frame");
+
+    RenderGraphFrame& frame = m_Frames[m_FrameSlot];
+
+    // Batches are distributed between threads round-robin, each thread uses its own command allocator per queue
+    uint32_t batchNum = (uint32_t)m_Batches.size();
+    uint32_t threadNum = std::max(std::min(m_Desc.threadMaxNum, batchNum), 1u);
+
+    m_CommandBuffers.resize(batchNum);
+    for (uint32_t i = 0; i < batchNum; i++) {
+        const RenderGraphBatch& batch = m_Batches[i];
+        RenderGraphCommandPool& commandPool = frame.commandPools[batch.queue * m_Desc.threadMaxNum + i % threadNum];
+
+        Result result = GetCommandBuffer(commandPool, i / threadNum, m_CommandBuffers[i]);
+        if (result != Result::SUCCESS)
+            return result;
+    }
+
+    Vector<Result> results(deviceBase.GetStdAllocator());
+    results.resize(threadNum, Result::SUCCESS);
+
+    auto worker = [&](uint32_t threadIndex) {
+        for (uint32_t i = threadIndex; i < batchNum; i += threadNum) {
+            CommandBuffer& commandBuffer = *m_CommandBuffers[i];
+
+            Result result = m_iCore.BeginCommandBuffer(commandBuffer, desc.descriptorPool);
+            if (result == Result::SUCCESS) {
+                bool isMeasured = m_QueryPool && i < RENDER_GRAPH_TIMESTAMP_BATCH_MAX_NUM;
+                uint32_t queryOffset = isMeasured ? m_FrameSlot * RENDER_GRAPH_TIMESTAMPS_PER_FRAME + i * 2 : RENDER_GRAPH_NULL;
+                RecordBatch(commandBuffer, m_Batches[i], queryOffset);
+
+                result = m_iCore.EndCommandBuffer(commandBuffer);
+            }
+
+            if (result != Result::SUCCESS) {
+                results[threadIndex] = result;
+                break;
+            }
+        }
+    };
+
+    m_Workers.Run(threadNum, worker);
+
+    for (Result result : results) {
+        if (result != Result::SUCCESS)
+            return result;
+    }
+
+    // Submission order guarantees that signals are submitted before waits
+    Vector<FenceSubmitDesc> waitFences(deviceBase.GetStdAllocator());
+    Vector<FenceSubmitDesc> signalFences(deviceBase.GetStdAllocator());
+
+    bool isFirstMainBatch = true;
+    uint32_t waitNum = 0;
+
+    for (uint32_t i = 0; i < batchNum; i++) {
+        RenderGraphBatch& batch = m_Batches[i];
+        uint32_t otherQueue = batch.queue ^ 1;
+
+        waitFences.clear();
+        signalFences.clear();
+
+        if (batch.queue == RENDER_GRAPH_QUEUE_MAIN && isFirstMainBatch) {
+            waitFences.insert(waitFences.end(), desc.waitFences, desc.waitFences + desc.waitFenceNum);
+            isFirstMainBatch = false;
+        }
+
+        if (batch.waitBatch != RENDER_GRAPH_NULL) {
+            waitFences.push_back({m_Fences[otherQueue], m_Batches[batch.waitBatch].signalValue, StageBits::ALL});
+            waitNum++;
+        } else if (batch.waitsPreviousFrame && m_PreviousFrameValue) {
+            waitFences.push_back({m_Fences[RENDER_GRAPH_QUEUE_MAIN], m_PreviousFrameValue, StageBits::ALL});
+            waitNum++;
+        }
+
+        if (batch.hasSignal) {
+            batch.signalValue = ++m_FenceValues[batch.queue];
+            signalFences.push_back({m_Fences[batch.queue], batch.signalValue, StageBits::ALL});
+        }
+
+        if (batch.isFinal)
+            signalFences.insert(signalFences.end(), desc.signalFences, desc.signalFences + desc.signalFenceNum);
+
+        QueueSubmitDesc queueSubmitDesc = {};
+        queueSubmitDesc.waitFences = waitFences.data();
+        queueSubmitDesc.waitFenceNum = (uint32_t)waitFences.size();
+        queueSubmitDesc.commandBuffers = &m_CommandBuffers[i];
+        queueSubmitDesc.commandBufferNum = 1;
+        queueSubmitDesc.signalFences = signalFences.data();
+        queueSubmitDesc.signalFenceNum = (uint32_t)signalFences.size();
+        queueSubmitDesc.swapChain = batch.isFinal ? desc.swapChain : nullptr;
+
+        Result result = m_iCore.QueueSubmit(*m_Queues[batch.queue], queueSubmitDesc);
+        if (result != Result::SUCCESS)
+            return result;
+    }
+
+    m_PreviousFrameValue = m_FenceValues[RENDER_GRAPH_QUEUE_MAIN];
+
+    // Remember what to read back when this slot gets reused
+    frame.timestampQueues.clear();
+    if (m_QueryPool) {
+        for (uint32_t i = 0; i < std::min(batchNum, RENDER_GRAPH_TIMESTAMP_BATCH_MAX_NUM); i++)
+            frame.timestampQueues.push_back(m_Batches[i].queue);
+    }
+
+    frame.frameIndex = m_FrameIndex - 1;
+    frame.waitNum = waitNum;
+
+    m_IsExecuted = true;
+
+    return Result::SUCCESS;
+}
+
+void RenderGraphImpl::ResolveStatistics(RenderGraphFrame& frame, uint32_t frameSlot) {
+    if (frame.timestampQueues.empty() || !m_ReadbackBuffer)
+        return;
+
+    uint32_t batchNum = (uint32_t)frame.timestampQueues.size();
+    uint64_t offset = frameSlot * RENDER_GRAPH_TIMESTAMPS_PER_FRAME * sizeof(uint64_t);
+    const uint64_t* timestamps = (uint64_t*)m_iCore.MapBuffer(*m_ReadbackBuffer, offset, batchNum * 2 * sizeof(uint64_t));
+
+    if (timestamps) {
+        RenderGraphStatistics statistics = {};
+        statistics.frameIndex = frame.frameIndex;
+        statistics.waitNum = frame.waitNum;
+
+        uint64_t frameBegin = UINT64_MAX;
+        uint64_t frameEnd = 0;
+        uint64_t busyTicks[RENDER_GRAPH_QUEUE_MAX_NUM] = {};
+        uint64_t overlapTicks = 0;
+
+        for (uint32_t i = 0; i < batchNum; i++) {
+            uint64_t begin = timestamps[i * 2];
+            uint64_t end = std::max(timestamps[i * 2 + 1], begin);
+            uint32_t queue = frame.timestampQueues[i];
+
+            busyTicks[queue] += end - begin;
+            frameBegin = std::min(frameBegin, begin);
+            frameEnd = std::max(frameEnd, end);
+
+            if (queue == RENDER_GRAPH_QUEUE_MAIN)
+                statistics.batchNum++;
+            else
+                statistics.computeBatchNum++;
+
+            // Batches on the same queue don't overlap, so the overlap is a sum of pairwise intersections
+            if (queue != RENDER_GRAPH_QUEUE_COMPUTE)
+                continue;
+
+            for (uint32_t j = 0; j < batchNum; j++) {
+                if (frame.timestampQueues[j] != RENDER_GRAPH_QUEUE_MAIN)
+                    continue;
+
+                uint64_t otherBegin = timestamps[j * 2];
+                uint64_t otherEnd = std::max(timestamps[j * 2 + 1], otherBegin);
+                uint64_t intersectionBegin = std::max(begin, otherBegin);
+                uint64_t intersectionEnd = std::min(end, otherEnd);
+
+                if (intersectionEnd > intersectionBegin)
+                    overlapTicks += intersectionEnd - intersectionBegin;
+            }
+        }
+
+        // Timestamps of different queues are comparable if the queues share a timestamp domain (true for graphics and compute queues)
+        statistics.queueTime = double(busyTicks[RENDER_GRAPH_QUEUE_MAIN]) * m_TicksToMs;
+        statistics.computeQueueTime = double(busyTicks[RENDER_GRAPH_QUEUE_COMPUTE]) * m_TicksToMs;
+        statistics.overlapTime = double(overlapTicks) * m_TicksToMs;
+        statistics.frameTime = frameEnd > frameBegin ? double(frameEnd - frameBegin) * m_TicksToMs : 0.0;
+
+        m_Statistics = statistics;
+
+        m_iCore.UnmapBuffer(*m_ReadbackBuffer);
+    }
+
+    frame.timestampQueues.clear();
+}
@@ -0,0 +1,67 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+enum class ResidencyObjectType : uint8_t {
+    NONE,
+    MEMORY,
+    BUFFER,
+    TEXTURE
+};
+
+struct ResidencyObject {
+    void* object;
+    uint64_t lastUsedFrame;
+    uint32_t prev; // in the "hot" list, most recently used first
+    uint32_t next;
+    float priority;
+    ResidencyObjectType type;
+    bool isCold;
+    bool isUnsupported;
+    bool isPromotionPending;
+};
+
+struct ResidencyManagerImpl : public DebugNameBase {
+    inline ResidencyManagerImpl(Device& device)
+        : m_Device(device)
+        , m_Objects(((DeviceBase&)device).GetStdAllocator())
+        , m_FreeObjects(((DeviceBase&)device).GetStdAllocator())
+        , m_Promotions(((DeviceBase&)device).GetStdAllocator()) {
+    }
+
+    inline Device& GetDevice() {
+        return m_Device;
+    }
+
+    inline void GetStatistics(ResidencyStatistics& statistics) const {
+        statistics = m_Statistics;
+    }
+
+    Result Create(const ResidencyManagerDesc& desc);
+    uint32_t Add(void* object, ResidencyObjectType type, float priority);
+    void Remove(uint32_t object);
+    void MarkUsed(uint32_t object);
+    void Update();
+
+private:
+    Result SetPriority(const ResidencyObject& residencyObject, float priority);
+    void Link(uint32_t object);
+    void Unlink(uint32_t object);
+
+private:
+    Device& m_Device;
+    ResidencyInterface m_iResidency = {};
+    HelperInterface m_iHelper = {};
+    ResidencyManagerDesc m_Desc = {};
+    ResidencyStatistics m_Statistics = {};
+    Vector<ResidencyObject> m_Objects; // handles are indices
+    Vector<uint32_t> m_FreeObjects;
+    Vector<uint32_t> m_Promotions; // cold objects used again
+    uint64_t m_FrameIndex = 0;
+    uint32_t m_Head = RESIDENCY_NULL;
+    uint32_t m_Tail = RESIDENCY_NULL;
+};
+
+} // namespace nri
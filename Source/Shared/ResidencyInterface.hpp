@@ -0,0 +1,202 @@
+// © 2025 NVIDIA Corporation
+
+#include <algorithm>
+
+Result ResidencyManagerImpl::Create(const ResidencyManagerDesc& desc) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    RETURN_ON_FAILURE(&deviceBase, desc.coldFrameNum != 0, Result::INVALID_ARGUMENT, "'coldFrameNum' can't be 0");
+    RETURN_ON_FAILURE(&deviceBase, desc.coldPriority >= -1.0f && desc.coldPriority <= 1.0f, Result::INVALID_ARGUMENT, "'coldPriority' must be in [-1; 1]");
+
+    Result result = nriGetInterface(m_Device, NRI_INTERFACE(ResidencyInterface), &m_iResidency);
+    if (result != Result::SUCCESS)
+        return result;
+
+    if (desc.budgetUsageThreshold != 0.0f) {
+        result = nriGetInterface(m_Device, NRI_INTERFACE(HelperInterface), &m_iHelper);
+        if (result != Result::SUCCESS)
+            return result;
+    }
+
+    m_Desc = desc;
+
+    return Result::SUCCESS;
+}
+
+Result ResidencyManagerImpl::SetPriority(const ResidencyObject& residencyObject, float priority) {
+    if (residencyObject.type == ResidencyObjectType::MEMORY)
+        return m_iResidency.SetMemoryPriority(*(Memory*)residencyObject.object, priority);
+    else if (residencyObject.type == ResidencyObjectType::BUFFER)
+        return m_iResidency.SetBufferPriority(*(Buffer*)residencyObject.object, priority);
+
+    return m_iResidency.SetTexturePriority(*(Texture*)residencyObject.object, priority);
+}
+
+void ResidencyManagerImpl::Link(uint32_t object) {
+    ResidencyObject& residencyObject = m_Objects[object];
+    residencyObject.prev = RESIDENCY_NULL;
+    residencyObject.next = m_Head;
+
+    if (m_Head != RESIDENCY_NULL)
+        m_Objects[m_Head].prev = object;
+    else
+        m_Tail = object;
+
+    m_Head = object;
+}
+
+void ResidencyManagerImpl::Unlink(uint32_t object) {
+    ResidencyObject& residencyObject = m_Objects[object];
+
+    if (residencyObject.prev != RESIDENCY_NULL)
+        m_Objects[residencyObject.prev].next = residencyObject.next;
+    else
+        m_Head = residencyObject.next;
+
+    if (residencyObject.next != RESIDENCY_NULL)
+        m_Objects[residencyObject.next].prev = residencyObject.prev;
+    else
+        m_Tail = residencyObject.prev;
+
+    residencyObject.prev = RESIDENCY_NULL;
+    residencyObject.next = RESIDENCY_NULL;
+}
+
+uint32_t ResidencyManagerImpl::Add(void* object, ResidencyObjectType type, float priority) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    RETURN_ON_FAILURE(&deviceBase, priority >= -1.0f && priority <= 1.0f, RESIDENCY_NULL, "'priority' must be in [-1; 1]");
+
+    uint32_t index = 0;
+    if (!m_FreeObjects.empty()) {
+        index = m_FreeObjects.back();
+        m_FreeObjects.pop_back();
+    } else {
+        index = (uint32_t)m_Objects.size();
+        m_Objects.emplace_back();
+    }
+
+    // A new object is hot, i.e. it's considered as used in the current frame
+    ResidencyObject& residencyObject = m_Objects[index];
+    residencyObject = {};
+    residencyObject.object = object;
+    residencyObject.lastUsedFrame = m_FrameIndex;
+    residencyObject.priority = priority;
+    residencyObject.type = type;
+
+    Link(index);
+
+    m_Statistics.objectNum++;
+
+    return index;
+}
+
+void ResidencyManagerImpl::Remove(uint32_t object) {
+    if (object >= m_Objects.size() || m_Objects[object].type == ResidencyObjectType::NONE)
+        return;
+
+    ResidencyObject& residencyObject = m_Objects[object];
+    if (residencyObject.isPromotionPending)
+        m_Promotions.erase(std::find(m_Promotions.begin(), m_Promotions.end(), object));
+
+    if (residencyObject.isUnsupported)
+        m_Statistics.unsupportedObjectNum--;
+    else if (residencyObject.isCold)
+        m_Statistics.coldObjectNum--;
+
+    // Cold and unsupported objects are not in the list
+    if (!residencyObject.isUnsupported && (!residencyObject.isCold || residencyObject.isPromotionPending))
+        Unlink(object);
+
+    residencyObject = {};
+    m_FreeObjects.push_back(object);
+
+    m_Statistics.objectNum--;
+}
+
+void ResidencyManagerImpl::MarkUsed(uint32_t object) {
+    if (object >= m_Objects.size())
+        return;
+
+    ResidencyObject& residencyObject = m_Objects[object];
+    if (residencyObject.type == ResidencyObjectType::NONE || residencyObject.isUnsupported || residencyObject.lastUsedFrame == m_FrameIndex)
+        return;
+
+    residencyObject.lastUsedFrame = m_FrameIndex;
+
+    // A cold object goes back to the list immediately, but its priority gets restored in "Update"
+    if (residencyObject.isCold && !residencyObject.isPromotionPending) {
+        residencyObject.isPromotionPending = true;
+        m_Promotions.push_back(object);
+    } else
+        Unlink(object);
+
+    Link(object);
+}
+
+void ResidencyManagerImpl::Update() {
+    uint32_t updateNum = m_Desc.maxPriorityUpdateNum ? m_Desc.maxPriorityUpdateNum : RESIDENCY_NULL;
+
+    m_Statistics.demotedNum = 0;
+    m_Statistics.promotedNum = 0;
+
+    // Promote used cold objects first, they are needed right now
+    uint32_t promotionNum = 0;
+    for (; promotionNum < m_Promotions.size() && updateNum; promotionNum++, updateNum--) {
+        ResidencyObject& residencyObject = m_Objects[m_Promotions[promotionNum]];
+        residencyObject.isCold = false;
+        residencyObject.isPromotionPending = false;
+
+        SetPriority(residencyObject, residencyObject.priority);
+
+        m_Statistics.coldObjectNum--;
+        m_Statistics.promotedNum++;
+    }
+
+    m_Promotions.erase(m_Promotions.begin(), m_Promotions.begin() + promotionNum);
+
+    // Demote only under memory pressure, if requested
+    bool isDemotionNeeded = true;
+    if (m_Desc.budgetUsageThreshold != 0.0f) {
+        VideoMemoryInfo videoMemoryInfo = {};
+        if (m_iHelper.QueryVideoMemoryInfo(m_Device, MemoryLocation::DEVICE, videoMemoryInfo) == Result::SUCCESS && videoMemoryInfo.budgetSize)
+            m_Statistics.budgetUsage = float(double(videoMemoryInfo.usageSize) / double(videoMemoryInfo.budgetSize));
+
+        isDemotionNeeded = m_Statistics.budgetUsage >= m_Desc.budgetUsageThreshold;
+    }
+
+    // Demote least recently used objects (the tail of the list), the list is sorted by "lastUsedFrame"
+    while (isDemotionNeeded && updateNum && m_Tail != RESIDENCY_NULL) {
+        uint32_t object = m_Tail;
+        ResidencyObject& residencyObject = m_Objects[object];
+
+        if (residencyObject.lastUsedFrame + m_Desc.coldFrameNum > m_FrameIndex)
+            break;
+
+        Unlink(object);
+
+        // Still cold, if the promotion has been postponed by "maxPriorityUpdateNum"
+        if (residencyObject.isPromotionPending) {
+            residencyObject.isPromotionPending = false;
+            m_Promotions.erase(std::find(m_Promotions.begin(), m_Promotions.end(), object));
+
+            continue;
+        }
+
+        Result result = SetPriority(residencyObject, m_Desc.coldPriority);
+        if (result == Result::SUCCESS) {
+            residencyObject.isCold = true;
+
+            m_Statistics.coldObjectNum++;
+            m_Statistics.demotedNum++;
+        } else {
+            residencyObject.isUnsupported = true;
+
+            m_Statistics.unsupportedObjectNum++;
+        }
+
+        updateNum--;
+    }
+
+    m_FrameIndex++;
+}
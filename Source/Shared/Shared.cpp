@@ -2,16 +2,29 @@
 
 #include "SharedExternal.h"
 
+#include "HeadlessSwapChain.h"
 #include "HelperInterface.h"
 #include "ImguiInterface.h"
+#include "MicromapBakerInterface.h"
+#include "ProfilerInterface.h"
+#include "RenderGraphInterface.h"
+#include "ResidencyInterface.h"
+#include "SparseInterface.h"
 #include "StreamerInterface.h"
 #include "UpscalerInterface.h"
 
 using namespace nri;
 
+#include "HeadlessSwapChain.hpp"
 #include "HelperInterface.hpp"
 #include "ImguiInterface.hpp"
+#include "MicromapBakerInterface.hpp"
+#include "ProfilerInterface.hpp"
+#include "RenderGraphInterface.hpp"
+#include "ResidencyInterface.hpp"
+#include "SparseInterface.hpp"
 #include "StreamerInterface.hpp"
+#include "TraceInterface.hpp"
 #include "UpscalerInterface.hpp"
 
 #include "SharedExternal.hpp"
@@ -4,10 +4,15 @@
 
 #include <array>
 #include <cassert>
+#include <chrono>
 #include <cinttypes>
+#include <cmath>
+#include <condition_variable>
 #include <cstring>
 #include <map>
+#include <mutex>
 #include <numeric>
+#include <thread>
 
 #if (NRI_ENABLE_D3D11_SUPPORT || NRI_ENABLE_D3D12_SUPPORT)
 #    include <dxgi1_6.h>
@@ -23,12 +28,19 @@ typedef uint32_t DXGI_FORMAT;
 #include "Extensions/NRIDeviceCreation.h"
 #include "Extensions/NRIHelper.h"
 #include "Extensions/NRIImgui.h"
+#include "Extensions/NRIIndirectCommands.h"
 #include "Extensions/NRILowLatency.h"
 #include "Extensions/NRIMeshShader.h"
 #include "Extensions/NRIRayTracing.h"
+#include "Extensions/NRIRenderGraph.h"
+#include "Extensions/NRIResidency.h"
+#include "Extensions/NRIMicromapBaker.h"
+#include "Extensions/NRIProfiler.h"
 #include "Extensions/NRIResourceAllocator.h"
+#include "Extensions/NRISparse.h"
 #include "Extensions/NRIStreamer.h"
 #include "Extensions/NRISwapChain.h"
+#include "Extensions/NRITrace.h"
 #include "Extensions/NRIUpscaler.h"
 #include "Extensions/NRIWrapperD3D11.h"
 #include "Extensions/NRIWrapperD3D12.h"
@@ -158,6 +170,7 @@ typedef nri::AllocationCallbacks AllocationCallbacks;
 
 // Base classes
 #include "DeviceBase.h"
+#include "TraceInterface.h"
 
 // Macro stuff
 #ifdef _WIN32
@@ -181,45 +194,48 @@ typedef nri::AllocationCallbacks AllocationCallbacks;
 #define RETURN_ON_BAD_HRESULT(deviceBase, hr, funcName) \
     if (hr < 0) { \
         Result _result = GetResultFromHRESULT(hr); \
-        (deviceBase)->ReportMessage(Message::ERROR, _result, __FILE__, __LINE__, funcName "(): failed, result = 0x%08X (%d)!", __FUNCTION__, hr, hr); \
+        (deviceBase)->ReportMessage(Message::ERROR, _result, true, __FILE__, __LINE__, funcName "(): failed, result = 0x%08X (%d)!", __FUNCTION__, hr, hr); \
         return _result; \
     }
 
 #define RETURN_VOID_ON_BAD_HRESULT(deviceBase, hr, funcName) \
     if (hr < 0) { \
         Result _result = GetResultFromHRESULT(hr); \
-        (deviceBase)->ReportMessage(Message::ERROR, _result, __FILE__, __LINE__, funcName "(): failed, result = 0x%08X (%d)!", __FUNCTION__, hr, hr); \
+        (deviceBase)->ReportMessage(Message::ERROR, _result, true, __FILE__, __LINE__, funcName "(): failed, result = 0x%08X (%d)!", __FUNCTION__, hr, hr); \
         return; \
     }
 
 #define RETURN_ON_BAD_VKRESULT(deviceBase, vkResult, funcName) \
     if (vkResult < 0) { \
         Result _result = GetResultFromVkResult(vkResult); \
-        (deviceBase)->ReportMessage(Message::ERROR, _result, __FILE__, __LINE__, funcName "(): failed, result = 0x%08X (%d)!", __FUNCTION__, vkResult, vkResult); \
+        (deviceBase)->ReportMessage(Message::ERROR, _result, true, __FILE__, __LINE__, funcName "(): failed, result = 0x%08X (%d)!", __FUNCTION__, vkResult, vkResult); \
         return _result; \
     }
 
 #define RETURN_VOID_ON_BAD_VKRESULT(deviceBase, vkResult, funcName) \
     if (vkResult < 0) { \
         Result _result = GetResultFromVkResult(vkResult); \
-        (deviceBase)->ReportMessage(Message::ERROR, _result, __FILE__, __LINE__, funcName "(): failed, result = 0x%08X (%d)!", __FUNCTION__, vkResult, vkResult); \
+        (deviceBase)->ReportMessage(Message::ERROR, _result, true, __FILE__, __LINE__, funcName "(): failed, result = 0x%08X (%d)!", __FUNCTION__, vkResult, vkResult); \
         return; \
     }
 
 #define REPORT_ERROR_ON_BAD_NVAPI_STATUS(deviceBase, expression) \
     if ((expression) != 0) { \
-        (deviceBase)->ReportMessage(Message::ERROR, Result::FAILURE, __FILE__, __LINE__, "%s: " NRI_STRINGIFY(expression) " failed!", __FUNCTION__); \
+        (deviceBase)->ReportMessage(Message::ERROR, Result::FAILURE, true, __FILE__, __LINE__, "%s: " NRI_STRINGIFY(expression) " failed!", __FUNCTION__); \
     }
 
 #define RETURN_ON_FAILURE(deviceBase, condition, returnCode, format, ...) \
     if (!(condition)) { \
-        (deviceBase)->ReportMessage(Message::ERROR, Result::FAILURE, __FILE__, __LINE__, "%s: " format, __FUNCTION__, ##__VA_ARGS__); \
+        (deviceBase)->ReportMessage(Message::ERROR, Result::FAILURE, true, __FILE__, __LINE__, "%s: " format, __FUNCTION__, ##__VA_ARGS__); \
         return returnCode; \
     }
 
-#define REPORT_INFO(deviceBase, format, ...)    (deviceBase)->ReportMessage(Message::INFO, Result::SUCCESS, __FILE__, __LINE__, format, ##__VA_ARGS__)
-#define REPORT_WARNING(deviceBase, format, ...) (deviceBase)->ReportMessage(Message::WARNING, Result::SUCCESS, __FILE__, __LINE__, "%s(): " format, __FUNCTION__, ##__VA_ARGS__)
-#define REPORT_ERROR(deviceBase, format, ...)   (deviceBase)->ReportMessage(Message::ERROR, Result::FAILURE, __FILE__, __LINE__, "%s(): " format, __FUNCTION__, ##__VA_ARGS__)
+#define REPORT_INFO(deviceBase, format, ...)    (deviceBase)->ReportMessage(Message::INFO, Result::SUCCESS, true, __FILE__, __LINE__, format, ##__VA_ARGS__)
+#define REPORT_WARNING(deviceBase, format, ...) (deviceBase)->ReportMessage(Message::WARNING, Result::SUCCESS, true, __FILE__, __LINE__, "%s(): " format, __FUNCTION__, ##__VA_ARGS__)
+#define REPORT_ERROR(deviceBase, format, ...)   (deviceBase)->ReportMessage(Message::ERROR, Result::FAILURE, true, __FILE__, __LINE__, "%s(): " format, __FUNCTION__, ##__VA_ARGS__)
+
+// Multi-line error reports, which must not be interrupted by "AbortExecution"
+#define REPORT_ERROR_NO_ABORT(deviceBase, format, ...) (deviceBase)->ReportMessage(Message::ERROR, Result::FAILURE, false, __FILE__, __LINE__, "%s(): " format, __FUNCTION__, ##__VA_ARGS__)
 
 // Queue scores // TODO: improve?
 #define GRAPHICS_QUEUE_SCORE ((graphics ? 100 : 0) + (compute ? 10 : 0) + (copy ? 10 : 0) + (sparse ? 5 : 0) + (videoDecode ? 2 : 0) + (videoEncode ? 2 : 0) + (protect ? 1 : 0) + (opticalFlow ? 1 : 0))
@@ -299,6 +315,15 @@ inline void Destroy(T* object) {
     }
 }
 
+// For objects created via "CreateImplementation" (keeps "DeviceStatistics" in sync)
+template <typename Interface, typename T>
+inline void DestroyObject(T* object) {
+    if (object) {
+        ((DeviceBase&)(object->GetDevice())).OnObjectDestroyed<Interface>();
+        Destroy(object);
+    }
+}
+
 constexpr uint64_t MsToUs(uint32_t x) {
     return x * 1000000ull;
 }
@@ -398,6 +423,127 @@ inline uint64_t GetPresentIndex(uint64_t presentId) {
     return presentId & ((1ull << PRESENT_INDEX_BIT_NUM) - 1ull);
 }
 
+// Swap chain statistics
+constexpr uint32_t PRESENT_HISTORY_NUM = 64;
+
+struct PresentRecord {
+    uint64_t index;
+    uint64_t cpuTime;
+    uint32_t textureIndex;
+};
+
+// Present indices start from 1. Times are in microseconds on the "steady_clock" timeline (CLOCK_MONOTONIC on Linux, QPC on Windows)
+struct SwapChainStatisticsHelper {
+    static uint64_t GetTime();
+
+    inline void Initialize(bool isVsync, bool isMeasured, uint32_t refreshInterval) {
+        ExclusiveScope lock(m_Lock);
+
+        m_IsVsync = isVsync;
+        m_IsMeasured = isMeasured;
+        m_RefreshInterval = refreshInterval;
+    }
+
+    void OnAcquire(uint64_t beginTime);
+    void OnTextureReleased(uint32_t textureIndex); // CPU-side approximation of presentation feedback, ignored if "isMeasured"
+    void OnWaitForPresent(uint64_t beginTime);
+    uint64_t OnPresent(uint64_t beginTime, uint32_t textureIndex); // call only if the present succeeded
+
+    inline uint64_t GetNextPresentIndex() {
+        ExclusiveScope lock(m_Lock);
+
+        return m_Statistics.presentNum + 1;
+    }
+
+    void OnDisplayed(uint64_t presentIndex, uint64_t displayTime, uint64_t refreshCount); // "refreshCount = 0" - missed vblanks are derived from display times
+    void GetStatistics(SwapChainStatistics& swapChainStatistics);
+
+private:
+    std::array<PresentRecord, PRESENT_HISTORY_NUM> m_History = {};
+    Lock m_Lock;
+    SwapChainStatistics m_Statistics = {};
+    uint64_t m_LatencySum = 0;
+    uint64_t m_LatencySampleNum = 0;
+    uint64_t m_LastDisplayedIndex = 0;
+    uint64_t m_LastDisplayTime = 0;
+    uint64_t m_LastRefreshCount = 0;
+    uint32_t m_RefreshInterval = 0;
+    uint32_t m_MinDisplayInterval = 0;
+    bool m_IsMeasured = false;
+    bool m_IsVsync = false;
+};
+
+// Transient attachment views (see "CreateTransientAttachmentView"), owned by a command buffer. A view is reused while recording and
+// destroyed by the next "Reset" (called from "Begin", i.e. when the app guarantees that the previous recording is not in use anymore)
+template <typename DeviceT, typename DescriptorT>
+struct TransientViewCache {
+    struct Entry {
+        Texture2DViewDesc desc;
+        DescriptorT* descriptor;
+    };
+
+    inline TransientViewCache(DeviceT& device)
+        : m_Device(device)
+        , m_Entries(device.GetStdAllocator()) {
+    }
+
+    inline ~TransientViewCache() {
+        Reset();
+    }
+
+    inline Result Get(const Texture2DViewDesc& textureViewDesc, Descriptor*& textureView) {
+        for (const Entry& entry : m_Entries) {
+            const Texture2DViewDesc& desc = entry.desc;
+            if (desc.texture == textureViewDesc.texture && desc.viewType == textureViewDesc.viewType && desc.format == textureViewDesc.format
+                && desc.mipOffset == textureViewDesc.mipOffset && desc.mipNum == textureViewDesc.mipNum
+                && desc.layerOffset == textureViewDesc.layerOffset && desc.layerNum == textureViewDesc.layerNum) {
+                textureView = (Descriptor*)entry.descriptor;
+                return Result::SUCCESS;
+            }
+        }
+
+        // Not tracked by "DeviceStatistics", since the app doesn't own these views
+        DescriptorT* descriptor = Allocate<DescriptorT>(m_Device.GetAllocationCallbacks(), m_Device);
+        Result result = descriptor->Create(textureViewDesc);
+        if (result != Result::SUCCESS) {
+            Destroy(m_Device.GetAllocationCallbacks(), descriptor);
+            textureView = nullptr;
+
+            return result;
+        }
+
+        m_Entries.push_back({textureViewDesc, descriptor});
+        textureView = (Descriptor*)descriptor;
+
+        return Result::SUCCESS;
+    }
+
+    inline void Reset() {
+        for (const Entry& entry : m_Entries)
+            Destroy(m_Device.GetAllocationCallbacks(), entry.descriptor);
+
+        m_Entries.clear();
+    }
+
+private:
+    DeviceT& m_Device;
+    Vector<Entry> m_Entries;
+};
+
+// Indirect commands (see "CreateCommandSignature"): arguments are packed in declaration order, "CommandSignatureDesc::stride" can only add padding
+uint32_t GetIndirectArgumentSize(const IndirectArgumentDesc& indirectArgumentDesc); // 0 for unknown types
+
+struct CommandSignatureLayout {
+    inline CommandSignatureLayout(const StdAllocator<uint8_t>& allocator)
+        : argumentOffsets(allocator) {
+    }
+
+    void Init(const CommandSignatureDesc& commandSignatureDesc);
+
+    Vector<uint32_t> argumentOffsets;
+    uint32_t stride = 0;
+};
+
 // Windows/D3D specific
 #if (NRI_ENABLE_D3D11_SUPPORT || NRI_ENABLE_D3D12_SUPPORT)
 
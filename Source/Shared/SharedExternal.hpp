@@ -819,7 +819,45 @@ Format nri::VKFormatToNRIFormat(uint32_t format) {
     return Format::UNKNOWN;
 }
 
-void DeviceBase::ReportMessage(Message messageType, Result result, const char* file, uint32_t line, const char* format, ...) const {
+DeviceBase::~DeviceBase() {
+    StopTrace();
+}
+
+void DeviceBase::GetStatistics(DeviceStatistics& deviceStatistics) const {
+    const DeviceStatisticsStorage& storage = *m_Statistics;
+
+    uint64_t* aliveObjects = (uint64_t*)&deviceStatistics.aliveObjects;
+    for (uint32_t i = 0; i < OBJECT_STATISTICS_NUM; i++)
+        aliveObjects[i] = storage.aliveObjects[i].load(std::memory_order_relaxed);
+
+    uint64_t* total = (uint64_t*)&deviceStatistics.total;
+    uint64_t* lastFrame = (uint64_t*)&deviceStatistics.lastFrame;
+    for (uint32_t i = 0; i < ACTIVITY_STATISTICS_NUM; i++) {
+        total[i] = storage.total[i].load(std::memory_order_relaxed);
+        lastFrame[i] = storage.lastFrame[i].load(std::memory_order_relaxed);
+    }
+
+    deviceStatistics.frameNum = storage.frameNum.load(std::memory_order_relaxed);
+}
+
+void DeviceBase::ShareStatistics(DeviceBase& owner) {
+    m_Statistics = owner.m_Statistics;
+}
+
+void DeviceBase::OnPresent() {
+    DeviceStatisticsStorage& storage = *m_Statistics;
+    ExclusiveScope lock(storage.frameLock);
+
+    for (uint32_t i = 0; i < ACTIVITY_STATISTICS_NUM; i++) {
+        uint64_t total = storage.total[i].load(std::memory_order_relaxed);
+        storage.lastFrame[i].store(total - storage.frameBegin[i], std::memory_order_relaxed);
+        storage.frameBegin[i] = total;
+    }
+
+    storage.frameNum.fetch_add(1, std::memory_order_relaxed);
+}
+
+void DeviceBase::ReportMessage(Message messageType, Result result, bool canAbort, const char* file, uint32_t line, const char* format, ...) const {
     // Report message
     if (m_CallbackInterface.MessageCallback) { // TODO: "MessageCallback" actually can't be "NULL"
         const DeviceDesc& desc = GetDesc();
@@ -840,7 +878,7 @@ void DeviceBase::ReportMessage(Message messageType, Result result, const char* f
     }
 
     // Abort execution
-    if (m_CallbackInterface.AbortExecution && (int8_t)result > 0)
+    if (canAbort && m_CallbackInterface.AbortExecution && (int8_t)result > 0)
         m_CallbackInterface.AbortExecution(m_CallbackInterface.userArg);
 }
 
@@ -868,3 +906,156 @@ uint64_t nri::GetSwapChainId() {
     static uint64_t id = 0;
     return id++ << PRESENT_INDEX_BIT_NUM;
 }
+
+uint64_t SwapChainStatisticsHelper::GetTime() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void SwapChainStatisticsHelper::OnAcquire(uint64_t beginTime) {
+    uint32_t blockedTime = (uint32_t)(GetTime() - beginTime);
+
+    ExclusiveScope lock(m_Lock);
+
+    m_Statistics.acquireBlockedTime = blockedTime;
+    m_Statistics.acquireBlockedTotalTime += blockedTime;
+}
+
+void SwapChainStatisticsHelper::OnTextureReleased(uint32_t textureIndex) {
+    uint64_t displayedIndex = 0;
+    {
+        ExclusiveScope lock(m_Lock);
+
+        if (m_IsMeasured)
+            return;
+
+        // The texture is not on screen anymore, i.e. the frame following the last present of this texture has been displayed
+        uint64_t presentNum = m_Statistics.presentNum;
+        uint64_t historyEnd = presentNum > PRESENT_HISTORY_NUM ? presentNum - PRESENT_HISTORY_NUM : 0;
+
+        for (uint64_t i = presentNum; i > historyEnd; i--) {
+            const PresentRecord& record = m_History[i % PRESENT_HISTORY_NUM];
+            if (record.textureIndex == textureIndex) {
+                displayedIndex = i < presentNum ? i + 1 : 0;
+                break;
+            }
+        }
+    }
+
+    if (displayedIndex)
+        OnDisplayed(displayedIndex, GetTime(), 0);
+}
+
+void SwapChainStatisticsHelper::OnWaitForPresent(uint64_t beginTime) {
+    uint32_t blockedTime = (uint32_t)(GetTime() - beginTime);
+
+    ExclusiveScope lock(m_Lock);
+
+    m_Statistics.waitForPresentBlockedTime = blockedTime;
+    m_Statistics.waitForPresentBlockedTotalTime += blockedTime;
+}
+
+uint64_t SwapChainStatisticsHelper::OnPresent(uint64_t beginTime, uint32_t textureIndex) {
+    ExclusiveScope lock(m_Lock);
+
+    uint64_t presentIndex = ++m_Statistics.presentNum;
+
+    PresentRecord& record = m_History[presentIndex % PRESENT_HISTORY_NUM];
+    record.index = presentIndex;
+    record.cpuTime = beginTime;
+    record.textureIndex = textureIndex;
+
+    return presentIndex;
+}
+
+void SwapChainStatisticsHelper::OnDisplayed(uint64_t presentIndex, uint64_t displayTime, uint64_t refreshCount) {
+    ExclusiveScope lock(m_Lock);
+
+    if (presentIndex <= m_LastDisplayedIndex || presentIndex > m_Statistics.presentNum)
+        return;
+
+    // Latency
+    const PresentRecord& record = m_History[presentIndex % PRESENT_HISTORY_NUM];
+    if (record.index == presentIndex && displayTime >= record.cpuTime) {
+        uint32_t latency = (uint32_t)(displayTime - record.cpuTime);
+
+        m_Statistics.presentToDisplayLatency = latency;
+        m_LatencySum += latency;
+        m_LatencySampleNum++;
+    }
+
+    // Missed vblanks: a frame stays on screen for more than 1 refresh cycle
+    if (m_IsVsync && m_LastDisplayedIndex) {
+        uint64_t frameNum = presentIndex - m_LastDisplayedIndex;
+        uint64_t vblankNum = 0;
+
+        if (refreshCount && m_LastRefreshCount) {
+            vblankNum = refreshCount - m_LastRefreshCount;
+
+            if (vblankNum && displayTime > m_LastDisplayTime) {
+                uint32_t refreshInterval = (uint32_t)((displayTime - m_LastDisplayTime) / vblankNum);
+                if (!m_MinDisplayInterval || refreshInterval < m_MinDisplayInterval)
+                    m_MinDisplayInterval = refreshInterval;
+            }
+        } else if (displayTime > m_LastDisplayTime) {
+            // The shortest observed interval is the best guess for the refresh interval, if it's unknown
+            uint32_t displayInterval = (uint32_t)((displayTime - m_LastDisplayTime) / frameNum);
+            if (!m_MinDisplayInterval || displayInterval < m_MinDisplayInterval)
+                m_MinDisplayInterval = displayInterval;
+
+            uint32_t refreshInterval = m_RefreshInterval ? m_RefreshInterval : m_MinDisplayInterval;
+            if (refreshInterval)
+                vblankNum = (displayTime - m_LastDisplayTime + refreshInterval / 2) / refreshInterval;
+        }
+
+        if (vblankNum > frameNum)
+            m_Statistics.missedVblankNum += vblankNum - frameNum;
+    }
+
+    m_LastDisplayedIndex = presentIndex;
+    m_LastDisplayTime = displayTime;
+    m_LastRefreshCount = refreshCount;
+}
+
+void SwapChainStatisticsHelper::GetStatistics(SwapChainStatistics& swapChainStatistics) {
+    ExclusiveScope lock(m_Lock);
+
+    swapChainStatistics = m_Statistics;
+    swapChainStatistics.displayedNum = m_LastDisplayedIndex;
+    swapChainStatistics.presentToDisplayLatencyAvg = m_LatencySampleNum ? (uint32_t)(m_LatencySum / m_LatencySampleNum) : 0;
+    swapChainStatistics.refreshInterval = m_RefreshInterval ? m_RefreshInterval : m_MinDisplayInterval;
+    swapChainStatistics.queuedFrameNum = (uint32_t)(m_Statistics.presentNum - m_LastDisplayedIndex);
+    swapChainStatistics.isMeasured = m_IsMeasured;
+}
+
+uint32_t nri::GetIndirectArgumentSize(const IndirectArgumentDesc& indirectArgumentDesc) {
+    switch (indirectArgumentDesc.type) {
+        case IndirectArgumentType::ROOT_CONSTANTS:
+            return indirectArgumentDesc.size;
+        case IndirectArgumentType::VERTEX_BUFFER:
+            return sizeof(IndirectVertexBufferDesc);
+        case IndirectArgumentType::INDEX_BUFFER:
+            return sizeof(IndirectIndexBufferDesc);
+        case IndirectArgumentType::DRAW:
+            return sizeof(DrawDesc);
+        case IndirectArgumentType::DRAW_INDEXED:
+            return sizeof(DrawIndexedDesc);
+        case IndirectArgumentType::DRAW_MESH_TASKS:
+            return sizeof(DrawMeshTasksDesc);
+        case IndirectArgumentType::DISPATCH:
+            return sizeof(DispatchDesc);
+        default:
+            return 0;
+    }
+}
+
+void CommandSignatureLayout::Init(const CommandSignatureDesc& commandSignatureDesc) {
+    argumentOffsets.resize(commandSignatureDesc.argumentNum);
+
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < commandSignatureDesc.argumentNum; i++) {
+        argumentOffsets[i] = offset;
+        offset += GetIndirectArgumentSize(commandSignatureDesc.arguments[i]);
+    }
+
+    stride = std::max(commandSignatureDesc.stride, offset);
+}
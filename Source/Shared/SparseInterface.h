@@ -0,0 +1,58 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct SparseTileBinding {
+    Memory* memory;
+    uint64_t memoryOffset;
+};
+
+struct SparsePendingMapping {
+    uint64_t key;
+    SparseTileBinding binding;
+};
+
+struct SparsePageTableImpl : public DebugNameBase {
+    inline SparsePageTableImpl(Device& device)
+        : m_Device(device)
+        , m_Committed(((DeviceBase&)device).GetStdAllocator())
+        , m_Pending(((DeviceBase&)device).GetStdAllocator())
+        , m_BufferBinds(((DeviceBase&)device).GetStdAllocator())
+        , m_TextureBinds(((DeviceBase&)device).GetStdAllocator())
+        , m_MipTailBinds(((DeviceBase&)device).GetStdAllocator()) {
+    }
+
+    inline Device& GetDevice() {
+        return m_Device;
+    }
+
+    inline uint32_t GetMappedTileNum() const {
+        return (uint32_t)m_Committed.size();
+    }
+
+    Result Create(const SparsePageTableDesc& desc);
+    void Update(const SparseTileMapping* tileMappings, uint32_t tileMappingNum);
+    void GetBinds(QueueBindSparseDesc& queueBindSparseDesc);
+
+private:
+    bool PackKey(const SparseTile& tile, uint64_t& key) const;
+    void EmitBind(uint64_t firstKey, uint32_t tileNum, const SparseTileBinding& binding);
+
+private:
+    Device& m_Device;
+    CoreInterface m_iCore = {};
+    SparseInterface m_iSparse = {};
+    Buffer* m_Buffer = nullptr;
+    Texture* m_Texture = nullptr;
+    SparseTiling m_Tiling = {};
+    TextureDesc m_TextureDesc = {};
+    UnorderedMap<uint64_t, SparseTileBinding> m_Committed; // only mapped tiles
+    Vector<SparsePendingMapping> m_Pending;
+    Vector<SparseBufferBindDesc> m_BufferBinds;
+    Vector<SparseTextureBindDesc> m_TextureBinds;
+    Vector<SparseMipTailBindDesc> m_MipTailBinds;
+};
+
+} // namespace nri
@@ -0,0 +1,226 @@
+// © 2025 NVIDIA Corporation
+
+#include <algorithm>
+
+// Key layout (MSB to LSB): layer 16, mip 4, z 12, y 16, x 16. Sorted keys go row by row, which makes adjacent tiles of a row adjacent in the key space
+constexpr uint32_t SPARSE_KEY_Y_SHIFT = 16;
+constexpr uint32_t SPARSE_KEY_Z_SHIFT = 32;
+constexpr uint32_t SPARSE_KEY_MIP_SHIFT = 44;
+constexpr uint32_t SPARSE_KEY_LAYER_SHIFT = 48;
+constexpr uint32_t SPARSE_KEY_MAX_Z = 1 << (SPARSE_KEY_MIP_SHIFT - SPARSE_KEY_Z_SHIFT);
+constexpr uint32_t SPARSE_KEY_MAX_MIP = 1 << (SPARSE_KEY_LAYER_SHIFT - SPARSE_KEY_MIP_SHIFT);
+
+static inline uint32_t GetSparseTileNum(Dim_t size, Dim_t mip, uint32_t tileSize) {
+    uint32_t mipSize = std::max(size >> mip, 1);
+
+    return (mipSize + tileSize - 1) / tileSize;
+}
+
+static inline bool IsSparseBindingContinued(const SparseTileBinding& first, uint32_t tileNum, const SparseTileBinding& next, uint64_t tileSize) {
+    if (first.memory != next.memory)
+        return false;
+
+    return !first.memory || next.memoryOffset == first.memoryOffset + tileNum * tileSize;
+}
+
+Result SparsePageTableImpl::Create(const SparsePageTableDesc& desc) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    RETURN_ON_FAILURE(&deviceBase, !desc.buffer != !desc.texture, Result::INVALID_ARGUMENT, "one of 'buffer' or 'texture' must be provided");
+
+    Result result = nriGetInterface(m_Device, NRI_INTERFACE(CoreInterface), &m_iCore);
+    if (result != Result::SUCCESS)
+        return result;
+
+    result = nriGetInterface(m_Device, NRI_INTERFACE(SparseInterface), &m_iSparse);
+    if (result != Result::SUCCESS)
+        return result;
+
+    m_Buffer = desc.buffer;
+    m_Texture = desc.texture;
+
+    if (m_Buffer)
+        m_iSparse.GetSparseBufferTiling(*m_Buffer, m_Tiling);
+    else {
+        m_iSparse.GetSparseTextureTiling(*m_Texture, m_Tiling);
+        m_TextureDesc = m_iCore.GetTextureDesc(*m_Texture);
+
+        m_TextureDesc.height = std::max(m_TextureDesc.height, (Dim_t)1);
+        m_TextureDesc.depth = std::max(m_TextureDesc.depth, (Dim_t)1);
+        m_TextureDesc.mipNum = std::max(m_TextureDesc.mipNum, (Dim_t)1);
+        m_TextureDesc.layerNum = std::max(m_TextureDesc.layerNum, (Dim_t)1);
+
+        RETURN_ON_FAILURE(&deviceBase, m_TextureDesc.mipNum <= SPARSE_KEY_MAX_MIP, Result::UNSUPPORTED, "'mipNum' must be <= %u", SPARSE_KEY_MAX_MIP);
+        RETURN_ON_FAILURE(&deviceBase, GetSparseTileNum(m_TextureDesc.depth, 0, m_Tiling.tileDepth) <= SPARSE_KEY_MAX_Z, Result::UNSUPPORTED, "the texture is too deep");
+    }
+
+    RETURN_ON_FAILURE(&deviceBase, m_Tiling.tileSize, Result::UNSUPPORTED, "the resource is not sparse");
+
+    return Result::SUCCESS;
+}
+
+bool SparsePageTableImpl::PackKey(const SparseTile& tile, uint64_t& key) const {
+    if (m_Buffer) {
+        key = tile.x;
+
+        return tile.x < m_Tiling.tileNum;
+    }
+
+    if (tile.mip >= m_TextureDesc.mipNum || tile.layer >= m_TextureDesc.layerNum)
+        return false;
+
+    if (tile.mip >= m_Tiling.mipTailFirst) {
+        uint64_t layer = m_Tiling.isMipTailShared ? 0 : tile.layer;
+        key = (layer << SPARSE_KEY_LAYER_SHIFT) | ((uint64_t)m_Tiling.mipTailFirst << SPARSE_KEY_MIP_SHIFT);
+
+        return true;
+    }
+
+    if (tile.x >= GetSparseTileNum(m_TextureDesc.width, tile.mip, m_Tiling.tileWidth)
+        || tile.y >= GetSparseTileNum(m_TextureDesc.height, tile.mip, m_Tiling.tileHeight)
+        || tile.z >= GetSparseTileNum(m_TextureDesc.depth, tile.mip, m_Tiling.tileDepth))
+        return false;
+
+    key = ((uint64_t)tile.layer << SPARSE_KEY_LAYER_SHIFT)
+        | ((uint64_t)tile.mip << SPARSE_KEY_MIP_SHIFT)
+        | ((uint64_t)tile.z << SPARSE_KEY_Z_SHIFT)
+        | ((uint64_t)tile.y << SPARSE_KEY_Y_SHIFT)
+        | tile.x;
+
+    return true;
+}
+
+void SparsePageTableImpl::Update(const SparseTileMapping* tileMappings, uint32_t tileMappingNum) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    for (uint32_t i = 0; i < tileMappingNum; i++) {
+        const SparseTileMapping& tileMapping = tileMappings[i];
+
+        uint64_t key = 0;
+        if (!PackKey(tileMapping.tile, key)) {
+            REPORT_ERROR(&deviceBase, "'tileMappings[%u].tile' is out of bounds", i);
+            continue;
+        }
+
+        if (tileMapping.memory && tileMapping.memoryOffset % m_Tiling.tileSize) {
+            REPORT_ERROR(&deviceBase, "'tileMappings[%u].memoryOffset' must be a multiple of 'tileSize'", i);
+            continue;
+        }
+
+        SparsePendingMapping& pending = m_Pending.emplace_back();
+        pending.key = key;
+        pending.binding.memory = tileMapping.memory;
+        pending.binding.memoryOffset = tileMapping.memory ? tileMapping.memoryOffset : 0;
+    }
+}
+
+void SparsePageTableImpl::EmitBind(uint64_t firstKey, uint32_t tileNum, const SparseTileBinding& binding) {
+    if (m_Buffer) {
+        SparseBufferBindDesc& bind = m_BufferBinds.emplace_back();
+        bind.buffer = m_Buffer;
+        bind.offset = firstKey * m_Tiling.tileSize;
+        bind.size = tileNum * m_Tiling.tileSize;
+        bind.memory = binding.memory;
+        bind.memoryOffset = binding.memoryOffset;
+
+        return;
+    }
+
+    Dim_t layer = Dim_t(firstKey >> SPARSE_KEY_LAYER_SHIFT);
+    Dim_t mip = Dim_t((firstKey >> SPARSE_KEY_MIP_SHIFT) & (SPARSE_KEY_MAX_MIP - 1));
+
+    if (mip >= m_Tiling.mipTailFirst) {
+        SparseMipTailBindDesc& bind = m_MipTailBinds.emplace_back();
+        bind.texture = m_Texture;
+        bind.layer = layer;
+        bind.memory = binding.memory;
+        bind.memoryOffset = binding.memoryOffset;
+
+        return;
+    }
+
+    Dim_t x = Dim_t(firstKey & 0xFFFF);
+    Dim_t y = Dim_t((firstKey >> SPARSE_KEY_Y_SHIFT) & 0xFFFF);
+    Dim_t z = Dim_t((firstKey >> SPARSE_KEY_Z_SHIFT) & (SPARSE_KEY_MAX_Z - 1));
+
+    // Grow the previous row run into a rectangle, if it's directly above and memory continues
+    if (!m_TextureBinds.empty()) {
+        SparseTextureBindDesc& prev = m_TextureBinds.back();
+        const TextureRegionDesc& region = prev.region;
+
+        if (region.mipOffset == mip && region.layerOffset == layer && region.z == z && region.x == x && region.width == tileNum && region.y + region.height == y) {
+            SparseTileBinding prevBinding = {prev.memory, prev.memoryOffset};
+            if (IsSparseBindingContinued(prevBinding, region.width * region.height, binding, m_Tiling.tileSize)) {
+                prev.region.height++;
+                return;
+            }
+        }
+    }
+
+    SparseTextureBindDesc& bind = m_TextureBinds.emplace_back();
+    bind.texture = m_Texture;
+    bind.region = {x, y, z, (Dim_t)tileNum, 1, 1, mip, layer};
+    bind.memory = binding.memory;
+    bind.memoryOffset = binding.memoryOffset;
+}
+
+void SparsePageTableImpl::GetBinds(QueueBindSparseDesc& queueBindSparseDesc) {
+    m_BufferBinds.clear();
+    m_TextureBinds.clear();
+    m_MipTailBinds.clear();
+
+    // The last change of a tile wins
+    std::stable_sort(m_Pending.begin(), m_Pending.end(), [](const SparsePendingMapping& a, const SparsePendingMapping& b) {
+        return a.key < b.key;
+    });
+
+    uint64_t runKey = 0;
+    uint32_t runTileNum = 0;
+    SparseTileBinding runBinding = {};
+
+    for (size_t i = 0; i < m_Pending.size(); i++) {
+        if (i + 1 < m_Pending.size() && m_Pending[i + 1].key == m_Pending[i].key)
+            continue;
+
+        const SparsePendingMapping& pending = m_Pending[i];
+
+        // Drop redundant changes
+        auto it = m_Committed.find(pending.key);
+        if (pending.binding.memory) {
+            if (it != m_Committed.end() && it->second.memory == pending.binding.memory && it->second.memoryOffset == pending.binding.memoryOffset)
+                continue;
+
+            m_Committed[pending.key] = pending.binding;
+        } else {
+            if (it == m_Committed.end())
+                continue;
+
+            m_Committed.erase(it);
+        }
+
+        // Coalesce (mip tails are never coalesced, since "x" is always 0 for them)
+        bool isContinued = runTileNum && pending.key == runKey + runTileNum && IsSparseBindingContinued(runBinding, runTileNum, pending.binding, m_Tiling.tileSize);
+        if (isContinued)
+            runTileNum++;
+        else {
+            if (runTileNum)
+                EmitBind(runKey, runTileNum, runBinding);
+
+            runKey = pending.key;
+            runTileNum = 1;
+            runBinding = pending.binding;
+        }
+    }
+
+    if (runTileNum)
+        EmitBind(runKey, runTileNum, runBinding);
+
+    m_Pending.clear();
+
+    queueBindSparseDesc.bufferBinds = m_BufferBinds.data();
+    queueBindSparseDesc.bufferBindNum = (uint32_t)m_BufferBinds.size();
+    queueBindSparseDesc.textureBinds = m_TextureBinds.data();
+    queueBindSparseDesc.textureBindNum = (uint32_t)m_TextureBinds.size();
+    queueBindSparseDesc.mipTailBinds = m_MipTailBinds.data();
+    queueBindSparseDesc.mipTailBindNum = (uint32_t)m_MipTailBinds.size();
+}
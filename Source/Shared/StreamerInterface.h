@@ -45,6 +45,7 @@ struct StreamerImpl : public DebugNameBase {
 
     Result Create(const StreamerDesc& desc);
     uint32_t StreamConstantData(const void* data, uint32_t dataSize);
+    uint64_t StreamDeviceAddresses(const BufferOffset* bufferOffsets, uint32_t bufferOffsetNum);
     BufferOffset StreamBufferData(const StreamBufferDataDesc& streamBufferDataDesc);
     BufferOffset StreamTextureData(const StreamTextureDataDesc& streamTextureDataDesc);
     void CmdCopyStreamedData(CommandBuffer& commandBuffer);
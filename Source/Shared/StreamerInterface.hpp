@@ -44,6 +44,8 @@ Result StreamerImpl::Create(const StreamerDesc& desc) {
         AllocateBufferDesc allocateBufferDesc = {};
         allocateBufferDesc.desc.size = desc.constantBufferSize;
         allocateBufferDesc.desc.usage = BufferUsageBits::CONSTANT_BUFFER;
+        if (m_iCore.GetDeviceDesc(m_Device).features.deviceAddress)
+            allocateBufferDesc.desc.usage |= BufferUsageBits::DEVICE_ADDRESS; // for "StreamDeviceAddresses"
         allocateBufferDesc.memoryLocation = desc.constantBufferMemoryLocation;
         allocateBufferDesc.dedicated = USE_DEDICATED;
 
@@ -81,9 +83,23 @@ uint32_t StreamerImpl::StreamConstantData(const void* data, uint32_t dataSize) {
         m_iCore.UnmapBuffer(*m_ConstantBuffer);
     }
 
+    ((DeviceBase&)m_Device).Count(Counter::STREAMED_BYTES, dataSize);
+
     return offset;
 }
 
+uint64_t StreamerImpl::StreamDeviceAddresses(const BufferOffset* bufferOffsets, uint32_t bufferOffsetNum) {
+    Scratch<uint64_t> addresses = AllocateScratch((DeviceBase&)m_Device, uint64_t, bufferOffsetNum);
+    for (uint32_t i = 0; i < bufferOffsetNum; i++) {
+        const BufferOffset& bufferOffset = bufferOffsets[i];
+        addresses[i] = m_iCore.GetBufferDeviceAddress(*bufferOffset.buffer) + bufferOffset.offset;
+    }
+
+    uint32_t offset = StreamConstantData(addresses, bufferOffsetNum * sizeof(uint64_t));
+
+    return m_iCore.GetBufferDeviceAddress(*m_ConstantBuffer) + offset;
+}
+
 BufferOffset StreamerImpl::StreamBufferData(const StreamBufferDataDesc& streamBufferDataDesc) {
     ExclusiveScope lock(m_Lock);
 
@@ -103,7 +119,7 @@ BufferOffset StreamerImpl::StreamBufferData(const StreamBufferDataDesc& streamBu
     if (!Grow())
         return {};
 
-    // Copy
+    // Copy (plain "memcpy" is intentional: stores into write-combined upload memory already bypass caches, non-temporal stores don't win)
     if (dataSize) {
         uint8_t* dst = (uint8_t*)m_iCore.MapBuffer(*m_DynamicBuffer, offset, dataSize);
 
@@ -127,6 +143,8 @@ BufferOffset StreamerImpl::StreamBufferData(const StreamBufferDataDesc& streamBu
         }
     }
 
+    ((DeviceBase&)m_Device).Count(Counter::STREAMED_BYTES, dataSize);
+
     return {m_DynamicBuffer, offset};
 }
 
@@ -188,10 +206,14 @@ BufferOffset StreamerImpl::StreamTextureData(const StreamTextureDataDesc& stream
         }
     }
 
+    ((DeviceBase&)m_Device).Count(Counter::STREAMED_BYTES, dataSize);
+
     return {m_DynamicBuffer, offset};
 }
 
 void StreamerImpl::CmdCopyStreamedData(CommandBuffer& commandBuffer) {
+    TRACE_SCOPE((DeviceBase*)&m_Device, "CmdCopyStreamedData");
+
     ExclusiveScope lock(m_Lock);
 
     // TODO: dynamic buffer(s) is in the persistent state, including "COPY_SOURCE", so there is no need to do a barrier... right? :)
@@ -210,6 +232,8 @@ void StreamerImpl::CmdCopyStreamedData(CommandBuffer& commandBuffer) {
 }
 
 void StreamerImpl::EndFrame() {
+    TRACE_SCOPE((DeviceBase*)&m_Device, "EndStreamerFrame");
+
     // Process garbage
     for (size_t i = 0; i < m_GarbageInFlight.size(); i++) {
         GarbageInFlight& garbageInFlight = m_GarbageInFlight[i];
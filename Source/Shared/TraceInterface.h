@@ -0,0 +1,78 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct TraceEventRecord {
+    const char* name;
+    uint64_t index; // to detect overwritten events
+    uint64_t beginNs;
+    uint64_t endNs; // 0 if not finished
+};
+
+struct TraceThread {
+    inline TraceThread(StdAllocator<uint8_t>& stdAllocator)
+        : events(stdAllocator) {
+    }
+
+    Vector<TraceEventRecord> events; // ring buffer
+    uint64_t eventNum = 0;
+    std::thread::id id;
+    Lock lock; // uncontended, except while "GetJson" takes a snapshot
+};
+
+struct Tracer {
+    Tracer(DeviceBase& device);
+    ~Tracer();
+
+    inline DeviceBase& GetDevice() {
+        return m_Device;
+    }
+
+    Result Start(const TraceDesc& traceDesc);
+    const char* GetJson();
+
+    uint64_t Begin(const char* name);
+    void End(uint64_t index);
+
+private:
+    TraceThread* GetThread();
+
+private:
+    DeviceBase& m_Device;
+    TraceDesc m_Desc = {};
+    Vector<TraceThread*> m_Threads;
+    Vector<TraceEventRecord> m_Snapshot;
+    String m_Json;
+    Lock m_Lock;
+    uint64_t m_Id = 0; // unique across all tracers
+    uint64_t m_StartNs = 0;
+};
+
+struct TraceScope {
+    inline TraceScope(Tracer* tracer, const char* name)
+        : m_Tracer(tracer) {
+        if (m_Tracer)
+            m_Index = m_Tracer->Begin(name);
+    }
+
+    inline ~TraceScope() {
+        if (m_Tracer)
+            m_Tracer->End(m_Index);
+    }
+
+private:
+    Tracer* m_Tracer;
+    uint64_t m_Index = 0;
+};
+
+} // namespace nri
+
+#if NRI_ENABLE_TRACE
+#    define NRI_TRACE_CONCAT_(a, b)          a##b
+#    define NRI_TRACE_CONCAT(a, b)           NRI_TRACE_CONCAT_(a, b)
+#    define TRACE_SCOPE(deviceBase, name)    TraceScope NRI_TRACE_CONCAT(traceScope, __LINE__)((deviceBase)->GetTracer(), name)
+#else
+#    define TRACE_SCOPE(deviceBase, name)
+#endif
@@ -0,0 +1,195 @@
+// © 2025 NVIDIA Corporation
+
+static std::atomic_uint64_t g_TracerId = 1;
+
+struct TraceThreadCache {
+    uint64_t tracerId;
+    TraceThread* thread;
+};
+
+static thread_local TraceThreadCache t_TraceThreadCache = {};
+
+static inline uint64_t GetTraceTimeNs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+Tracer::Tracer(DeviceBase& device)
+    : m_Device(device)
+    , m_Threads(device.GetStdAllocator())
+    , m_Snapshot(device.GetStdAllocator())
+    , m_Json(device.GetStdAllocator()) {
+    m_Id = g_TracerId.fetch_add(1, std::memory_order_relaxed);
+}
+
+Tracer::~Tracer() {
+    for (TraceThread* thread : m_Threads)
+        Destroy(m_Device.GetAllocationCallbacks(), thread);
+}
+
+Result Tracer::Start(const TraceDesc& traceDesc) {
+    RETURN_ON_FAILURE(&m_Device, !traceDesc.callbacks.BeginEvent == !traceDesc.callbacks.EndEvent, Result::INVALID_ARGUMENT, "'BeginEvent' and 'EndEvent' must be provided together");
+
+    m_Desc = traceDesc;
+    m_StartNs = GetTraceTimeNs();
+
+    return Result::SUCCESS;
+}
+
+TraceThread* Tracer::GetThread() {
+    TraceThreadCache& cache = t_TraceThreadCache;
+    if (cache.tracerId == m_Id)
+        return cache.thread;
+
+    // Slow path: first event on this thread or the thread alternates between devices
+    std::thread::id id = std::this_thread::get_id();
+    TraceThread* thread = nullptr;
+    {
+        ExclusiveScope lock(m_Lock);
+
+        for (TraceThread* existing : m_Threads) {
+            if (existing->id == id) {
+                thread = existing;
+                break;
+            }
+        }
+
+        if (!thread) {
+            thread = Allocate<TraceThread>(m_Device.GetAllocationCallbacks(), m_Device.GetStdAllocator());
+            thread->id = id;
+            thread->events.resize(m_Desc.eventMaxNumPerThread);
+
+            m_Threads.push_back(thread);
+        }
+    }
+
+    cache.tracerId = m_Id;
+    cache.thread = thread;
+
+    return thread;
+}
+
+uint64_t Tracer::Begin(const char* name) {
+    if (m_Desc.callbacks.BeginEvent)
+        m_Desc.callbacks.BeginEvent(name, m_Desc.callbacks.userArg);
+
+    if (!m_Desc.eventMaxNumPerThread)
+        return 0;
+
+    TraceThread* thread = GetThread();
+    uint64_t beginNs = GetTraceTimeNs();
+
+    ExclusiveScope lock(thread->lock);
+
+    uint64_t index = thread->eventNum++;
+
+    TraceEventRecord& event = thread->events[index % m_Desc.eventMaxNumPerThread];
+    event.name = name;
+    event.index = index;
+    event.beginNs = beginNs;
+    event.endNs = 0;
+
+    return index;
+}
+
+void Tracer::End(uint64_t index) {
+    if (m_Desc.eventMaxNumPerThread) {
+        TraceThread* thread = GetThread();
+        uint64_t endNs = GetTraceTimeNs();
+
+        ExclusiveScope lock(thread->lock);
+
+        // The event can be overwritten by nested events if the ring buffer is too small
+        TraceEventRecord& event = thread->events[index % m_Desc.eventMaxNumPerThread];
+        if (event.index == index)
+            event.endNs = endNs;
+    }
+
+    if (m_Desc.callbacks.EndEvent)
+        m_Desc.callbacks.EndEvent(m_Desc.callbacks.userArg);
+}
+
+const char* Tracer::GetJson() {
+    ExclusiveScope lock(m_Lock);
+
+    m_Json = "{\"traceEvents\":[";
+
+    char buffer[512];
+    bool isFirst = true;
+
+    for (TraceThread* thread : m_Threads) {
+        uint32_t tid = (uint32_t)std::hash<std::thread::id>()(thread->id);
+
+        // Events are written concurrently, take a snapshot (cheap, the thread is blocked only for a copy)
+        uint64_t eventNum = 0;
+        {
+            ExclusiveScope threadLock(thread->lock);
+
+            eventNum = thread->eventNum;
+            m_Snapshot.assign(thread->events.begin(), thread->events.end());
+        }
+
+        uint64_t first = eventNum > m_Desc.eventMaxNumPerThread ? eventNum - m_Desc.eventMaxNumPerThread : 0;
+
+        for (uint64_t i = first; i < eventNum; i++) {
+            const TraceEventRecord& event = m_Snapshot[i % m_Desc.eventMaxNumPerThread];
+            if (event.index != i || !event.endNs || event.beginNs < m_StartNs)
+                continue;
+
+            double ts = double(event.beginNs - m_StartNs) * 0.001;
+            double dur = double(event.endNs - event.beginNs) * 0.001;
+
+            // Names are string literals, which don't need escaping
+            snprintf(buffer, sizeof(buffer), "%s\n{\"name\":\"%s\",\"cat\":\"NRI\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%u}", isFirst ? "" : ",", event.name, ts, dur, tid);
+            m_Json += buffer;
+
+            isFirst = false;
+        }
+    }
+
+    m_Json += "\n],\"displayTimeUnit\":\"ns\"}\n";
+
+    return m_Json.c_str();
+}
+
+Result DeviceBase::StartTrace(const TraceDesc& traceDesc) {
+#if NRI_ENABLE_TRACE
+    StopTrace();
+
+    Tracer* tracer = Allocate<Tracer>(m_AllocationCallbacks, *this);
+    Result result = tracer->Start(traceDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(m_AllocationCallbacks, tracer);
+        return result;
+    }
+
+    m_Tracer.store(tracer, std::memory_order_relaxed);
+
+    return Result::SUCCESS;
+#else
+    MaybeUnused(traceDesc);
+
+    return Result::UNSUPPORTED;
+#endif
+}
+
+void DeviceBase::ShareTrace(const DeviceBase& owner) {
+    StopTrace();
+
+    m_Tracer.store(owner.GetTracer(), std::memory_order_relaxed);
+    m_IsTraceShared = true;
+}
+
+void DeviceBase::StopTrace() {
+    Tracer* tracer = m_Tracer.exchange(nullptr, std::memory_order_relaxed);
+    if (!m_IsTraceShared)
+        Destroy(m_AllocationCallbacks, tracer);
+
+    m_IsTraceShared = false;
+}
+
+const char* DeviceBase::GetTraceJson() {
+    Tracer* tracer = GetTracer();
+
+    return tracer ? tracer->GetJson() : nullptr;
+}
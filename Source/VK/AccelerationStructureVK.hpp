@@ -25,7 +25,7 @@ Result AccelerationStructureVK::Create(const AccelerationStructureDesc& accelera
     bufferDesc.size = sizesInfo.accelerationStructureSize;
     bufferDesc.usage = BufferUsageBits::ACCELERATION_STRUCTURE_STORAGE;
 
-    return m_Device.CreateImplementation<BufferVK>(m_Buffer, bufferDesc);
+    return m_Device.CreateInternalImplementation<BufferVK>(m_Buffer, bufferDesc);
 }
 
 Result AccelerationStructureVK::Create(const AccelerationStructureVKDesc& accelerationStructureVKDesc) {
@@ -81,6 +81,7 @@ NRI_INLINE Result AccelerationStructureVK::CreateDescriptor(Descriptor*& descrip
     Result result = descriptorVK->Create(m_Handle);
 
     if (result == Result::SUCCESS) {
+        m_Device.OnObjectCreated<Descriptor>();
         descriptor = (Descriptor*)descriptorVK;
         return Result::SUCCESS;
     }
@@ -32,9 +32,11 @@ struct BufferVK final : public DebugNameBase {
     Result Create(const BufferDesc& bufferDesc);
     Result Create(const BufferVKDesc& bufferVKDesc);
     Result Create(const AllocateBufferDesc& allocateBufferDesc);
+    Result Create(const SparseBufferDesc& sparseBufferDesc);
     void FinishMemoryBinding(MemoryVK& memory, uint64_t memoryOffset);
     void DestroyVma();
     void GetMemoryDesc(MemoryLocation memoryLocation, MemoryDesc& memoryDesc) const;
+    void GetSparseTiling(SparseTiling& sparseTiling) const;
 
     //================================================================================================================
     // DebugNameBase
@@ -49,6 +51,8 @@ struct BufferVK final : public DebugNameBase {
     void* Map(uint64_t offset, uint64_t size);
     void Unmap();
 
+    Result SetPriority(float priority);
+
 private:
     DeviceVK& m_Device;
     VkBuffer m_Handle = VK_NULL_HANDLE;
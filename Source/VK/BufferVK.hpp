@@ -1,6 +1,8 @@
 // © 2021 NVIDIA Corporation
 
 BufferVK::~BufferVK() {
+    m_Device.UntrackResource(VK_OBJECT_TYPE_BUFFER, (uint64_t)m_Handle);
+
     if (m_OwnsNativeObjects) {
         const auto& vk = m_Device.GetDispatchTable();
 
@@ -14,8 +16,9 @@ BufferVK::~BufferVK() {
 Result BufferVK::Create(const BufferDesc& bufferDesc) {
     m_Desc = bufferDesc;
 
+    VkBufferUsageFlags2CreateInfoKHR usage2 = {VK_STRUCTURE_TYPE_BUFFER_USAGE_FLAGS_2_CREATE_INFO_KHR};
     VkBufferCreateInfo info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-    m_Device.FillCreateInfo(bufferDesc, info);
+    m_Device.FillCreateInfo(bufferDesc, info, usage2);
 
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.CreateBuffer(m_Device, &info, m_Device.GetVkAllocationCallbacks(), &m_Handle);
@@ -31,6 +34,9 @@ Result BufferVK::Create(const BufferVKDesc& bufferVKDesc) {
     m_NonCoherentDeviceMemory = (VkDeviceMemory)bufferVKDesc.vkDeviceMemory;
     m_DeviceAddress = (VkDeviceAddress)bufferVKDesc.deviceAddress;
 
+    if (m_DeviceAddress)
+        m_Device.TrackResource(VK_OBJECT_TYPE_BUFFER, (uint64_t)m_Handle, m_DeviceAddress, bufferVKDesc.size);
+
     m_Desc.size = bufferVKDesc.size;
     m_Desc.structureStride = bufferVKDesc.structureStride;
 
@@ -57,6 +63,7 @@ void BufferVK::FinishMemoryBinding(MemoryVK& memory, uint64_t memoryOffset) {
 
         const auto& vk = m_Device.GetDispatchTable();
         m_DeviceAddress = vk.GetBufferDeviceAddress(m_Device, &bufferDeviceAddressInfo);
+        m_Device.TrackResource(VK_OBJECT_TYPE_BUFFER, (uint64_t)m_Handle, m_DeviceAddress, m_Desc.size);
     }
 }
 
@@ -86,6 +93,7 @@ void BufferVK::GetMemoryDesc(MemoryLocation memoryLocation, MemoryDesc& memoryDe
 
 NRI_INLINE void BufferVK::SetDebugName(const char* name) {
     m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_BUFFER, (uint64_t)m_Handle, name);
+    m_Device.SetTrackedResourceName(VK_OBJECT_TYPE_BUFFER, (uint64_t)m_Handle, name);
 }
 
 NRI_INLINE void* BufferVK::Map(uint64_t offset, uint64_t size) {
@@ -114,3 +122,11 @@ NRI_INLINE void BufferVK::Unmap() {
         RETURN_VOID_ON_BAD_VKRESULT(&m_Device, vkResult, "vkFlushMappedMemoryRanges");
     }
 }
+
+NRI_INLINE Result BufferVK::SetPriority(float priority) {
+    // Only allocations made by "ResourceAllocatorInterface" are known, for resources bound to "Memory" use "SetMemoryPriority"
+    if (!m_VmaAllocation)
+        return Result::UNSUPPORTED;
+
+    return m_Device.SetVmaAllocationPriority(m_VmaAllocation, priority);
+}
@@ -46,6 +46,7 @@ NRI_INLINE Result CommandAllocatorVK::CreateCommandBuffer(CommandBuffer*& comman
 
     CommandBufferVK* commandBufferVK = Allocate<CommandBufferVK>(m_Device.GetAllocationCallbacks(), m_Device);
     commandBufferVK->Create(m_Handle, commandBufferHandle, m_Type);
+    m_Device.OnObjectCreated<CommandBuffer>();
 
     commandBuffer = (CommandBuffer*)commandBufferVK;
 
@@ -8,9 +8,31 @@ struct PipelineVK;
 struct PipelineLayoutVK;
 struct DescriptorVK;
 
+constexpr size_t RENDERING_SETUP_MAX_NUM = 16;
+
+// Translated "AttachmentsDesc", reused by passes with the same attachments (descriptors can't be destroyed while the command buffer is in use)
+struct RenderingSetupVK {
+    VkRenderingAttachmentInfo depthStencil;
+    VkRenderingFragmentShadingRateAttachmentInfoKHR shadingRate;
+    const Descriptor* depthStencilDescriptor;
+    const Descriptor* shadingRateDescriptor;
+    uint32_t colorOffset; // in "m_RenderingColors" and "m_RenderingColorDescriptors"
+    uint32_t colorNum;
+    Dim_t layerNum;
+    Dim_t width;
+    Dim_t height;
+    bool hasStencil;
+    bool hasColors; // "AttachmentsDesc::colors" is not NULL, even if "colorNum = 0" (affects "layerNum")
+};
+
 struct CommandBufferVK final : public DebugNameBase {
     inline CommandBufferVK(DeviceVK& device)
-        : m_Device(device) {
+        : m_Device(device)
+        , m_TransientViews(device)
+        , m_RenderingSetups(device.GetStdAllocator())
+        , m_RenderingColors(device.GetStdAllocator())
+        , m_RenderingColorDescriptors(device.GetStdAllocator())
+        , m_Breadcrumbs(device.GetStdAllocator()) {
     }
 
     inline operator VkCommandBuffer() const {
@@ -44,6 +66,7 @@ struct CommandBufferVK final : public DebugNameBase {
     void SetRootConstants(const SetRootConstantsDesc& setRootConstantsDesc);
     void SetRootDescriptor(const SetRootDescriptorDesc& setRootDescriptorDesc);
     void Barrier(const BarrierDesc& barrierDesc);
+    Result CreateTransientAttachmentView(const Texture2DViewDesc& textureViewDesc, Descriptor*& textureView);
     void BeginRendering(const AttachmentsDesc& attachmentsDesc);
     void EndRendering();
     void SetViewports(const Viewport* viewports, uint32_t viewportNum);
@@ -73,6 +96,9 @@ struct CommandBufferVK final : public DebugNameBase {
     void CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion);
     void UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout);
     void ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion);
+    void CopyBufferRegions(Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum);
+    void UploadBufferToTextureRegions(Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum);
+    void ReadbackTextureToBufferRegions(Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum);
     void ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size);
     void ResolveTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion);
     void CopyQueries(const QueryPool& queryPool, uint32_t offset, uint32_t num, Buffer& dstBuffer, uint64_t dstOffset);
@@ -88,10 +114,22 @@ struct CommandBufferVK final : public DebugNameBase {
     void DispatchRaysIndirect(const Buffer& buffer, uint64_t offset);
     void DrawMeshTasks(const DrawMeshTasksDesc& drawMeshTasksDesc);
     void DrawMeshTasksIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
+    void ExecuteIndirect(const ExecuteIndirectDesc& executeIndirectDesc);
 
 private:
+    const RenderingSetupVK& GetRenderingSetup(const AttachmentsDesc& attachmentsDesc);
+    void ResetRenderingSetups();
+    bool CanWriteBreadcrumbMarker() const;
+    void WriteBreadcrumbMarker(uint32_t id, bool isEnd);
+
     DeviceVK& m_Device;
+    TransientViewCache<DeviceVK, DescriptorVK> m_TransientViews;
+    Vector<RenderingSetupVK> m_RenderingSetups;
+    Vector<VkRenderingAttachmentInfo> m_RenderingColors;
+    Vector<const Descriptor*> m_RenderingColorDescriptors;
+    Vector<uint32_t> m_Breadcrumbs; // stack of opened annotations, 0 - no breadcrumb
     const PipelineLayoutVK* m_PipelineLayout = nullptr;
+    const PipelineVK* m_Pipeline = nullptr;
     const DescriptorVK* m_DepthStencil = nullptr;
     VkCommandBuffer m_Handle = VK_NULL_HANDLE;
     VkCommandPool m_CommandPool = VK_NULL_HANDLE;
@@ -101,6 +139,7 @@ private:
     Dim_t m_RenderLayerNum = 0;
     Dim_t m_RenderWidth = 0;
     Dim_t m_RenderHeight = 0;
+    bool m_IsRendering = false;
 };
 
 } // namespace nri
@@ -47,8 +47,14 @@ NRI_INLINE Result CommandBufferVK::Begin(const DescriptorPool*) {
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkBeginCommandBuffer");
 
     m_PipelineLayout = nullptr;
+    m_Pipeline = nullptr;
     m_PipelineBindPoint = BindPoint::INHERIT;
 
+    m_TransientViews.Reset();
+    ResetRenderingSetups();
+    m_Breadcrumbs.clear();
+    m_IsRendering = false;
+
     return Result::SUCCESS;
 }
 
@@ -227,101 +233,157 @@ NRI_INLINE void CommandBufferVK::ClearStorage(const ClearStorageDesc& clearDesc)
     }
 }
 
-NRI_INLINE void CommandBufferVK::BeginRendering(const AttachmentsDesc& attachmentsDesc) {
+NRI_INLINE Result CommandBufferVK::CreateTransientAttachmentView(const Texture2DViewDesc& textureViewDesc, Descriptor*& textureView) {
+    return m_TransientViews.Get(textureViewDesc, textureView);
+}
+
+NRI_INLINE const RenderingSetupVK& CommandBufferVK::GetRenderingSetup(const AttachmentsDesc& attachmentsDesc) {
+    // Look up (recent first)
+    for (size_t i = m_RenderingSetups.size(); i > 0; i--) {
+        const RenderingSetupVK& setup = m_RenderingSetups[i - 1];
+        if (setup.depthStencilDescriptor != attachmentsDesc.depthStencil || setup.shadingRateDescriptor != attachmentsDesc.shadingRate || setup.colorNum != attachmentsDesc.colorNum)
+            continue;
+
+        if (setup.hasColors != (attachmentsDesc.colors != nullptr))
+            continue;
+
+        const Descriptor* const* colorDescriptors = m_RenderingColorDescriptors.data() + setup.colorOffset;
+
+        bool isEqual = true;
+        for (uint32_t j = 0; j < setup.colorNum && isEqual; j++)
+            isEqual = colorDescriptors[j] == attachmentsDesc.colors[j];
+
+        if (isEqual)
+            return setup;
+    }
+
+    if (m_RenderingSetups.size() == RENDERING_SETUP_MAX_NUM)
+        ResetRenderingSetups();
+
+    // Translate
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
 
+    RenderingSetupVK setup = {};
+    setup.depthStencilDescriptor = attachmentsDesc.depthStencil;
+    setup.shadingRateDescriptor = attachmentsDesc.shadingRate;
+    setup.colorOffset = (uint32_t)m_RenderingColors.size();
+    setup.colorNum = attachmentsDesc.colorNum;
+    setup.hasColors = attachmentsDesc.colors != nullptr;
+
     // TODO: if there are no attachments, render area has max dimensions. It can be suboptimal even on desktop. It's a no-go on tiled architectures
-    m_RenderLayerNum = deviceDesc.dimensions.attachmentLayerMaxNum;
-    m_RenderWidth = deviceDesc.dimensions.attachmentMaxDim;
-    m_RenderHeight = deviceDesc.dimensions.attachmentMaxDim;
+    setup.layerNum = deviceDesc.dimensions.attachmentLayerMaxNum;
+    setup.width = deviceDesc.dimensions.attachmentMaxDim;
+    setup.height = deviceDesc.dimensions.attachmentMaxDim;
 
     // Color
-    Scratch<VkRenderingAttachmentInfo> colors = AllocateScratch(m_Device, VkRenderingAttachmentInfo, attachmentsDesc.colorNum);
     for (uint32_t i = 0; i < attachmentsDesc.colorNum; i++) {
         const DescriptorVK& descriptor = *(DescriptorVK*)attachmentsDesc.colors[i];
         const DescriptorTexDesc& desc = descriptor.GetTexDesc();
 
-        VkRenderingAttachmentInfo& color = colors[i];
-        color = {VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO};
+        // Transient attachments are never loaded or stored, otherwise tilers have to commit lazily allocated memory
+        bool isTransient = (desc.texture->GetDesc().usage & TextureUsageBits::TRANSIENT_ATTACHMENT) != 0;
+
+        VkRenderingAttachmentInfo color = {VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO};
         color.imageView = descriptor.GetImageView();
-        color.imageLayout = descriptor.GetTexDesc().layout;
+        color.imageLayout = desc.layout;
         color.resolveMode = VK_RESOLVE_MODE_NONE; // TODO: add support for "on-the-fly" resolve
         color.resolveImageView = VK_NULL_HANDLE;
         color.resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        color.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
-        color.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        color.loadOp = isTransient ? VK_ATTACHMENT_LOAD_OP_DONT_CARE : VK_ATTACHMENT_LOAD_OP_LOAD;
+        color.storeOp = isTransient ? VK_ATTACHMENT_STORE_OP_DONT_CARE : VK_ATTACHMENT_STORE_OP_STORE;
         color.clearValue = {};
 
+        m_RenderingColors.push_back(color);
+        m_RenderingColorDescriptors.push_back(attachmentsDesc.colors[i]);
+
         Dim_t w = desc.texture->GetSize(0, desc.mipOffset);
         Dim_t h = desc.texture->GetSize(1, desc.mipOffset);
 
-        m_RenderLayerNum = std::min(m_RenderLayerNum, desc.layerNum);
-        m_RenderWidth = std::min(m_RenderWidth, w);
-        m_RenderHeight = std::min(m_RenderHeight, h);
+        setup.layerNum = std::min(setup.layerNum, desc.layerNum);
+        setup.width = std::min(setup.width, w);
+        setup.height = std::min(setup.height, h);
     }
 
     // Depth-stencil
-    VkRenderingAttachmentInfo depthStencil = {VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO};
-    bool hasStencil = false;
+    setup.depthStencil = {VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO};
     if (attachmentsDesc.depthStencil) {
         const DescriptorVK& descriptor = *(DescriptorVK*)attachmentsDesc.depthStencil;
         const DescriptorTexDesc& desc = descriptor.GetTexDesc();
+        bool isTransient = (desc.texture->GetDesc().usage & TextureUsageBits::TRANSIENT_ATTACHMENT) != 0;
 
+        VkRenderingAttachmentInfo& depthStencil = setup.depthStencil;
         depthStencil.imageView = descriptor.GetImageView();
         depthStencil.imageLayout = desc.layout;
         depthStencil.resolveMode = VK_RESOLVE_MODE_NONE;
         depthStencil.resolveImageView = VK_NULL_HANDLE;
         depthStencil.resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        depthStencil.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
-        depthStencil.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        depthStencil.loadOp = isTransient ? VK_ATTACHMENT_LOAD_OP_DONT_CARE : VK_ATTACHMENT_LOAD_OP_LOAD;
+        depthStencil.storeOp = isTransient ? VK_ATTACHMENT_STORE_OP_DONT_CARE : VK_ATTACHMENT_STORE_OP_STORE;
         depthStencil.clearValue = {};
 
         Dim_t w = desc.texture->GetSize(0, desc.mipOffset);
         Dim_t h = desc.texture->GetSize(1, desc.mipOffset);
 
-        m_RenderLayerNum = std::min(m_RenderLayerNum, desc.layerNum);
-        m_RenderWidth = std::min(m_RenderWidth, w);
-        m_RenderHeight = std::min(m_RenderHeight, h);
+        setup.layerNum = std::min(setup.layerNum, desc.layerNum);
+        setup.width = std::min(setup.width, w);
+        setup.height = std::min(setup.height, h);
 
         const FormatProps& formatProps = GetFormatProps(descriptor.GetTexture().GetDesc().format);
-        hasStencil = formatProps.isStencil != 0;
-
-        m_DepthStencil = &descriptor;
-    } else
-        m_DepthStencil = nullptr;
+        setup.hasStencil = formatProps.isStencil != 0;
+    }
 
     // Shading rate
-    VkRenderingFragmentShadingRateAttachmentInfoKHR shadingRate = {VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR};
+    setup.shadingRate = {VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR};
     if (attachmentsDesc.shadingRate) {
-        uint32_t tileSize = m_Device.GetDesc().other.shadingRateAttachmentTileSize;
+        uint32_t tileSize = deviceDesc.other.shadingRateAttachmentTileSize;
         const DescriptorVK& descriptor = *(DescriptorVK*)attachmentsDesc.shadingRate;
 
-        shadingRate.imageView = descriptor.GetImageView();
-        shadingRate.imageLayout = descriptor.GetTexDesc().layout;
-        shadingRate.shadingRateAttachmentTexelSize = {tileSize, tileSize};
+        setup.shadingRate.imageView = descriptor.GetImageView();
+        setup.shadingRate.imageLayout = descriptor.GetTexDesc().layout;
+        setup.shadingRate.shadingRateAttachmentTexelSize = {tileSize, tileSize};
     }
 
     bool hasAttachment = attachmentsDesc.depthStencil || attachmentsDesc.colors;
     if (!hasAttachment)
-        m_RenderLayerNum = 1;
+        setup.layerNum = 1;
+
+    m_RenderingSetups.push_back(setup);
+
+    return m_RenderingSetups.back();
+}
+
+NRI_INLINE void CommandBufferVK::ResetRenderingSetups() {
+    m_RenderingSetups.clear();
+    m_RenderingColors.clear();
+    m_RenderingColorDescriptors.clear();
+}
+
+NRI_INLINE void CommandBufferVK::BeginRendering(const AttachmentsDesc& attachmentsDesc) {
+    const RenderingSetupVK& setup = GetRenderingSetup(attachmentsDesc);
+
+    m_RenderLayerNum = setup.layerNum;
+    m_RenderWidth = setup.width;
+    m_RenderHeight = setup.height;
+    m_DepthStencil = (const DescriptorVK*)setup.depthStencilDescriptor;
 
     VkRenderingInfo renderingInfo = {VK_STRUCTURE_TYPE_RENDERING_INFO};
     renderingInfo.flags = 0;
     renderingInfo.renderArea = {{0, 0}, {m_RenderWidth, m_RenderHeight}};
     renderingInfo.layerCount = m_RenderLayerNum;
     renderingInfo.viewMask = attachmentsDesc.viewMask;
-    renderingInfo.colorAttachmentCount = attachmentsDesc.colorNum;
-    renderingInfo.pColorAttachments = colors;
-    renderingInfo.pDepthAttachment = attachmentsDesc.depthStencil ? &depthStencil : nullptr;
-    renderingInfo.pStencilAttachment = hasStencil ? &depthStencil : nullptr;
+    renderingInfo.colorAttachmentCount = setup.colorNum;
+    renderingInfo.pColorAttachments = m_RenderingColors.data() + setup.colorOffset;
+    renderingInfo.pDepthAttachment = setup.depthStencilDescriptor ? &setup.depthStencil : nullptr;
+    renderingInfo.pStencilAttachment = setup.hasStencil ? &setup.depthStencil : nullptr;
 
-    if (attachmentsDesc.shadingRate)
-        renderingInfo.pNext = &shadingRate;
+    if (setup.shadingRateDescriptor)
+        renderingInfo.pNext = &setup.shadingRate;
 
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdBeginRendering(m_Handle, &renderingInfo);
 
     m_ViewMask = attachmentsDesc.viewMask;
+    m_IsRendering = true;
 }
 
 NRI_INLINE void CommandBufferVK::EndRendering() {
@@ -329,6 +391,7 @@ NRI_INLINE void CommandBufferVK::EndRendering() {
     vk.CmdEndRendering(m_Handle);
 
     m_DepthStencil = nullptr;
+    m_IsRendering = false;
 }
 
 NRI_INLINE void CommandBufferVK::SetVertexBuffers(uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum) {
@@ -390,6 +453,8 @@ NRI_INLINE void CommandBufferVK::SetPipeline(const Pipeline& pipeline) {
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdBindPipeline(m_Handle, pipelineVK.GetBindPoint(), pipelineVK);
 
+    m_Pipeline = &pipelineVK;
+
     // Set depth bias provided at pipeline creation time to match D3D12 behavior
     const DepthBiasDesc& depthBias = pipelineVK.GetDepthBias();
     if (IsDepthBiasEnabled(depthBias))
@@ -491,19 +556,33 @@ NRI_INLINE void CommandBufferVK::DrawIndexedIndirect(const Buffer& buffer, uint6
 }
 
 NRI_INLINE void CommandBufferVK::CopyBuffer(Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    BufferCopyRegionDesc region = {dstOffset, srcOffset, size};
+    CopyBufferRegions(dstBuffer, srcBuffer, &region, 1);
+}
+
+NRI_INLINE void CommandBufferVK::CopyBufferRegions(Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    if (!regionNum)
+        return; // "regionCount" must be > 0
+
     const BufferVK& src = (BufferVK&)srcBuffer;
     const BufferVK& dstBufferVK = (BufferVK&)dstBuffer;
 
-    VkBufferCopy2 region = {VK_STRUCTURE_TYPE_BUFFER_COPY_2};
-    region.srcOffset = srcOffset;
-    region.dstOffset = dstOffset;
-    region.size = size == WHOLE_SIZE ? src.GetDesc().size : size;
+    Scratch<VkBufferCopy2> vkRegions = AllocateScratch(m_Device, VkBufferCopy2, regionNum);
+    for (uint32_t i = 0; i < regionNum; i++) {
+        const BufferCopyRegionDesc& region = regions[i];
+
+        VkBufferCopy2& vkRegion = vkRegions[i];
+        vkRegion = {VK_STRUCTURE_TYPE_BUFFER_COPY_2};
+        vkRegion.srcOffset = region.srcOffset;
+        vkRegion.dstOffset = region.dstOffset;
+        vkRegion.size = region.size == WHOLE_SIZE ? src.GetDesc().size : region.size;
+    }
 
     VkCopyBufferInfo2 info = {VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2};
     info.srcBuffer = src.GetHandle();
     info.dstBuffer = dstBufferVK.GetHandle();
-    info.regionCount = 1;
-    info.pRegions = &region;
+    info.regionCount = regionNum;
+    info.pRegions = vkRegions;
 
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdCopyBuffer2(m_Handle, &info);
@@ -661,95 +740,92 @@ NRI_INLINE void CommandBufferVK::ResolveTexture(Texture& dstTexture, const Textu
     vk.CmdResolveImage2(m_Handle, &info);
 }
 
-NRI_INLINE void CommandBufferVK::UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout) {
-    const BufferVK& src = (BufferVK&)srcBuffer;
-    const TextureVK& dst = (TextureVK&)dstTexture;
-    const FormatProps& formatProps = GetFormatProps(dst.GetDesc().format);
+static inline void FillBufferImageCopy(const TextureVK& texture, const TextureBufferCopyRegionDesc& region, VkBufferImageCopy2& vkRegion) {
+    const TextureRegionDesc& textureRegion = region.textureRegion;
+    const TextureDataLayoutDesc& bufferDataLayout = region.bufferDataLayout;
+    const FormatProps& formatProps = GetFormatProps(texture.GetDesc().format);
 
-    uint32_t rowBlockNum = srcDataLayout.rowPitch / formatProps.stride;
+    uint32_t rowBlockNum = bufferDataLayout.rowPitch / formatProps.stride;
     uint32_t bufferRowLength = rowBlockNum * formatProps.blockWidth;
 
-    uint32_t sliceRowNum = srcDataLayout.slicePitch / srcDataLayout.rowPitch;
+    uint32_t sliceRowNum = bufferDataLayout.slicePitch / bufferDataLayout.rowPitch;
     uint32_t bufferImageHeight = sliceRowNum * formatProps.blockWidth;
 
-    VkImageAspectFlags dstAspectFlags = GetImageAspectFlags(dstRegion.planes);
-    if (dstRegion.planes == PlaneBits::ALL)
-        dstAspectFlags = dst.GetImageAspectFlags();
-
-    VkBufferImageCopy2 region = {VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2};
-    region.bufferOffset = srcDataLayout.offset;
-    region.bufferRowLength = bufferRowLength;
-    region.bufferImageHeight = bufferImageHeight;
-    region.imageSubresource = VkImageSubresourceLayers{
-        dstAspectFlags,
-        dstRegion.mipOffset,
-        dstRegion.layerOffset,
+    VkImageAspectFlags aspectFlags = GetImageAspectFlags(textureRegion.planes);
+    if (textureRegion.planes == PlaneBits::ALL)
+        aspectFlags = texture.GetImageAspectFlags();
+
+    vkRegion = {VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2};
+    vkRegion.bufferOffset = bufferDataLayout.offset;
+    vkRegion.bufferRowLength = bufferRowLength;
+    vkRegion.bufferImageHeight = bufferImageHeight;
+    vkRegion.imageSubresource = VkImageSubresourceLayers{
+        aspectFlags,
+        textureRegion.mipOffset,
+        textureRegion.layerOffset,
         1,
     };
-    region.imageOffset = VkOffset3D{
-        dstRegion.x,
-        dstRegion.y,
-        dstRegion.z,
+    vkRegion.imageOffset = VkOffset3D{
+        textureRegion.x,
+        textureRegion.y,
+        textureRegion.z,
     };
-    region.imageExtent = VkExtent3D{
-        (dstRegion.width == WHOLE_SIZE) ? dst.GetSize(0, dstRegion.mipOffset) : dstRegion.width,
-        (dstRegion.height == WHOLE_SIZE) ? dst.GetSize(1, dstRegion.mipOffset) : dstRegion.height,
-        (dstRegion.depth == WHOLE_SIZE) ? dst.GetSize(2, dstRegion.mipOffset) : dstRegion.depth,
+    vkRegion.imageExtent = VkExtent3D{
+        (textureRegion.width == WHOLE_SIZE) ? texture.GetSize(0, textureRegion.mipOffset) : textureRegion.width,
+        (textureRegion.height == WHOLE_SIZE) ? texture.GetSize(1, textureRegion.mipOffset) : textureRegion.height,
+        (textureRegion.depth == WHOLE_SIZE) ? texture.GetSize(2, textureRegion.mipOffset) : textureRegion.depth,
     };
+}
+
+NRI_INLINE void CommandBufferVK::UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout) {
+    TextureBufferCopyRegionDesc region = {dstRegion, srcDataLayout};
+    UploadBufferToTextureRegions(dstTexture, srcBuffer, &region, 1);
+}
+
+NRI_INLINE void CommandBufferVK::UploadBufferToTextureRegions(Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    if (!regionNum)
+        return; // "regionCount" must be > 0
+
+    const BufferVK& src = (BufferVK&)srcBuffer;
+    const TextureVK& dst = (TextureVK&)dstTexture;
+
+    Scratch<VkBufferImageCopy2> vkRegions = AllocateScratch(m_Device, VkBufferImageCopy2, regionNum);
+    for (uint32_t i = 0; i < regionNum; i++)
+        FillBufferImageCopy(dst, regions[i], vkRegions[i]);
 
     VkCopyBufferToImageInfo2 info = {VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2};
     info.srcBuffer = src.GetHandle();
     info.dstImage = dst.GetHandle();
     info.dstImageLayout = IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-    info.regionCount = 1;
-    info.pRegions = &region;
+    info.regionCount = regionNum;
+    info.pRegions = vkRegions;
 
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdCopyBufferToImage2(m_Handle, &info);
 }
 
 NRI_INLINE void CommandBufferVK::ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion) {
+    TextureBufferCopyRegionDesc region = {srcRegion, dstDataLayout};
+    ReadbackTextureToBufferRegions(dstBuffer, srcTexture, &region, 1);
+}
+
+NRI_INLINE void CommandBufferVK::ReadbackTextureToBufferRegions(Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    if (!regionNum)
+        return; // "regionCount" must be > 0
+
     const TextureVK& src = (TextureVK&)srcTexture;
     const BufferVK& dst = (BufferVK&)dstBuffer;
-    const FormatProps& formatProps = GetFormatProps(src.GetDesc().format);
 
-    uint32_t rowBlockNum = dstDataLayout.rowPitch / formatProps.stride;
-    uint32_t bufferRowLength = rowBlockNum * formatProps.blockWidth;
-
-    uint32_t sliceRowNum = dstDataLayout.slicePitch / dstDataLayout.rowPitch;
-    uint32_t bufferImageHeight = sliceRowNum * formatProps.blockWidth;
-
-    VkImageAspectFlags srcAspectFlags = GetImageAspectFlags(srcRegion.planes);
-    if (srcRegion.planes == PlaneBits::ALL)
-        srcAspectFlags = src.GetImageAspectFlags();
-
-    VkBufferImageCopy2 region = {VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2};
-    region.bufferOffset = dstDataLayout.offset;
-    region.bufferRowLength = bufferRowLength;
-    region.bufferImageHeight = bufferImageHeight;
-    region.imageSubresource = VkImageSubresourceLayers{
-        srcAspectFlags,
-        srcRegion.mipOffset,
-        srcRegion.layerOffset,
-        1,
-    };
-    region.imageOffset = VkOffset3D{
-        srcRegion.x,
-        srcRegion.y,
-        srcRegion.z,
-    };
-    region.imageExtent = VkExtent3D{
-        (srcRegion.width == WHOLE_SIZE) ? src.GetSize(0, srcRegion.mipOffset) : srcRegion.width,
-        (srcRegion.height == WHOLE_SIZE) ? src.GetSize(1, srcRegion.mipOffset) : srcRegion.height,
-        (srcRegion.depth == WHOLE_SIZE) ? src.GetSize(2, srcRegion.mipOffset) : srcRegion.depth,
-    };
+    Scratch<VkBufferImageCopy2> vkRegions = AllocateScratch(m_Device, VkBufferImageCopy2, regionNum);
+    for (uint32_t i = 0; i < regionNum; i++)
+        FillBufferImageCopy(src, regions[i], vkRegions[i]);
 
     VkCopyImageToBufferInfo2 info = {VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2};
     info.srcImage = src.GetHandle();
     info.srcImageLayout = IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
     info.dstBuffer = dst.GetHandle();
-    info.regionCount = 1;
-    info.pRegions = &region;
+    info.regionCount = regionNum;
+    info.pRegions = vkRegions;
 
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdCopyImageToBuffer2(m_Handle, &info);
@@ -839,6 +915,8 @@ static inline VkAccessFlags2 GetAccessFlags(AccessBits accessBits) {
 }
 
 NRI_INLINE void CommandBufferVK::Barrier(const BarrierDesc& barrierDesc) {
+    m_Device.Count(Counter::BARRIER, barrierDesc.globalNum + barrierDesc.bufferNum + barrierDesc.textureNum);
+
     // Global
     Scratch<VkMemoryBarrier2> memoryBarriers = AllocateScratch(m_Device, VkMemoryBarrier2, barrierDesc.globalNum);
     for (uint32_t i = 0; i < barrierDesc.globalNum; i++) {
@@ -963,12 +1041,29 @@ NRI_INLINE void CommandBufferVK::BeginAnnotation(const char* name, uint32_t bgra
     const auto& vk = m_Device.GetDispatchTable();
     if (vk.CmdBeginDebugUtilsLabelEXT)
         vk.CmdBeginDebugUtilsLabelEXT(m_Handle, &info);
+
+    if (m_Device.IsBreadcrumbsEnabled()) {
+        uint32_t id = CanWriteBreadcrumbMarker() ? m_Device.AddBreadcrumb(name, m_Type) : 0;
+        WriteBreadcrumbMarker(id, false);
+
+        m_Breadcrumbs.push_back(id);
+    }
 }
 
 NRI_INLINE void CommandBufferVK::EndAnnotation() {
     const auto& vk = m_Device.GetDispatchTable();
     if (vk.CmdEndDebugUtilsLabelEXT)
         vk.CmdEndDebugUtilsLabelEXT(m_Handle);
+
+    if (!m_Breadcrumbs.empty()) {
+        uint32_t id = m_Breadcrumbs.back();
+        m_Breadcrumbs.pop_back();
+
+        if (CanWriteBreadcrumbMarker())
+            WriteBreadcrumbMarker(id, true);
+        else if (id)
+            m_Device.SkipBreadcrumbEnd(id);
+    }
 }
 
 NRI_INLINE void CommandBufferVK::Annotation(const char* name, uint32_t bgra) {
@@ -982,6 +1077,48 @@ NRI_INLINE void CommandBufferVK::Annotation(const char* name, uint32_t bgra) {
     const auto& vk = m_Device.GetDispatchTable();
     if (vk.CmdInsertDebugUtilsLabelEXT)
         vk.CmdInsertDebugUtilsLabelEXT(m_Handle, &info);
+
+    if (m_Device.IsBreadcrumbsEnabled() && CanWriteBreadcrumbMarker()) {
+        uint32_t id = m_Device.AddBreadcrumb(name, m_Type);
+        WriteBreadcrumbMarker(id, false);
+        WriteBreadcrumbMarker(id, true);
+    }
+}
+
+NRI_INLINE bool CommandBufferVK::CanWriteBreadcrumbMarker() const {
+    // "vkCmdFillBuffer" is not allowed inside a render pass
+    const auto& vk = m_Device.GetDispatchTable();
+    return vk.CmdWriteBufferMarker2AMD || !m_IsRendering;
+}
+
+NRI_INLINE void CommandBufferVK::WriteBreadcrumbMarker(uint32_t id, bool isEnd) {
+    if (!id)
+        return;
+
+    VkBuffer buffer = m_Device.GetBreadcrumbBuffer();
+    VkDeviceSize offset = ((id % BREADCRUMB_MAX_NUM) * 2 + (isEnd ? 1 : 0)) * sizeof(uint32_t);
+
+    const auto& vk = m_Device.GetDispatchTable();
+    if (vk.CmdWriteBufferMarker2AMD) {
+        // "begin" is written once preceding commands have started, "end" - once they have completed
+        VkPipelineStageFlags2 stage = isEnd ? VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT : VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT;
+        vk.CmdWriteBufferMarker2AMD(m_Handle, stage, buffer, offset, id);
+    } else {
+        if (isEnd) {
+            // Make "end" wait for preceding commands
+            VkMemoryBarrier2 barrier = {VK_STRUCTURE_TYPE_MEMORY_BARRIER_2};
+            barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+            barrier.dstStageMask = VK_PIPELINE_STAGE_2_CLEAR_BIT;
+
+            VkDependencyInfo dependencyInfo = {VK_STRUCTURE_TYPE_DEPENDENCY_INFO};
+            dependencyInfo.memoryBarrierCount = 1;
+            dependencyInfo.pMemoryBarriers = &barrier;
+
+            vk.CmdPipelineBarrier2(m_Handle, &dependencyInfo);
+        }
+
+        vk.CmdFillBuffer(m_Handle, buffer, offset, sizeof(uint32_t), id);
+    }
 }
 
 NRI_INLINE void CommandBufferVK::BuildTopLevelAccelerationStructures(const BuildTopLevelAccelerationStructureDesc* buildTopLevelAccelerationStructureDescs, uint32_t buildTopLevelAccelerationStructureDescNum) {
@@ -1233,3 +1370,27 @@ NRI_INLINE void CommandBufferVK::DrawMeshTasksIndirect(const Buffer& buffer, uin
     } else
         vk.CmdDrawMeshTasksIndirectEXT(m_Handle, bufferVK.GetHandle(), offset, drawNum, stride);
 }
+
+NRI_INLINE void CommandBufferVK::ExecuteIndirect(const ExecuteIndirectDesc& executeIndirectDesc) {
+    const CommandSignatureVK& commandSignatureVK = *(CommandSignatureVK*)executeIndirectDesc.commandSignature;
+    const BufferVK& preprocessBufferVK = *(BufferVK*)executeIndirectDesc.preprocessBuffer;
+
+    // No execution sets, i.e. the bound pipeline is used by all commands
+    VkGeneratedCommandsPipelineInfoEXT pipelineInfo = {VK_STRUCTURE_TYPE_GENERATED_COMMANDS_PIPELINE_INFO_EXT};
+    pipelineInfo.pipeline = *m_Pipeline;
+
+    VkGeneratedCommandsInfoEXT generatedCommandsInfo = {VK_STRUCTURE_TYPE_GENERATED_COMMANDS_INFO_EXT};
+    generatedCommandsInfo.pNext = &pipelineInfo;
+    generatedCommandsInfo.shaderStages = m_Pipeline->GetShaderStages() ? m_Pipeline->GetShaderStages() : commandSignatureVK.GetShaderStages();
+    generatedCommandsInfo.indirectCommandsLayout = commandSignatureVK;
+    generatedCommandsInfo.indirectAddress = GetBufferDeviceAddress(executeIndirectDesc.buffer, executeIndirectDesc.offset);
+    generatedCommandsInfo.indirectAddressSize = (uint64_t)executeIndirectDesc.commandMaxNum * commandSignatureVK.GetStride();
+    generatedCommandsInfo.preprocessAddress = preprocessBufferVK.GetDeviceAddress() + executeIndirectDesc.preprocessBufferOffset;
+    generatedCommandsInfo.preprocessSize = preprocessBufferVK.GetDesc().size - executeIndirectDesc.preprocessBufferOffset;
+    generatedCommandsInfo.maxSequenceCount = executeIndirectDesc.commandMaxNum;
+    generatedCommandsInfo.sequenceCountAddress = GetBufferDeviceAddress(executeIndirectDesc.countBuffer, executeIndirectDesc.countBufferOffset);
+    generatedCommandsInfo.maxDrawCount = 1; // no multi-draw tokens
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdExecuteGeneratedCommandsEXT(m_Handle, VK_FALSE, &generatedCommandsInfo);
+}
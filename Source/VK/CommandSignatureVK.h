@@ -0,0 +1,56 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct CommandSignatureVK final : public DebugNameBase {
+    inline CommandSignatureVK(DeviceVK& device)
+        : m_Device(device)
+        , m_Layout(device.GetStdAllocator()) {
+    }
+
+    inline operator VkIndirectCommandsLayoutEXT() const {
+        return m_Handle;
+    }
+
+    inline DeviceVK& GetDevice() const {
+        return m_Device;
+    }
+
+    inline VkShaderStageFlags GetShaderStages() const {
+        return m_ShaderStages;
+    }
+
+    ~CommandSignatureVK();
+
+    Result Create(const CommandSignatureDesc& commandSignatureDesc);
+
+    //================================================================================================================
+    // DebugNameBase
+    //================================================================================================================
+
+    void SetDebugName(const char* name) DEBUG_NAME_OVERRIDE;
+
+    //================================================================================================================
+    // NRI
+    //================================================================================================================
+
+    inline uint32_t GetStride() const {
+        return m_Layout.stride;
+    }
+
+    inline uint32_t GetArgumentOffset(uint32_t argumentIndex) const {
+        return m_Layout.argumentOffsets[argumentIndex];
+    }
+
+    uint64_t GetPreprocessSize(const Pipeline& pipeline, uint32_t commandMaxNum) const;
+
+private:
+    DeviceVK& m_Device;
+    CommandSignatureLayout m_Layout;
+    VkIndirectCommandsLayoutEXT m_Handle = VK_NULL_HANDLE;
+    VkShaderStageFlags m_ShaderStages = 0;
+};
+
+} // namespace nri
@@ -0,0 +1,121 @@
+// © 2025 NVIDIA Corporation
+
+CommandSignatureVK::~CommandSignatureVK() {
+    const auto& vk = m_Device.GetDispatchTable();
+    if (m_Handle)
+        vk.DestroyIndirectCommandsLayoutEXT(m_Device, m_Handle, m_Device.GetVkAllocationCallbacks());
+}
+
+Result CommandSignatureVK::Create(const CommandSignatureDesc& commandSignatureDesc) {
+    static_assert(sizeof(IndirectVertexBufferDesc) == sizeof(VkBindVertexBufferIndirectCommandEXT), "Type mismatch");
+    static_assert(sizeof(IndirectIndexBufferDesc) == sizeof(VkBindIndexBufferIndirectCommandEXT), "Type mismatch");
+
+    if (!m_Device.GetDesc().features.indirectCommands)
+        return Result::UNSUPPORTED;
+
+    m_Layout.Init(commandSignatureDesc);
+
+    const PipelineLayoutVK* pipelineLayoutVK = (PipelineLayoutVK*)commandSignatureDesc.pipelineLayout;
+    uint32_t argumentNum = commandSignatureDesc.argumentNum;
+
+    Scratch<VkIndirectCommandsLayoutTokenEXT> tokens = AllocateScratch(m_Device, VkIndirectCommandsLayoutTokenEXT, argumentNum);
+    Scratch<VkIndirectCommandsPushConstantTokenEXT> pushConstantTokens = AllocateScratch(m_Device, VkIndirectCommandsPushConstantTokenEXT, argumentNum);
+    Scratch<VkIndirectCommandsVertexBufferTokenEXT> vertexBufferTokens = AllocateScratch(m_Device, VkIndirectCommandsVertexBufferTokenEXT, argumentNum);
+
+    // Index buffers are "D3D12_INDEX_BUFFER_VIEW"-compatible (see "IndirectIndexBufferDesc")
+    VkIndirectCommandsIndexBufferTokenEXT indexBufferToken = {};
+    indexBufferToken.mode = VK_INDIRECT_COMMANDS_INPUT_MODE_DXGI_INDEX_BUFFER_EXT;
+
+    for (uint32_t i = 0; i < argumentNum; i++) {
+        const IndirectArgumentDesc& argumentDesc = commandSignatureDesc.arguments[i];
+
+        VkIndirectCommandsLayoutTokenEXT& token = tokens[i];
+        token = {VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_TOKEN_EXT};
+        token.offset = m_Layout.argumentOffsets[i];
+
+        switch (argumentDesc.type) {
+            case IndirectArgumentType::ROOT_CONSTANTS: {
+                const PushConstantBindingDesc& pushConstantBindingDesc = pipelineLayoutVK->GetBindingInfo().pushConstantBindings[argumentDesc.index];
+
+                VkIndirectCommandsPushConstantTokenEXT& pushConstantToken = pushConstantTokens[i];
+                pushConstantToken = {};
+                pushConstantToken.updateRange.stageFlags = pushConstantBindingDesc.stages;
+                pushConstantToken.updateRange.offset = pushConstantBindingDesc.offset + argumentDesc.offset;
+                pushConstantToken.updateRange.size = argumentDesc.size;
+
+                token.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_PUSH_CONSTANT_EXT;
+                token.data.pPushConstant = &pushConstantToken;
+            } break;
+            case IndirectArgumentType::VERTEX_BUFFER: {
+                VkIndirectCommandsVertexBufferTokenEXT& vertexBufferToken = vertexBufferTokens[i];
+                vertexBufferToken = {};
+                vertexBufferToken.vertexBindingUnit = argumentDesc.index;
+
+                token.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_VERTEX_BUFFER_EXT;
+                token.data.pVertexBuffer = &vertexBufferToken;
+            } break;
+            case IndirectArgumentType::INDEX_BUFFER:
+                token.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_INDEX_BUFFER_EXT;
+                token.data.pIndexBuffer = &indexBufferToken;
+                break;
+            case IndirectArgumentType::DRAW:
+                token.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_DRAW_EXT;
+                m_ShaderStages = VK_SHADER_STAGE_ALL_GRAPHICS;
+                break;
+            case IndirectArgumentType::DRAW_INDEXED:
+                token.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_DRAW_INDEXED_EXT;
+                m_ShaderStages = VK_SHADER_STAGE_ALL_GRAPHICS;
+                break;
+            case IndirectArgumentType::DRAW_MESH_TASKS:
+                token.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_DRAW_MESH_TASKS_EXT;
+                m_ShaderStages = VK_SHADER_STAGE_TASK_BIT_EXT | VK_SHADER_STAGE_MESH_BIT_EXT | VK_SHADER_STAGE_FRAGMENT_BIT;
+                break;
+            case IndirectArgumentType::DISPATCH:
+                token.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_DISPATCH_EXT;
+                m_ShaderStages = VK_SHADER_STAGE_COMPUTE_BIT;
+                break;
+            default:
+                return Result::INVALID_ARGUMENT;
+        }
+    }
+
+    // The layout must cover all stages of any pipeline it's executed with, but only the stages supported by the device
+    VkShaderStageFlags requiredStages = m_ShaderStages & (VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_MESH_BIT_EXT | VK_SHADER_STAGE_COMPUTE_BIT);
+    m_ShaderStages &= m_Device.GetIndirectCommandsShaderStages();
+    RETURN_ON_FAILURE(&m_Device, (m_ShaderStages & requiredStages) == requiredStages, Result::UNSUPPORTED, "Shader stages 0x%X are not supported by indirect commands", requiredStages);
+
+    VkIndirectCommandsLayoutCreateInfoEXT createInfo = {VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_CREATE_INFO_EXT};
+    createInfo.shaderStages = m_ShaderStages;
+    createInfo.indirectStride = m_Layout.stride;
+    createInfo.pipelineLayout = pipelineLayoutVK ? (VkPipelineLayout)*pipelineLayoutVK : VK_NULL_HANDLE;
+    createInfo.tokenCount = argumentNum;
+    createInfo.pTokens = tokens;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.CreateIndirectCommandsLayoutEXT(m_Device, &createInfo, m_Device.GetVkAllocationCallbacks(), &m_Handle);
+    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateIndirectCommandsLayoutEXT");
+
+    return Result::SUCCESS;
+}
+
+NRI_INLINE void CommandSignatureVK::SetDebugName(const char* name) {
+    m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_INDIRECT_COMMANDS_LAYOUT_EXT, (uint64_t)m_Handle, name);
+}
+
+NRI_INLINE uint64_t CommandSignatureVK::GetPreprocessSize(const Pipeline& pipeline, uint32_t commandMaxNum) const {
+    VkGeneratedCommandsPipelineInfoEXT pipelineInfo = {VK_STRUCTURE_TYPE_GENERATED_COMMANDS_PIPELINE_INFO_EXT};
+    pipelineInfo.pipeline = (PipelineVK&)pipeline;
+
+    VkGeneratedCommandsMemoryRequirementsInfoEXT memoryRequirementsInfo = {VK_STRUCTURE_TYPE_GENERATED_COMMANDS_MEMORY_REQUIREMENTS_INFO_EXT};
+    memoryRequirementsInfo.pNext = &pipelineInfo;
+    memoryRequirementsInfo.indirectCommandsLayout = m_Handle;
+    memoryRequirementsInfo.maxSequenceCount = commandMaxNum;
+    memoryRequirementsInfo.maxDrawCount = 1; // no multi-draw tokens
+
+    VkMemoryRequirements2 requirements = {VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2};
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.GetGeneratedCommandsMemoryRequirementsEXT(m_Device, &memoryRequirementsInfo, &requirements);
+
+    return Align(requirements.memoryRequirements.size, requirements.memoryRequirements.alignment);
+}
@@ -87,6 +87,8 @@ NRI_INLINE Result DescriptorPoolVK::AllocateDescriptorSets(const PipelineLayout&
         descriptorSets[i] = (DescriptorSet*)descriptorSet;
     }
 
+    m_Device.Count(Counter::DESCRIPTOR_SET, instanceNum);
+
     return Result::SUCCESS;
 }
 
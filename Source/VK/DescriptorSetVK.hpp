@@ -93,6 +93,8 @@ NRI_INLINE void DescriptorSetVK::SetDebugName(const char* name) {
 }
 
 NRI_INLINE void DescriptorSetVK::UpdateDescriptorRanges(uint32_t rangeOffset, uint32_t rangeNum, const DescriptorRangeUpdateDesc* rangeUpdateDescs) {
+    TRACE_SCOPE(m_Device, "UpdateDescriptorRanges");
+
     // Count and allocate scratch memory
     uint32_t scratchSize = 0;
     for (uint32_t i = 0; i < rangeNum; i++) {
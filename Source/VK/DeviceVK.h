@@ -12,6 +12,7 @@ struct IsSupported {
     uint32_t swapChainMutableFormat : 1;
     uint32_t presentId              : 1;
     uint32_t memoryPriority         : 1;
+    uint32_t pageableMemory         : 1;
     uint32_t memoryBudget           : 1;
     uint32_t maintenance4           : 1;
     uint32_t maintenance5           : 1;
@@ -23,10 +24,55 @@ struct IsSupported {
     uint32_t pipelineRobustness     : 1;
     uint32_t swapChainMaintenance1  : 1;
     uint32_t fifoLatestReady        : 1;
+    uint32_t sparse                 : 1;
+    uint32_t sparse3D               : 1;
+    uint32_t displayTiming          : 1;
+    uint32_t deviceFault            : 1;
+    uint32_t addressBindingReport   : 1;
 };
 
 static_assert(sizeof(IsSupported) == sizeof(uint32_t), "4 bytes expected");
 
+// Usages, for which sample counts are queried separately
+enum class FormatSampleUsage : uint8_t {
+    NONE, // copies only
+    SHADER_RESOURCE,
+    SHADER_RESOURCE_STORAGE,
+    COLOR_ATTACHMENT,
+    DEPTH_STENCIL_ATTACHMENT,
+
+    MAX_NUM
+};
+
+// Computed once, sample counts are queried with the same flags and usage as used in "FillCreateInfo"
+struct FormatCaps {
+    std::array<VkSampleCountFlags, (size_t)FormatSampleUsage::MAX_NUM> sampleCounts;
+    FormatSupportBits supportBits;
+};
+
+// A ring: only the last "BREADCRUMB_MAX_NUM" recorded annotations can be reported. Slots are reused on recording, not on submission,
+// so a command buffer recorded once and submitted many times loses its breadcrumbs after the ring wraps
+constexpr uint32_t BREADCRUMB_MAX_NUM = 4096;
+constexpr uint32_t BREADCRUMB_NAME_MAX_LEN = 64;
+
+// An annotated range in a command buffer. The GPU writes "id" into 2 markers (begin and end) of the slot "id % BREADCRUMB_MAX_NUM",
+// a stale value means "not reached yet"
+struct BreadcrumbVK {
+    char name[BREADCRUMB_NAME_MAX_LEN];
+    uint32_t id;
+    QueueType queueType;
+    bool hasEnd; // "false" if the end marker can't be written
+};
+
+constexpr uint32_t TRACKED_RESOURCE_NAME_MAX_LEN = 64;
+
+// A live buffer or texture, used to resolve faulting addresses
+struct TrackedResourceVK {
+    char name[TRACKED_RESOURCE_NAME_MAX_LEN];
+    uint64_t address; // 0 - unknown
+    uint64_t size;
+};
+
 struct DeviceVK final : public DeviceBase {
     inline operator VkDevice() const {
         return m_Device;
@@ -68,8 +114,35 @@ struct DeviceVK final : public DeviceBase {
         return m_Vma;
     }
 
+    inline bool IsBreadcrumbsEnabled() const {
+        return m_BreadcrumbMarkers != nullptr;
+    }
+
+    inline VkBuffer GetBreadcrumbBuffer() const {
+        return m_BreadcrumbBuffer;
+    }
+
+    inline VkShaderStageFlags GetIndirectCommandsShaderStages() const {
+        return m_IndirectCommandsShaderStages;
+    }
+
+    inline void CheckDeviceLost(VkResult vkResult) {
+        if (vkResult == VK_ERROR_DEVICE_LOST)
+            ReportDeviceLost();
+    }
+
     template <typename Implementation, typename Interface, typename... Args>
     inline Result CreateImplementation(Interface*& entity, const Args&... args) {
+        Result result = CreateInternalImplementation<Implementation>(entity, args...);
+        if (result == Result::SUCCESS)
+            OnObjectCreated<Interface>();
+
+        return result;
+    }
+
+    // For objects not visible to the app (not counted by "DeviceStatistics", must be destroyed via "Destroy")
+    template <typename Implementation, typename Interface, typename... Args>
+    inline Result CreateInternalImplementation(Interface*& entity, const Args&... args) {
         Implementation* impl = Allocate<Implementation>(GetAllocationCallbacks(), *this);
         Result result = impl->Create(args...);
 
@@ -86,8 +159,9 @@ struct DeviceVK final : public DeviceBase {
     ~DeviceVK();
 
     Result Create(const DeviceCreationDesc& desc, const DeviceCreationVKDesc& descVK);
-    void FillCreateInfo(const BufferDesc& bufferDesc, VkBufferCreateInfo& info) const;
+    void FillCreateInfo(const BufferDesc& bufferDesc, VkBufferCreateInfo& info, VkBufferUsageFlags2CreateInfoKHR& usage2) const;
     void FillCreateInfo(const TextureDesc& bufferDesc, VkImageCreateInfo& info) const;
+    VkSampleCountFlags GetSampleCounts(Format format, TextureUsageBits usage) const;
     void GetMemoryDesc2(const BufferDesc& bufferDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) const;
     void GetMemoryDesc2(const TextureDesc& textureDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) const;
     void GetMemoryDesc2(const AccelerationStructureDesc& accelerationStructureDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc);
@@ -98,6 +172,15 @@ struct DeviceVK final : public DeviceBase {
     void GetMicromapBuildSizesInfo(const MicromapDesc& micromapDesc, VkMicromapBuildSizesInfoEXT& sizesInfo);
     void SetDebugNameToTrivialObject(VkObjectType objectType, uint64_t handle, const char* name);
     void DestroyVma();
+    Result SetVmaAllocationPriority(VmaAllocation_T* allocation, float priority);
+    Result GetVmaStatistics(ResourceAllocatorHeapStatistics* heapStatistics, uint32_t& heapStatisticsNum) const;
+    Result GetVmaDump(char* dump, uint64_t& dumpSize) const;
+    void TrackResource(VkObjectType objectType, uint64_t handle, uint64_t address, uint64_t size);
+    void SetTrackedResourceName(VkObjectType objectType, uint64_t handle, const char* name);
+    void UntrackResource(VkObjectType objectType, uint64_t handle);
+    uint32_t AddBreadcrumb(const char* name, QueueType queueType);
+    void SkipBreadcrumbEnd(uint32_t id);
+    void ReportDeviceLost();
 
     //================================================================================================================
     // DebugNameBase
@@ -116,12 +199,19 @@ struct DeviceVK final : public DeviceBase {
     void Destruct() override;
     Result FillFunctionTable(CoreInterface& table) const override;
     Result FillFunctionTable(HelperInterface& table) const override;
+    Result FillFunctionTable(IndirectCommandsInterface& table) const override;
     Result FillFunctionTable(LowLatencyInterface& table) const override;
     Result FillFunctionTable(MeshShaderInterface& table) const override;
+    Result FillFunctionTable(MicromapBakerInterface& table) const override;
+    Result FillFunctionTable(ProfilerInterface& table) const override;
     Result FillFunctionTable(RayTracingInterface& table) const override;
+    Result FillFunctionTable(RenderGraphInterface& table) const override;
+    Result FillFunctionTable(ResidencyInterface& table) const override;
     Result FillFunctionTable(ResourceAllocatorInterface& table) const override;
+    Result FillFunctionTable(SparseInterface& table) const override;
     Result FillFunctionTable(StreamerInterface& table) const override;
     Result FillFunctionTable(SwapChainInterface& table) const override;
+    Result FillFunctionTable(TraceInterface& table) const override;
     Result FillFunctionTable(UpscalerInterface& table) const override;
     Result FillFunctionTable(WrapperVKInterface& table) const override;
 
@@ -148,10 +238,16 @@ private:
     void ProcessInstanceExtensions(Vector<const char*>& desiredInstanceExts);
     void ProcessDeviceExtensions(Vector<const char*>& desiredDeviceExts, bool disableRayTracing);
     void ReportDeviceGroupInfo();
+    void FillFormatCaps();
     Result CreateInstance(bool enableGraphicsAPIValidation, const Vector<const char*>& desiredInstanceExts);
     Result ResolvePreInstanceDispatchTable();
     Result ResolveInstanceDispatchTable(const Vector<const char*>& desiredInstanceExts);
     Result ResolveDispatchTable(const Vector<const char*>& desiredDeviceExts);
+    Result CreateBreadcrumbs();
+    void DestroyBreadcrumbs();
+    void ReportBreadcrumbs();
+    void ReportDeviceFault();
+    const TrackedResourceVK* FindTrackedResource(uint64_t address, bool& isTexture) const;
 
 public:
     union {
@@ -165,6 +261,10 @@ private:
     std::array<Vector<QueueVK*>, (size_t)QueueType::MAX_NUM> m_QueueFamilies;
     DispatchTable m_VK = {};
     VkPhysicalDeviceMemoryProperties m_MemoryProps = {};
+    std::array<FormatCaps, (size_t)Format::MAX_NUM> m_FormatCaps = {};
+    Vector<BreadcrumbVK> m_Breadcrumbs;
+    UnorderedMap<uint64_t, TrackedResourceVK> m_TrackedBuffers;  // key: "VkBuffer"
+    UnorderedMap<uint64_t, TrackedResourceVK> m_TrackedTextures; // key: "VkImage"
     VkAllocationCallbacks m_AllocationCallbacks = {};
     VKBindingOffsets m_BindingOffsets = {};
     CoreInterface m_iCore = {};
@@ -174,13 +274,23 @@ private:
     VkInstance m_Instance = VK_NULL_HANDLE;
     VkAllocationCallbacks* m_AllocationCallbackPtr = nullptr;
     VkDebugUtilsMessengerEXT m_Messenger = VK_NULL_HANDLE;
+    VkDebugUtilsMessengerEXT m_AddressBindingMessenger = VK_NULL_HANDLE;
     VmaAllocator_T* m_Vma = nullptr;
+    VkBuffer m_BreadcrumbBuffer = VK_NULL_HANDLE;
+    VkDeviceMemory m_BreadcrumbMemory = VK_NULL_HANDLE;
+    const uint32_t* m_BreadcrumbMarkers = nullptr;
+    std::atomic_uint32_t m_BreadcrumbNextId = 1;
+    std::atomic_bool m_IsDeviceLostReported = false;
+    VkShaderStageFlags m_IndirectCommandsShaderStages = 0;
     uint32_t m_NumActiveFamilyIndices = 0;
     uint32_t m_MinorVersion = 0;
     bool m_OwnsNativeObjects = true;
     bool m_IsMemoryZeroInitializationEnabled = false;
+    bool m_IsResourceTrackingEnabled = false;
 
     Lock m_Lock;
+    Lock m_TrackedResourcesLock;
+    Lock m_BreadcrumbsLock;
 };
 
 } // namespace nri
@@ -46,7 +46,8 @@ static constexpr VkBufferUsageFlags GetBufferUsageFlags(BufferUsageBits bufferUs
 }
 
 static constexpr VkImageUsageFlags GetImageUsageFlags(TextureUsageBits textureUsageBits) {
-    VkImageUsageFlags flags = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    // Transient attachments can't be combined with any non-attachment usage, including copies
+    VkImageUsageFlags flags = (textureUsageBits & TextureUsageBits::TRANSIENT_ATTACHMENT) ? VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT : (VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
 
     if (textureUsageBits & TextureUsageBits::SHADER_RESOURCE)
         flags |= VK_IMAGE_USAGE_SAMPLED_BIT;
@@ -102,6 +103,27 @@ static void VKAPI_PTR vkFreeHostMemory(void* pUserData, void* pMemory) {
     return allocationCallbacks.Free(allocationCallbacks.userArg, pMemory);
 }
 
+static VkBool32 VKAPI_PTR AddressBindingCallback(VkDebugUtilsMessageSeverityFlagBitsEXT, VkDebugUtilsMessageTypeFlagsEXT, const VkDebugUtilsMessengerCallbackDataEXT* callbackData, void* userData) {
+    DeviceVK& device = *(DeviceVK*)userData;
+
+    const VkDeviceAddressBindingCallbackDataEXT* bindingData = nullptr;
+    for (const VkBaseInStructure* next = (const VkBaseInStructure*)callbackData->pNext; next; next = next->pNext) {
+        if (next->sType == VK_STRUCTURE_TYPE_DEVICE_ADDRESS_BINDING_CALLBACK_DATA_EXT)
+            bindingData = (const VkDeviceAddressBindingCallbackDataEXT*)next;
+    }
+
+    if (!bindingData || callbackData->objectCount == 0)
+        return VK_FALSE;
+
+    const VkDebugUtilsObjectNameInfoEXT& object = callbackData->pObjects[0];
+    if (bindingData->bindingType == VK_DEVICE_ADDRESS_BINDING_TYPE_BIND_EXT)
+        device.TrackResource(object.objectType, object.objectHandle, bindingData->baseAddress, bindingData->size);
+    else
+        device.UntrackResource(object.objectType, object.objectHandle);
+
+    return VK_FALSE;
+}
+
 static VkBool32 VKAPI_PTR MessageCallback(VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity, VkDebugUtilsMessageTypeFlagsEXT, const VkDebugUtilsMessengerCallbackDataEXT* callbackData, void* userData) {
     DeviceVK& device = *(DeviceVK*)userData;
 
@@ -128,7 +150,7 @@ static VkBool32 VKAPI_PTR MessageCallback(VkDebugUtilsMessageSeverityFlagBitsEXT
     } else if (messageSeverity == VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT)
         severity = Message::WARNING;
 
-    device.ReportMessage(severity, result, __FILE__, __LINE__, "[%u] %s", callbackData->messageIdNumber, callbackData->pMessage);
+    device.ReportMessage(severity, result, true, __FILE__, __LINE__, "[%u] %s", callbackData->messageIdNumber, callbackData->pMessage);
 
     return VK_FALSE;
 }
@@ -316,6 +338,9 @@ void DeviceVK::ProcessDeviceExtensions(Vector<const char*>& desiredDeviceExts, b
     if (IsExtensionSupported(VK_EXT_MESH_SHADER_EXTENSION_NAME, supportedExts))
         desiredDeviceExts.push_back(VK_EXT_MESH_SHADER_EXTENSION_NAME);
 
+    if (IsExtensionSupported(VK_EXT_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME, supportedExts))
+        desiredDeviceExts.push_back(VK_EXT_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME);
+
     if (IsExtensionSupported(VK_EXT_SHADER_ATOMIC_FLOAT_EXTENSION_NAME, supportedExts))
         desiredDeviceExts.push_back(VK_EXT_SHADER_ATOMIC_FLOAT_EXTENSION_NAME);
 
@@ -328,6 +353,9 @@ void DeviceVK::ProcessDeviceExtensions(Vector<const char*>& desiredDeviceExts, b
     if (IsExtensionSupported(VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME, supportedExts))
         desiredDeviceExts.push_back(VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME);
 
+    if (IsExtensionSupported(VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME, supportedExts))
+        desiredDeviceExts.push_back(VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME);
+
     if (IsExtensionSupported(VK_EXT_IMAGE_SLICED_VIEW_OF_3D_EXTENSION_NAME, supportedExts))
         desiredDeviceExts.push_back(VK_EXT_IMAGE_SLICED_VIEW_OF_3D_EXTENSION_NAME);
 
@@ -346,10 +374,22 @@ void DeviceVK::ProcessDeviceExtensions(Vector<const char*>& desiredDeviceExts, b
     if (IsExtensionSupported(VK_EXT_ZERO_INITIALIZE_DEVICE_MEMORY_EXTENSION_NAME, supportedExts))
         desiredDeviceExts.push_back(VK_EXT_ZERO_INITIALIZE_DEVICE_MEMORY_EXTENSION_NAME);
 
+    if (IsExtensionSupported(VK_EXT_DEVICE_FAULT_EXTENSION_NAME, supportedExts))
+        desiredDeviceExts.push_back(VK_EXT_DEVICE_FAULT_EXTENSION_NAME);
+
+    if (IsExtensionSupported(VK_EXT_DEVICE_ADDRESS_BINDING_REPORT_EXTENSION_NAME, supportedExts))
+        desiredDeviceExts.push_back(VK_EXT_DEVICE_ADDRESS_BINDING_REPORT_EXTENSION_NAME);
+
     // Optional
+    if (IsExtensionSupported(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME, supportedExts))
+        desiredDeviceExts.push_back(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME);
+
     if (IsExtensionSupported(VK_NV_LOW_LATENCY_2_EXTENSION_NAME, supportedExts))
         desiredDeviceExts.push_back(VK_NV_LOW_LATENCY_2_EXTENSION_NAME);
 
+    if (IsExtensionSupported(VK_AMD_BUFFER_MARKER_EXTENSION_NAME, supportedExts))
+        desiredDeviceExts.push_back(VK_AMD_BUFFER_MARKER_EXTENSION_NAME);
+
     if (IsExtensionSupported(VK_NVX_BINARY_IMPORT_EXTENSION_NAME, supportedExts))
         desiredDeviceExts.push_back(VK_NVX_BINARY_IMPORT_EXTENSION_NAME);
 
@@ -367,7 +407,10 @@ DeviceVK::DeviceVK(const CallbackInterface& callbacks, const AllocationCallbacks
           Vector<QueueVK*>(GetStdAllocator()),
           Vector<QueueVK*>(GetStdAllocator()),
           Vector<QueueVK*>(GetStdAllocator()),
-      } {
+      }
+    , m_Breadcrumbs(GetStdAllocator())
+    , m_TrackedBuffers(GetStdAllocator())
+    , m_TrackedTextures(GetStdAllocator()) {
     m_AllocationCallbacks.pUserData = (void*)&GetAllocationCallbacks();
     m_AllocationCallbacks.pfnAllocation = vkAllocateHostMemory;
     m_AllocationCallbacks.pfnReallocation = vkReallocateHostMemory;
@@ -378,6 +421,7 @@ DeviceVK::DeviceVK(const CallbackInterface& callbacks, const AllocationCallbacks
 }
 
 DeviceVK::~DeviceVK() {
+    DestroyBreadcrumbs();
     DestroyVma();
 
     for (auto& queueFamily : m_QueueFamilies) {
@@ -391,6 +435,12 @@ DeviceVK::~DeviceVK() {
         destroyCallback(m_Instance, m_Messenger, m_AllocationCallbackPtr);
     }
 
+    if (m_AddressBindingMessenger) {
+        typedef PFN_vkDestroyDebugUtilsMessengerEXT Func;
+        Func destroyCallback = (Func)m_VK.GetInstanceProcAddr(m_Instance, "vkDestroyDebugUtilsMessengerEXT");
+        destroyCallback(m_Instance, m_AddressBindingMessenger, m_AllocationCallbackPtr);
+    }
+
     if (m_OwnsNativeObjects) {
         if (m_Device)
             m_VK.DestroyDevice(m_Device, m_AllocationCallbackPtr);
@@ -726,6 +776,11 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         APPEND_EXT(meshShaderFeatures);
     }
 
+    VkPhysicalDeviceDeviceGeneratedCommandsFeaturesEXT deviceGeneratedCommandsFeatures = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_FEATURES_EXT};
+    if (IsExtensionSupported(VK_EXT_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME, desiredDeviceExts)) {
+        APPEND_EXT(deviceGeneratedCommandsFeatures);
+    }
+
     VkPhysicalDeviceShaderAtomicFloatFeaturesEXT shaderAtomicFloatFeatures = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_FEATURES_EXT};
     if (IsExtensionSupported(VK_EXT_SHADER_ATOMIC_FLOAT_EXTENSION_NAME, desiredDeviceExts)) {
         APPEND_EXT(shaderAtomicFloatFeatures);
@@ -741,6 +796,11 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         APPEND_EXT(memoryPriorityFeatures);
     }
 
+    VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT pageableDeviceLocalMemoryFeatures = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT};
+    if (IsExtensionSupported(VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME, desiredDeviceExts)) {
+        APPEND_EXT(pageableDeviceLocalMemoryFeatures);
+    }
+
     VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT slicedViewFeatures = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_SLICED_VIEW_OF_3D_FEATURES_EXT};
     if (IsExtensionSupported(VK_EXT_IMAGE_SLICED_VIEW_OF_3D_EXTENSION_NAME, desiredDeviceExts)) {
         APPEND_EXT(slicedViewFeatures);
@@ -781,6 +841,17 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         APPEND_EXT(zeroInitializeDeviceMemoryFeatures);
     }
 
+    VkPhysicalDeviceFaultFeaturesEXT faultFeatures = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FAULT_FEATURES_EXT};
+    if (IsExtensionSupported(VK_EXT_DEVICE_FAULT_EXTENSION_NAME, desiredDeviceExts)) {
+        APPEND_EXT(faultFeatures);
+    }
+
+    // Address binding reports are needed only to resolve faulting addresses for "DeviceFaultCallback"
+    VkPhysicalDeviceAddressBindingReportFeaturesEXT addressBindingReportFeatures = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ADDRESS_BINDING_REPORT_FEATURES_EXT};
+    if (IsExtensionSupported(VK_EXT_DEVICE_ADDRESS_BINDING_REPORT_EXTENSION_NAME, desiredDeviceExts) && m_CallbackInterface.DeviceFaultCallback) {
+        APPEND_EXT(addressBindingReportFeatures);
+    }
+
     if (IsExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, desiredDeviceExts))
         m_IsSupported.memoryBudget = true;
 
@@ -791,6 +862,7 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     m_IsSupported.swapChainMutableFormat = IsExtensionSupported(VK_KHR_SWAPCHAIN_MUTABLE_FORMAT_EXTENSION_NAME, desiredDeviceExts);
     m_IsSupported.presentId = presentIdFeatures.presentId;
     m_IsSupported.memoryPriority = memoryPriorityFeatures.memoryPriority;
+    m_IsSupported.pageableMemory = m_IsSupported.memoryPriority && pageableDeviceLocalMemoryFeatures.pageableDeviceLocalMemory;
     m_IsSupported.maintenance4 = features13.maintenance4 != 0 || maintenance4Features.maintenance4 != 0;
     m_IsSupported.maintenance5 = maintenance5Features.maintenance5;
     m_IsSupported.maintenance6 = maintenance6Features.maintenance6;
@@ -801,8 +873,15 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     m_IsSupported.pipelineRobustness = pipelineRobustnessFeatures.pipelineRobustness;
     m_IsSupported.swapChainMaintenance1 = swapchainMaintenance1Features.swapchainMaintenance1;
     m_IsSupported.fifoLatestReady = presentModeFifoLatestReadyFeaturesEXT.presentModeFifoLatestReady;
+    m_IsSupported.displayTiming = IsExtensionSupported(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME, desiredDeviceExts);
+    m_IsSupported.sparse = features.features.sparseBinding != 0 && features.features.sparseResidencyBuffer != 0 && features.features.sparseResidencyImage2D != 0;
+    m_IsSupported.sparse3D = m_IsSupported.sparse && features.features.sparseResidencyImage3D != 0;
+
+    m_IsSupported.deviceFault = faultFeatures.deviceFault;
+    m_IsSupported.addressBindingReport = addressBindingReportFeatures.reportAddressBinding;
 
     m_IsMemoryZeroInitializationEnabled = desc.enableMemoryZeroInitialization && zeroInitializeDeviceMemoryFeatures.zeroInitializeDeviceMemory;
+    m_IsResourceTrackingEnabled = m_IsSupported.deviceFault && m_CallbackInterface.DeviceFaultCallback;
 
     { // Check hard requirements
         bool hasDynamicRendering = features13.dynamicRendering != 0 || (dynamicRenderingFeatures.dynamicRendering != 0 && extendedDynamicStateFeatures.extendedDynamicState != 0);
@@ -1007,6 +1086,11 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
             APPEND_EXT(micromapProps);
         }
 
+        VkPhysicalDeviceDeviceGeneratedCommandsPropertiesEXT deviceGeneratedCommandsProps = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_PROPERTIES_EXT};
+        if (IsExtensionSupported(VK_EXT_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME, desiredDeviceExts)) {
+            APPEND_EXT(deviceGeneratedCommandsProps);
+        }
+
         VkPhysicalDeviceComputeShaderDerivativesPropertiesKHR computeShaderDerivativesProps = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_SHADER_DERIVATIVES_PROPERTIES_KHR};
         if (IsExtensionSupported(VK_KHR_COMPUTE_SHADER_DERIVATIVES_EXTENSION_NAME, desiredDeviceExts)) {
             APPEND_EXT(computeShaderDerivativesProps);
@@ -1039,6 +1123,9 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
             const VkMemoryType& memoryType = m_MemoryProps.memoryTypes[i];
             if ((memoryType.propertyFlags & neededFlags) == neededFlags)
                 m_Desc.memory.deviceUploadHeapSize += m_MemoryProps.memoryHeaps[memoryType.heapIndex].size;
+
+            if (memoryType.propertyFlags & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT)
+                m_Desc.features.lazilyAllocatedMemory = true;
         }
 
         m_Desc.memory.allocationMaxNum = limits.maxMemoryAllocationCount;
@@ -1237,6 +1324,8 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         m_Desc.features.meshShader = meshShaderFeatures.meshShader != 0 && meshShaderFeatures.taskShader != 0;
         m_Desc.features.lowLatency = m_IsSupported.presentId != 0 && IsExtensionSupported(VK_NV_LOW_LATENCY_2_EXTENSION_NAME, desiredDeviceExts);
         m_Desc.features.micromap = micromapFeatures.micromap != 0;
+        m_Desc.features.indirectCommands = deviceGeneratedCommandsFeatures.deviceGeneratedCommands != 0 && m_IsSupported.maintenance5 && m_IsSupported.deviceAddress;
+        m_IndirectCommandsShaderStages = deviceGeneratedCommandsProps.supportedIndirectCommandsShaderStages;
 
         m_Desc.features.independentFrontAndBackStencilReferenceAndMasks = true;
         m_Desc.features.textureFilterMinMax = features12.samplerFilterMinmax;
@@ -1253,6 +1342,7 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         m_Desc.features.presentFromCompute = true;
         m_Desc.features.waitableSwapChain = presentIdFeatures.presentId != 0 && presentWaitFeatures.presentWait != 0;
         m_Desc.features.pipelineStatistics = features.features.pipelineStatisticsQuery;
+        m_Desc.features.deviceAddress = m_IsSupported.deviceAddress;
 
         m_Desc.shaderFeatures.nativeI16 = features.features.shaderInt16;
         m_Desc.shaderFeatures.nativeF16 = features12.shaderFloat16;
@@ -1304,17 +1394,48 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     RETURN_ON_BAD_VKRESULT(this, vkResult, "vmaCreateAllocator");
 
     ReportDeviceGroupInfo();
+    FillFormatCaps();
+
+    if (desc.enableBreadcrumbs) {
+        Result result = CreateBreadcrumbs();
+        if (result != Result::SUCCESS)
+            return result;
+    }
+
+    // Buffer addresses are known anyway, but texture addresses are reported only via "VK_EXT_device_address_binding_report"
+    if (m_IsResourceTrackingEnabled && m_IsSupported.addressBindingReport) {
+        VkDebugUtilsMessengerCreateInfoEXT messengerCreateInfo = {VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT};
+        messengerCreateInfo.pUserData = this;
+        messengerCreateInfo.pfnUserCallback = AddressBindingCallback;
+        messengerCreateInfo.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT;
+        messengerCreateInfo.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_DEVICE_ADDRESS_BINDING_BIT_EXT;
+
+        PFN_vkCreateDebugUtilsMessengerEXT vkCreateDebugUtilsMessengerEXT = (PFN_vkCreateDebugUtilsMessengerEXT)m_VK.GetInstanceProcAddr(m_Instance, "vkCreateDebugUtilsMessengerEXT");
+        if (vkCreateDebugUtilsMessengerEXT) {
+            vkResult = vkCreateDebugUtilsMessengerEXT(m_Instance, &messengerCreateInfo, m_AllocationCallbackPtr, &m_AddressBindingMessenger);
+            RETURN_ON_BAD_VKRESULT(this, vkResult, "vkCreateDebugUtilsMessengerEXT");
+        }
+    }
 
     return FillFunctionTable(m_iCore);
 }
 
-void DeviceVK::FillCreateInfo(const BufferDesc& bufferDesc, VkBufferCreateInfo& info) const {
+void DeviceVK::FillCreateInfo(const BufferDesc& bufferDesc, VkBufferCreateInfo& info, VkBufferUsageFlags2CreateInfoKHR& usage2) const {
     info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO; // should be already set
     info.size = bufferDesc.size;
     info.usage = GetBufferUsageFlags(bufferDesc.usage, bufferDesc.structureStride, m_IsSupported.deviceAddress);
     info.sharingMode = m_NumActiveFamilyIndices <= 1 ? VK_SHARING_MODE_EXCLUSIVE : VK_SHARING_MODE_CONCURRENT;
     info.queueFamilyIndexCount = m_NumActiveFamilyIndices;
     info.pQueueFamilyIndices = m_ActiveQueueFamilyIndices.data();
+
+    // "VK_BUFFER_USAGE_2_PREPROCESS_BUFFER_BIT_EXT" doesn't fit into "VkBufferUsageFlags" ("info.usage" gets ignored)
+    if ((bufferDesc.usage & BufferUsageBits::PREPROCESS_BUFFER) && m_Desc.features.indirectCommands) {
+        usage2.sType = VK_STRUCTURE_TYPE_BUFFER_USAGE_FLAGS_2_CREATE_INFO_KHR;
+        usage2.pNext = info.pNext;
+        usage2.usage = info.usage | VK_BUFFER_USAGE_2_PREPROCESS_BUFFER_BIT_EXT;
+
+        info.pNext = &usage2;
+    }
 }
 
 void DeviceVK::FillCreateInfo(const TextureDesc& textureDesc, VkImageCreateInfo& info) const {
@@ -1352,8 +1473,9 @@ void DeviceVK::FillCreateInfo(const TextureDesc& textureDesc, VkImageCreateInfo&
 }
 
 void DeviceVK::GetMemoryDesc2(const BufferDesc& bufferDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) const {
+    VkBufferUsageFlags2CreateInfoKHR usage2 = {VK_STRUCTURE_TYPE_BUFFER_USAGE_FLAGS_2_CREATE_INFO_KHR};
     VkBufferCreateInfo createInfo = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-    FillCreateInfo(bufferDesc, createInfo);
+    FillCreateInfo(bufferDesc, createInfo, usage2);
 
     VkMemoryDedicatedRequirements dedicatedRequirements = {VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS};
 
@@ -1435,6 +1557,7 @@ bool DeviceVK::GetMemoryTypeInfo(MemoryLocation memoryLocation, uint32_t memoryT
     if (memoryLocation == MemoryLocation::DEVICE) {
         neededFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
         undesiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+        desiredFlags = VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT; // only transient attachments can have such types in "memoryTypeMask"
     } else if (memoryLocation == MemoryLocation::DEVICE_UPLOAD) {
         neededFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
         undesiredFlags = VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
@@ -1721,6 +1844,311 @@ void DeviceVK::ReportDeviceGroupInfo() {
     }
 }
 
+Result DeviceVK::CreateBreadcrumbs() {
+    m_Breadcrumbs.resize(BREADCRUMB_MAX_NUM, {});
+
+    // Markers live in host memory to survive "device lost"
+    VkBufferCreateInfo bufferCreateInfo = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    bufferCreateInfo.size = BREADCRUMB_MAX_NUM * 2 * sizeof(uint32_t);
+    bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    VkResult vkResult = m_VK.CreateBuffer(m_Device, &bufferCreateInfo, m_AllocationCallbackPtr, &m_BreadcrumbBuffer);
+    RETURN_ON_BAD_VKRESULT(this, vkResult, "vkCreateBuffer");
+
+    VkBufferMemoryRequirementsInfo2 requirementsInfo = {VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2};
+    requirementsInfo.buffer = m_BreadcrumbBuffer;
+
+    VkMemoryRequirements2 requirements = {VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2};
+    m_VK.GetBufferMemoryRequirements2(m_Device, &requirementsInfo, &requirements);
+
+    // Must be "HOST_COHERENT": no "vkInvalidateMappedMemoryRanges" after "device lost" (cached is preferred for CPU reads)
+    constexpr VkMemoryPropertyFlags requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    uint32_t memoryTypeIndex = uint32_t(-1);
+    for (uint32_t i = 0; i < m_MemoryProps.memoryTypeCount; i++) {
+        VkMemoryPropertyFlags flags = m_MemoryProps.memoryTypes[i].propertyFlags;
+        if (!(requirements.memoryRequirements.memoryTypeBits & (1u << i)) || (flags & requiredFlags) != requiredFlags)
+            continue;
+
+        if (memoryTypeIndex == uint32_t(-1) || (flags & VK_MEMORY_PROPERTY_HOST_CACHED_BIT))
+            memoryTypeIndex = i;
+
+        if (flags & VK_MEMORY_PROPERTY_HOST_CACHED_BIT)
+            break;
+    }
+    RETURN_ON_FAILURE(this, memoryTypeIndex != uint32_t(-1), Result::UNSUPPORTED, "Can't find a 'HOST_COHERENT' memory type for breadcrumbs");
+
+    VkMemoryAllocateInfo memoryAllocateInfo = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+    memoryAllocateInfo.allocationSize = requirements.memoryRequirements.size;
+    memoryAllocateInfo.memoryTypeIndex = memoryTypeIndex;
+
+    vkResult = m_VK.AllocateMemory(m_Device, &memoryAllocateInfo, m_AllocationCallbackPtr, &m_BreadcrumbMemory);
+    RETURN_ON_BAD_VKRESULT(this, vkResult, "vkAllocateMemory");
+
+    VkBindBufferMemoryInfo bindBufferMemoryInfo = {VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO};
+    bindBufferMemoryInfo.buffer = m_BreadcrumbBuffer;
+    bindBufferMemoryInfo.memory = m_BreadcrumbMemory;
+
+    vkResult = m_VK.BindBufferMemory2(m_Device, 1, &bindBufferMemoryInfo);
+    RETURN_ON_BAD_VKRESULT(this, vkResult, "vkBindBufferMemory2");
+
+    void* markers = nullptr;
+    vkResult = m_VK.MapMemory(m_Device, m_BreadcrumbMemory, 0, VK_WHOLE_SIZE, 0, &markers);
+    RETURN_ON_BAD_VKRESULT(this, vkResult, "vkMapMemory");
+
+    memset(markers, 0, (size_t)bufferCreateInfo.size);
+    m_BreadcrumbMarkers = (const uint32_t*)markers;
+
+    if (!m_VK.CmdWriteBufferMarker2AMD)
+        REPORT_WARNING(this, "'VK_AMD_buffer_marker' is not supported, breadcrumbs use 'vkCmdFillBuffer' and are not written inside render passes");
+
+    return Result::SUCCESS;
+}
+
+void DeviceVK::DestroyBreadcrumbs() {
+    if (m_BreadcrumbBuffer)
+        m_VK.DestroyBuffer(m_Device, m_BreadcrumbBuffer, m_AllocationCallbackPtr);
+
+    if (m_BreadcrumbMemory)
+        m_VK.FreeMemory(m_Device, m_BreadcrumbMemory, m_AllocationCallbackPtr); // implicitly unmapped
+
+    m_BreadcrumbMarkers = nullptr;
+}
+
+uint32_t DeviceVK::AddBreadcrumb(const char* name, QueueType queueType) {
+    uint32_t id = m_BreadcrumbNextId++;
+    if (id == 0) // 0 is the initial marker value
+        id = m_BreadcrumbNextId++;
+
+    ExclusiveScope lock(m_BreadcrumbsLock);
+
+    BreadcrumbVK& breadcrumb = m_Breadcrumbs[id % BREADCRUMB_MAX_NUM];
+    breadcrumb.id = id;
+    breadcrumb.queueType = queueType;
+    breadcrumb.hasEnd = true;
+    snprintf(breadcrumb.name, sizeof(breadcrumb.name), "%s", name ? name : "");
+
+    return id;
+}
+
+void DeviceVK::SkipBreadcrumbEnd(uint32_t id) {
+    ExclusiveScope lock(m_BreadcrumbsLock);
+
+    BreadcrumbVK& breadcrumb = m_Breadcrumbs[id % BREADCRUMB_MAX_NUM];
+    if (breadcrumb.id == id)
+        breadcrumb.hasEnd = false;
+}
+
+void DeviceVK::TrackResource(VkObjectType objectType, uint64_t handle, uint64_t address, uint64_t size) {
+    if (!m_IsResourceTrackingEnabled || (objectType != VK_OBJECT_TYPE_BUFFER && objectType != VK_OBJECT_TYPE_IMAGE))
+        return;
+
+    ExclusiveScope lock(m_TrackedResourcesLock);
+
+    auto& trackedResources = objectType == VK_OBJECT_TYPE_BUFFER ? m_TrackedBuffers : m_TrackedTextures;
+    TrackedResourceVK& trackedResource = trackedResources[handle]; // a new one is zeroed
+    trackedResource.address = address;
+    trackedResource.size = size;
+}
+
+void DeviceVK::SetTrackedResourceName(VkObjectType objectType, uint64_t handle, const char* name) {
+    if (!m_IsResourceTrackingEnabled)
+        return;
+
+    ExclusiveScope lock(m_TrackedResourcesLock);
+
+    auto& trackedResources = objectType == VK_OBJECT_TYPE_BUFFER ? m_TrackedBuffers : m_TrackedTextures;
+    TrackedResourceVK& trackedResource = trackedResources[handle];
+    snprintf(trackedResource.name, sizeof(trackedResource.name), "%s", name ? name : "");
+}
+
+void DeviceVK::UntrackResource(VkObjectType objectType, uint64_t handle) {
+    if (!m_IsResourceTrackingEnabled || (objectType != VK_OBJECT_TYPE_BUFFER && objectType != VK_OBJECT_TYPE_IMAGE))
+        return;
+
+    ExclusiveScope lock(m_TrackedResourcesLock);
+
+    auto& trackedResources = objectType == VK_OBJECT_TYPE_BUFFER ? m_TrackedBuffers : m_TrackedTextures;
+    trackedResources.erase(handle);
+}
+
+const TrackedResourceVK* DeviceVK::FindTrackedResource(uint64_t address, bool& isTexture) const {
+    for (const auto& entry : m_TrackedBuffers) {
+        const TrackedResourceVK& trackedResource = entry.second;
+        if (trackedResource.address && address >= trackedResource.address && address < trackedResource.address + trackedResource.size) {
+            isTexture = false;
+            return &trackedResource;
+        }
+    }
+
+    for (const auto& entry : m_TrackedTextures) {
+        const TrackedResourceVK& trackedResource = entry.second;
+        if (trackedResource.address && address >= trackedResource.address && address < trackedResource.address + trackedResource.size) {
+            isTexture = true;
+            return &trackedResource;
+        }
+    }
+
+    return nullptr;
+}
+
+void DeviceVK::ReportDeviceLost() {
+    if (m_IsDeviceLostReported.exchange(true))
+        return;
+
+    ReportBreadcrumbs();
+    ReportDeviceFault();
+}
+
+void DeviceVK::ReportDeviceFault() {
+    if (!m_IsSupported.deviceFault)
+        return;
+
+    VkDeviceFaultCountsEXT faultCounts = {VK_STRUCTURE_TYPE_DEVICE_FAULT_COUNTS_EXT};
+    VkResult vkResult = m_VK.GetDeviceFaultInfoEXT(m_Device, &faultCounts, nullptr);
+    if (vkResult < 0) { // a device lost report must not abort
+        REPORT_ERROR_NO_ABORT(this, "vkGetDeviceFaultInfoEXT(): failed, result = 0x%08X (%d)!", vkResult, vkResult);
+        return;
+    }
+
+    Vector<VkDeviceFaultAddressInfoEXT> addressInfos(faultCounts.addressInfoCount, GetStdAllocator());
+    Vector<VkDeviceFaultVendorInfoEXT> vendorInfos(faultCounts.vendorInfoCount, GetStdAllocator());
+    Vector<uint8_t> vendorBinary((size_t)faultCounts.vendorBinarySize, GetStdAllocator());
+
+    VkDeviceFaultInfoEXT faultInfo = {VK_STRUCTURE_TYPE_DEVICE_FAULT_INFO_EXT};
+    faultInfo.pAddressInfos = addressInfos.data();
+    faultInfo.pVendorInfos = vendorInfos.data();
+    faultInfo.pVendorBinaryData = vendorBinary.data();
+
+    vkResult = m_VK.GetDeviceFaultInfoEXT(m_Device, &faultCounts, &faultInfo); // "faultCounts" gets updated
+    if (vkResult < 0) {
+        REPORT_ERROR_NO_ABORT(this, "vkGetDeviceFaultInfoEXT(): failed, result = 0x%08X (%d)!", vkResult, vkResult);
+        return;
+    }
+
+    static const char* addressTypeNames[] = {
+        "NONE",
+        "READ_INVALID",
+        "WRITE_INVALID",
+        "EXECUTE_INVALID",
+        "INSTRUCTION_POINTER_UNKNOWN",
+        "INSTRUCTION_POINTER_INVALID",
+        "INSTRUCTION_POINTER_FAULT",
+    };
+    static_assert(GetCountOf(addressTypeNames) == (size_t)DeviceFaultAddressType::MAX_NUM, "Unexpected number of address types");
+
+    Vector<DeviceFaultAddress> addresses(faultCounts.addressInfoCount, GetStdAllocator());
+    Vector<TrackedResourceVK> resources(faultCounts.addressInfoCount, GetStdAllocator()); // copies, since resources can be destroyed once the lock is released
+    {
+        ExclusiveScope lock(m_TrackedResourcesLock);
+
+        for (uint32_t i = 0; i < faultCounts.addressInfoCount; i++) {
+            const VkDeviceFaultAddressInfoEXT& addressInfo = addressInfos[i];
+            uint64_t precision = std::max(addressInfo.addressPrecision, (VkDeviceSize)1);
+
+            DeviceFaultAddress& address = addresses[i];
+            address.address = addressInfo.reportedAddress & ~(precision - 1); // see the spec
+            address.precision = precision;
+            address.type = (uint32_t)addressInfo.addressType < (uint32_t)DeviceFaultAddressType::MAX_NUM ? (DeviceFaultAddressType)addressInfo.addressType : DeviceFaultAddressType::NONE;
+
+            const TrackedResourceVK* trackedResource = FindTrackedResource(address.address, address.isTexture);
+            if (trackedResource) {
+                resources[i] = *trackedResource;
+                address.resourceName = resources[i].name;
+                address.resourceOffset = address.address - trackedResource->address;
+            }
+        }
+    }
+
+    // Report outside of the lock, callbacks may call back into NRI
+    REPORT_ERROR_NO_ABORT(this, "Device fault: %s", faultInfo.description);
+
+    for (uint32_t i = 0; i < faultCounts.addressInfoCount; i++) {
+        const DeviceFaultAddress& address = addresses[i];
+        if (address.resourceName) {
+            REPORT_ERROR_NO_ABORT(this, "  %s at 0x%llX (precision %llu): %s '%s' + %llu", addressTypeNames[(uint32_t)address.type], (unsigned long long)address.address, (unsigned long long)address.precision,
+                address.isTexture ? "texture" : "buffer", address.resourceName, (unsigned long long)address.resourceOffset);
+        } else {
+            REPORT_ERROR_NO_ABORT(this, "  %s at 0x%llX (precision %llu)", addressTypeNames[(uint32_t)address.type], (unsigned long long)address.address, (unsigned long long)address.precision);
+        }
+    }
+
+    Vector<DeviceFaultVendorInfo> vendorInfoDescs(faultCounts.vendorInfoCount, GetStdAllocator());
+    for (uint32_t i = 0; i < faultCounts.vendorInfoCount; i++) {
+        const VkDeviceFaultVendorInfoEXT& vendorInfo = vendorInfos[i];
+
+        DeviceFaultVendorInfo& vendorInfoDesc = vendorInfoDescs[i];
+        vendorInfoDesc.description = vendorInfo.description;
+        vendorInfoDesc.code = vendorInfo.vendorFaultCode;
+        vendorInfoDesc.data = vendorInfo.vendorFaultData;
+
+        REPORT_ERROR_NO_ABORT(this, "  Vendor: %s (code = 0x%llX, data = 0x%llX)", vendorInfo.description, (unsigned long long)vendorInfo.vendorFaultCode, (unsigned long long)vendorInfo.vendorFaultData);
+    }
+
+    if (m_CallbackInterface.DeviceFaultCallback) {
+        DeviceFaultDesc deviceFaultDesc = {};
+        deviceFaultDesc.description = faultInfo.description;
+        deviceFaultDesc.addresses = addresses.data();
+        deviceFaultDesc.addressNum = faultCounts.addressInfoCount;
+        deviceFaultDesc.vendorInfos = vendorInfoDescs.data();
+        deviceFaultDesc.vendorInfoNum = faultCounts.vendorInfoCount;
+        deviceFaultDesc.vendorBinary = faultCounts.vendorBinarySize ? vendorBinary.data() : nullptr;
+        deviceFaultDesc.vendorBinarySize = faultCounts.vendorBinarySize;
+
+        m_CallbackInterface.DeviceFaultCallback(deviceFaultDesc, m_CallbackInterface.userArg);
+    }
+}
+
+void DeviceVK::ReportBreadcrumbs() {
+    if (!m_BreadcrumbMarkers)
+        return;
+
+    static const char* queueTypeNames[] = {
+        "GRAPHICS",
+        "COMPUTE",
+        "COPY",
+    };
+    static_assert(GetCountOf(queueTypeNames) == (size_t)QueueType::MAX_NUM, "Unexpected number of queue types");
+
+    // Other threads may still be recording, take a snapshot to not report under the lock
+    Vector<BreadcrumbVK> breadcrumbs(GetStdAllocator());
+    {
+        ExclusiveScope lock(m_BreadcrumbsLock);
+        breadcrumbs = m_Breadcrumbs;
+    }
+
+    REPORT_ERROR_NO_ABORT(this, "Device lost! Breadcrumbs (ordered by recording, the execution order may differ):");
+
+    for (uint32_t i = 0; i < (uint32_t)QueueType::MAX_NUM; i++) {
+        // Queue annotations are host-side only
+        for (uint32_t j = 0; j < m_QueueFamilies[i].size(); j++) {
+            const QueueVK& queue = *m_QueueFamilies[i][j];
+            REPORT_ERROR_NO_ABORT(this, "  %s queue #%u: %u submits, the last batch = '%s'", queueTypeNames[i], j, queue.GetSubmitNum(), queue.GetSubmittedBatchName());
+        }
+
+        // Command buffer annotations
+        const BreadcrumbVK* lastCompleted = nullptr;
+        for (uint32_t j = 0; j < BREADCRUMB_MAX_NUM; j++) {
+            const BreadcrumbVK& breadcrumb = breadcrumbs[j];
+            if (breadcrumb.id == 0 || breadcrumb.queueType != (QueueType)i || !breadcrumb.hasEnd)
+                continue;
+
+            bool isBegun = m_BreadcrumbMarkers[j * 2] == breadcrumb.id;
+            bool isEnded = m_BreadcrumbMarkers[j * 2 + 1] == breadcrumb.id;
+
+            if (isEnded) {
+                if (!lastCompleted || breadcrumb.id > lastCompleted->id)
+                    lastCompleted = &breadcrumb;
+            } else if (isBegun) {
+                REPORT_ERROR_NO_ABORT(this, "  %s: in flight '%s' (#%u)", queueTypeNames[i], breadcrumb.name, breadcrumb.id);
+            }
+        }
+
+        if (lastCompleted)
+            REPORT_ERROR_NO_ABORT(this, "  %s: the last completed '%s' (#%u)", queueTypeNames[i], lastCompleted->name, lastCompleted->id);
+    }
+}
+
 #define MERGE_TOKENS2(a, b)    a##b
 #define MERGE_TOKENS3(a, b, c) a##b##c
 
@@ -1874,6 +2302,8 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
     GET_DEVICE_CORE_FUNC(BindImageMemory2);
     GET_DEVICE_CORE_FUNC(GetBufferMemoryRequirements2);
     GET_DEVICE_CORE_FUNC(GetImageMemoryRequirements2);
+    GET_DEVICE_CORE_FUNC(GetImageSparseMemoryRequirements2);
+    GET_DEVICE_CORE_FUNC(QueueBindSparse);
     GET_DEVICE_CORE_FUNC(ResetQueryPool);
     GET_DEVICE_CORE_FUNC(GetBufferDeviceAddress);
 
@@ -1982,6 +2412,22 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
         GET_DEVICE_FUNC(CmdDrawMeshTasksIndirectCountEXT);
     }
 
+    if (IsExtensionSupported(VK_EXT_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(CreateIndirectCommandsLayoutEXT);
+        GET_DEVICE_FUNC(DestroyIndirectCommandsLayoutEXT);
+        GET_DEVICE_FUNC(GetGeneratedCommandsMemoryRequirementsEXT);
+        GET_DEVICE_FUNC(CmdExecuteGeneratedCommandsEXT);
+    }
+
+    if (IsExtensionSupported(VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(SetDeviceMemoryPriorityEXT);
+    }
+
+    if (IsExtensionSupported(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(GetRefreshCycleDurationGOOGLE);
+        GET_DEVICE_FUNC(GetPastPresentationTimingGOOGLE);
+    }
+
     if (IsExtensionSupported(VK_NV_LOW_LATENCY_2_EXTENSION_NAME, desiredDeviceExts)) {
         GET_DEVICE_FUNC(GetLatencyTimingsNV);
         GET_DEVICE_FUNC(LatencySleepNV);
@@ -1989,6 +2435,14 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
         GET_DEVICE_FUNC(SetLatencySleepModeNV);
     }
 
+    if (IsExtensionSupported(VK_AMD_BUFFER_MARKER_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_OPTIONAL_CORE_FUNC(CmdWriteBufferMarker2AMD); // "synchronization2" flavor, can be absent
+    }
+
+    if (IsExtensionSupported(VK_EXT_DEVICE_FAULT_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(GetDeviceFaultInfoEXT);
+    }
+
     return Result::SUCCESS;
 }
 
@@ -2177,62 +2631,117 @@ NRI_INLINE Result DeviceVK::BindMicromapMemory(const BindMicromapMemoryDesc* bin
     if ((props3.bufferFeatures & (required)) == (required)) \
         supportBits |= bit;
 
-NRI_INLINE FormatSupportBits DeviceVK::GetFormatSupport(Format format) const {
-    FormatSupportBits supportBits = FormatSupportBits::UNSUPPORTED;
-    VkFormat vkFormat = GetVkFormat(format);
-
-    VkFormatProperties3 props3 = {VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3};
-    VkFormatProperties2 props2 = {VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2, &props3};
-    m_VK.GetPhysicalDeviceFormatProperties2(m_PhysicalDevice, vkFormat, &props2);
-
-    UPDATE_TEXTURE_SUPPORT_BITS(VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_BIT, FormatSupportBits::TEXTURE);
-    UPDATE_TEXTURE_SUPPORT_BITS(VK_FORMAT_FEATURE_2_STORAGE_IMAGE_BIT, FormatSupportBits::STORAGE_TEXTURE);
-    UPDATE_TEXTURE_SUPPORT_BITS(VK_FORMAT_FEATURE_2_COLOR_ATTACHMENT_BIT, FormatSupportBits::COLOR_ATTACHMENT);
-    UPDATE_TEXTURE_SUPPORT_BITS(VK_FORMAT_FEATURE_2_DEPTH_STENCIL_ATTACHMENT_BIT, FormatSupportBits::DEPTH_STENCIL_ATTACHMENT);
-    UPDATE_TEXTURE_SUPPORT_BITS(VK_FORMAT_FEATURE_2_COLOR_ATTACHMENT_BLEND_BIT, FormatSupportBits::BLEND);
-    UPDATE_TEXTURE_SUPPORT_BITS(VK_FORMAT_FEATURE_2_STORAGE_IMAGE_ATOMIC_BIT, FormatSupportBits::STORAGE_TEXTURE_ATOMICS);
-
-    UPDATE_BUFFER_SUPPORT_BITS(VK_FORMAT_FEATURE_2_UNIFORM_TEXEL_BUFFER_BIT, FormatSupportBits::BUFFER);
-    UPDATE_BUFFER_SUPPORT_BITS(VK_FORMAT_FEATURE_2_STORAGE_TEXEL_BUFFER_BIT, FormatSupportBits::STORAGE_BUFFER);
-    UPDATE_BUFFER_SUPPORT_BITS(VK_FORMAT_FEATURE_2_VERTEX_BUFFER_BIT, FormatSupportBits::VERTEX_BUFFER);
-    UPDATE_BUFFER_SUPPORT_BITS(VK_FORMAT_FEATURE_2_STORAGE_TEXEL_BUFFER_ATOMIC_BIT, FormatSupportBits::STORAGE_BUFFER_ATOMICS);
-
-    if ((props3.optimalTilingFeatures | props3.bufferFeatures) & VK_FORMAT_FEATURE_2_STORAGE_READ_WITHOUT_FORMAT_BIT)
-        supportBits |= FormatSupportBits::STORAGE_READ_WITHOUT_FORMAT;
-
-    if ((props3.optimalTilingFeatures | props3.bufferFeatures) & VK_FORMAT_FEATURE_2_STORAGE_WRITE_WITHOUT_FORMAT_BIT)
-        supportBits |= FormatSupportBits::STORAGE_WRITE_WITHOUT_FORMAT;
-
-    VkPhysicalDeviceImageFormatInfo2 imageInfo = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2};
-    imageInfo.format = vkFormat;
-    imageInfo.type = VK_IMAGE_TYPE_2D;
-    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
-    imageInfo.flags = 0; // TODO: kinda needed, but unknown here
-
-    imageInfo.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
-    if (supportBits & FormatSupportBits::TEXTURE)
-        imageInfo.usage |= VK_IMAGE_USAGE_SAMPLED_BIT;
-    if (supportBits & FormatSupportBits::DEPTH_STENCIL_ATTACHMENT)
-        imageInfo.usage |= VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
-    if (supportBits & FormatSupportBits::COLOR_ATTACHMENT)
-        imageInfo.usage |= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
-
-    VkImageFormatProperties2 imageProps = {VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2};
-    m_VK.GetPhysicalDeviceImageFormatProperties2(m_PhysicalDevice, &imageInfo, &imageProps);
-
-    if (imageProps.imageFormatProperties.sampleCounts & VK_SAMPLE_COUNT_2_BIT)
-        supportBits |= FormatSupportBits::MULTISAMPLE_2X;
-    if (imageProps.imageFormatProperties.sampleCounts & VK_SAMPLE_COUNT_4_BIT)
-        supportBits |= FormatSupportBits::MULTISAMPLE_4X;
-    if (imageProps.imageFormatProperties.sampleCounts & VK_SAMPLE_COUNT_8_BIT)
-        supportBits |= FormatSupportBits::MULTISAMPLE_8X;
-
-    return supportBits;
+void DeviceVK::FillFormatCaps() {
+    constexpr std::array<TextureUsageBits, (size_t)FormatSampleUsage::MAX_NUM> sampleUsages = {
+        TextureUsageBits::NONE,
+        TextureUsageBits::SHADER_RESOURCE,
+        TextureUsageBits::SHADER_RESOURCE_STORAGE,
+        TextureUsageBits::COLOR_ATTACHMENT,
+        TextureUsageBits::DEPTH_STENCIL_ATTACHMENT,
+    };
+
+    // "UNKNOWN" stays unsupported
+    for (uint32_t i = 1; i < (uint32_t)Format::MAX_NUM; i++) {
+        Format format = (Format)i;
+        FormatCaps& formatCaps = m_FormatCaps[i];
+
+        FormatSupportBits supportBits = FormatSupportBits::UNSUPPORTED;
+
+        VkFormatProperties3 props3 = {VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3};
+        VkFormatProperties2 props2 = {VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2, &props3};
+        m_VK.GetPhysicalDeviceFormatProperties2(m_PhysicalDevice, GetVkFormat(format), &props2);
+
+        UPDATE_TEXTURE_SUPPORT_BITS(VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_BIT, FormatSupportBits::TEXTURE);
+        UPDATE_TEXTURE_SUPPORT_BITS(VK_FORMAT_FEATURE_2_STORAGE_IMAGE_BIT, FormatSupportBits::STORAGE_TEXTURE);
+        UPDATE_TEXTURE_SUPPORT_BITS(VK_FORMAT_FEATURE_2_COLOR_ATTACHMENT_BIT, FormatSupportBits::COLOR_ATTACHMENT);
+        UPDATE_TEXTURE_SUPPORT_BITS(VK_FORMAT_FEATURE_2_DEPTH_STENCIL_ATTACHMENT_BIT, FormatSupportBits::DEPTH_STENCIL_ATTACHMENT);
+        UPDATE_TEXTURE_SUPPORT_BITS(VK_FORMAT_FEATURE_2_COLOR_ATTACHMENT_BLEND_BIT, FormatSupportBits::BLEND);
+        UPDATE_TEXTURE_SUPPORT_BITS(VK_FORMAT_FEATURE_2_STORAGE_IMAGE_ATOMIC_BIT, FormatSupportBits::STORAGE_TEXTURE_ATOMICS);
+
+        UPDATE_BUFFER_SUPPORT_BITS(VK_FORMAT_FEATURE_2_UNIFORM_TEXEL_BUFFER_BIT, FormatSupportBits::BUFFER);
+        UPDATE_BUFFER_SUPPORT_BITS(VK_FORMAT_FEATURE_2_STORAGE_TEXEL_BUFFER_BIT, FormatSupportBits::STORAGE_BUFFER);
+        UPDATE_BUFFER_SUPPORT_BITS(VK_FORMAT_FEATURE_2_VERTEX_BUFFER_BIT, FormatSupportBits::VERTEX_BUFFER);
+        UPDATE_BUFFER_SUPPORT_BITS(VK_FORMAT_FEATURE_2_STORAGE_TEXEL_BUFFER_ATOMIC_BIT, FormatSupportBits::STORAGE_BUFFER_ATOMICS);
+
+        if ((props3.optimalTilingFeatures | props3.bufferFeatures) & VK_FORMAT_FEATURE_2_STORAGE_READ_WITHOUT_FORMAT_BIT)
+            supportBits |= FormatSupportBits::STORAGE_READ_WITHOUT_FORMAT;
+
+        if ((props3.optimalTilingFeatures | props3.bufferFeatures) & VK_FORMAT_FEATURE_2_STORAGE_WRITE_WITHOUT_FORMAT_BIT)
+            supportBits |= FormatSupportBits::STORAGE_WRITE_WITHOUT_FORMAT;
+
+        // Sample counts per usage, image create flags are known since "FillCreateInfo" is used
+        for (uint32_t j = 0; j < (uint32_t)FormatSampleUsage::MAX_NUM; j++) {
+            TextureDesc textureDesc = {};
+            textureDesc.type = TextureType::TEXTURE_2D;
+            textureDesc.usage = sampleUsages[j];
+            textureDesc.format = format;
+            textureDesc.width = 1;
+            textureDesc.height = 1;
+            textureDesc.depth = 1;
+            textureDesc.mipNum = 1;
+            textureDesc.layerNum = 1;
+            textureDesc.sampleNum = 1;
+
+            VkImageCreateInfo createInfo = {VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+            FillCreateInfo(textureDesc, createInfo);
+
+            VkPhysicalDeviceImageFormatInfo2 imageInfo = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2};
+            imageInfo.format = createInfo.format;
+            imageInfo.type = createInfo.imageType;
+            imageInfo.tiling = createInfo.tiling;
+            imageInfo.usage = createInfo.usage;
+            imageInfo.flags = createInfo.flags;
+
+            VkImageFormatProperties2 imageProps = {VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2};
+            VkResult vkResult = m_VK.GetPhysicalDeviceImageFormatProperties2(m_PhysicalDevice, &imageInfo, &imageProps);
+
+            formatCaps.sampleCounts[j] = vkResult == VK_SUCCESS ? imageProps.imageFormatProperties.sampleCounts : 0;
+        }
+
+        // MSAA is reported for the typical combination of supported texture usages
+        TextureUsageBits usage = TextureUsageBits::NONE;
+        if (supportBits & FormatSupportBits::TEXTURE)
+            usage |= TextureUsageBits::SHADER_RESOURCE;
+        if (supportBits & FormatSupportBits::COLOR_ATTACHMENT)
+            usage |= TextureUsageBits::COLOR_ATTACHMENT;
+        if (supportBits & FormatSupportBits::DEPTH_STENCIL_ATTACHMENT)
+            usage |= TextureUsageBits::DEPTH_STENCIL_ATTACHMENT;
+
+        formatCaps.supportBits = supportBits;
+
+        VkSampleCountFlags sampleCounts = GetSampleCounts(format, usage);
+        if (sampleCounts & VK_SAMPLE_COUNT_2_BIT)
+            formatCaps.supportBits |= FormatSupportBits::MULTISAMPLE_2X;
+        if (sampleCounts & VK_SAMPLE_COUNT_4_BIT)
+            formatCaps.supportBits |= FormatSupportBits::MULTISAMPLE_4X;
+        if (sampleCounts & VK_SAMPLE_COUNT_8_BIT)
+            formatCaps.supportBits |= FormatSupportBits::MULTISAMPLE_8X;
+    }
 }
 
 #undef UPDATE_TEXTURE_SUPPORT_BITS
 #undef UPDATE_BUFFER_SUPPORT_BITS
 
+VkSampleCountFlags DeviceVK::GetSampleCounts(Format format, TextureUsageBits usage) const {
+    const FormatCaps& formatCaps = m_FormatCaps[(size_t)format];
+
+    VkSampleCountFlags sampleCounts = formatCaps.sampleCounts[(size_t)FormatSampleUsage::NONE];
+    if (usage & TextureUsageBits::SHADER_RESOURCE)
+        sampleCounts &= formatCaps.sampleCounts[(size_t)FormatSampleUsage::SHADER_RESOURCE];
+    if (usage & TextureUsageBits::SHADER_RESOURCE_STORAGE)
+        sampleCounts &= formatCaps.sampleCounts[(size_t)FormatSampleUsage::SHADER_RESOURCE_STORAGE];
+    if (usage & TextureUsageBits::COLOR_ATTACHMENT)
+        sampleCounts &= formatCaps.sampleCounts[(size_t)FormatSampleUsage::COLOR_ATTACHMENT];
+    if (usage & TextureUsageBits::DEPTH_STENCIL_ATTACHMENT)
+        sampleCounts &= formatCaps.sampleCounts[(size_t)FormatSampleUsage::DEPTH_STENCIL_ATTACHMENT];
+
+    return sampleCounts;
+}
+
+NRI_INLINE FormatSupportBits DeviceVK::GetFormatSupport(Format format) const {
+    return m_FormatCaps[(size_t)format].supportBits;
+}
+
 NRI_INLINE Result DeviceVK::QueryVideoMemoryInfo(MemoryLocation memoryLocation, VideoMemoryInfo& videoMemoryInfo) const {
     videoMemoryInfo = {};
 
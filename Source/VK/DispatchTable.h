@@ -111,6 +111,8 @@ struct DispatchTable {
     VK_FUNC(BindImageMemory2);                            // + | +
     VK_FUNC(GetBufferMemoryRequirements2);                // + | +
     VK_FUNC(GetImageMemoryRequirements2);                 // + | +
+    VK_FUNC(GetImageSparseMemoryRequirements2);           // + | +
+    VK_FUNC(QueueBindSparse);                             // - | + may return "VK_ERROR_DEVICE_LOST"
     VK_FUNC(GetDeviceBufferMemoryRequirements);           // + | +
     VK_FUNC(GetDeviceImageMemoryRequirements);            // + | +
     VK_FUNC(ResetQueryPool);                              // + | +
@@ -193,11 +195,25 @@ struct DispatchTable {
     VK_FUNC(CmdDrawMeshTasksEXT);                         // - | +
     VK_FUNC(CmdDrawMeshTasksIndirectEXT);                 // - | +
     VK_FUNC(CmdDrawMeshTasksIndirectCountEXT);            // - | +
+                                                          // VK_EXT_device_generated_commands
+    VK_FUNC(CreateIndirectCommandsLayoutEXT);             // + | +
+    VK_FUNC(DestroyIndirectCommandsLayoutEXT);            // - | +
+    VK_FUNC(GetGeneratedCommandsMemoryRequirementsEXT);   // - | +
+    VK_FUNC(CmdExecuteGeneratedCommandsEXT);              // - | +
+                                                          // VK_EXT_pageable_device_local_memory
+    VK_FUNC(SetDeviceMemoryPriorityEXT);                  // - | +
+                                                          // VK_GOOGLE_display_timing
+    VK_FUNC(GetRefreshCycleDurationGOOGLE);               // + | ? may return "VK_ERROR_DEVICE_LOST"
+    VK_FUNC(GetPastPresentationTimingGOOGLE);             // + | ? may return "VK_ERROR_DEVICE_LOST"
                                                           // VK_NV_low_latency2
     VK_FUNC(GetLatencyTimingsNV);                         // + | +
     VK_FUNC(LatencySleepNV);                              // + | +
     VK_FUNC(SetLatencyMarkerNV);                          // + | +
     VK_FUNC(SetLatencySleepModeNV);                       // + | +
+                                                          // VK_AMD_buffer_marker
+    VK_FUNC(CmdWriteBufferMarker2AMD);                    // - | +
+                                                          // VK_EXT_device_fault
+    VK_FUNC(GetDeviceFaultInfoEXT);                       // - | +
 };
 
 #undef VK_FUNC
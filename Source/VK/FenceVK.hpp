@@ -43,11 +43,15 @@ NRI_INLINE uint64_t FenceVK::GetFenceValue() const {
 }
 
 NRI_INLINE void FenceVK::Wait(uint64_t value) {
+    TRACE_SCOPE(&m_Device, "FenceWait");
+    m_Device.Count(Counter::HOST_WAIT);
+
     VkSemaphoreWaitInfo semaphoreWaitInfo = {VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO};
     semaphoreWaitInfo.semaphoreCount = 1;
     semaphoreWaitInfo.pSemaphores = &m_Handle;
     semaphoreWaitInfo.pValues = &value;
 
     const auto& vk = m_Device.GetDispatchTable();
-    vk.WaitSemaphores((VkDevice)m_Device, &semaphoreWaitInfo, MsToUs(TIMEOUT_FENCE));
+    VkResult vkResult = vk.WaitSemaphores((VkDevice)m_Device, &semaphoreWaitInfo, MsToUs(TIMEOUT_FENCE));
+    m_Device.CheckDeviceLost(vkResult);
 }
@@ -6,6 +6,7 @@
 #include "BufferVK.h"
 #include "CommandAllocatorVK.h"
 #include "CommandBufferVK.h"
+#include "CommandSignatureVK.h"
 #include "ConversionVK.h"
 #include "DescriptorPoolVK.h"
 #include "DescriptorSetVK.h"
@@ -20,8 +21,14 @@
 #include "SwapChainVK.h"
 #include "TextureVK.h"
 
+#include "HeadlessSwapChain.h"
 #include "HelperInterface.h"
 #include "ImguiInterface.h"
+#include "MicromapBakerInterface.h"
+#include "ProfilerInterface.h"
+#include "RenderGraphInterface.h"
+#include "ResidencyInterface.h"
+#include "SparseInterface.h"
 #include "StreamerInterface.h"
 #include "UpscalerInterface.h"
 
@@ -31,6 +38,7 @@ using namespace nri;
 #include "BufferVK.hpp"
 #include "CommandAllocatorVK.hpp"
 #include "CommandBufferVK.hpp"
+#include "CommandSignatureVK.hpp"
 #include "ConversionVK.hpp"
 #include "DescriptorPoolVK.hpp"
 #include "DescriptorSetVK.hpp"
@@ -44,6 +52,7 @@ using namespace nri;
 #include "QueryPoolVK.hpp"
 #include "QueueVK.hpp"
 #include "ResourceAllocatorVK.hpp"
+#include "SparseVK.hpp"
 #include "SwapChainVK.hpp"
 #include "TextureVK.hpp"
 
@@ -87,6 +96,14 @@ static uint64_t NRI_CALL GetFenceValue(Fence& fence) {
     return ((FenceVK&)fence).GetFenceValue();
 }
 
+static uint64_t NRI_CALL GetBufferDeviceAddress(const Buffer& buffer) {
+    return ((BufferVK&)buffer).GetDeviceAddress();
+}
+
+static void NRI_CALL GetDeviceStatistics(const Device& device, DeviceStatistics& deviceStatistics) {
+    ((const DeviceBase&)device).GetStatistics(deviceStatistics);
+}
+
 static void NRI_CALL GetBufferMemoryDesc(const Buffer& buffer, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
     ((BufferVK&)buffer).GetMemoryDesc(memoryLocation, memoryDesc);
 }
@@ -173,43 +190,43 @@ static Result NRI_CALL CreateTexture3DView(const Texture3DViewDesc& textureViewD
 }
 
 static void NRI_CALL DestroyCommandAllocator(CommandAllocator* commandAllocator) {
-    Destroy((CommandAllocatorVK*)commandAllocator);
+    DestroyObject<CommandAllocator>((CommandAllocatorVK*)commandAllocator);
 }
 
 static void NRI_CALL DestroyCommandBuffer(CommandBuffer* commandBuffer) {
-    Destroy((CommandBufferVK*)commandBuffer);
+    DestroyObject<CommandBuffer>((CommandBufferVK*)commandBuffer);
 }
 
 static void NRI_CALL DestroyDescriptorPool(DescriptorPool* descriptorPool) {
-    Destroy((DescriptorPoolVK*)descriptorPool);
+    DestroyObject<DescriptorPool>((DescriptorPoolVK*)descriptorPool);
 }
 
 static void NRI_CALL DestroyBuffer(Buffer* buffer) {
-    Destroy((BufferVK*)buffer);
+    DestroyObject<Buffer>((BufferVK*)buffer);
 }
 
 static void NRI_CALL DestroyTexture(Texture* texture) {
-    Destroy((TextureVK*)texture);
+    DestroyObject<Texture>((TextureVK*)texture);
 }
 
 static void NRI_CALL DestroyDescriptor(Descriptor* descriptor) {
-    Destroy((DescriptorVK*)descriptor);
+    DestroyObject<Descriptor>((DescriptorVK*)descriptor);
 }
 
 static void NRI_CALL DestroyPipelineLayout(PipelineLayout* pipelineLayout) {
-    Destroy((PipelineLayoutVK*)pipelineLayout);
+    DestroyObject<PipelineLayout>((PipelineLayoutVK*)pipelineLayout);
 }
 
 static void NRI_CALL DestroyPipeline(Pipeline* pipeline) {
-    Destroy((PipelineVK*)pipeline);
+    DestroyObject<Pipeline>((PipelineVK*)pipeline);
 }
 
 static void NRI_CALL DestroyQueryPool(QueryPool* queryPool) {
-    Destroy((QueryPoolVK*)queryPool);
+    DestroyObject<QueryPool>((QueryPoolVK*)queryPool);
 }
 
 static void NRI_CALL DestroyFence(Fence* fence) {
-    Destroy((FenceVK*)fence);
+    DestroyObject<Fence>((FenceVK*)fence);
 }
 
 static Result NRI_CALL AllocateMemory(Device& device, const AllocateMemoryDesc& allocateMemoryDesc, Memory*& memory) {
@@ -225,7 +242,7 @@ static Result NRI_CALL BindTextureMemory(Device& device, const BindTextureMemory
 }
 
 static void NRI_CALL FreeMemory(Memory* memory) {
-    Destroy((MemoryVK*)memory);
+    DestroyObject<Memory>((MemoryVK*)memory);
 }
 
 static Result NRI_CALL BeginCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool* descriptorPool) {
@@ -299,6 +316,10 @@ static void NRI_CALL CmdSetDepthBias(CommandBuffer& commandBuffer, const DepthBi
     ((CommandBufferVK&)commandBuffer).SetDepthBias(depthBiasDesc);
 }
 
+static Result NRI_CALL CreateTransientAttachmentView(CommandBuffer& commandBuffer, const Texture2DViewDesc& textureViewDesc, Descriptor*& textureView) {
+    return ((CommandBufferVK&)commandBuffer).CreateTransientAttachmentView(textureViewDesc, textureView);
+}
+
 static void NRI_CALL CmdBeginRendering(CommandBuffer& commandBuffer, const AttachmentsDesc& attachmentsDesc) {
     ((CommandBufferVK&)commandBuffer).BeginRendering(attachmentsDesc);
 }
@@ -351,6 +372,18 @@ static void NRI_CALL CmdReadbackTextureToBuffer(CommandBuffer& commandBuffer, Bu
     ((CommandBufferVK&)commandBuffer).ReadbackTextureToBuffer(dstBuffer, dstDataLayout, srcTexture, srcRegion);
 }
 
+static void NRI_CALL CmdCopyBufferRegions(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferVK&)commandBuffer).CopyBufferRegions(dstBuffer, srcBuffer, regions, regionNum);
+}
+
+static void NRI_CALL CmdUploadBufferToTextureRegions(CommandBuffer& commandBuffer, Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferVK&)commandBuffer).UploadBufferToTextureRegions(dstTexture, srcBuffer, regions, regionNum);
+}
+
+static void NRI_CALL CmdReadbackTextureToBufferRegions(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferVK&)commandBuffer).ReadbackTextureToBufferRegions(dstBuffer, srcTexture, regions, regionNum);
+}
+
 static void NRI_CALL CmdZeroBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, uint64_t size) {
     ((CommandBufferVK&)commandBuffer).ZeroBuffer(buffer, offset, size);
 }
@@ -603,6 +636,7 @@ Result DeviceVK::FillFunctionTable(CoreInterface& table) const {
     table.CmdSetSampleLocations = ::CmdSetSampleLocations;
     table.CmdSetShadingRate = ::CmdSetShadingRate;
     table.CmdSetDepthBias = ::CmdSetDepthBias;
+    table.CreateTransientAttachmentView = ::CreateTransientAttachmentView;
     table.CmdBeginRendering = ::CmdBeginRendering;
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
@@ -616,6 +650,9 @@ Result DeviceVK::FillFunctionTable(CoreInterface& table) const {
     table.CmdCopyTexture = ::CmdCopyTexture;
     table.CmdUploadBufferToTexture = ::CmdUploadBufferToTexture;
     table.CmdReadbackTextureToBuffer = ::CmdReadbackTextureToBuffer;
+    table.CmdCopyBufferRegions = ::CmdCopyBufferRegions;
+    table.CmdUploadBufferToTextureRegions = ::CmdUploadBufferToTextureRegions;
+    table.CmdReadbackTextureToBufferRegions = ::CmdReadbackTextureToBufferRegions;
     table.CmdZeroBuffer = ::CmdZeroBuffer;
     table.CmdResolveTexture = ::CmdResolveTexture;
     table.CmdClearStorage = ::CmdClearStorage;
@@ -636,6 +673,8 @@ Result DeviceVK::FillFunctionTable(CoreInterface& table) const {
     table.QueueSubmit = ::QueueSubmit;
     table.Wait = ::Wait;
     table.GetFenceValue = ::GetFenceValue;
+    table.GetBufferDeviceAddress = ::GetBufferDeviceAddress;
+    table.GetDeviceStatistics = ::GetDeviceStatistics;
     table.UpdateDescriptorRanges = ::UpdateDescriptorRanges;
     table.UpdateDynamicConstantBuffers = ::UpdateDynamicConstantBuffers;
     table.CopyDescriptorSet = ::CopyDescriptorSet;
@@ -682,15 +721,98 @@ static Result NRI_CALL AllocateAndBindMemory(Device& device, const ResourceGroup
     return allocator.AllocateAndBindMemory(resourceGroupDesc, allocations);
 }
 
+static Result NRI_CALL CreateResourceGroup(Device& device, const ResourceGroupCreationDesc& resourceGroupCreationDesc, Texture** textures, Buffer** buffers, Memory** allocations, uint32_t& allocationNum, uint64_t& allocationSize) {
+    DeviceVK& deviceVK = (DeviceVK&)device;
+    HelperDeviceMemoryAllocator allocator(deviceVK.GetCoreInterface(), device);
+
+    return allocator.CreateResourceGroup(resourceGroupCreationDesc, textures, buffers, allocations, allocationNum, allocationSize);
+}
+
 static Result NRI_CALL QueryVideoMemoryInfo(const Device& device, MemoryLocation memoryLocation, VideoMemoryInfo& videoMemoryInfo) {
     return ((DeviceVK&)device).QueryVideoMemoryInfo(memoryLocation, videoMemoryInfo);
 }
 
+static Result NRI_CALL CreateMemoryPool(Device& device, const MemoryPoolDesc& memoryPoolDesc, MemoryPool*& memoryPool) {
+    DeviceVK& deviceVK = (DeviceVK&)device;
+    MemoryPoolImpl* impl = Allocate<MemoryPoolImpl>(deviceVK.GetAllocationCallbacks(), device, deviceVK.GetCoreInterface());
+    Result result = impl->Create(memoryPoolDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        memoryPool = nullptr;
+    } else
+        memoryPool = (MemoryPool*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyMemoryPool(MemoryPool* memoryPool) {
+    Destroy((MemoryPoolImpl*)memoryPool);
+}
+
+static Result NRI_CALL AllocatePooledBufferMemory(MemoryPool& memoryPool, Buffer& buffer, MemoryLocation memoryLocation, uint32_t& allocation) {
+    return ((MemoryPoolImpl&)memoryPool).AllocateBufferMemory(buffer, memoryLocation, allocation);
+}
+
+static Result NRI_CALL AllocatePooledTextureMemory(MemoryPool& memoryPool, Texture& texture, MemoryLocation memoryLocation, uint32_t& allocation) {
+    return ((MemoryPoolImpl&)memoryPool).AllocateTextureMemory(texture, memoryLocation, allocation);
+}
+
+static void NRI_CALL FreePooledMemory(MemoryPool& memoryPool, uint32_t allocation) {
+    ((MemoryPoolImpl&)memoryPool).Free(allocation);
+}
+
+static void NRI_CALL GetMemoryPoolStatistics(const MemoryPool& memoryPool, MemoryPoolStatistics& memoryPoolStatistics) {
+    ((MemoryPoolImpl&)memoryPool).GetStatistics(memoryPoolStatistics);
+}
+
+static Result NRI_CALL CreateTexturePool(Device& device, const TexturePoolDesc& texturePoolDesc, TexturePool*& texturePool) {
+    DeviceVK& deviceVK = (DeviceVK&)device;
+    TexturePoolImpl* impl = Allocate<TexturePoolImpl>(deviceVK.GetAllocationCallbacks(), device, deviceVK.GetCoreInterface());
+    Result result = impl->Create(texturePoolDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        texturePool = nullptr;
+    } else
+        texturePool = (TexturePool*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyTexturePool(TexturePool* texturePool) {
+    Destroy((TexturePoolImpl*)texturePool);
+}
+
+static Result NRI_CALL AcquirePooledTexture(TexturePool& texturePool, const TextureDesc& textureDesc, PooledTexture& pooledTexture) {
+    return ((TexturePoolImpl&)texturePool).Acquire(textureDesc, pooledTexture);
+}
+
+static void NRI_CALL ReleasePooledTexture(TexturePool& texturePool, uint32_t handle, Fence* fence, uint64_t value) {
+    ((TexturePoolImpl&)texturePool).Release(handle, fence, value);
+}
+
+static void NRI_CALL GetTexturePoolStatistics(const TexturePool& texturePool, TexturePoolStatistics& texturePoolStatistics) {
+    ((TexturePoolImpl&)texturePool).GetStatistics(texturePoolStatistics);
+}
+
 Result DeviceVK::FillFunctionTable(HelperInterface& table) const {
     table.CalculateAllocationNumber = ::CalculateAllocationNumber;
     table.AllocateAndBindMemory = ::AllocateAndBindMemory;
+    table.CreateResourceGroup = ::CreateResourceGroup;
     table.UploadData = ::UploadData;
     table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.CreateMemoryPool = ::CreateMemoryPool;
+    table.DestroyMemoryPool = ::DestroyMemoryPool;
+    table.AllocatePooledBufferMemory = ::AllocatePooledBufferMemory;
+    table.AllocatePooledTextureMemory = ::AllocatePooledTextureMemory;
+    table.FreePooledMemory = ::FreePooledMemory;
+    table.GetMemoryPoolStatistics = ::GetMemoryPoolStatistics;
+    table.CreateTexturePool = ::CreateTexturePool;
+    table.DestroyTexturePool = ::DestroyTexturePool;
+    table.AcquirePooledTexture = ::AcquirePooledTexture;
+    table.ReleasePooledTexture = ::ReleasePooledTexture;
+    table.GetTexturePoolStatistics = ::GetTexturePoolStatistics;
 
     return Result::SUCCESS;
 }
@@ -745,6 +867,59 @@ Result DeviceVK::FillFunctionTable(ImguiInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  IndirectCommands  ]
+
+static Result NRI_CALL CreateCommandSignature(Device& device, const CommandSignatureDesc& commandSignatureDesc, CommandSignature*& commandSignature) {
+    DeviceVK& deviceVK = (DeviceVK&)device;
+    CommandSignatureVK* impl = Allocate<CommandSignatureVK>(deviceVK.GetAllocationCallbacks(), deviceVK);
+    Result result = impl->Create(commandSignatureDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        commandSignature = nullptr;
+    } else
+        commandSignature = (CommandSignature*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyCommandSignature(CommandSignature* commandSignature) {
+    Destroy((CommandSignatureVK*)commandSignature);
+}
+
+static uint32_t NRI_CALL GetCommandSignatureStride(const CommandSignature& commandSignature) {
+    return ((CommandSignatureVK&)commandSignature).GetStride();
+}
+
+static uint32_t NRI_CALL GetIndirectArgumentOffset(const CommandSignature& commandSignature, uint32_t argumentIndex) {
+    return ((CommandSignatureVK&)commandSignature).GetArgumentOffset(argumentIndex);
+}
+
+static uint64_t NRI_CALL GetCommandSignaturePreprocessSize(const CommandSignature& commandSignature, const Pipeline& pipeline, uint32_t commandMaxNum) {
+    return ((CommandSignatureVK&)commandSignature).GetPreprocessSize(pipeline, commandMaxNum);
+}
+
+static void NRI_CALL CmdExecuteIndirect(CommandBuffer& commandBuffer, const ExecuteIndirectDesc& executeIndirectDesc) {
+    ((CommandBufferVK&)commandBuffer).ExecuteIndirect(executeIndirectDesc);
+}
+
+Result DeviceVK::FillFunctionTable(IndirectCommandsInterface& table) const {
+    if (!m_Desc.features.indirectCommands)
+        return Result::UNSUPPORTED;
+
+    table.CreateCommandSignature = ::CreateCommandSignature;
+    table.DestroyCommandSignature = ::DestroyCommandSignature;
+    table.GetCommandSignatureStride = ::GetCommandSignatureStride;
+    table.GetIndirectArgumentOffset = ::GetIndirectArgumentOffset;
+    table.GetCommandSignaturePreprocessSize = ::GetCommandSignaturePreprocessSize;
+    table.CmdExecuteIndirect = ::CmdExecuteIndirect;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  Low latency  ]
 
@@ -801,6 +976,116 @@ Result DeviceVK::FillFunctionTable(MeshShaderInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  MicromapBaker  ]
+
+static Result NRI_CALL CreateMicromapBaker(Device& device, const MicromapBakerDesc& micromapBakerDesc, MicromapBaker*& micromapBaker) {
+    DeviceVK& deviceVK = (DeviceVK&)device;
+    MicromapBakerImpl* impl = Allocate<MicromapBakerImpl>(deviceVK.GetAllocationCallbacks(), device);
+    Result result = impl->Create(micromapBakerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        micromapBaker = nullptr;
+    } else
+        micromapBaker = (MicromapBaker*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyMicromapBaker(MicromapBaker* micromapBaker) {
+    Destroy((MicromapBakerImpl*)micromapBaker);
+}
+
+static Result NRI_CALL BakeMicromap(MicromapBaker& micromapBaker, const MicromapBakeDesc& micromapBakeDesc, MicromapBakeResult& micromapBakeResult) {
+    return ((MicromapBakerImpl&)micromapBaker).Bake(micromapBakeDesc, micromapBakeResult);
+}
+
+Result DeviceVK::FillFunctionTable(MicromapBakerInterface& table) const {
+    table.CreateMicromapBaker = ::CreateMicromapBaker;
+    table.DestroyMicromapBaker = ::DestroyMicromapBaker;
+    table.BakeMicromap = ::BakeMicromap;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Profiler  ]
+
+static Result NRI_CALL CreateProfiler(Device& device, const ProfilerDesc& profilerDesc, Profiler*& profiler) {
+    DeviceVK& deviceVK = (DeviceVK&)device;
+    ProfilerImpl* impl = Allocate<ProfilerImpl>(deviceVK.GetAllocationCallbacks(), device, deviceVK.GetCoreInterface());
+    Result result = impl->Create(profilerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        profiler = nullptr;
+    } else
+        profiler = (Profiler*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyProfiler(Profiler* profiler) {
+    Destroy((ProfilerImpl*)profiler);
+}
+
+static void NRI_CALL CmdBeginProfilerFrame(CommandBuffer& commandBuffer, Profiler& profiler) {
+    ((ProfilerImpl&)profiler).CmdBeginFrame(commandBuffer);
+}
+
+static void NRI_CALL CmdEndProfilerFrame(CommandBuffer& commandBuffer, Profiler& profiler) {
+    ((ProfilerImpl&)profiler).CmdEndFrame(commandBuffer);
+}
+
+static void NRI_CALL CmdBeginProfilerRange(CommandBuffer& commandBuffer, Profiler& profiler, const char* name, uint32_t bgra) {
+    ((ProfilerImpl&)profiler).CmdBeginRange(commandBuffer, name, bgra);
+}
+
+static void NRI_CALL CmdEndProfilerRange(CommandBuffer& commandBuffer, Profiler& profiler) {
+    ((ProfilerImpl&)profiler).CmdEndRange(commandBuffer);
+}
+
+static void NRI_CALL CmdBeginProfilerStatistics(CommandBuffer& commandBuffer, Profiler& profiler, const char* name) {
+    ((ProfilerImpl&)profiler).CmdBeginStatistics(commandBuffer, name);
+}
+
+static void NRI_CALL CmdEndProfilerStatistics(CommandBuffer& commandBuffer, Profiler& profiler) {
+    ((ProfilerImpl&)profiler).CmdEndStatistics(commandBuffer);
+}
+
+static void NRI_CALL EndProfilerFrame(Profiler& profiler) {
+    ((ProfilerImpl&)profiler).EndFrame();
+}
+
+static const ProfilerRange* NRI_CALL GetProfilerRanges(const Profiler& profiler, uint32_t& rangeNum) {
+    return ((ProfilerImpl&)profiler).GetRanges(rangeNum);
+}
+
+static const ProfilerStatistics* NRI_CALL GetProfilerStatistics(const Profiler& profiler, uint32_t& statisticsNum) {
+    return ((ProfilerImpl&)profiler).GetStatistics(statisticsNum);
+}
+
+Result DeviceVK::FillFunctionTable(ProfilerInterface& table) const {
+    table.CreateProfiler = ::CreateProfiler;
+    table.DestroyProfiler = ::DestroyProfiler;
+    table.CmdBeginProfilerFrame = ::CmdBeginProfilerFrame;
+    table.CmdEndProfilerFrame = ::CmdEndProfilerFrame;
+    table.CmdBeginProfilerRange = ::CmdBeginProfilerRange;
+    table.CmdEndProfilerRange = ::CmdEndProfilerRange;
+    table.CmdBeginProfilerStatistics = ::CmdBeginProfilerStatistics;
+    table.CmdEndProfilerStatistics = ::CmdEndProfilerStatistics;
+    table.EndProfilerFrame = ::EndProfilerFrame;
+    table.GetProfilerRanges = ::GetProfilerRanges;
+    table.GetProfilerStatistics = ::GetProfilerStatistics;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  RayTracing  ]
 
@@ -846,11 +1131,11 @@ static Buffer* NRI_CALL GetMicromapBuffer(const Micromap& micromap) {
 }
 
 static void NRI_CALL DestroyAccelerationStructure(AccelerationStructure* accelerationStructure) {
-    Destroy((AccelerationStructureVK*)accelerationStructure);
+    DestroyObject<AccelerationStructure>((AccelerationStructureVK*)accelerationStructure);
 }
 
 static void NRI_CALL DestroyMicromap(Micromap* micromap) {
-    Destroy((MicromapVK*)micromap);
+    DestroyObject<Micromap>((MicromapVK*)micromap);
 }
 
 static void NRI_CALL GetAccelerationStructureMemoryDesc(const AccelerationStructure& accelerationStructure, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
@@ -971,6 +1256,184 @@ Result DeviceVK::FillFunctionTable(RayTracingInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  RenderGraph  ]
+
+static Result NRI_CALL CreateRenderGraph(Device& device, const RenderGraphDesc& renderGraphDesc, RenderGraph*& renderGraph) {
+    DeviceVK& deviceVK = (DeviceVK&)device;
+    RenderGraphImpl* impl = Allocate<RenderGraphImpl>(deviceVK.GetAllocationCallbacks(), device, deviceVK.GetCoreInterface());
+    Result result = impl->Create(renderGraphDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        renderGraph = nullptr;
+    } else
+        renderGraph = (RenderGraph*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyRenderGraph(RenderGraph* renderGraph) {
+    Destroy((RenderGraphImpl*)renderGraph);
+}
+
+static void NRI_CALL BeginRenderGraph(RenderGraph& renderGraph) {
+    ((RenderGraphImpl&)renderGraph).Begin();
+}
+
+static uint32_t NRI_CALL AddRenderGraphTexture(RenderGraph& renderGraph, const RenderGraphTextureDesc& renderGraphTextureDesc) {
+    return ((RenderGraphImpl&)renderGraph).AddTexture(renderGraphTextureDesc);
+}
+
+static uint32_t NRI_CALL AddRenderGraphBuffer(RenderGraph& renderGraph, const RenderGraphBufferDesc& renderGraphBufferDesc) {
+    return ((RenderGraphImpl&)renderGraph).AddBuffer(renderGraphBufferDesc);
+}
+
+static uint32_t NRI_CALL ImportRenderGraphTexture(RenderGraph& renderGraph, const RenderGraphImportedTextureDesc& renderGraphImportedTextureDesc) {
+    return ((RenderGraphImpl&)renderGraph).ImportTexture(renderGraphImportedTextureDesc);
+}
+
+static uint32_t NRI_CALL ImportRenderGraphBuffer(RenderGraph& renderGraph, const RenderGraphImportedBufferDesc& renderGraphImportedBufferDesc) {
+    return ((RenderGraphImpl&)renderGraph).ImportBuffer(renderGraphImportedBufferDesc);
+}
+
+static uint32_t NRI_CALL AddRenderGraphPass(RenderGraph& renderGraph, const RenderGraphPassDesc& renderGraphPassDesc) {
+    return ((RenderGraphImpl&)renderGraph).AddPass(renderGraphPassDesc);
+}
+
+static Result NRI_CALL CompileRenderGraph(RenderGraph& renderGraph) {
+    return ((RenderGraphImpl&)renderGraph).Compile();
+}
+
+static Texture* NRI_CALL GetRenderGraphTexture(const RenderGraph& renderGraph, uint32_t texture) {
+    return ((RenderGraphImpl&)renderGraph).GetTexture(texture);
+}
+
+static Buffer* NRI_CALL GetRenderGraphBuffer(const RenderGraph& renderGraph, uint32_t buffer) {
+    return ((RenderGraphImpl&)renderGraph).GetBuffer(buffer);
+}
+
+static const char* NRI_CALL GetRenderGraphDump(const RenderGraph& renderGraph) {
+    return ((RenderGraphImpl&)renderGraph).GetDump();
+}
+
+static CommandBuffer* const* NRI_CALL ExecuteRenderGraph(RenderGraph& renderGraph, const RenderGraphExecuteDesc& renderGraphExecuteDesc, uint32_t& commandBufferNum) {
+    return ((RenderGraphImpl&)renderGraph).Execute(renderGraphExecuteDesc, commandBufferNum);
+}
+
+static Result NRI_CALL SubmitRenderGraph(RenderGraph& renderGraph, const RenderGraphSubmitDesc& renderGraphSubmitDesc) {
+    return ((RenderGraphImpl&)renderGraph).Submit(renderGraphSubmitDesc);
+}
+
+static void NRI_CALL GetRenderGraphStatistics(const RenderGraph& renderGraph, RenderGraphStatistics& renderGraphStatistics) {
+    ((RenderGraphImpl&)renderGraph).GetStatistics(renderGraphStatistics);
+}
+
+Result DeviceVK::FillFunctionTable(RenderGraphInterface& table) const {
+    table.CreateRenderGraph = ::CreateRenderGraph;
+    table.DestroyRenderGraph = ::DestroyRenderGraph;
+    table.BeginRenderGraph = ::BeginRenderGraph;
+    table.AddRenderGraphTexture = ::AddRenderGraphTexture;
+    table.AddRenderGraphBuffer = ::AddRenderGraphBuffer;
+    table.ImportRenderGraphTexture = ::ImportRenderGraphTexture;
+    table.ImportRenderGraphBuffer = ::ImportRenderGraphBuffer;
+    table.AddRenderGraphPass = ::AddRenderGraphPass;
+    table.CompileRenderGraph = ::CompileRenderGraph;
+    table.GetRenderGraphTexture = ::GetRenderGraphTexture;
+    table.GetRenderGraphBuffer = ::GetRenderGraphBuffer;
+    table.GetRenderGraphDump = ::GetRenderGraphDump;
+    table.ExecuteRenderGraph = ::ExecuteRenderGraph;
+    table.SubmitRenderGraph = ::SubmitRenderGraph;
+    table.GetRenderGraphStatistics = ::GetRenderGraphStatistics;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Residency  ]
+
+static Result NRI_CALL SetMemoryPriority(Memory& memory, float priority) {
+    return ((MemoryVK&)memory).SetPriority(priority);
+}
+
+static Result NRI_CALL SetBufferPriority(Buffer& buffer, float priority) {
+    return ((BufferVK&)buffer).SetPriority(priority);
+}
+
+static Result NRI_CALL SetTexturePriority(Texture& texture, float priority) {
+    return ((TextureVK&)texture).SetPriority(priority);
+}
+
+static Result NRI_CALL CreateResidencyManager(Device& device, const ResidencyManagerDesc& residencyManagerDesc, ResidencyManager*& residencyManager) {
+    DeviceVK& deviceVK = (DeviceVK&)device;
+    ResidencyManagerImpl* impl = Allocate<ResidencyManagerImpl>(deviceVK.GetAllocationCallbacks(), device);
+    Result result = impl->Create(residencyManagerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        residencyManager = nullptr;
+    } else
+        residencyManager = (ResidencyManager*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyResidencyManager(ResidencyManager* residencyManager) {
+    Destroy((ResidencyManagerImpl*)residencyManager);
+}
+
+static uint32_t NRI_CALL AddResidencyMemory(ResidencyManager& residencyManager, Memory& memory, float priority) {
+    return ((ResidencyManagerImpl&)residencyManager).Add(&memory, ResidencyObjectType::MEMORY, priority);
+}
+
+static uint32_t NRI_CALL AddResidencyBuffer(ResidencyManager& residencyManager, Buffer& buffer, float priority) {
+    return ((ResidencyManagerImpl&)residencyManager).Add(&buffer, ResidencyObjectType::BUFFER, priority);
+}
+
+static uint32_t NRI_CALL AddResidencyTexture(ResidencyManager& residencyManager, Texture& texture, float priority) {
+    return ((ResidencyManagerImpl&)residencyManager).Add(&texture, ResidencyObjectType::TEXTURE, priority);
+}
+
+static void NRI_CALL RemoveResidencyObject(ResidencyManager& residencyManager, uint32_t object) {
+    ((ResidencyManagerImpl&)residencyManager).Remove(object);
+}
+
+static void NRI_CALL MarkResidencyObjectUsed(ResidencyManager& residencyManager, uint32_t object) {
+    ((ResidencyManagerImpl&)residencyManager).MarkUsed(object);
+}
+
+static void NRI_CALL UpdateResidency(ResidencyManager& residencyManager) {
+    ((ResidencyManagerImpl&)residencyManager).Update();
+}
+
+static void NRI_CALL GetResidencyStatistics(const ResidencyManager& residencyManager, ResidencyStatistics& residencyStatistics) {
+    ((ResidencyManagerImpl&)residencyManager).GetStatistics(residencyStatistics);
+}
+
+Result DeviceVK::FillFunctionTable(ResidencyInterface& table) const {
+    if (!m_IsSupported.pageableMemory)
+        return Result::UNSUPPORTED;
+
+    table.SetMemoryPriority = ::SetMemoryPriority;
+    table.SetBufferPriority = ::SetBufferPriority;
+    table.SetTexturePriority = ::SetTexturePriority;
+    table.CreateResidencyManager = ::CreateResidencyManager;
+    table.DestroyResidencyManager = ::DestroyResidencyManager;
+    table.AddResidencyMemory = ::AddResidencyMemory;
+    table.AddResidencyBuffer = ::AddResidencyBuffer;
+    table.AddResidencyTexture = ::AddResidencyTexture;
+    table.RemoveResidencyObject = ::RemoveResidencyObject;
+    table.MarkResidencyObjectUsed = ::MarkResidencyObjectUsed;
+    table.UpdateResidency = ::UpdateResidency;
+    table.GetResidencyStatistics = ::GetResidencyStatistics;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  ResourceAllocator  ]
 
@@ -990,11 +1453,94 @@ static Result NRI_CALL AllocateMicromap(Device& device, const AllocateMicromapDe
     return ((DeviceVK&)device).CreateImplementation<MicromapVK>(micromap, allocateMicromapDesc);
 }
 
+static Result NRI_CALL GetResourceAllocatorStatistics(const Device& device, ResourceAllocatorHeapStatistics* heapStatistics, uint32_t& heapStatisticsNum) {
+    return ((DeviceVK&)device).GetVmaStatistics(heapStatistics, heapStatisticsNum);
+}
+
+static Result NRI_CALL GetResourceAllocatorDump(const Device& device, char* dump, uint64_t& dumpSize) {
+    return ((DeviceVK&)device).GetVmaDump(dump, dumpSize);
+}
+
 Result DeviceVK::FillFunctionTable(ResourceAllocatorInterface& table) const {
     table.AllocateBuffer = ::AllocateBuffer;
     table.AllocateTexture = ::AllocateTexture;
     table.AllocateAccelerationStructure = ::AllocateAccelerationStructure;
     table.AllocateMicromap = ::AllocateMicromap;
+    table.GetResourceAllocatorStatistics = ::GetResourceAllocatorStatistics;
+    table.GetResourceAllocatorDump = ::GetResourceAllocatorDump;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Sparse  ]
+
+static Result NRI_CALL CreateSparseBuffer(Device& device, const SparseBufferDesc& sparseBufferDesc, Buffer*& buffer) {
+    return ((DeviceVK&)device).CreateImplementation<BufferVK>(buffer, sparseBufferDesc);
+}
+
+static Result NRI_CALL CreateSparseTexture(Device& device, const SparseTextureDesc& sparseTextureDesc, Texture*& texture) {
+    return ((DeviceVK&)device).CreateImplementation<TextureVK>(texture, sparseTextureDesc);
+}
+
+static void NRI_CALL GetSparseBufferTiling(const Buffer& buffer, SparseTiling& sparseTiling) {
+    ((BufferVK&)buffer).GetSparseTiling(sparseTiling);
+}
+
+static void NRI_CALL GetSparseTextureTiling(const Texture& texture, SparseTiling& sparseTiling) {
+    sparseTiling = ((TextureVK&)texture).GetSparseTiling();
+}
+
+static Result NRI_CALL QueueBindSparse(Queue& queue, const QueueBindSparseDesc& queueBindSparseDesc) {
+    return ((QueueVK&)queue).BindSparse(queueBindSparseDesc);
+}
+
+static Result NRI_CALL CreateSparsePageTable(Device& device, const SparsePageTableDesc& sparsePageTableDesc, SparsePageTable*& sparsePageTable) {
+    DeviceVK& deviceVK = (DeviceVK&)device;
+    SparsePageTableImpl* impl = Allocate<SparsePageTableImpl>(deviceVK.GetAllocationCallbacks(), device);
+    Result result = impl->Create(sparsePageTableDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        sparsePageTable = nullptr;
+    } else
+        sparsePageTable = (SparsePageTable*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroySparsePageTable(SparsePageTable* sparsePageTable) {
+    Destroy((SparsePageTableImpl*)sparsePageTable);
+}
+
+static void NRI_CALL UpdateSparsePageTable(SparsePageTable& sparsePageTable, const SparseTileMapping* tileMappings, uint32_t tileMappingNum) {
+    ((SparsePageTableImpl&)sparsePageTable).Update(tileMappings, tileMappingNum);
+}
+
+static uint32_t NRI_CALL GetSparsePageTableMappedTileNum(const SparsePageTable& sparsePageTable) {
+    return ((SparsePageTableImpl&)sparsePageTable).GetMappedTileNum();
+}
+
+static void NRI_CALL GetSparsePageTableBinds(SparsePageTable& sparsePageTable, QueueBindSparseDesc& queueBindSparseDesc) {
+    ((SparsePageTableImpl&)sparsePageTable).GetBinds(queueBindSparseDesc);
+}
+
+Result DeviceVK::FillFunctionTable(SparseInterface& table) const {
+    if (!m_IsSupported.sparse)
+        return Result::UNSUPPORTED;
+
+    table.CreateSparseBuffer = ::CreateSparseBuffer;
+    table.CreateSparseTexture = ::CreateSparseTexture;
+    table.GetSparseBufferTiling = ::GetSparseBufferTiling;
+    table.GetSparseTextureTiling = ::GetSparseTextureTiling;
+    table.QueueBindSparse = ::QueueBindSparse;
+    table.CreateSparsePageTable = ::CreateSparsePageTable;
+    table.DestroySparsePageTable = ::DestroySparsePageTable;
+    table.UpdateSparsePageTable = ::UpdateSparsePageTable;
+    table.GetSparsePageTableMappedTileNum = ::GetSparsePageTableMappedTileNum;
+    table.GetSparsePageTableBinds = ::GetSparsePageTableBinds;
 
     return Result::SUCCESS;
 }
@@ -1030,6 +1576,10 @@ static uint32_t NRI_CALL StreamConstantData(Streamer& streamer, const void* data
     return ((StreamerImpl&)streamer).StreamConstantData(data, dataSize);
 }
 
+static uint64_t NRI_CALL StreamDeviceAddresses(Streamer& streamer, const BufferOffset* bufferOffsets, uint32_t bufferOffsetNum) {
+    return ((StreamerImpl&)streamer).StreamDeviceAddresses(bufferOffsets, bufferOffsetNum);
+}
+
 static BufferOffset NRI_CALL StreamBufferData(Streamer& streamer, const StreamBufferDataDesc& streamBufferDataDesc) {
     return ((StreamerImpl&)streamer).StreamBufferData(streamBufferDataDesc);
 }
@@ -1053,6 +1603,7 @@ Result DeviceVK::FillFunctionTable(StreamerInterface& table) const {
     table.StreamBufferData = ::StreamBufferData;
     table.StreamTextureData = ::StreamTextureData;
     table.StreamConstantData = ::StreamConstantData;
+    table.StreamDeviceAddresses = ::StreamDeviceAddresses;
     table.EndStreamerFrame = ::EndStreamerFrame;
     table.CmdCopyStreamedData = ::CmdCopyStreamedData;
 
@@ -1069,7 +1620,7 @@ static Result NRI_CALL CreateSwapChain(Device& device, const SwapChainDesc& swap
 }
 
 static void NRI_CALL DestroySwapChain(SwapChain* swapChain) {
-    Destroy((SwapChainVK*)swapChain);
+    DestroyObject<SwapChain>((SwapChainVK*)swapChain);
 }
 
 static Texture* const* NRI_CALL GetSwapChainTextures(const SwapChain& swapChain, uint32_t& textureNum) {
@@ -1092,10 +1643,15 @@ static Result NRI_CALL QueuePresent(SwapChain& swapChain, Fence& releaseSemaphor
     return ((SwapChainVK&)swapChain).Present((FenceVK&)releaseSemaphore);
 }
 
-Result DeviceVK::FillFunctionTable(SwapChainInterface& table) const {
-    if (!m_Desc.features.swapChain)
-        return Result::UNSUPPORTED;
+static Result NRI_CALL GetSwapChainStatistics(SwapChain& swapChain, SwapChainStatistics& swapChainStatistics) {
+    return ((SwapChainVK&)swapChain).GetStatistics(swapChainStatistics);
+}
+
+static Result NRI_CALL GetPresentedFrame(SwapChain& swapChain, PresentedFrame& presentedFrame) {
+    return ((SwapChainVK&)swapChain).GetPresentedFrame(presentedFrame);
+}
 
+Result DeviceVK::FillFunctionTable(SwapChainInterface& table) const {
     table.CreateSwapChain = ::CreateSwapChain;
     table.DestroySwapChain = ::DestroySwapChain;
     table.GetSwapChainTextures = ::GetSwapChainTextures;
@@ -1103,6 +1659,33 @@ Result DeviceVK::FillFunctionTable(SwapChainInterface& table) const {
     table.AcquireNextTexture = ::AcquireNextTexture;
     table.WaitForPresent = ::WaitForPresent;
     table.QueuePresent = ::QueuePresent;
+    table.GetSwapChainStatistics = ::GetSwapChainStatistics;
+    table.GetPresentedFrame = ::GetPresentedFrame;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Trace  ]
+
+static Result NRI_CALL StartTrace(Device& device, const TraceDesc& traceDesc) {
+    return ((DeviceVK&)device).StartTrace(traceDesc);
+}
+
+static void NRI_CALL StopTrace(Device& device) {
+    ((DeviceVK&)device).StopTrace();
+}
+
+static const char* NRI_CALL GetTraceJson(Device& device) {
+    return ((DeviceVK&)device).GetTraceJson();
+}
+
+Result DeviceVK::FillFunctionTable(TraceInterface& table) const {
+    table.StartTrace = ::StartTrace;
+    table.StopTrace = ::StopTrace;
+    table.GetTraceJson = ::GetTraceJson;
 
     return Result::SUCCESS;
 }
@@ -43,6 +43,12 @@ struct MemoryVK final : public DebugNameBase {
 
     void SetDebugName(const char* name) DEBUG_NAME_OVERRIDE;
 
+    //================================================================================================================
+    // NRI
+    //================================================================================================================
+
+    Result SetPriority(float priority);
+
 private:
     DeviceVK& m_Device;
     VkDeviceMemory m_Handle = VK_NULL_HANDLE;
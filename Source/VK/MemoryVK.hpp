@@ -54,6 +54,8 @@ Result MemoryVK::Create(const AllocateMemoryDesc& allocateMemoryDesc) {
     VkResult vkResult = vk.AllocateMemory(m_Device, &memoryInfo, m_Device.GetVkAllocationCallbacks(), &m_Handle);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkAllocateMemory");
 
+    m_Device.Count(Counter::MEMORY_ALLOCATION);
+
     if (IsHostVisibleMemory(memoryTypeInfo.location)) {
         vkResult = vk.MapMemory(m_Device, m_Handle, 0, allocateMemoryDesc.size, 0, (void**)&m_MappedMemory);
         RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkMapMemory");
@@ -92,6 +94,8 @@ Result MemoryVK::CreateDedicated(const BufferVK& buffer) {
     VkResult vkResult = vk.AllocateMemory(m_Device, &memoryInfo, m_Device.GetVkAllocationCallbacks(), &m_Handle);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkAllocateMemory");
 
+    m_Device.Count(Counter::MEMORY_ALLOCATION);
+
     if (IsHostVisibleMemory(memoryTypeInfo.location)) {
         vkResult = vk.MapMemory(m_Device, m_Handle, 0, memoryDesc.size, 0, (void**)&m_MappedMemory);
         RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkMapMemory");
@@ -130,6 +134,8 @@ Result MemoryVK::CreateDedicated(const TextureVK& texture) {
     VkResult vkResult = vk.AllocateMemory(m_Device, &memoryInfo, m_Device.GetVkAllocationCallbacks(), &m_Handle);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkAllocateMemory");
 
+    m_Device.Count(Counter::MEMORY_ALLOCATION);
+
     if (IsHostVisibleMemory(memoryTypeInfo.location)) {
         vkResult = vk.MapMemory(m_Device, m_Handle, 0, memoryDesc.size, 0, (void**)&m_MappedMemory);
         RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkMapMemory");
@@ -141,3 +147,18 @@ Result MemoryVK::CreateDedicated(const TextureVK& texture) {
 NRI_INLINE void MemoryVK::SetDebugName(const char* name) {
     m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_DEVICE_MEMORY, (uint64_t)m_Handle, name);
 }
+
+NRI_INLINE Result MemoryVK::SetPriority(float priority) {
+    if (!m_Device.m_IsSupported.pageableMemory)
+        return Result::UNSUPPORTED;
+
+    // Memory of "mustBeDedicated" types gets allocated later, in "BindBufferMemory" or "BindTextureMemory"
+    m_Priority = priority * 0.5f + 0.5f;
+
+    if (m_Handle) {
+        const auto& vk = m_Device.GetDispatchTable();
+        vk.SetDeviceMemoryPriorityEXT(m_Device, m_Handle, m_Priority);
+    }
+
+    return Result::SUCCESS;
+}
@@ -40,7 +40,7 @@ Result MicromapVK::Create(const MicromapDesc& micromapDesc) {
     bufferDesc.size = sizesInfo.micromapSize;
     bufferDesc.usage = BufferUsageBits::MICROMAP_STORAGE;
 
-    return m_Device.CreateImplementation<BufferVK>(m_Buffer, bufferDesc);
+    return m_Device.CreateInternalImplementation<BufferVK>(m_Buffer, bufferDesc);
 }
 
 Result MicromapVK::FinishCreation() {
@@ -25,6 +25,10 @@ struct PipelineVK final : public DebugNameBase {
         return m_DepthBias;
     }
 
+    inline VkShaderStageFlags GetShaderStages() const {
+        return m_ShaderStages;
+    }
+
     ~PipelineVK();
 
     Result Create(const GraphicsPipelineDesc& graphicsPipelineDesc);
@@ -51,6 +55,7 @@ private:
     DeviceVK& m_Device;
     VkPipeline m_Handle = VK_NULL_HANDLE;
     VkPipelineBindPoint m_BindPoint = VK_PIPELINE_BIND_POINT_MAX_ENUM;
+    VkShaderStageFlags m_ShaderStages = 0; // 0 - unknown (wrapped pipeline)
     DepthBiasDesc m_DepthBias = {};
     bool m_OwnsNativeObjects = true;
 };
@@ -41,6 +41,8 @@ PipelineVK::~PipelineVK() {
 }
 
 Result PipelineVK::Create(const GraphicsPipelineDesc& graphicsPipelineDesc) {
+    TRACE_SCOPE(&m_Device, "CreateGraphicsPipeline");
+
     m_BindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
 
     // Shaders
@@ -54,6 +56,7 @@ Result PipelineVK::Create(const GraphicsPipelineDesc& graphicsPipelineDesc) {
             return res;
 
         stages[i].pName = shaderDesc.entryPointName ? shaderDesc.entryPointName : "main";
+        m_ShaderStages |= stages[i].stage;
     }
 
     // Vertex input
@@ -300,7 +303,10 @@ Result PipelineVK::Create(const GraphicsPipelineDesc& graphicsPipelineDesc) {
 }
 
 Result PipelineVK::Create(const ComputePipelineDesc& computePipelineDesc) {
+    TRACE_SCOPE(&m_Device, "CreateComputePipeline");
+
     m_BindPoint = VK_PIPELINE_BIND_POINT_COMPUTE;
+    m_ShaderStages = VK_SHADER_STAGE_COMPUTE_BIT;
 
     const PipelineLayoutVK& pipelineLayoutVK = *(const PipelineLayoutVK*)computePipelineDesc.pipelineLayout;
 
@@ -350,6 +356,8 @@ Result PipelineVK::Create(const ComputePipelineDesc& computePipelineDesc) {
 }
 
 Result PipelineVK::Create(const RayTracingPipelineDesc& rayTracingPipelineDesc) {
+    TRACE_SCOPE(&m_Device, "CreateRayTracingPipeline");
+
     m_BindPoint = VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR;
 
     const PipelineLayoutVK& pipelineLayoutVK = *(const PipelineLayoutVK*)rayTracingPipelineDesc.pipelineLayout;
@@ -6,7 +6,10 @@ namespace nri {
 
 struct QueueVK final : public DebugNameBase {
     inline QueueVK(DeviceVK& device)
-        : m_Device(device) {
+        : m_Device(device)
+        , m_BatchName(device.GetStdAllocator())
+        , m_BatchNameLengths(device.GetStdAllocator())
+        , m_SubmittedBatchName(device.GetStdAllocator()) {
     }
 
     inline operator VkQueue() const {
@@ -29,6 +32,14 @@ struct QueueVK final : public DebugNameBase {
         return m_Lock;
     }
 
+    inline uint32_t GetSubmitNum() const {
+        return m_SubmitNum;
+    }
+
+    inline const char* GetSubmittedBatchName() const {
+        return m_SubmittedBatchName.c_str();
+    }
+
     Result Create(QueueType type, uint32_t familyIndex, VkQueue handle);
 
     //================================================================================================================
@@ -45,6 +56,7 @@ struct QueueVK final : public DebugNameBase {
     void EndAnnotation();
     void Annotation(const char* name, uint32_t bgra);
     Result Submit(const QueueSubmitDesc& queueSubmitDesc);
+    Result BindSparse(const QueueBindSparseDesc& queueBindSparseDesc);
     Result WaitIdle();
 
 private:
@@ -53,6 +65,13 @@ private:
     uint32_t m_FamilyIndex = INVALID_FAMILY_INDEX;
     QueueType m_Type = QueueType(-1);
     Lock m_Lock;
+    bool m_IsSparseBindingSupported = false;
+
+    // Breadcrumbs: nested queue annotations, "/" separated
+    String m_BatchName;
+    Vector<size_t> m_BatchNameLengths;
+    String m_SubmittedBatchName;
+    uint32_t m_SubmitNum = 0;
 };
 
 } // namespace nri
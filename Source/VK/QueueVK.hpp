@@ -5,6 +5,21 @@ Result QueueVK::Create(QueueType type, uint32_t familyIndex, VkQueue handle) {
     m_FamilyIndex = familyIndex;
     m_Handle = handle;
 
+    // Sparse binding is a family capability (wrapped queues can come from any family)
+    const auto& vk = m_Device.GetDispatchTable();
+
+    uint32_t familyNum = 0;
+    vk.GetPhysicalDeviceQueueFamilyProperties2(m_Device, &familyNum, nullptr);
+
+    Scratch<VkQueueFamilyProperties2> familyProps2 = AllocateScratch(m_Device, VkQueueFamilyProperties2, familyNum);
+    for (uint32_t i = 0; i < familyNum; i++)
+        familyProps2[i] = {VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2};
+
+    vk.GetPhysicalDeviceQueueFamilyProperties2(m_Device, &familyNum, familyProps2);
+
+    if (familyIndex < familyNum)
+        m_IsSparseBindingSupported = (familyProps2[familyIndex].queueFamilyProperties.queueFlags & VK_QUEUE_SPARSE_BINDING_BIT) != 0;
+
     return Result::SUCCESS;
 }
 
@@ -23,12 +38,30 @@ NRI_INLINE void QueueVK::BeginAnnotation(const char* name, uint32_t bgra) {
     const auto& vk = m_Device.GetDispatchTable();
     if (vk.QueueBeginDebugUtilsLabelEXT)
         vk.QueueBeginDebugUtilsLabelEXT(m_Handle, &info);
+
+    if (m_Device.IsBreadcrumbsEnabled()) {
+        ExclusiveScope lock(m_Lock);
+
+        m_BatchNameLengths.push_back(m_BatchName.size());
+        if (!m_BatchName.empty())
+            m_BatchName += " / ";
+        m_BatchName += name;
+    }
 }
 
 NRI_INLINE void QueueVK::EndAnnotation() {
     const auto& vk = m_Device.GetDispatchTable();
     if (vk.QueueEndDebugUtilsLabelEXT)
         vk.QueueEndDebugUtilsLabelEXT(m_Handle);
+
+    if (m_Device.IsBreadcrumbsEnabled()) {
+        ExclusiveScope lock(m_Lock);
+
+        if (!m_BatchNameLengths.empty()) {
+            m_BatchName.resize(m_BatchNameLengths.back());
+            m_BatchNameLengths.pop_back();
+        }
+    }
 }
 
 NRI_INLINE void QueueVK::Annotation(const char* name, uint32_t bgra) {
@@ -45,6 +78,9 @@ NRI_INLINE void QueueVK::Annotation(const char* name, uint32_t bgra) {
 }
 
 NRI_INLINE Result QueueVK::Submit(const QueueSubmitDesc& queueSubmitDesc) {
+    TRACE_SCOPE(&m_Device, "QueueSubmit");
+    m_Device.Count(Counter::QUEUE_SUBMIT);
+
     ExclusiveScope lock(m_Lock);
 
     Scratch<VkSemaphoreSubmitInfo> waitSemaphores = AllocateScratch(m_Device, VkSemaphoreSubmitInfo, queueSubmitDesc.waitFenceNum);
@@ -83,18 +119,27 @@ NRI_INLINE Result QueueVK::Submit(const QueueSubmitDesc& queueSubmitDesc) {
         submitInfo.pNext = &presentId;
     }
 
+    if (m_Device.IsBreadcrumbsEnabled()) {
+        m_SubmittedBatchName = m_BatchName;
+        m_SubmitNum++;
+    }
+
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.QueueSubmit2(m_Handle, 1, &submitInfo, VK_NULL_HANDLE);
+    m_Device.CheckDeviceLost(vkResult);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "QueueSubmit2");
 
     return Result::SUCCESS;
 }
 
 NRI_INLINE Result QueueVK::WaitIdle() {
+    m_Device.Count(Counter::HOST_WAIT);
+
     ExclusiveScope lock(m_Lock);
 
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.QueueWaitIdle(m_Handle);
+    m_Device.CheckDeviceLost(vkResult);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "QueueWaitIdle");
 
     return Result::SUCCESS;
@@ -66,8 +66,9 @@ VkResult DeviceVK::CreateVma() {
 
 Result BufferVK::Create(const AllocateBufferDesc& allocateBufferDesc) {
     // Fill info
+    VkBufferUsageFlags2CreateInfoKHR usage2 = {VK_STRUCTURE_TYPE_BUFFER_USAGE_FLAGS_2_CREATE_INFO_KHR};
     VkBufferCreateInfo bufferCreateInfo = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-    m_Device.FillCreateInfo(allocateBufferDesc.desc, bufferCreateInfo);
+    m_Device.FillCreateInfo(allocateBufferDesc.desc, bufferCreateInfo, usage2);
 
     // Create
     VmaAllocationCreateInfo allocationCreateInfo = {};
@@ -110,6 +111,8 @@ Result BufferVK::Create(const AllocateBufferDesc& allocateBufferDesc) {
     VkResult vkResult = vmaCreateBufferWithAlignment(m_Device.GetVma(), &bufferCreateInfo, &allocationCreateInfo, alignment, &m_Handle, &m_VmaAllocation, &allocationInfo);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vmaCreateBufferWithAlignment");
 
+    m_Device.Count(Counter::MEMORY_ALLOCATION);
+
     // Mapped memory
     if (IsHostVisibleMemory(allocateBufferDesc.memoryLocation)) {
         m_MappedMemory = (uint8_t*)allocationInfo.pMappedData - allocationInfo.offset;
@@ -130,6 +133,7 @@ Result BufferVK::Create(const AllocateBufferDesc& allocateBufferDesc) {
 
         const auto& vk = m_Device.GetDispatchTable();
         m_DeviceAddress = vk.GetBufferDeviceAddress(m_Device, &bufferDeviceAddressInfo);
+        m_Device.TrackResource(VK_OBJECT_TYPE_BUFFER, (uint64_t)m_Handle, m_DeviceAddress, allocateBufferDesc.desc.size);
     }
 
     m_Desc = allocateBufferDesc.desc;
@@ -142,6 +146,9 @@ Result TextureVK::Create(const AllocateTextureDesc& allocateTextureDesc) {
     VkImageCreateInfo imageCreateInfo = {VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
     m_Device.FillCreateInfo(allocateTextureDesc.desc, imageCreateInfo);
 
+    VkSampleCountFlags sampleCounts = m_Device.GetSampleCounts(allocateTextureDesc.desc.format, allocateTextureDesc.desc.usage);
+    RETURN_ON_FAILURE(&m_Device, (sampleCounts & imageCreateInfo.samples) != 0, Result::UNSUPPORTED, "'sampleNum=%u' is not supported for this format and usage", (uint32_t)imageCreateInfo.samples);
+
     // Create
     VmaAllocationCreateInfo allocationCreateInfo = {};
     allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_CAN_ALIAS_BIT | VMA_ALLOCATION_CREATE_STRATEGY_MIN_MEMORY_BIT;
@@ -151,9 +158,21 @@ Result TextureVK::Create(const AllocateTextureDesc& allocateTextureDesc) {
     if (allocateTextureDesc.dedicated)
         allocationCreateInfo.flags |= VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT;
 
-    VkResult vkResult = vmaCreateImage(m_Device.GetVma(), &imageCreateInfo, &allocationCreateInfo, &m_Handle, &m_VmaAllocation, nullptr);
+    // Transient attachments prefer lazily allocated memory, falling back to a regular allocation if the image can't live there
+    VkResult vkResult = VK_ERROR_FEATURE_NOT_PRESENT;
+    if ((allocateTextureDesc.desc.usage & TextureUsageBits::TRANSIENT_ATTACHMENT) && m_Device.GetDesc().features.lazilyAllocatedMemory && !IsHostMemory(allocateTextureDesc.memoryLocation)) {
+        VmaAllocationCreateInfo lazyAllocationCreateInfo = allocationCreateInfo;
+        lazyAllocationCreateInfo.usage = VMA_MEMORY_USAGE_GPU_LAZILY_ALLOCATED;
+
+        vkResult = vmaCreateImage(m_Device.GetVma(), &imageCreateInfo, &lazyAllocationCreateInfo, &m_Handle, &m_VmaAllocation, nullptr);
+    }
+
+    if (vkResult != VK_SUCCESS)
+        vkResult = vmaCreateImage(m_Device.GetVma(), &imageCreateInfo, &allocationCreateInfo, &m_Handle, &m_VmaAllocation, nullptr);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vmaCreateImage");
 
+    m_Device.Count(Counter::MEMORY_ALLOCATION);
+
     m_Desc = FixTextureDesc(allocateTextureDesc.desc);
 
     return Result::SUCCESS;
@@ -169,7 +188,7 @@ Result AccelerationStructureVK::Create(const AllocateAccelerationStructureDesc&
     bufferDesc.desc.size = sizesInfo.accelerationStructureSize;
     bufferDesc.desc.usage = BufferUsageBits::ACCELERATION_STRUCTURE_STORAGE;
 
-    Result result = m_Device.CreateImplementation<BufferVK>(m_Buffer, bufferDesc);
+    Result result = m_Device.CreateInternalImplementation<BufferVK>(m_Buffer, bufferDesc);
     if (result == Result::SUCCESS) {
         m_BuildScratchSize = sizesInfo.buildScratchSize;
         m_UpdateScratchSize = sizesInfo.updateScratchSize;
@@ -195,7 +214,7 @@ Result MicromapVK::Create(const AllocateMicromapDesc& allocateMicromapDesc) {
     bufferDesc.desc.size = sizesInfo.micromapSize;
     bufferDesc.desc.usage = BufferUsageBits::ACCELERATION_STRUCTURE_STORAGE;
 
-    Result result = m_Device.CreateImplementation<BufferVK>(m_Buffer, bufferDesc);
+    Result result = m_Device.CreateInternalImplementation<BufferVK>(m_Buffer, bufferDesc);
     if (result == Result::SUCCESS) {
         m_BuildScratchSize = sizesInfo.buildScratchSize;
         m_Flags = allocateMicromapDesc.desc.flags;
@@ -211,6 +230,75 @@ void DeviceVK::DestroyVma() {
         vmaDestroyAllocator(m_Vma);
 }
 
+Result DeviceVK::SetVmaAllocationPriority(VmaAllocation_T* allocation, float priority) {
+    if (!m_IsSupported.pageableMemory)
+        return Result::UNSUPPORTED;
+
+    // Memory blocks are shared by allocations, only dedicated allocations can be changed without side effects
+    VmaAllocationInfo2 allocationInfo = {};
+    vmaGetAllocationInfo2(m_Vma, allocation, &allocationInfo);
+
+    if (!allocationInfo.dedicatedMemory)
+        return Result::UNSUPPORTED;
+
+    m_VK.SetDeviceMemoryPriorityEXT(m_Device, allocationInfo.allocationInfo.deviceMemory, priority * 0.5f + 0.5f);
+
+    return Result::SUCCESS;
+}
+
+Result DeviceVK::GetVmaStatistics(ResourceAllocatorHeapStatistics* heapStatistics, uint32_t& heapStatisticsNum) const {
+    if (!heapStatistics) {
+        heapStatisticsNum = m_MemoryProps.memoryHeapCount;
+        return Result::SUCCESS;
+    }
+
+    std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> budgets = {};
+    vmaGetHeapBudgets(m_Vma, budgets.data());
+
+    VmaTotalStatistics totalStatistics = {};
+    vmaCalculateStatistics(m_Vma, &totalStatistics);
+
+    heapStatisticsNum = std::min(heapStatisticsNum, m_MemoryProps.memoryHeapCount);
+    for (uint32_t i = 0; i < heapStatisticsNum; i++) {
+        const VmaDetailedStatistics& detailedStatistics = totalStatistics.memoryHeap[i];
+        const VmaStatistics& statistics = detailedStatistics.statistics;
+        uint64_t freeSize = statistics.blockBytes - statistics.allocationBytes;
+
+        ResourceAllocatorHeapStatistics& heapStatistic = heapStatistics[i];
+        heapStatistic = {};
+        heapStatistic.budgetSize = budgets[i].budget;
+        heapStatistic.usageSize = budgets[i].usage;
+        heapStatistic.blockSize = statistics.blockBytes;
+        heapStatistic.allocationSize = statistics.allocationBytes;
+        heapStatistic.blockNum = statistics.blockCount;
+        heapStatistic.allocationNum = statistics.allocationCount;
+        heapStatistic.fragmentation = freeSize ? std::max(1.0f - float(double(detailedStatistics.unusedRangeSizeMax) / double(freeSize)), 0.0f) : 0.0f;
+        heapStatistic.isDeviceLocal = (m_MemoryProps.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0;
+    }
+
+    return Result::SUCCESS;
+}
+
+Result DeviceVK::GetVmaDump(char* dump, uint64_t& dumpSize) const {
+    char* statsString = nullptr;
+    vmaBuildStatsString(m_Vma, &statsString, VK_TRUE);
+
+    uint64_t size = strlen(statsString) + 1;
+
+    Result result = Result::SUCCESS;
+    if (dump) {
+        if (dumpSize >= size)
+            memcpy(dump, statsString, (size_t)size);
+        else
+            result = Result::FAILURE;
+    }
+
+    dumpSize = size;
+    vmaFreeStatsString(m_Vma, statsString);
+
+    return result;
+}
+
 void BufferVK::DestroyVma() {
     CHECK(m_VmaAllocation, "Not a VMA allocation");
     vmaDestroyBuffer(m_Device.GetVma(), m_Handle, m_VmaAllocation);
@@ -0,0 +1,230 @@
+// © 2025 NVIDIA Corporation
+
+Result BufferVK::Create(const SparseBufferDesc& sparseBufferDesc) {
+    RETURN_ON_FAILURE(&m_Device, m_Device.m_IsSupported.sparse, Result::UNSUPPORTED, "sparse resources are not supported");
+
+    m_Desc = sparseBufferDesc.desc;
+
+    VkBufferUsageFlags2CreateInfoKHR usage2 = {VK_STRUCTURE_TYPE_BUFFER_USAGE_FLAGS_2_CREATE_INFO_KHR};
+    VkBufferCreateInfo info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    m_Device.FillCreateInfo(sparseBufferDesc.desc, info, usage2);
+    info.flags |= VK_BUFFER_CREATE_SPARSE_BINDING_BIT | VK_BUFFER_CREATE_SPARSE_RESIDENCY_BIT;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.CreateBuffer(m_Device, &info, m_Device.GetVkAllocationCallbacks(), &m_Handle);
+    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateBuffer");
+
+    // Device address (sparse resources don't need to be bound to memory)
+    if (m_Device.m_IsSupported.deviceAddress) {
+        VkBufferDeviceAddressInfo bufferDeviceAddressInfo = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO};
+        bufferDeviceAddressInfo.buffer = m_Handle;
+
+        m_DeviceAddress = vk.GetBufferDeviceAddress(m_Device, &bufferDeviceAddressInfo);
+        m_Device.TrackResource(VK_OBJECT_TYPE_BUFFER, (uint64_t)m_Handle, m_DeviceAddress, m_Desc.size);
+    }
+
+    return Result::SUCCESS;
+}
+
+void BufferVK::GetSparseTiling(SparseTiling& sparseTiling) const {
+    VkMemoryRequirements2 requirements = {VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2};
+
+    VkBufferMemoryRequirementsInfo2 bufferMemoryRequirements = {VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2};
+    bufferMemoryRequirements.buffer = m_Handle;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.GetBufferMemoryRequirements2(m_Device, &bufferMemoryRequirements, &requirements);
+
+    // For sparse buffers "alignment" is the sparse block size
+    uint64_t tileSize = requirements.memoryRequirements.alignment;
+
+    sparseTiling = {};
+    sparseTiling.tileSize = tileSize;
+    sparseTiling.tileNum = (uint32_t)((requirements.memoryRequirements.size + tileSize - 1) / tileSize);
+    sparseTiling.tileWidth = (uint32_t)tileSize;
+    sparseTiling.tileHeight = 1;
+    sparseTiling.tileDepth = 1;
+}
+
+Result TextureVK::Create(const SparseTextureDesc& sparseTextureDesc) {
+    RETURN_ON_FAILURE(&m_Device, m_Device.m_IsSupported.sparse, Result::UNSUPPORTED, "sparse resources are not supported");
+    RETURN_ON_FAILURE(&m_Device, sparseTextureDesc.desc.type != TextureType::TEXTURE_3D || m_Device.m_IsSupported.sparse3D, Result::UNSUPPORTED, "sparse 3D textures are not supported");
+
+    m_Desc = FixTextureDesc(sparseTextureDesc.desc);
+
+    VkImageCreateInfo info = {VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+    m_Device.FillCreateInfo(sparseTextureDesc.desc, info);
+    info.flags |= VK_IMAGE_CREATE_SPARSE_BINDING_BIT | VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT;
+    info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED; // there is no memory to zero-initialize
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.CreateImage(m_Device, &info, m_Device.GetVkAllocationCallbacks(), &m_Handle);
+    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateImage");
+
+    // Tiling
+    VkMemoryRequirements2 requirements = {VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2};
+
+    VkImageMemoryRequirementsInfo2 imageMemoryRequirements = {VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2};
+    imageMemoryRequirements.image = m_Handle;
+
+    vk.GetImageMemoryRequirements2(m_Device, &imageMemoryRequirements, &requirements);
+
+    VkImageSparseMemoryRequirementsInfo2 sparseMemoryRequirementsInfo = {VK_STRUCTURE_TYPE_IMAGE_SPARSE_MEMORY_REQUIREMENTS_INFO_2};
+    sparseMemoryRequirementsInfo.image = m_Handle;
+
+    uint32_t sparseRequirementNum = 0;
+    vk.GetImageSparseMemoryRequirements2(m_Device, &sparseMemoryRequirementsInfo, &sparseRequirementNum, nullptr);
+
+    Scratch<VkSparseImageMemoryRequirements2> sparseRequirements = AllocateScratch(m_Device, VkSparseImageMemoryRequirements2, sparseRequirementNum);
+    for (uint32_t i = 0; i < sparseRequirementNum; i++)
+        sparseRequirements[i] = {VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2};
+
+    vk.GetImageSparseMemoryRequirements2(m_Device, &sparseMemoryRequirementsInfo, &sparseRequirementNum, sparseRequirements);
+
+    // Metadata is not exposed, the first "color" or "depth" aspect is used
+    VkImageAspectFlags aspectFlags = GetImageAspectFlags();
+    const VkSparseImageMemoryRequirements* sparseRequirement = nullptr;
+    for (uint32_t i = 0; i < sparseRequirementNum && !sparseRequirement; i++) {
+        if (sparseRequirements[i].memoryRequirements.formatProperties.aspectMask & aspectFlags)
+            sparseRequirement = &sparseRequirements[i].memoryRequirements;
+    }
+
+    RETURN_ON_FAILURE(&m_Device, sparseRequirement, Result::UNSUPPORTED, "the format doesn't support sparse residency");
+
+    const VkExtent3D& granularity = sparseRequirement->formatProperties.imageGranularity;
+    uint64_t tileSize = requirements.memoryRequirements.alignment;
+
+    m_SparseTiling.tileSize = tileSize;
+    m_SparseTiling.tileNum = (uint32_t)((requirements.memoryRequirements.size + tileSize - 1) / tileSize);
+    m_SparseTiling.tileWidth = granularity.width;
+    m_SparseTiling.tileHeight = granularity.height;
+    m_SparseTiling.tileDepth = granularity.depth;
+    m_SparseTiling.mipTailFirst = (Dim_t)std::min(sparseRequirement->imageMipTailFirstLod, (uint32_t)m_Desc.mipNum);
+    m_SparseTiling.mipTailTileNum = (uint32_t)((sparseRequirement->imageMipTailSize + tileSize - 1) / tileSize);
+    m_SparseTiling.isMipTailShared = (sparseRequirement->formatProperties.flags & VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT) != 0;
+
+    m_MipTailOffset = sparseRequirement->imageMipTailOffset;
+    m_MipTailStride = sparseRequirement->imageMipTailStride;
+
+    return Result::SUCCESS;
+}
+
+NRI_INLINE Result QueueVK::BindSparse(const QueueBindSparseDesc& queueBindSparseDesc) {
+    TRACE_SCOPE(&m_Device, "QueueBindSparse");
+    RETURN_ON_FAILURE(&m_Device, m_IsSparseBindingSupported, Result::UNSUPPORTED, "The queue family doesn't support sparse binding (VK_QUEUE_SPARSE_BINDING_BIT)");
+
+    m_Device.Count(Counter::QUEUE_SUBMIT);
+
+    // Fences
+    Scratch<VkSemaphore> waitSemaphores = AllocateScratch(m_Device, VkSemaphore, queueBindSparseDesc.waitFenceNum);
+    Scratch<uint64_t> waitValues = AllocateScratch(m_Device, uint64_t, queueBindSparseDesc.waitFenceNum);
+    for (uint32_t i = 0; i < queueBindSparseDesc.waitFenceNum; i++) {
+        waitSemaphores[i] = *(FenceVK*)queueBindSparseDesc.waitFences[i].fence;
+        waitValues[i] = queueBindSparseDesc.waitFences[i].value;
+    }
+
+    Scratch<VkSemaphore> signalSemaphores = AllocateScratch(m_Device, VkSemaphore, queueBindSparseDesc.signalFenceNum);
+    Scratch<uint64_t> signalValues = AllocateScratch(m_Device, uint64_t, queueBindSparseDesc.signalFenceNum);
+    for (uint32_t i = 0; i < queueBindSparseDesc.signalFenceNum; i++) {
+        signalSemaphores[i] = *(FenceVK*)queueBindSparseDesc.signalFences[i].fence;
+        signalValues[i] = queueBindSparseDesc.signalFences[i].value;
+    }
+
+    // Buffers
+    Scratch<VkSparseMemoryBind> bufferMemoryBinds = AllocateScratch(m_Device, VkSparseMemoryBind, queueBindSparseDesc.bufferBindNum);
+    Scratch<VkSparseBufferMemoryBindInfo> bufferBinds = AllocateScratch(m_Device, VkSparseBufferMemoryBindInfo, queueBindSparseDesc.bufferBindNum);
+    for (uint32_t i = 0; i < queueBindSparseDesc.bufferBindNum; i++) {
+        const SparseBufferBindDesc& bufferBindDesc = queueBindSparseDesc.bufferBinds[i];
+        const MemoryVK* memory = (MemoryVK*)bufferBindDesc.memory;
+
+        VkSparseMemoryBind& memoryBind = bufferMemoryBinds[i];
+        memoryBind = {};
+        memoryBind.resourceOffset = bufferBindDesc.offset;
+        memoryBind.size = bufferBindDesc.size;
+        memoryBind.memory = memory ? memory->GetHandle() : VK_NULL_HANDLE;
+        memoryBind.memoryOffset = memory ? bufferBindDesc.memoryOffset : 0;
+
+        bufferBinds[i].buffer = ((BufferVK*)bufferBindDesc.buffer)->GetHandle();
+        bufferBinds[i].bindCount = 1;
+        bufferBinds[i].pBinds = &memoryBind;
+    }
+
+    // Textures
+    Scratch<VkSparseImageMemoryBind> imageMemoryBinds = AllocateScratch(m_Device, VkSparseImageMemoryBind, queueBindSparseDesc.textureBindNum);
+    Scratch<VkSparseImageMemoryBindInfo> imageBinds = AllocateScratch(m_Device, VkSparseImageMemoryBindInfo, queueBindSparseDesc.textureBindNum);
+    for (uint32_t i = 0; i < queueBindSparseDesc.textureBindNum; i++) {
+        const SparseTextureBindDesc& textureBindDesc = queueBindSparseDesc.textureBinds[i];
+        const TextureVK& texture = *(TextureVK*)textureBindDesc.texture;
+        const SparseTiling& tiling = texture.GetSparseTiling();
+        const TextureRegionDesc& region = textureBindDesc.region;
+        const MemoryVK* memory = (MemoryVK*)textureBindDesc.memory;
+
+        // Tiles to texels (partial tiles on the edges are clamped to the mip size)
+        uint32_t x = region.x * tiling.tileWidth;
+        uint32_t y = region.y * tiling.tileHeight;
+        uint32_t z = region.z * tiling.tileDepth;
+
+        VkSparseImageMemoryBind& memoryBind = imageMemoryBinds[i];
+        memoryBind = {};
+        memoryBind.subresource = {texture.GetImageAspectFlags(), region.mipOffset, region.layerOffset};
+        memoryBind.offset = {(int32_t)x, (int32_t)y, (int32_t)z};
+        memoryBind.extent.width = std::min(region.width * tiling.tileWidth, texture.GetSize(0, region.mipOffset) - x);
+        memoryBind.extent.height = std::min(region.height * tiling.tileHeight, texture.GetSize(1, region.mipOffset) - y);
+        memoryBind.extent.depth = std::min(region.depth * tiling.tileDepth, texture.GetSize(2, region.mipOffset) - z);
+        memoryBind.memory = memory ? memory->GetHandle() : VK_NULL_HANDLE;
+        memoryBind.memoryOffset = memory ? textureBindDesc.memoryOffset : 0;
+
+        imageBinds[i].image = texture.GetHandle();
+        imageBinds[i].bindCount = 1;
+        imageBinds[i].pBinds = &memoryBind;
+    }
+
+    // Mip tails
+    Scratch<VkSparseMemoryBind> mipTailMemoryBinds = AllocateScratch(m_Device, VkSparseMemoryBind, queueBindSparseDesc.mipTailBindNum);
+    Scratch<VkSparseImageOpaqueMemoryBindInfo> mipTailBinds = AllocateScratch(m_Device, VkSparseImageOpaqueMemoryBindInfo, queueBindSparseDesc.mipTailBindNum);
+    for (uint32_t i = 0; i < queueBindSparseDesc.mipTailBindNum; i++) {
+        const SparseMipTailBindDesc& mipTailBindDesc = queueBindSparseDesc.mipTailBinds[i];
+        const TextureVK& texture = *(TextureVK*)mipTailBindDesc.texture;
+        const SparseTiling& tiling = texture.GetSparseTiling();
+        const MemoryVK* memory = (MemoryVK*)mipTailBindDesc.memory;
+
+        VkSparseMemoryBind& memoryBind = mipTailMemoryBinds[i];
+        memoryBind = {};
+        memoryBind.resourceOffset = texture.GetMipTailOffset(mipTailBindDesc.layer);
+        memoryBind.size = tiling.mipTailTileNum * tiling.tileSize;
+        memoryBind.memory = memory ? memory->GetHandle() : VK_NULL_HANDLE;
+        memoryBind.memoryOffset = memory ? mipTailBindDesc.memoryOffset : 0;
+
+        mipTailBinds[i].image = texture.GetHandle();
+        mipTailBinds[i].bindCount = 1;
+        mipTailBinds[i].pBinds = &memoryBind;
+    }
+
+    VkTimelineSemaphoreSubmitInfo timelineInfo = {VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO};
+    timelineInfo.waitSemaphoreValueCount = queueBindSparseDesc.waitFenceNum;
+    timelineInfo.pWaitSemaphoreValues = waitValues;
+    timelineInfo.signalSemaphoreValueCount = queueBindSparseDesc.signalFenceNum;
+    timelineInfo.pSignalSemaphoreValues = signalValues;
+
+    VkBindSparseInfo bindSparseInfo = {VK_STRUCTURE_TYPE_BIND_SPARSE_INFO};
+    bindSparseInfo.pNext = &timelineInfo;
+    bindSparseInfo.waitSemaphoreCount = queueBindSparseDesc.waitFenceNum;
+    bindSparseInfo.pWaitSemaphores = waitSemaphores;
+    bindSparseInfo.bufferBindCount = queueBindSparseDesc.bufferBindNum;
+    bindSparseInfo.pBufferBinds = bufferBinds;
+    bindSparseInfo.imageOpaqueBindCount = queueBindSparseDesc.mipTailBindNum;
+    bindSparseInfo.pImageOpaqueBinds = mipTailBinds;
+    bindSparseInfo.imageBindCount = queueBindSparseDesc.textureBindNum;
+    bindSparseInfo.pImageBinds = imageBinds;
+    bindSparseInfo.signalSemaphoreCount = queueBindSparseDesc.signalFenceNum;
+    bindSparseInfo.pSignalSemaphores = signalSemaphores;
+
+    ExclusiveScope lock(m_Lock);
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.QueueBindSparse(m_Handle, 1, &bindSparseInfo, VK_NULL_HANDLE);
+    m_Device.CheckDeviceLost(vkResult);
+    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "QueueBindSparse");
+
+    return Result::SUCCESS;
+}
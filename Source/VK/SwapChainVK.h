@@ -7,6 +7,7 @@ namespace nri {
 struct QueueVK;
 struct FenceVK;
 struct TextureVK;
+struct HeadlessSwapChain;
 
 struct SwapChainVK final : public DisplayDescHelper, DebugNameBase {
     SwapChainVK(DeviceVK& device)
@@ -36,14 +37,13 @@ struct SwapChainVK final : public DisplayDescHelper, DebugNameBase {
     // NRI
     //================================================================================================================
 
-    inline Result GetDisplayDesc(DisplayDesc& displayDesc) {
-        return DisplayDescHelper::GetDisplayDesc(m_Hwnd, displayDesc);
-    }
-
+    Result GetDisplayDesc(DisplayDesc& displayDesc);
     Texture* const* GetTextures(uint32_t& textureNum) const;
     Result AcquireNextTexture(FenceVK& acquireSemaphore, uint32_t& textureIndex);
     Result WaitForPresent();
     Result Present(FenceVK& releaseSemaphore);
+    Result GetStatistics(SwapChainStatistics& swapChainStatistics);
+    Result GetPresentedFrame(PresentedFrame& presentedFrame);
 
     Result SetLatencySleepMode(const LatencySleepMode& latencySleepMode);
     Result SetLatencyMarker(LatencyMarker latencyMarker);
@@ -53,7 +53,9 @@ struct SwapChainVK final : public DisplayDescHelper, DebugNameBase {
 private:
     DeviceVK& m_Device;
     Vector<TextureVK*> m_Textures;
+    SwapChainStatisticsHelper m_Statistics;
     FenceVK* m_LatencyFence = nullptr;
+    HeadlessSwapChain* m_Headless = nullptr;
     VkSwapchainKHR m_Handle = VK_NULL_HANDLE;
     VkSurfaceKHR m_Surface = VK_NULL_HANDLE;
     QueueVK* m_Queue = nullptr;
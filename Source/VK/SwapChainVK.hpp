@@ -16,6 +16,11 @@ constexpr VkPresentGravityFlagBitsEXT GetGravity(Gravity gravity) {
 }
 
 SwapChainVK::~SwapChainVK() {
+    if (m_Headless) {
+        Destroy(m_Headless);
+        return;
+    }
+
     // TODO: use "vkReleaseSwapchainImagesEXT" to release acquired but not presented images?
 
     for (size_t i = 0; i < m_Textures.size(); i++)
@@ -32,6 +37,16 @@ SwapChainVK::~SwapChainVK() {
 }
 
 Result SwapChainVK::Create(const SwapChainDesc& swapChainDesc) {
+    // Headless
+    if (swapChainDesc.window.headless.enable) {
+        m_Headless = Allocate<HeadlessSwapChain>(m_Device.GetAllocationCallbacks(), (Device&)m_Device);
+        m_PresentId = GetSwapChainId();
+
+        return m_Headless->Create(swapChainDesc);
+    }
+
+    RETURN_ON_FAILURE(&m_Device, m_Device.GetDesc().features.swapChain, Result::UNSUPPORTED, "'features.swapChain' is false");
+
     const auto& vk = m_Device.GetDispatchTable();
 
     m_Queue = (QueueVK*)swapChainDesc.queue;
@@ -387,23 +402,52 @@ Result SwapChainVK::Create(const SwapChainDesc& swapChainDesc) {
     if (!m_Device.GetDesc().features.waitableSwapChain)
         m_Flags &= ~SwapChainBits::WAITABLE;
 
+    // Statistics
+    uint32_t refreshInterval = 0;
+    if (m_Device.m_IsSupported.displayTiming) {
+        VkRefreshCycleDurationGOOGLE refreshCycleDuration = {};
+        if (vk.GetRefreshCycleDurationGOOGLE(m_Device, m_Handle, &refreshCycleDuration) == VK_SUCCESS)
+            refreshInterval = (uint32_t)(refreshCycleDuration.refreshDuration / 1000);
+    }
+
+    bool isMeasured = m_Device.m_IsSupported.displayTiming || (m_Flags & SwapChainBits::WAITABLE);
+    m_Statistics.Initialize((m_Flags & SwapChainBits::VSYNC) != 0, isMeasured, refreshInterval);
+
     return Result::SUCCESS;
 }
 
 NRI_INLINE void SwapChainVK::SetDebugName(const char* name) {
+    if (m_Headless)
+        return;
+
     m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_SURFACE_KHR, (uint64_t)m_Surface, name);
     m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_SWAPCHAIN_KHR, (uint64_t)m_Handle, name);
 }
 
+NRI_INLINE Result SwapChainVK::GetDisplayDesc(DisplayDesc& displayDesc) {
+    if (m_Headless)
+        return m_Headless->GetDisplayDesc(displayDesc);
+
+    return DisplayDescHelper::GetDisplayDesc(m_Hwnd, displayDesc);
+}
+
 NRI_INLINE Texture* const* SwapChainVK::GetTextures(uint32_t& textureNum) const {
+    if (m_Headless)
+        return m_Headless->GetTextures(textureNum);
+
     textureNum = (uint32_t)m_Textures.size();
 
     return (Texture* const*)m_Textures.data();
 }
 
 NRI_INLINE Result SwapChainVK::AcquireNextTexture(FenceVK& acquireSemaphore, uint32_t& textureIndex) {
+    if (m_Headless)
+        return m_Headless->AcquireNextTexture((Fence*)&acquireSemaphore, textureIndex);
+
     ExclusiveScope lock(m_Queue->GetLock());
 
+    uint64_t beginTime = SwapChainStatisticsHelper::GetTime();
+
     // Acquire next image (signal)
     VkAcquireNextImageInfoKHR acquireInfo = {VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR};
     acquireInfo.swapchain = m_Handle;
@@ -413,25 +457,46 @@ NRI_INLINE Result SwapChainVK::AcquireNextTexture(FenceVK& acquireSemaphore, uin
 
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.AcquireNextImage2KHR(m_Device, &acquireInfo, &m_TextureIndex);
+    m_Device.CheckDeviceLost(vkResult);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "AcquireNextImage2KHR");
 
+    m_Statistics.OnAcquire(beginTime);
+    m_Statistics.OnTextureReleased(m_TextureIndex);
+
     textureIndex = m_TextureIndex;
 
     return Result::SUCCESS;
 }
 
 NRI_INLINE Result SwapChainVK::WaitForPresent() {
+    if (m_Headless)
+        return m_Headless->WaitForPresent();
+
     if (!(m_Flags & SwapChainBits::WAITABLE) || GetPresentIndex(m_PresentId) == 0)
         return Result::UNSUPPORTED;
 
+    uint64_t beginTime = SwapChainStatisticsHelper::GetTime();
+
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.WaitForPresentKHR(m_Device, m_Handle, m_PresentId - 1, MsToUs(TIMEOUT_PRESENT));
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "WaitForPresentKHR");
 
+    m_Statistics.OnWaitForPresent(beginTime);
+
+    // The wait returns once the previous frame is on screen. If available, "VK_GOOGLE_display_timing" provides more precise timings
+    if (!m_Device.m_IsSupported.displayTiming && vkResult == VK_SUCCESS)
+        m_Statistics.OnDisplayed(GetPresentIndex(m_PresentId) - 1, SwapChainStatisticsHelper::GetTime(), 0);
+
     return Result::SUCCESS;
 }
 
 NRI_INLINE Result SwapChainVK::Present(FenceVK& releaseSemaphore) {
+    if (m_Headless) {
+        m_PresentId++;
+
+        return m_Headless->Present((Fence*)&releaseSemaphore);
+    }
+
     ExclusiveScope lock(m_Queue->GetLock());
 
     // Present (wait)
@@ -453,21 +518,77 @@ NRI_INLINE Result SwapChainVK::Present(FenceVK& releaseSemaphore) {
     if (m_Device.m_IsSupported.presentId)
         presentInfo.pNext = &presentId;
 
+    // The present is recorded only if it succeeds, but its index is needed for "VK_GOOGLE_display_timing" upfront
+    uint64_t beginTime = SwapChainStatisticsHelper::GetTime();
+    uint64_t presentIndex = m_Statistics.GetNextPresentIndex();
+
+    VkPresentTimeGOOGLE presentTime = {};
+    presentTime.presentID = (uint32_t)presentIndex;
+
+    VkPresentTimesInfoGOOGLE presentTimesInfo = {VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE};
+    presentTimesInfo.swapchainCount = 1;
+    presentTimesInfo.pTimes = &presentTime;
+
+    if (m_Device.m_IsSupported.displayTiming) {
+        presentTimesInfo.pNext = presentInfo.pNext;
+        presentInfo.pNext = &presentTimesInfo;
+    }
+
     if (m_Flags & SwapChainBits::ALLOW_LOW_LATENCY)
         SetLatencyMarker((LatencyMarker)VK_LATENCY_MARKER_PRESENT_START_NV);
 
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.QueuePresentKHR(*m_Queue, &presentInfo);
+    m_Device.CheckDeviceLost(vkResult);
 
     if (m_Flags & SwapChainBits::ALLOW_LOW_LATENCY)
         SetLatencyMarker((LatencyMarker)VK_LATENCY_MARKER_PRESENT_END_NV);
 
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "QueuePresentKHR");
 
+    m_Device.OnPresent();
+    m_Statistics.OnPresent(beginTime, m_TextureIndex);
+
+    return Result::SUCCESS;
+}
+
+NRI_INLINE Result SwapChainVK::GetStatistics(SwapChainStatistics& swapChainStatistics) {
+    if (m_Headless)
+        return m_Headless->GetStatistics(swapChainStatistics);
+
+    if (m_Device.m_IsSupported.displayTiming) {
+        ExclusiveScope lock(m_Queue->GetLock());
+
+        // Timings are returned only once, "actualPresentTime" is expected to be on the "CLOCK_MONOTONIC" timeline
+        std::array<VkPastPresentationTimingGOOGLE, 16> timings;
+        VkResult vkResult = VK_INCOMPLETE;
+
+        const auto& vk = m_Device.GetDispatchTable();
+        while (vkResult == VK_INCOMPLETE) {
+            uint32_t timingNum = (uint32_t)timings.size();
+            vkResult = vk.GetPastPresentationTimingGOOGLE(m_Device, m_Handle, &timingNum, timings.data());
+            RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "GetPastPresentationTimingGOOGLE");
+
+            for (uint32_t i = 0; i < timingNum; i++)
+                m_Statistics.OnDisplayed(timings[i].presentID, timings[i].actualPresentTime / 1000, 0);
+        }
+    }
+
+    m_Statistics.GetStatistics(swapChainStatistics);
+
     return Result::SUCCESS;
 }
 
+NRI_INLINE Result SwapChainVK::GetPresentedFrame(PresentedFrame& presentedFrame) {
+    RETURN_ON_FAILURE(&m_Device, m_Headless, Result::UNSUPPORTED, "only headless swap chains support frame readback");
+
+    return m_Headless->GetPresentedFrame(presentedFrame);
+}
+
 NRI_INLINE Result SwapChainVK::SetLatencySleepMode(const LatencySleepMode& latencySleepMode) {
+    if (m_Headless)
+        return m_Headless->SetLatencySleepMode(latencySleepMode);
+
     VkLatencySleepModeInfoNV sleepModeInfo = {VK_STRUCTURE_TYPE_LATENCY_SLEEP_MODE_INFO_NV};
     sleepModeInfo.lowLatencyMode = latencySleepMode.lowLatencyMode;
     sleepModeInfo.lowLatencyBoost = latencySleepMode.lowLatencyBoost;
@@ -481,6 +602,9 @@ NRI_INLINE Result SwapChainVK::SetLatencySleepMode(const LatencySleepMode& laten
 }
 
 NRI_INLINE Result SwapChainVK::SetLatencyMarker(LatencyMarker latencyMarker) {
+    if (m_Headless)
+        return m_Headless->SetLatencyMarker(latencyMarker);
+
     VkSetLatencyMarkerInfoNV markerInfo = {VK_STRUCTURE_TYPE_SET_LATENCY_MARKER_INFO_NV};
     markerInfo.presentID = m_PresentId;
     markerInfo.marker = (VkLatencyMarkerNV)latencyMarker;
@@ -492,6 +616,9 @@ NRI_INLINE Result SwapChainVK::SetLatencyMarker(LatencyMarker latencyMarker) {
 }
 
 NRI_INLINE Result SwapChainVK::LatencySleep() {
+    if (m_Headless)
+        return m_Headless->LatencySleep();
+
     VkLatencySleepInfoNV sleepInfo = {VK_STRUCTURE_TYPE_LATENCY_SLEEP_INFO_NV};
     sleepInfo.signalSemaphore = *m_LatencyFence;
     sleepInfo.value = m_PresentId;
@@ -506,6 +633,9 @@ NRI_INLINE Result SwapChainVK::LatencySleep() {
 }
 
 NRI_INLINE Result SwapChainVK::GetLatencyReport(LatencyReport& latencyReport) {
+    if (m_Headless)
+        return m_Headless->GetLatencyReport(latencyReport);
+
     VkLatencyTimingsFrameReportNV timingsInfo[64] = {};
     for (uint32_t i = 0; i < GetCountOf(timingsInfo); i++)
         timingsInfo[i].sType = VK_STRUCTURE_TYPE_LATENCY_TIMINGS_FRAME_REPORT_NV;
@@ -29,11 +29,20 @@ struct TextureVK final : public DebugNameBase {
         return GetDimension(GraphicsAPI::VK, m_Desc, dimensionIndex, mip);
     }
 
+    inline const SparseTiling& GetSparseTiling() const {
+        return m_SparseTiling;
+    }
+
+    inline uint64_t GetMipTailOffset(Dim_t layer) const {
+        return m_MipTailOffset + (m_SparseTiling.isMipTailShared ? 0 : layer * m_MipTailStride);
+    }
+
     ~TextureVK();
 
     Result Create(const TextureDesc& textureDesc);
     Result Create(const TextureVKDesc& textureVKDesc);
     Result Create(const AllocateTextureDesc& allocateTextureDesc);
+    Result Create(const SparseTextureDesc& sparseTextureDesc);
     VkImageAspectFlags GetImageAspectFlags() const;
     void DestroyVma();
     void GetMemoryDesc(MemoryLocation memoryLocation, MemoryDesc& memoryDesc) const;
@@ -44,11 +53,20 @@ struct TextureVK final : public DebugNameBase {
 
     void SetDebugName(const char* name) DEBUG_NAME_OVERRIDE;
 
+    //================================================================================================================
+    // NRI
+    //================================================================================================================
+
+    Result SetPriority(float priority);
+
 private:
     DeviceVK& m_Device;
     VkImage m_Handle = VK_NULL_HANDLE;
     TextureDesc m_Desc = {};
     VmaAllocation_T* m_VmaAllocation = nullptr;
+    SparseTiling m_SparseTiling = {}; // only for sparse textures
+    uint64_t m_MipTailOffset = 0;
+    uint64_t m_MipTailStride = 0;
     bool m_OwnsNativeObjects = true;
 };
 
@@ -1,6 +1,8 @@
 // © 2021 NVIDIA Corporation
 
 TextureVK::~TextureVK() {
+    m_Device.UntrackResource(VK_OBJECT_TYPE_IMAGE, (uint64_t)m_Handle);
+
     if (m_OwnsNativeObjects) {
         const auto& vk = m_Device.GetDispatchTable();
 
@@ -17,6 +19,9 @@ Result TextureVK::Create(const TextureDesc& textureDesc) {
     VkImageCreateInfo info = {VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
     m_Device.FillCreateInfo(m_Desc, info);
 
+    VkSampleCountFlags sampleCounts = m_Device.GetSampleCounts(m_Desc.format, m_Desc.usage);
+    RETURN_ON_FAILURE(&m_Device, (sampleCounts & info.samples) != 0, Result::UNSUPPORTED, "'sampleNum=%u' is not supported for this format and usage", (uint32_t)info.samples);
+
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.CreateImage(m_Device, &info, m_Device.GetVkAllocationCallbacks(), &m_Handle);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateImage");
@@ -71,4 +76,13 @@ void TextureVK::GetMemoryDesc(MemoryLocation memoryLocation, MemoryDesc& memoryD
 
 NRI_INLINE void TextureVK::SetDebugName(const char* name) {
     m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_IMAGE, (uint64_t)m_Handle, name);
+    m_Device.SetTrackedResourceName(VK_OBJECT_TYPE_IMAGE, (uint64_t)m_Handle, name);
+}
+
+NRI_INLINE Result TextureVK::SetPriority(float priority) {
+    // Only allocations made by "ResourceAllocatorInterface" are known, for resources bound to "Memory" use "SetMemoryPriority"
+    if (!m_VmaAllocation)
+        return Result::UNSUPPORTED;
+
+    return m_Device.SetVmaAllocationPriority(m_VmaAllocation, priority);
 }
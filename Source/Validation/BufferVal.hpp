@@ -25,3 +25,11 @@ NRI_INLINE void BufferVal::Unmap() {
 
     GetCoreInterfaceImpl().UnmapBuffer(*GetImpl());
 }
+
+NRI_INLINE uint64_t BufferVal::GetDeviceAddress() const {
+    RETURN_ON_FAILURE(&m_Device, m_Device.GetDesc().features.deviceAddress, 0, "'features.deviceAddress' is unsupported");
+    RETURN_ON_FAILURE(&m_Device, m_Desc.usage & BufferUsageBits::DEVICE_ADDRESS, 0, "the buffer is not created with 'BufferUsageBits::DEVICE_ADDRESS'");
+    RETURN_ON_FAILURE(&m_Device, m_IsBoundToMemory, 0, "the buffer is not bound to memory");
+
+    return GetCoreInterfaceImpl().GetBufferDeviceAddress(*GetImpl());
+}
@@ -11,10 +11,13 @@ struct PipelineLayoutVal;
 struct CommandBufferVal final : public ObjectVal {
     CommandBufferVal(DeviceVal& device, CommandBuffer* commandBuffer, bool isWrapped)
         : ObjectVal(device, commandBuffer)
+        , m_TransientViews(device.GetStdAllocator())
         , m_IsRecordingStarted(isWrapped)
         , m_IsWrapped(isWrapped) {
     }
 
+    ~CommandBufferVal();
+
     inline CommandBuffer* GetImpl() const {
         return (CommandBuffer*)m_Impl;
     }
@@ -47,6 +50,7 @@ struct CommandBufferVal final : public ObjectVal {
     void SetDepthBias(const DepthBiasDesc& depthBiasDesc);
     void ClearAttachments(const ClearDesc* clearDescs, uint32_t clearDescNum, const Rect* rects, uint32_t rectNum);
     void ClearStorage(const ClearStorageDesc& clearDesc);
+    Result CreateTransientAttachmentView(const Texture2DViewDesc& textureViewDesc, Descriptor*& textureView);
     void BeginRendering(const AttachmentsDesc& attachmentsDesc);
     void EndRendering();
     void SetVertexBuffers(uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum);
@@ -65,6 +69,9 @@ struct CommandBufferVal final : public ObjectVal {
     void CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion);
     void UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout);
     void ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion);
+    void CopyBufferRegions(Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum);
+    void UploadBufferToTextureRegions(Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum);
+    void ReadbackTextureToBufferRegions(Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum);
     void ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size);
     void ResolveTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion);
     void Dispatch(const DispatchDesc& dispatchDesc);
@@ -88,11 +95,14 @@ struct CommandBufferVal final : public ObjectVal {
     void DispatchRaysIndirect(const Buffer& buffer, uint64_t offset);
     void DrawMeshTasks(const DrawMeshTasksDesc& drawMeshTasksDesc);
     void DrawMeshTasksIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
+    void ExecuteIndirect(const ExecuteIndirectDesc& executeIndirectDesc);
 
 private:
     void ValidateReadonlyDepthStencil();
+    void ResetTransientViews();
 
     std::array<DescriptorVal*, 16> m_RenderTargets = {};
+    Vector<DescriptorVal*> m_TransientViews; // wrappers for views owned by the implementation
     DescriptorVal* m_DepthStencil = nullptr;
     PipelineLayoutVal* m_PipelineLayout = nullptr;
     PipelineVal* m_Pipeline = nullptr;
@@ -28,14 +28,20 @@ static bool ValidateTextureBarrierDesc(const DeviceVal& device, uint32_t i, cons
     return true;
 }
 
+CommandBufferVal::~CommandBufferVal() {
+    ResetTransientViews();
+}
+
 NRI_INLINE Result CommandBufferVal::Begin(const DescriptorPool* descriptorPool) {
     RETURN_ON_FAILURE(&m_Device, !m_IsRecordingStarted, Result::FAILURE, "already in the recording state");
 
     DescriptorPool* descriptorPoolImpl = NRI_GET_IMPL(DescriptorPool, descriptorPool);
 
     Result result = GetCoreInterfaceImpl().BeginCommandBuffer(*GetImpl(), descriptorPoolImpl);
-    if (result == Result::SUCCESS)
+    if (result == Result::SUCCESS) {
         m_IsRecordingStarted = true;
+        ResetTransientViews(); // the implementation has destroyed the views
+    }
 
     m_Pipeline = nullptr;
     m_PipelineLayout = nullptr;
@@ -165,6 +171,49 @@ NRI_INLINE void CommandBufferVal::ClearStorage(const ClearStorageDesc& clearDesc
     GetCoreInterfaceImpl().CmdClearStorage(*GetImpl(), clearDescImpl);
 }
 
+NRI_INLINE Result CommandBufferVal::CreateTransientAttachmentView(const Texture2DViewDesc& textureViewDesc, Descriptor*& textureView) {
+    textureView = nullptr;
+
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, Result::FAILURE, "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, textureViewDesc.texture != nullptr, Result::INVALID_ARGUMENT, "'texture' is NULL");
+    RETURN_ON_FAILURE(&m_Device, textureViewDesc.viewType >= Texture2DViewType::COLOR_ATTACHMENT && textureViewDesc.viewType < Texture2DViewType::MAX_NUM, Result::INVALID_ARGUMENT,
+        "'viewType' must be an attachment view type");
+    RETURN_ON_FAILURE(&m_Device, textureViewDesc.format > Format::UNKNOWN && textureViewDesc.format < Format::MAX_NUM, Result::INVALID_ARGUMENT, "'format' is invalid");
+
+    const TextureVal& textureVal = *(TextureVal*)textureViewDesc.texture;
+    const TextureDesc& textureDesc = textureVal.GetDesc();
+
+    RETURN_ON_FAILURE(&m_Device, textureVal.IsBoundToMemory(), Result::INVALID_ARGUMENT, "'textureViewDesc.texture' is not bound to memory");
+
+    RETURN_ON_FAILURE(&m_Device, textureViewDesc.mipOffset + textureViewDesc.mipNum <= textureDesc.mipNum, Result::INVALID_ARGUMENT,
+        "'mipOffset=%u' + 'mipNum=%u' must be <= texture 'mipNum=%u'", textureViewDesc.mipOffset, textureViewDesc.mipNum, textureDesc.mipNum);
+
+    RETURN_ON_FAILURE(&m_Device, textureViewDesc.layerOffset + textureViewDesc.layerNum <= textureDesc.layerNum, Result::INVALID_ARGUMENT,
+        "'layerOffset=%u' + 'layerNum=%u' must be <= texture 'layerNum=%u'", textureViewDesc.layerOffset, textureViewDesc.layerNum, textureDesc.layerNum);
+
+    auto textureViewDescImpl = textureViewDesc;
+    textureViewDescImpl.texture = NRI_GET_IMPL(Texture, textureViewDesc.texture);
+
+    Descriptor* descriptorImpl = nullptr;
+    Result result = GetCoreInterfaceImpl().CreateTransientAttachmentView(*GetImpl(), textureViewDescImpl, descriptorImpl);
+    if (result != Result::SUCCESS)
+        return result;
+
+    // A cached view gets the same wrapper
+    for (DescriptorVal* descriptorVal : m_TransientViews) {
+        if (descriptorVal->GetImpl() == descriptorImpl) {
+            textureView = (Descriptor*)descriptorVal;
+            return Result::SUCCESS;
+        }
+    }
+
+    DescriptorVal* descriptorVal = Allocate<DescriptorVal>(m_Device.GetAllocationCallbacks(), m_Device, descriptorImpl, textureViewDesc);
+    m_TransientViews.push_back(descriptorVal);
+    textureView = (Descriptor*)descriptorVal;
+
+    return Result::SUCCESS;
+}
+
 NRI_INLINE void CommandBufferVal::BeginRendering(const AttachmentsDesc& attachmentsDesc) {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "'CmdBeginRendering' has been already called");
@@ -359,8 +408,13 @@ NRI_INLINE void CommandBufferVal::CopyBuffer(Buffer& dstBuffer, uint64_t dstOffs
 }
 
 NRI_INLINE void CommandBufferVal::CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    const TextureDesc& dstDesc = ((TextureVal&)dstTexture).GetDesc();
+    const TextureDesc& srcDesc = ((TextureVal&)srcTexture).GetDesc();
+
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !(dstDesc.usage & TextureUsageBits::TRANSIENT_ATTACHMENT), ReturnVoid(), "'dstTexture' is a 'TRANSIENT_ATTACHMENT' texture, which contents can't leave a render pass");
+    RETURN_ON_FAILURE(&m_Device, !(srcDesc.usage & TextureUsageBits::TRANSIENT_ATTACHMENT), ReturnVoid(), "'srcTexture' is a 'TRANSIENT_ATTACHMENT' texture, which contents can't leave a render pass");
 
     Texture* dstTextureImpl = NRI_GET_IMPL(Texture, &dstTexture);
     Texture* srcTextureImpl = NRI_GET_IMPL(Texture, &srcTexture);
@@ -369,8 +423,13 @@ NRI_INLINE void CommandBufferVal::CopyTexture(Texture& dstTexture, const Texture
 }
 
 NRI_INLINE void CommandBufferVal::ResolveTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    const TextureDesc& dstDesc = ((TextureVal&)dstTexture).GetDesc();
+    const TextureDesc& srcDesc = ((TextureVal&)srcTexture).GetDesc();
+
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !(dstDesc.usage & TextureUsageBits::TRANSIENT_ATTACHMENT), ReturnVoid(), "'dstTexture' is a 'TRANSIENT_ATTACHMENT' texture, which contents can't leave a render pass");
+    RETURN_ON_FAILURE(&m_Device, !(srcDesc.usage & TextureUsageBits::TRANSIENT_ATTACHMENT), ReturnVoid(), "'srcTexture' is a 'TRANSIENT_ATTACHMENT' texture, which contents can't leave a render pass");
 
     Texture* dstTextureImpl = NRI_GET_IMPL(Texture, &dstTexture);
     Texture* srcTextureImpl = NRI_GET_IMPL(Texture, &srcTexture);
@@ -379,8 +438,11 @@ NRI_INLINE void CommandBufferVal::ResolveTexture(Texture& dstTexture, const Text
 }
 
 NRI_INLINE void CommandBufferVal::UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout) {
+    const TextureDesc& dstDesc = ((TextureVal&)dstTexture).GetDesc();
+
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !(dstDesc.usage & TextureUsageBits::TRANSIENT_ATTACHMENT), ReturnVoid(), "'dstTexture' is a 'TRANSIENT_ATTACHMENT' texture, which contents can't leave a render pass");
 
     Texture* dstTextureImpl = NRI_GET_IMPL(Texture, &dstTexture);
     Buffer* srcBufferImpl = NRI_GET_IMPL(Buffer, &srcBuffer);
@@ -389,8 +451,11 @@ NRI_INLINE void CommandBufferVal::UploadBufferToTexture(Texture& dstTexture, con
 }
 
 NRI_INLINE void CommandBufferVal::ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion) {
+    const TextureDesc& srcDesc = ((TextureVal&)srcTexture).GetDesc();
+
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !(srcDesc.usage & TextureUsageBits::TRANSIENT_ATTACHMENT), ReturnVoid(), "'srcTexture' is a 'TRANSIENT_ATTACHMENT' texture, which contents can't leave a render pass");
 
     Buffer* dstBufferImpl = NRI_GET_IMPL(Buffer, &dstBuffer);
     Texture* srcTextureImpl = NRI_GET_IMPL(Texture, &srcTexture);
@@ -398,6 +463,75 @@ NRI_INLINE void CommandBufferVal::ReadbackTextureToBuffer(Buffer& dstBuffer, con
     GetCoreInterfaceImpl().CmdReadbackTextureToBuffer(*GetImpl(), *dstBufferImpl, dstDataLayout, *srcTextureImpl, srcRegion);
 }
 
+NRI_INLINE void CommandBufferVal::CopyBufferRegions(Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    const BufferDesc& dstDesc = ((BufferVal&)dstBuffer).GetDesc();
+    const BufferDesc& srcDesc = ((BufferVal&)srcBuffer).GetDesc();
+
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, regionNum == 0 || regions != nullptr, ReturnVoid(), "'regions' is NULL");
+
+    for (uint32_t i = 0; i < regionNum; i++) {
+        const BufferCopyRegionDesc& region = regions[i];
+
+        if (region.size == WHOLE_SIZE) {
+            RETURN_ON_FAILURE(&m_Device, region.dstOffset == 0, ReturnVoid(), "'regions[%u]': 'WHOLE_SIZE' is used but 'dstOffset' is not 0", i);
+            RETURN_ON_FAILURE(&m_Device, region.srcOffset == 0, ReturnVoid(), "'regions[%u]': 'WHOLE_SIZE' is used but 'srcOffset' is not 0", i);
+            RETURN_ON_FAILURE(&m_Device, dstDesc.size == srcDesc.size, ReturnVoid(), "'regions[%u]': 'WHOLE_SIZE' is used but 'dstBuffer' and 'srcBuffer' have different sizes", i);
+        } else {
+            RETURN_ON_FAILURE(&m_Device, region.srcOffset + region.size <= srcDesc.size, ReturnVoid(), "'regions[%u]': 'srcOffset + size' > srcBuffer.size", i);
+            RETURN_ON_FAILURE(&m_Device, region.dstOffset + region.size <= dstDesc.size, ReturnVoid(), "'regions[%u]': 'dstOffset + size' > dstBuffer.size", i);
+        }
+    }
+
+    Buffer* dstBufferImpl = NRI_GET_IMPL(Buffer, &dstBuffer);
+    Buffer* srcBufferImpl = NRI_GET_IMPL(Buffer, &srcBuffer);
+
+    GetCoreInterfaceImpl().CmdCopyBufferRegions(*GetImpl(), *dstBufferImpl, *srcBufferImpl, regions, regionNum);
+}
+
+NRI_INLINE void CommandBufferVal::UploadBufferToTextureRegions(Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    const TextureDesc& dstDesc = ((TextureVal&)dstTexture).GetDesc();
+
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !(dstDesc.usage & TextureUsageBits::TRANSIENT_ATTACHMENT), ReturnVoid(), "'dstTexture' is a 'TRANSIENT_ATTACHMENT' texture, which contents can't leave a render pass");
+    RETURN_ON_FAILURE(&m_Device, regionNum == 0 || regions != nullptr, ReturnVoid(), "'regions' is NULL");
+
+    for (uint32_t i = 0; i < regionNum; i++) {
+        const TextureRegionDesc& textureRegion = regions[i].textureRegion;
+
+        RETURN_ON_FAILURE(&m_Device, textureRegion.mipOffset < dstDesc.mipNum, ReturnVoid(), "'regions[%u].textureRegion.mipOffset' is out of bounds", i);
+        RETURN_ON_FAILURE(&m_Device, textureRegion.layerOffset < dstDesc.layerNum, ReturnVoid(), "'regions[%u].textureRegion.layerOffset' is out of bounds", i);
+    }
+
+    Texture* dstTextureImpl = NRI_GET_IMPL(Texture, &dstTexture);
+    Buffer* srcBufferImpl = NRI_GET_IMPL(Buffer, &srcBuffer);
+
+    GetCoreInterfaceImpl().CmdUploadBufferToTextureRegions(*GetImpl(), *dstTextureImpl, *srcBufferImpl, regions, regionNum);
+}
+
+NRI_INLINE void CommandBufferVal::ReadbackTextureToBufferRegions(Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    const TextureDesc& srcDesc = ((TextureVal&)srcTexture).GetDesc();
+
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !(srcDesc.usage & TextureUsageBits::TRANSIENT_ATTACHMENT), ReturnVoid(), "'srcTexture' is a 'TRANSIENT_ATTACHMENT' texture, which contents can't leave a render pass");
+    RETURN_ON_FAILURE(&m_Device, regionNum == 0 || regions != nullptr, ReturnVoid(), "'regions' is NULL");
+
+    for (uint32_t i = 0; i < regionNum; i++) {
+        const TextureRegionDesc& textureRegion = regions[i].textureRegion;
+
+        RETURN_ON_FAILURE(&m_Device, textureRegion.mipOffset < srcDesc.mipNum, ReturnVoid(), "'regions[%u].textureRegion.mipOffset' is out of bounds", i);
+        RETURN_ON_FAILURE(&m_Device, textureRegion.layerOffset < srcDesc.layerNum, ReturnVoid(), "'regions[%u].textureRegion.layerOffset' is out of bounds", i);
+    }
+
+    Buffer* dstBufferImpl = NRI_GET_IMPL(Buffer, &dstBuffer);
+    Texture* srcTextureImpl = NRI_GET_IMPL(Texture, &srcTexture);
+
+    GetCoreInterfaceImpl().CmdReadbackTextureToBufferRegions(*GetImpl(), *dstBufferImpl, *srcTextureImpl, regions, regionNum);
+}
+
 NRI_INLINE void CommandBufferVal::ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size) {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     if (size == WHOLE_SIZE) {
@@ -768,6 +902,42 @@ NRI_INLINE void CommandBufferVal::DrawMeshTasksIndirect(const Buffer& buffer, ui
     GetMeshShaderInterfaceImpl().CmdDrawMeshTasksIndirect(*GetImpl(), *bufferImpl, offset, drawNum, stride, countBufferImpl, countBufferOffset);
 }
 
+NRI_INLINE void CommandBufferVal::ExecuteIndirect(const ExecuteIndirectDesc& executeIndirectDesc) {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, executeIndirectDesc.commandSignature != nullptr, ReturnVoid(), "'commandSignature' is NULL");
+    RETURN_ON_FAILURE(&m_Device, executeIndirectDesc.buffer != nullptr, ReturnVoid(), "'buffer' is NULL");
+
+    const CommandSignatureVal& commandSignatureVal = *(CommandSignatureVal*)executeIndirectDesc.commandSignature;
+    const BufferDesc& bufferDesc = ((BufferVal*)executeIndirectDesc.buffer)->GetDesc();
+
+    if (commandSignatureVal.IsDispatch()) {
+        RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    } else {
+        RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    }
+
+    RETURN_ON_FAILURE(&m_Device, m_Pipeline != nullptr, ReturnVoid(), "a pipeline must be bound");
+    RETURN_ON_FAILURE(&m_Device, !commandSignatureVal.HasRootConstants() || m_PipelineLayout, ReturnVoid(), "a pipeline layout must be bound");
+    RETURN_ON_FAILURE(&m_Device, executeIndirectDesc.offset < bufferDesc.size, ReturnVoid(), "'offset' is greater than the buffer size");
+    RETURN_ON_FAILURE(&m_Device, executeIndirectDesc.offset % 4 == 0, ReturnVoid(), "'offset' must be a multiple of 4");
+
+    if (m_Device.GetDesc().graphicsAPI == GraphicsAPI::VK) {
+        RETURN_ON_FAILURE(&m_Device, executeIndirectDesc.preprocessBuffer != nullptr, ReturnVoid(), "'preprocessBuffer' is required");
+
+        const BufferDesc& preprocessBufferDesc = ((BufferVal*)executeIndirectDesc.preprocessBuffer)->GetDesc();
+        RETURN_ON_FAILURE(&m_Device, preprocessBufferDesc.usage & BufferUsageBits::PREPROCESS_BUFFER, ReturnVoid(), "'preprocessBuffer' is not created with 'BufferUsageBits::PREPROCESS_BUFFER'");
+        RETURN_ON_FAILURE(&m_Device, executeIndirectDesc.preprocessBufferOffset < preprocessBufferDesc.size, ReturnVoid(), "'preprocessBufferOffset' is greater than the buffer size");
+    }
+
+    auto executeIndirectDescImpl = executeIndirectDesc;
+    executeIndirectDescImpl.commandSignature = commandSignatureVal.GetImpl();
+    executeIndirectDescImpl.buffer = NRI_GET_IMPL(Buffer, executeIndirectDesc.buffer);
+    executeIndirectDescImpl.countBuffer = NRI_GET_IMPL(Buffer, executeIndirectDesc.countBuffer);
+    executeIndirectDescImpl.preprocessBuffer = NRI_GET_IMPL(Buffer, executeIndirectDesc.preprocessBuffer);
+
+    GetIndirectCommandsInterfaceImpl().CmdExecuteIndirect(*GetImpl(), executeIndirectDescImpl);
+}
+
 NRI_INLINE void CommandBufferVal::ValidateReadonlyDepthStencil() {
     if (m_Pipeline && m_DepthStencil) {
         if (m_DepthStencil->IsDepthReadonly() && m_Pipeline->WritesToDepth())
@@ -777,3 +947,10 @@ NRI_INLINE void CommandBufferVal::ValidateReadonlyDepthStencil() {
             REPORT_WARNING(&m_Device, "Stencil is read-only, but the pipeline writes to stencil. Writing happens only in VK!");
     }
 }
+
+NRI_INLINE void CommandBufferVal::ResetTransientViews() {
+    for (DescriptorVal* descriptorVal : m_TransientViews)
+        Destroy(descriptorVal);
+
+    m_TransientViews.clear();
+}
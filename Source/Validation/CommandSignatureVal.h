@@ -0,0 +1,40 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct CommandSignatureVal final : public ObjectVal {
+    inline CommandSignatureVal(DeviceVal& device, CommandSignature* commandSignature, const CommandSignatureDesc& commandSignatureDesc)
+        : ObjectVal(device, commandSignature)
+        , m_ArgumentNum(commandSignatureDesc.argumentNum)
+        , m_Action(commandSignatureDesc.arguments[commandSignatureDesc.argumentNum - 1].type) {
+        for (uint32_t i = 0; i < commandSignatureDesc.argumentNum; i++) {
+            if (commandSignatureDesc.arguments[i].type == IndirectArgumentType::ROOT_CONSTANTS)
+                m_HasRootConstants = true;
+        }
+    }
+
+    inline CommandSignature* GetImpl() const {
+        return (CommandSignature*)m_Impl;
+    }
+
+    inline uint32_t GetArgumentNum() const {
+        return m_ArgumentNum;
+    }
+
+    inline bool IsDispatch() const {
+        return m_Action == IndirectArgumentType::DISPATCH;
+    }
+
+    inline bool HasRootConstants() const {
+        return m_HasRootConstants;
+    }
+
+private:
+    uint32_t m_ArgumentNum = 0;
+    IndirectArgumentType m_Action = IndirectArgumentType::MAX_NUM;
+    bool m_HasRootConstants = false;
+};
+
+} // namespace nri
@@ -7,13 +7,16 @@ namespace nri {
 struct QueueVal;
 
 struct IsExtSupported {
-    uint32_t lowLatency   : 1;
-    uint32_t meshShader   : 1;
-    uint32_t rayTracing   : 1;
-    uint32_t swapChain    : 1;
-    uint32_t wrapperD3D11 : 1;
-    uint32_t wrapperD3D12 : 1;
-    uint32_t wrapperVK    : 1;
+    uint32_t indirectCommands : 1;
+    uint32_t lowLatency       : 1;
+    uint32_t meshShader       : 1;
+    uint32_t rayTracing       : 1;
+    uint32_t residency        : 1;
+    uint32_t sparse           : 1;
+    uint32_t swapChain        : 1;
+    uint32_t wrapperD3D11     : 1;
+    uint32_t wrapperD3D12     : 1;
+    uint32_t wrapperVK        : 1;
 };
 
 struct DeviceVal final : public DeviceBase {
@@ -36,6 +39,10 @@ struct DeviceVal final : public DeviceBase {
         return m_iHelperImpl;
     }
 
+    inline const IndirectCommandsInterface& GetIndirectCommandsInterfaceImpl() const {
+        return m_iIndirectCommandsImpl;
+    }
+
     inline const LowLatencyInterface& GetLowLatencyInterfaceImpl() const {
         return m_iLowLatencyImpl;
     }
@@ -48,6 +55,14 @@ struct DeviceVal final : public DeviceBase {
         return m_iRayTracingImpl;
     }
 
+    inline const ResidencyInterface& GetResidencyInterfaceImpl() const {
+        return m_iResidencyImpl;
+    }
+
+    inline const SparseInterface& GetSparseInterfaceImpl() const {
+        return m_iSparseImpl;
+    }
+
     inline const SwapChainInterface& GetSwapChainInterfaceImpl() const {
         return m_iSwapChainImpl;
     }
@@ -102,12 +117,19 @@ struct DeviceVal final : public DeviceBase {
     void Destruct() override;
     Result FillFunctionTable(CoreInterface& table) const override;
     Result FillFunctionTable(HelperInterface& table) const override;
+    Result FillFunctionTable(IndirectCommandsInterface& table) const override;
     Result FillFunctionTable(LowLatencyInterface& table) const override;
     Result FillFunctionTable(MeshShaderInterface& table) const override;
+    Result FillFunctionTable(MicromapBakerInterface& table) const override;
+    Result FillFunctionTable(ProfilerInterface& table) const override;
     Result FillFunctionTable(RayTracingInterface& table) const override;
+    Result FillFunctionTable(RenderGraphInterface& table) const override;
+    Result FillFunctionTable(ResidencyInterface& table) const override;
     Result FillFunctionTable(ResourceAllocatorInterface& table) const override;
+    Result FillFunctionTable(SparseInterface& table) const override;
     Result FillFunctionTable(StreamerInterface& table) const override;
     Result FillFunctionTable(SwapChainInterface& table) const override;
+    Result FillFunctionTable(TraceInterface& table) const override;
     Result FillFunctionTable(UpscalerInterface& table) const override;
     Result FillFunctionTable(WrapperD3D11Interface& table) const override;
     Result FillFunctionTable(WrapperD3D12Interface& table) const override;
@@ -142,10 +164,15 @@ struct DeviceVal final : public DeviceBase {
     Result AllocateMemory(const AllocateMemoryDesc& allocateMemoryDesc, Memory*& memory);
     Result AllocateBuffer(const AllocateBufferDesc& allocateBufferDesc, Buffer*& buffer);
     Result AllocateTexture(const AllocateTextureDesc& allocateTextureDesc, Texture*& texture);
+    Result CreateSparseBuffer(const SparseBufferDesc& sparseBufferDesc, Buffer*& buffer);
+    Result CreateSparseTexture(const SparseTextureDesc& sparseTextureDesc, Texture*& texture);
+    Result CreateCommandSignature(const CommandSignatureDesc& commandSignatureDesc, CommandSignature*& commandSignature);
     Result CreateQueryPool(const QueryPoolDesc& queryPoolDesc, QueryPool*& queryPool);
     Result CreateQueryPool(const QueryPoolVKDesc& queryPoolVKDesc, QueryPool*& queryPool);
     Result CreateSwapChain(const SwapChainDesc& swapChainDesc, SwapChain*& swapChain);
     Result AllocateMicromap(const AllocateMicromapDesc& allocateMicromapDesc, Micromap*& micromap);
+    Result GetResourceAllocatorStatistics(ResourceAllocatorHeapStatistics* heapStatistics, uint32_t& heapStatisticsNum);
+    Result GetResourceAllocatorDump(char* dump, uint64_t& dumpSize);
     Result CreateDescriptor(const SamplerDesc& samplerDesc, Descriptor*& sampler);
     Result CreateDescriptor(const BufferViewDesc& bufferViewDesc, Descriptor*& bufferView);
     Result CreateDescriptor(const Texture1DViewDesc& textureViewDesc, Descriptor*& textureView);
@@ -201,10 +228,13 @@ private:
     // Implementation
     CoreInterface m_iCoreImpl = {};
     HelperInterface m_iHelperImpl = {};
+    IndirectCommandsInterface m_iIndirectCommandsImpl = {};
     LowLatencyInterface m_iLowLatencyImpl = {};
     MeshShaderInterface m_iMeshShaderImpl = {};
     RayTracingInterface m_iRayTracingImpl = {};
+    ResidencyInterface m_iResidencyImpl = {};
     ResourceAllocatorInterface m_iResourceAllocatorImpl = {};
+    SparseInterface m_iSparseImpl = {};
     SwapChainInterface m_iSwapChainImpl = {};
     WrapperD3D11Interface m_iWrapperD3D11Impl = {};
     WrapperD3D12Interface m_iWrapperD3D12Impl = {};
@@ -64,9 +64,12 @@ bool DeviceVal::Create() {
     result = deviceBaseImpl.FillFunctionTable(m_iResourceAllocatorImpl);
     RETURN_ON_FAILURE(this, result == Result::SUCCESS, false, "Failed to get 'ResourceAllocatorInterface' interface");
 
+    m_IsExtSupported.indirectCommands = deviceBaseImpl.FillFunctionTable(m_iIndirectCommandsImpl) == Result::SUCCESS;
     m_IsExtSupported.lowLatency = deviceBaseImpl.FillFunctionTable(m_iLowLatencyImpl) == Result::SUCCESS;
     m_IsExtSupported.meshShader = deviceBaseImpl.FillFunctionTable(m_iMeshShaderImpl) == Result::SUCCESS;
     m_IsExtSupported.rayTracing = deviceBaseImpl.FillFunctionTable(m_iRayTracingImpl) == Result::SUCCESS;
+    m_IsExtSupported.residency = deviceBaseImpl.FillFunctionTable(m_iResidencyImpl) == Result::SUCCESS;
+    m_IsExtSupported.sparse = deviceBaseImpl.FillFunctionTable(m_iSparseImpl) == Result::SUCCESS;
     m_IsExtSupported.swapChain = deviceBaseImpl.FillFunctionTable(m_iSwapChainImpl) == Result::SUCCESS;
     m_IsExtSupported.wrapperD3D11 = deviceBaseImpl.FillFunctionTable(m_iWrapperD3D11Impl) == Result::SUCCESS;
     m_IsExtSupported.wrapperD3D12 = deviceBaseImpl.FillFunctionTable(m_iWrapperD3D12Impl) == Result::SUCCESS;
@@ -74,6 +77,8 @@ bool DeviceVal::Create() {
 
     m_Desc = GetDesc();
 
+    ShareStatistics((DeviceBase&)m_Impl);
+
     return FillFunctionTable(m_iCore) == Result::SUCCESS;
 }
 
@@ -93,6 +98,7 @@ NRI_INLINE Result DeviceVal::CreateSwapChain(const SwapChainDesc& swapChainDesc,
     RETURN_ON_FAILURE(this, swapChainDesc.height != 0, Result::INVALID_ARGUMENT, "'height' is 0");
     RETURN_ON_FAILURE(this, swapChainDesc.textureNum != 0, Result::INVALID_ARGUMENT, "'textureNum' is invalid");
     RETURN_ON_FAILURE(this, swapChainDesc.format < SwapChainFormat::MAX_NUM, Result::INVALID_ARGUMENT, "'format' is invalid");
+    RETURN_ON_FAILURE(this, swapChainDesc.window.headless.enable || GetDesc().features.swapChain, Result::UNSUPPORTED, "'features.swapChain' is false");
 
     auto swapChainDescImpl = swapChainDesc;
     swapChainDescImpl.queue = NRI_GET_IMPL(Queue, swapChainDesc.queue);
@@ -194,6 +200,9 @@ NRI_INLINE Result DeviceVal::CreateTexture(const TextureDesc& textureDesc, Textu
     constexpr TextureUsageBits attachmentBits = TextureUsageBits::COLOR_ATTACHMENT | TextureUsageBits::DEPTH_STENCIL_ATTACHMENT | TextureUsageBits::SHADING_RATE_ATTACHMENT;
     RETURN_ON_FAILURE(this, textureDesc.sharingMode != SharingMode::EXCLUSIVE || (textureDesc.usage & attachmentBits), Result::INVALID_ARGUMENT, "'EXCLUSIVE' is needed only for attachments to enable DCC on some HW");
 
+    constexpr TextureUsageBits transientBits = TextureUsageBits::TRANSIENT_ATTACHMENT | TextureUsageBits::COLOR_ATTACHMENT | TextureUsageBits::DEPTH_STENCIL_ATTACHMENT;
+    RETURN_ON_FAILURE(this, !(textureDesc.usage & TextureUsageBits::TRANSIENT_ATTACHMENT) || !(textureDesc.usage & ~transientBits), Result::INVALID_ARGUMENT, "'TRANSIENT_ATTACHMENT' can be combined only with 'COLOR_ATTACHMENT' or 'DEPTH_STENCIL_ATTACHMENT'");
+
     Texture* textureImpl = nullptr;
     Result result = m_iCoreImpl.CreateTexture(m_Impl, textureDesc, textureImpl);
 
@@ -211,6 +220,9 @@ NRI_INLINE Result DeviceVal::AllocateTexture(const AllocateTextureDesc& allocate
     RETURN_ON_FAILURE(this, allocateTextureDesc.desc.width != 0, Result::INVALID_ARGUMENT, "'desc.width' is 0");
     RETURN_ON_FAILURE(this, allocateTextureDesc.desc.mipNum <= maxMipNum, Result::INVALID_ARGUMENT, "'desc.mipNum=%u' can't be > %u", allocateTextureDesc.desc.mipNum, maxMipNum);
 
+    constexpr TextureUsageBits transientBits = TextureUsageBits::TRANSIENT_ATTACHMENT | TextureUsageBits::COLOR_ATTACHMENT | TextureUsageBits::DEPTH_STENCIL_ATTACHMENT;
+    RETURN_ON_FAILURE(this, !(allocateTextureDesc.desc.usage & TextureUsageBits::TRANSIENT_ATTACHMENT) || !(allocateTextureDesc.desc.usage & ~transientBits), Result::INVALID_ARGUMENT, "'desc.usage' has 'TRANSIENT_ATTACHMENT', which can be combined only with 'COLOR_ATTACHMENT' or 'DEPTH_STENCIL_ATTACHMENT'");
+
     Texture* textureImpl = nullptr;
     Result result = m_iResourceAllocatorImpl.AllocateTexture(m_Impl, allocateTextureDesc, textureImpl);
 
@@ -221,6 +233,89 @@ NRI_INLINE Result DeviceVal::AllocateTexture(const AllocateTextureDesc& allocate
     return result;
 }
 
+NRI_INLINE Result DeviceVal::CreateSparseBuffer(const SparseBufferDesc& sparseBufferDesc, Buffer*& buffer) {
+    RETURN_ON_FAILURE(this, sparseBufferDesc.desc.size != 0, Result::INVALID_ARGUMENT, "'desc.size' is 0");
+
+    Buffer* bufferImpl = nullptr;
+    Result result = m_iSparseImpl.CreateSparseBuffer(m_Impl, sparseBufferDesc, bufferImpl);
+
+    buffer = nullptr;
+    if (result == Result::SUCCESS)
+        buffer = (Buffer*)Allocate<BufferVal>(GetAllocationCallbacks(), *this, bufferImpl, true);
+
+    return result;
+}
+
+NRI_INLINE Result DeviceVal::CreateSparseTexture(const SparseTextureDesc& sparseTextureDesc, Texture*& texture) {
+    const TextureDesc& textureDesc = sparseTextureDesc.desc;
+    Dim_t maxMipNum = GetMaxMipNum(textureDesc.width, textureDesc.height, textureDesc.depth);
+
+    RETURN_ON_FAILURE(this, textureDesc.format > Format::UNKNOWN && textureDesc.format < Format::MAX_NUM, Result::INVALID_ARGUMENT, "'desc.format' is invalid");
+    RETURN_ON_FAILURE(this, textureDesc.width != 0, Result::INVALID_ARGUMENT, "'desc.width' is 0");
+    RETURN_ON_FAILURE(this, textureDesc.mipNum <= maxMipNum, Result::INVALID_ARGUMENT, "'desc.mipNum=%u' can't be > %u", textureDesc.mipNum, maxMipNum);
+    RETURN_ON_FAILURE(this, textureDesc.type != TextureType::TEXTURE_1D, Result::INVALID_ARGUMENT, "1D textures can't be sparse");
+    RETURN_ON_FAILURE(this, textureDesc.sampleNum <= 1, Result::INVALID_ARGUMENT, "multisampled textures can't be sparse");
+
+    Texture* textureImpl = nullptr;
+    Result result = m_iSparseImpl.CreateSparseTexture(m_Impl, sparseTextureDesc, textureImpl);
+
+    texture = nullptr;
+    if (result == Result::SUCCESS)
+        texture = (Texture*)Allocate<TextureVal>(GetAllocationCallbacks(), *this, textureImpl, true);
+
+    return result;
+}
+
+NRI_INLINE Result DeviceVal::CreateCommandSignature(const CommandSignatureDesc& commandSignatureDesc, CommandSignature*& commandSignature) {
+    RETURN_ON_FAILURE(this, commandSignatureDesc.argumentNum != 0, Result::INVALID_ARGUMENT, "'argumentNum' is 0");
+    RETURN_ON_FAILURE(this, commandSignatureDesc.arguments != nullptr, Result::INVALID_ARGUMENT, "'arguments' is NULL");
+    RETURN_ON_FAILURE(this, commandSignatureDesc.stride % 4 == 0, Result::INVALID_ARGUMENT, "'stride' must be a multiple of 4");
+
+    const PipelineLayoutVal* pipelineLayoutVal = (PipelineLayoutVal*)commandSignatureDesc.pipelineLayout;
+    uint32_t packedStride = 0;
+
+    for (uint32_t i = 0; i < commandSignatureDesc.argumentNum; i++) {
+        const IndirectArgumentDesc& argumentDesc = commandSignatureDesc.arguments[i];
+        bool isAction = argumentDesc.type >= IndirectArgumentType::DRAW;
+        bool isLast = i == commandSignatureDesc.argumentNum - 1;
+
+        RETURN_ON_FAILURE(this, argumentDesc.type < IndirectArgumentType::MAX_NUM, Result::INVALID_ARGUMENT, "'arguments[%u].type' is invalid", i);
+        RETURN_ON_FAILURE(this, isAction == isLast, Result::INVALID_ARGUMENT, "the last argument (and only it) must be a draw or a dispatch, 'arguments[%u]' is not", i);
+
+        if (argumentDesc.type == IndirectArgumentType::ROOT_CONSTANTS) {
+            RETURN_ON_FAILURE(this, pipelineLayoutVal != nullptr, Result::INVALID_ARGUMENT, "'pipelineLayout' is required for 'ROOT_CONSTANTS'");
+
+            const PipelineLayoutDesc& pipelineLayoutDesc = pipelineLayoutVal->GetPipelineLayoutDesc();
+            RETURN_ON_FAILURE(this, argumentDesc.index < pipelineLayoutDesc.rootConstantNum, Result::INVALID_ARGUMENT, "'arguments[%u].index' is out of bounds", i);
+
+            const RootConstantDesc& rootConstantDesc = pipelineLayoutDesc.rootConstants[argumentDesc.index];
+            RETURN_ON_FAILURE(this, argumentDesc.size != 0 && argumentDesc.size % 4 == 0, Result::INVALID_ARGUMENT, "'arguments[%u].size' must be a non-zero multiple of 4", i);
+            RETURN_ON_FAILURE(this, argumentDesc.offset % 4 == 0, Result::INVALID_ARGUMENT, "'arguments[%u].offset' must be a multiple of 4", i);
+            RETURN_ON_FAILURE(this, argumentDesc.offset + argumentDesc.size <= rootConstantDesc.size, Result::INVALID_ARGUMENT, "'arguments[%u]' is out of the root constant bounds", i);
+        } else if (argumentDesc.type == IndirectArgumentType::VERTEX_BUFFER) {
+            RETURN_ON_FAILURE(this, argumentDesc.index < GetDesc().shaderStage.vertex.streamMaxNum, Result::INVALID_ARGUMENT, "'arguments[%u].index' is out of bounds", i);
+        } else if (argumentDesc.type == IndirectArgumentType::DRAW_MESH_TASKS) {
+            RETURN_ON_FAILURE(this, GetDesc().features.meshShader, Result::UNSUPPORTED, "'features.meshShader' is false");
+        }
+
+        packedStride += GetIndirectArgumentSize(argumentDesc);
+    }
+
+    RETURN_ON_FAILURE(this, commandSignatureDesc.stride == 0 || commandSignatureDesc.stride >= packedStride, Result::INVALID_ARGUMENT, "'stride' can't be < %u", packedStride);
+
+    auto commandSignatureDescImpl = commandSignatureDesc;
+    commandSignatureDescImpl.pipelineLayout = NRI_GET_IMPL(PipelineLayout, commandSignatureDesc.pipelineLayout);
+
+    CommandSignature* commandSignatureImpl = nullptr;
+    Result result = m_iIndirectCommandsImpl.CreateCommandSignature(m_Impl, commandSignatureDescImpl, commandSignatureImpl);
+
+    commandSignature = nullptr;
+    if (result == Result::SUCCESS)
+        commandSignature = (CommandSignature*)Allocate<CommandSignatureVal>(GetAllocationCallbacks(), *this, commandSignatureImpl, commandSignatureDesc);
+
+    return result;
+}
+
 NRI_INLINE Result DeviceVal::CreateDescriptor(const BufferViewDesc& bufferViewDesc, Descriptor*& bufferView) {
     RETURN_ON_FAILURE(this, bufferViewDesc.buffer != nullptr, Result::INVALID_ARGUMENT, "'buffer' is NULL");
     RETURN_ON_FAILURE(this, bufferViewDesc.format < Format::MAX_NUM, Result::INVALID_ARGUMENT, "'format' is invalid");
@@ -255,6 +350,8 @@ NRI_INLINE Result DeviceVal::CreateDescriptor(const Texture1DViewDesc& textureVi
     const TextureDesc& textureDesc = textureVal.GetDesc();
 
     RETURN_ON_FAILURE(this, textureVal.IsBoundToMemory(), Result::INVALID_ARGUMENT, "'textureViewDesc.texture' is not bound to memory");
+    RETURN_ON_FAILURE(this, !(textureDesc.usage & TextureUsageBits::TRANSIENT_ATTACHMENT) || textureViewDesc.viewType >= Texture1DViewType::COLOR_ATTACHMENT, Result::INVALID_ARGUMENT,
+        "'TRANSIENT_ATTACHMENT' textures can only have attachment views");
 
     RETURN_ON_FAILURE(this, textureViewDesc.mipOffset + textureViewDesc.mipNum <= textureDesc.mipNum, Result::INVALID_ARGUMENT,
         "'mipOffset=%u' + 'mipNum=%u' must be <= texture 'mipNum=%u'", textureViewDesc.mipOffset, textureViewDesc.mipNum, textureDesc.mipNum);
@@ -284,6 +381,8 @@ NRI_INLINE Result DeviceVal::CreateDescriptor(const Texture2DViewDesc& textureVi
     const TextureDesc& textureDesc = textureVal.GetDesc();
 
     RETURN_ON_FAILURE(this, textureVal.IsBoundToMemory(), Result::INVALID_ARGUMENT, "'textureViewDesc.texture' is not bound to memory");
+    RETURN_ON_FAILURE(this, !(textureDesc.usage & TextureUsageBits::TRANSIENT_ATTACHMENT) || textureViewDesc.viewType >= Texture2DViewType::COLOR_ATTACHMENT, Result::INVALID_ARGUMENT,
+        "'TRANSIENT_ATTACHMENT' textures can only have attachment views");
 
     RETURN_ON_FAILURE(this, textureViewDesc.mipOffset + textureViewDesc.mipNum <= textureDesc.mipNum, Result::INVALID_ARGUMENT,
         "'mipOffset=%u' + 'mipNum=%u' must be <= texture 'mipNum=%u'", textureViewDesc.mipOffset, textureViewDesc.mipNum, textureDesc.mipNum);
@@ -313,6 +412,8 @@ NRI_INLINE Result DeviceVal::CreateDescriptor(const Texture3DViewDesc& textureVi
     const TextureDesc& textureDesc = textureVal.GetDesc();
 
     RETURN_ON_FAILURE(this, textureVal.IsBoundToMemory(), Result::INVALID_ARGUMENT, "'textureViewDesc.texture' is not bound to memory");
+    RETURN_ON_FAILURE(this, !(textureDesc.usage & TextureUsageBits::TRANSIENT_ATTACHMENT) || textureViewDesc.viewType >= Texture3DViewType::COLOR_ATTACHMENT, Result::INVALID_ARGUMENT,
+        "'TRANSIENT_ATTACHMENT' textures can only have attachment views");
 
     RETURN_ON_FAILURE(this, textureViewDesc.mipOffset + textureViewDesc.mipNum <= textureDesc.mipNum, Result::INVALID_ARGUMENT,
         "'mipOffset=%u' + 'mipNum=%u' must be <= texture 'mipNum=%u'", textureViewDesc.mipOffset, textureViewDesc.mipNum, textureDesc.mipNum);
@@ -1177,6 +1278,18 @@ NRI_INLINE Result DeviceVal::AllocateMicromap(const AllocateMicromapDesc& alloca
     return result;
 }
 
+NRI_INLINE Result DeviceVal::GetResourceAllocatorStatistics(ResourceAllocatorHeapStatistics* heapStatistics, uint32_t& heapStatisticsNum) {
+    RETURN_ON_FAILURE(this, !heapStatistics || heapStatisticsNum != 0, Result::INVALID_ARGUMENT, "'heapStatisticsNum' is 0");
+
+    return m_iResourceAllocatorImpl.GetResourceAllocatorStatistics(m_Impl, heapStatistics, heapStatisticsNum);
+}
+
+NRI_INLINE Result DeviceVal::GetResourceAllocatorDump(char* dump, uint64_t& dumpSize) {
+    RETURN_ON_FAILURE(this, !dump || dumpSize != 0, Result::INVALID_ARGUMENT, "'dumpSize' is 0");
+
+    return m_iResourceAllocatorImpl.GetResourceAllocatorDump(m_Impl, dump, dumpSize);
+}
+
 NRI_INLINE Result DeviceVal::BindMicromapMemory(const BindMicromapMemoryDesc* bindMicromapMemoryDescs, uint32_t bindMicromapMemoryDescNum) {
     Scratch<BindMicromapMemoryDesc> bindMicromapMemoryDescsImpl = AllocateScratch(*this, BindMicromapMemoryDesc, bindMicromapMemoryDescNum);
     for (uint32_t i = 0; i < bindMicromapMemoryDescNum; i++) {
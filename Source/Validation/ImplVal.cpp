@@ -6,6 +6,7 @@
 #include "BufferVal.h"
 #include "CommandAllocatorVal.h"
 #include "CommandBufferVal.h"
+#include "CommandSignatureVal.h"
 #include "DescriptorPoolVal.h"
 #include "DescriptorSetVal.h"
 #include "DescriptorVal.h"
@@ -22,6 +23,11 @@
 
 #include "HelperInterface.h"
 #include "ImguiInterface.h"
+#include "MicromapBakerInterface.h"
+#include "ProfilerInterface.h"
+#include "RenderGraphInterface.h"
+#include "ResidencyInterface.h"
+#include "SparseInterface.h"
 #include "StreamerInterface.h"
 #include "UpscalerInterface.h"
 
@@ -84,6 +90,14 @@ static uint64_t NRI_CALL GetFenceValue(Fence& fence) {
     return ((FenceVal&)fence).GetFenceValue();
 }
 
+static uint64_t NRI_CALL GetBufferDeviceAddress(const Buffer& buffer) {
+    return ((BufferVal&)buffer).GetDeviceAddress();
+}
+
+static void NRI_CALL GetDeviceStatistics(const Device& device, DeviceStatistics& deviceStatistics) {
+    ((const DeviceBase&)device).GetStatistics(deviceStatistics);
+}
+
 static void NRI_CALL GetBufferMemoryDesc(const Buffer& buffer, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) {
     const BufferVal& bufferVal = (BufferVal&)buffer;
     DeviceVal& deviceVal = bufferVal.GetDevice();
@@ -323,6 +337,10 @@ static void NRI_CALL CmdSetDepthBias(CommandBuffer& commandBuffer, const DepthBi
     ((CommandBufferVal&)commandBuffer).SetDepthBias(depthBiasDesc);
 }
 
+static Result NRI_CALL CreateTransientAttachmentView(CommandBuffer& commandBuffer, const Texture2DViewDesc& textureViewDesc, Descriptor*& textureView) {
+    return ((CommandBufferVal&)commandBuffer).CreateTransientAttachmentView(textureViewDesc, textureView);
+}
+
 static void NRI_CALL CmdBeginRendering(CommandBuffer& commandBuffer, const AttachmentsDesc& attachmentsDesc) {
     ((CommandBufferVal&)commandBuffer).BeginRendering(attachmentsDesc);
 }
@@ -375,6 +393,18 @@ static void NRI_CALL CmdReadbackTextureToBuffer(CommandBuffer& commandBuffer, Bu
     ((CommandBufferVal&)commandBuffer).ReadbackTextureToBuffer(dstBuffer, dstDataLayout, srcTexture, srcRegion);
 }
 
+static void NRI_CALL CmdCopyBufferRegions(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferVal&)commandBuffer).CopyBufferRegions(dstBuffer, srcBuffer, regions, regionNum);
+}
+
+static void NRI_CALL CmdUploadBufferToTextureRegions(CommandBuffer& commandBuffer, Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferVal&)commandBuffer).UploadBufferToTextureRegions(dstTexture, srcBuffer, regions, regionNum);
+}
+
+static void NRI_CALL CmdReadbackTextureToBufferRegions(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferVal&)commandBuffer).ReadbackTextureToBufferRegions(dstBuffer, srcTexture, regions, regionNum);
+}
+
 static void NRI_CALL CmdZeroBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, uint64_t size) {
     ((CommandBufferVal&)commandBuffer).ZeroBuffer(buffer, offset, size);
 }
@@ -596,6 +626,7 @@ Result DeviceVal::FillFunctionTable(CoreInterface& table) const {
     table.CmdSetSampleLocations = ::CmdSetSampleLocations;
     table.CmdSetShadingRate = ::CmdSetShadingRate;
     table.CmdSetDepthBias = ::CmdSetDepthBias;
+    table.CreateTransientAttachmentView = ::CreateTransientAttachmentView;
     table.CmdBeginRendering = ::CmdBeginRendering;
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
@@ -609,6 +640,9 @@ Result DeviceVal::FillFunctionTable(CoreInterface& table) const {
     table.CmdCopyTexture = ::CmdCopyTexture;
     table.CmdUploadBufferToTexture = ::CmdUploadBufferToTexture;
     table.CmdReadbackTextureToBuffer = ::CmdReadbackTextureToBuffer;
+    table.CmdCopyBufferRegions = ::CmdCopyBufferRegions;
+    table.CmdUploadBufferToTextureRegions = ::CmdUploadBufferToTextureRegions;
+    table.CmdReadbackTextureToBufferRegions = ::CmdReadbackTextureToBufferRegions;
     table.CmdZeroBuffer = ::CmdZeroBuffer;
     table.CmdResolveTexture = ::CmdResolveTexture;
     table.CmdClearStorage = ::CmdClearStorage;
@@ -629,6 +663,8 @@ Result DeviceVal::FillFunctionTable(CoreInterface& table) const {
     table.QueueSubmit = ::QueueSubmit;
     table.Wait = ::Wait;
     table.GetFenceValue = ::GetFenceValue;
+    table.GetBufferDeviceAddress = ::GetBufferDeviceAddress;
+    table.GetDeviceStatistics = ::GetDeviceStatistics;
     table.UpdateDescriptorRanges = ::UpdateDescriptorRanges;
     table.UpdateDynamicConstantBuffers = ::UpdateDynamicConstantBuffers;
     table.CopyDescriptorSet = ::CopyDescriptorSet;
@@ -753,17 +789,132 @@ static Result NRI_CALL AllocateAndBindMemory(Device& device, const ResourceGroup
     return result;
 }
 
+static Result NRI_CALL CreateResourceGroup(Device& device, const ResourceGroupCreationDesc& resourceGroupCreationDesc, Texture** textures, Buffer** buffers, Memory** allocations, uint32_t& allocationNum, uint64_t& allocationSize) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+
+    RETURN_ON_FAILURE(&deviceVal, resourceGroupCreationDesc.memoryLocation < MemoryLocation::MAX_NUM, Result::INVALID_ARGUMENT, "'memoryLocation' is invalid");
+    RETURN_ON_FAILURE(&deviceVal, resourceGroupCreationDesc.textureNum == 0 || (resourceGroupCreationDesc.textureDescs != nullptr && textures != nullptr), Result::INVALID_ARGUMENT, "'textureDescs' or 'textures' is NULL");
+    RETURN_ON_FAILURE(&deviceVal, resourceGroupCreationDesc.bufferNum == 0 || (resourceGroupCreationDesc.bufferDescs != nullptr && buffers != nullptr), Result::INVALID_ARGUMENT, "'bufferDescs' or 'buffers' is NULL");
+    RETURN_ON_FAILURE(&deviceVal, resourceGroupCreationDesc.textureNum + resourceGroupCreationDesc.bufferNum == 0 || allocations != nullptr, Result::INVALID_ARGUMENT, "'allocations' is NULL");
+
+    // Resources get created via the validation layer, i.e. descs are validated there
+    HelperDeviceMemoryAllocator allocator(deviceVal.GetCoreInterface(), device);
+    Result result = allocator.CreateResourceGroup(resourceGroupCreationDesc, textures, buffers, allocations, allocationNum, allocationSize);
+
+    return result;
+}
+
 static Result NRI_CALL QueryVideoMemoryInfo(const Device& device, MemoryLocation memoryLocation, VideoMemoryInfo& videoMemoryInfo) {
     DeviceVal& deviceVal = (DeviceVal&)device;
 
     return deviceVal.GetHelperInterfaceImpl().QueryVideoMemoryInfo(deviceVal.GetImpl(), memoryLocation, videoMemoryInfo);
 }
 
+static Result NRI_CALL CreateMemoryPool(Device& device, const MemoryPoolDesc& memoryPoolDesc, MemoryPool*& memoryPool) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+    MemoryPoolImpl* impl = Allocate<MemoryPoolImpl>(deviceVal.GetAllocationCallbacks(), device, deviceVal.GetCoreInterface());
+    Result result = impl->Create(memoryPoolDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        memoryPool = nullptr;
+    } else
+        memoryPool = (MemoryPool*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyMemoryPool(MemoryPool* memoryPool) {
+    Destroy((MemoryPoolImpl*)memoryPool);
+}
+
+static Result NRI_CALL AllocatePooledBufferMemory(MemoryPool& memoryPool, Buffer& buffer, MemoryLocation memoryLocation, uint32_t& allocation) {
+    MemoryPoolImpl& memoryPoolImpl = (MemoryPoolImpl&)memoryPool;
+    DeviceVal& deviceVal = (DeviceVal&)memoryPoolImpl.GetDevice();
+
+    allocation = MEMORY_POOL_NULL;
+
+    RETURN_ON_FAILURE(&deviceVal, memoryLocation < MemoryLocation::MAX_NUM, Result::INVALID_ARGUMENT, "'memoryLocation' is invalid");
+    RETURN_ON_FAILURE(&deviceVal, !((BufferVal&)buffer).IsBoundToMemory(), Result::INVALID_ARGUMENT, "'buffer' is already bound to memory");
+
+    return memoryPoolImpl.AllocateBufferMemory(buffer, memoryLocation, allocation);
+}
+
+static Result NRI_CALL AllocatePooledTextureMemory(MemoryPool& memoryPool, Texture& texture, MemoryLocation memoryLocation, uint32_t& allocation) {
+    MemoryPoolImpl& memoryPoolImpl = (MemoryPoolImpl&)memoryPool;
+    DeviceVal& deviceVal = (DeviceVal&)memoryPoolImpl.GetDevice();
+
+    allocation = MEMORY_POOL_NULL;
+
+    RETURN_ON_FAILURE(&deviceVal, memoryLocation < MemoryLocation::MAX_NUM, Result::INVALID_ARGUMENT, "'memoryLocation' is invalid");
+    RETURN_ON_FAILURE(&deviceVal, !((TextureVal&)texture).IsBoundToMemory(), Result::INVALID_ARGUMENT, "'texture' is already bound to memory");
+
+    return memoryPoolImpl.AllocateTextureMemory(texture, memoryLocation, allocation);
+}
+
+static void NRI_CALL FreePooledMemory(MemoryPool& memoryPool, uint32_t allocation) {
+    ((MemoryPoolImpl&)memoryPool).Free(allocation);
+}
+
+static void NRI_CALL GetMemoryPoolStatistics(const MemoryPool& memoryPool, MemoryPoolStatistics& memoryPoolStatistics) {
+    ((MemoryPoolImpl&)memoryPool).GetStatistics(memoryPoolStatistics);
+}
+
+static Result NRI_CALL CreateTexturePool(Device& device, const TexturePoolDesc& texturePoolDesc, TexturePool*& texturePool) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+    TexturePoolImpl* impl = Allocate<TexturePoolImpl>(deviceVal.GetAllocationCallbacks(), device, deviceVal.GetCoreInterface());
+    Result result = impl->Create(texturePoolDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        texturePool = nullptr;
+    } else
+        texturePool = (TexturePool*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyTexturePool(TexturePool* texturePool) {
+    Destroy((TexturePoolImpl*)texturePool);
+}
+
+static Result NRI_CALL AcquirePooledTexture(TexturePool& texturePool, const TextureDesc& textureDesc, PooledTexture& pooledTexture) {
+    TexturePoolImpl& texturePoolImpl = (TexturePoolImpl&)texturePool;
+    DeviceVal& deviceVal = (DeviceVal&)texturePoolImpl.GetDevice();
+
+    pooledTexture = {};
+    pooledTexture.handle = TEXTURE_POOL_NULL;
+
+    RETURN_ON_FAILURE(&deviceVal, textureDesc.usage != TextureUsageBits::NONE, Result::INVALID_ARGUMENT, "'textureDesc.usage' is NONE");
+
+    return texturePoolImpl.Acquire(textureDesc, pooledTexture);
+}
+
+static void NRI_CALL ReleasePooledTexture(TexturePool& texturePool, uint32_t handle, Fence* fence, uint64_t value) {
+    ((TexturePoolImpl&)texturePool).Release(handle, fence, value);
+}
+
+static void NRI_CALL GetTexturePoolStatistics(const TexturePool& texturePool, TexturePoolStatistics& texturePoolStatistics) {
+    ((TexturePoolImpl&)texturePool).GetStatistics(texturePoolStatistics);
+}
+
 Result DeviceVal::FillFunctionTable(HelperInterface& table) const {
     table.CalculateAllocationNumber = ::CalculateAllocationNumber;
     table.AllocateAndBindMemory = ::AllocateAndBindMemory;
+    table.CreateResourceGroup = ::CreateResourceGroup;
     table.UploadData = ::UploadData;
     table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.CreateMemoryPool = ::CreateMemoryPool;
+    table.DestroyMemoryPool = ::DestroyMemoryPool;
+    table.AllocatePooledBufferMemory = ::AllocatePooledBufferMemory;
+    table.AllocatePooledTextureMemory = ::AllocatePooledTextureMemory;
+    table.FreePooledMemory = ::FreePooledMemory;
+    table.GetMemoryPoolStatistics = ::GetMemoryPoolStatistics;
+    table.CreateTexturePool = ::CreateTexturePool;
+    table.DestroyTexturePool = ::DestroyTexturePool;
+    table.AcquirePooledTexture = ::AcquirePooledTexture;
+    table.ReleasePooledTexture = ::ReleasePooledTexture;
+    table.GetTexturePoolStatistics = ::GetTexturePoolStatistics;
 
     return Result::SUCCESS;
 }
@@ -838,6 +989,68 @@ Result DeviceVal::FillFunctionTable(ImguiInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  IndirectCommands  ]
+
+static Result NRI_CALL CreateCommandSignature(Device& device, const CommandSignatureDesc& commandSignatureDesc, CommandSignature*& commandSignature) {
+    return ((DeviceVal&)device).CreateCommandSignature(commandSignatureDesc, commandSignature);
+}
+
+static void NRI_CALL DestroyCommandSignature(CommandSignature* commandSignature) {
+    if (!commandSignature)
+        return;
+
+    CommandSignatureVal* commandSignatureVal = (CommandSignatureVal*)commandSignature;
+    DeviceVal& deviceVal = commandSignatureVal->GetDevice();
+
+    deviceVal.GetIndirectCommandsInterfaceImpl().DestroyCommandSignature(commandSignatureVal->GetImpl());
+    Destroy(commandSignatureVal);
+}
+
+static uint32_t NRI_CALL GetCommandSignatureStride(const CommandSignature& commandSignature) {
+    const CommandSignatureVal& commandSignatureVal = (CommandSignatureVal&)commandSignature;
+    DeviceVal& deviceVal = commandSignatureVal.GetDevice();
+
+    return deviceVal.GetIndirectCommandsInterfaceImpl().GetCommandSignatureStride(*commandSignatureVal.GetImpl());
+}
+
+static uint32_t NRI_CALL GetIndirectArgumentOffset(const CommandSignature& commandSignature, uint32_t argumentIndex) {
+    const CommandSignatureVal& commandSignatureVal = (CommandSignatureVal&)commandSignature;
+    DeviceVal& deviceVal = commandSignatureVal.GetDevice();
+
+    RETURN_ON_FAILURE(&deviceVal, argumentIndex < commandSignatureVal.GetArgumentNum(), 0, "'argumentIndex' is out of bounds");
+
+    return deviceVal.GetIndirectCommandsInterfaceImpl().GetIndirectArgumentOffset(*commandSignatureVal.GetImpl(), argumentIndex);
+}
+
+static uint64_t NRI_CALL GetCommandSignaturePreprocessSize(const CommandSignature& commandSignature, const Pipeline& pipeline, uint32_t commandMaxNum) {
+    const CommandSignatureVal& commandSignatureVal = (CommandSignatureVal&)commandSignature;
+    DeviceVal& deviceVal = commandSignatureVal.GetDevice();
+    Pipeline* pipelineImpl = NRI_GET_IMPL(Pipeline, &pipeline);
+
+    return deviceVal.GetIndirectCommandsInterfaceImpl().GetCommandSignaturePreprocessSize(*commandSignatureVal.GetImpl(), *pipelineImpl, commandMaxNum);
+}
+
+static void NRI_CALL CmdExecuteIndirect(CommandBuffer& commandBuffer, const ExecuteIndirectDesc& executeIndirectDesc) {
+    ((CommandBufferVal&)commandBuffer).ExecuteIndirect(executeIndirectDesc);
+}
+
+Result DeviceVal::FillFunctionTable(IndirectCommandsInterface& table) const {
+    if (!m_IsExtSupported.indirectCommands)
+        return Result::UNSUPPORTED;
+
+    table.CreateCommandSignature = ::CreateCommandSignature;
+    table.DestroyCommandSignature = ::DestroyCommandSignature;
+    table.GetCommandSignatureStride = ::GetCommandSignatureStride;
+    table.GetIndirectArgumentOffset = ::GetIndirectArgumentOffset;
+    table.GetCommandSignaturePreprocessSize = ::GetCommandSignaturePreprocessSize;
+    table.CmdExecuteIndirect = ::CmdExecuteIndirect;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  Low latency  ]
 
@@ -894,6 +1107,116 @@ Result DeviceVal::FillFunctionTable(MeshShaderInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  MicromapBaker  ]
+
+static Result NRI_CALL CreateMicromapBaker(Device& device, const MicromapBakerDesc& micromapBakerDesc, MicromapBaker*& micromapBaker) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+    MicromapBakerImpl* impl = Allocate<MicromapBakerImpl>(deviceVal.GetAllocationCallbacks(), device);
+    Result result = impl->Create(micromapBakerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        micromapBaker = nullptr;
+    } else
+        micromapBaker = (MicromapBaker*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyMicromapBaker(MicromapBaker* micromapBaker) {
+    Destroy((MicromapBakerImpl*)micromapBaker);
+}
+
+static Result NRI_CALL BakeMicromap(MicromapBaker& micromapBaker, const MicromapBakeDesc& micromapBakeDesc, MicromapBakeResult& micromapBakeResult) {
+    return ((MicromapBakerImpl&)micromapBaker).Bake(micromapBakeDesc, micromapBakeResult);
+}
+
+Result DeviceVal::FillFunctionTable(MicromapBakerInterface& table) const {
+    table.CreateMicromapBaker = ::CreateMicromapBaker;
+    table.DestroyMicromapBaker = ::DestroyMicromapBaker;
+    table.BakeMicromap = ::BakeMicromap;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Profiler  ]
+
+static Result NRI_CALL CreateProfiler(Device& device, const ProfilerDesc& profilerDesc, Profiler*& profiler) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+    ProfilerImpl* impl = Allocate<ProfilerImpl>(deviceVal.GetAllocationCallbacks(), device, deviceVal.GetCoreInterface());
+    Result result = impl->Create(profilerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        profiler = nullptr;
+    } else
+        profiler = (Profiler*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyProfiler(Profiler* profiler) {
+    Destroy((ProfilerImpl*)profiler);
+}
+
+static void NRI_CALL CmdBeginProfilerFrame(CommandBuffer& commandBuffer, Profiler& profiler) {
+    ((ProfilerImpl&)profiler).CmdBeginFrame(commandBuffer);
+}
+
+static void NRI_CALL CmdEndProfilerFrame(CommandBuffer& commandBuffer, Profiler& profiler) {
+    ((ProfilerImpl&)profiler).CmdEndFrame(commandBuffer);
+}
+
+static void NRI_CALL CmdBeginProfilerRange(CommandBuffer& commandBuffer, Profiler& profiler, const char* name, uint32_t bgra) {
+    ((ProfilerImpl&)profiler).CmdBeginRange(commandBuffer, name, bgra);
+}
+
+static void NRI_CALL CmdEndProfilerRange(CommandBuffer& commandBuffer, Profiler& profiler) {
+    ((ProfilerImpl&)profiler).CmdEndRange(commandBuffer);
+}
+
+static void NRI_CALL CmdBeginProfilerStatistics(CommandBuffer& commandBuffer, Profiler& profiler, const char* name) {
+    ((ProfilerImpl&)profiler).CmdBeginStatistics(commandBuffer, name);
+}
+
+static void NRI_CALL CmdEndProfilerStatistics(CommandBuffer& commandBuffer, Profiler& profiler) {
+    ((ProfilerImpl&)profiler).CmdEndStatistics(commandBuffer);
+}
+
+static void NRI_CALL EndProfilerFrame(Profiler& profiler) {
+    ((ProfilerImpl&)profiler).EndFrame();
+}
+
+static const ProfilerRange* NRI_CALL GetProfilerRanges(const Profiler& profiler, uint32_t& rangeNum) {
+    return ((ProfilerImpl&)profiler).GetRanges(rangeNum);
+}
+
+static const ProfilerStatistics* NRI_CALL GetProfilerStatistics(const Profiler& profiler, uint32_t& statisticsNum) {
+    return ((ProfilerImpl&)profiler).GetStatistics(statisticsNum);
+}
+
+Result DeviceVal::FillFunctionTable(ProfilerInterface& table) const {
+    table.CreateProfiler = ::CreateProfiler;
+    table.DestroyProfiler = ::DestroyProfiler;
+    table.CmdBeginProfilerFrame = ::CmdBeginProfilerFrame;
+    table.CmdEndProfilerFrame = ::CmdEndProfilerFrame;
+    table.CmdBeginProfilerRange = ::CmdBeginProfilerRange;
+    table.CmdEndProfilerRange = ::CmdEndProfilerRange;
+    table.CmdBeginProfilerStatistics = ::CmdBeginProfilerStatistics;
+    table.CmdEndProfilerStatistics = ::CmdEndProfilerStatistics;
+    table.EndProfilerFrame = ::EndProfilerFrame;
+    table.GetProfilerRanges = ::GetProfilerRanges;
+    table.GetProfilerStatistics = ::GetProfilerStatistics;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  RayTracing  ]
 
@@ -1109,6 +1432,199 @@ Result DeviceVal::FillFunctionTable(RayTracingInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  RenderGraph  ]
+
+static Result NRI_CALL CreateRenderGraph(Device& device, const RenderGraphDesc& renderGraphDesc, RenderGraph*& renderGraph) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+    RenderGraphImpl* impl = Allocate<RenderGraphImpl>(deviceVal.GetAllocationCallbacks(), device, deviceVal.GetCoreInterface());
+    Result result = impl->Create(renderGraphDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        renderGraph = nullptr;
+    } else
+        renderGraph = (RenderGraph*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyRenderGraph(RenderGraph* renderGraph) {
+    Destroy((RenderGraphImpl*)renderGraph);
+}
+
+static void NRI_CALL BeginRenderGraph(RenderGraph& renderGraph) {
+    ((RenderGraphImpl&)renderGraph).Begin();
+}
+
+static uint32_t NRI_CALL AddRenderGraphTexture(RenderGraph& renderGraph, const RenderGraphTextureDesc& renderGraphTextureDesc) {
+    return ((RenderGraphImpl&)renderGraph).AddTexture(renderGraphTextureDesc);
+}
+
+static uint32_t NRI_CALL AddRenderGraphBuffer(RenderGraph& renderGraph, const RenderGraphBufferDesc& renderGraphBufferDesc) {
+    return ((RenderGraphImpl&)renderGraph).AddBuffer(renderGraphBufferDesc);
+}
+
+static uint32_t NRI_CALL ImportRenderGraphTexture(RenderGraph& renderGraph, const RenderGraphImportedTextureDesc& renderGraphImportedTextureDesc) {
+    return ((RenderGraphImpl&)renderGraph).ImportTexture(renderGraphImportedTextureDesc);
+}
+
+static uint32_t NRI_CALL ImportRenderGraphBuffer(RenderGraph& renderGraph, const RenderGraphImportedBufferDesc& renderGraphImportedBufferDesc) {
+    return ((RenderGraphImpl&)renderGraph).ImportBuffer(renderGraphImportedBufferDesc);
+}
+
+static uint32_t NRI_CALL AddRenderGraphPass(RenderGraph& renderGraph, const RenderGraphPassDesc& renderGraphPassDesc) {
+    return ((RenderGraphImpl&)renderGraph).AddPass(renderGraphPassDesc);
+}
+
+static Result NRI_CALL CompileRenderGraph(RenderGraph& renderGraph) {
+    return ((RenderGraphImpl&)renderGraph).Compile();
+}
+
+static Texture* NRI_CALL GetRenderGraphTexture(const RenderGraph& renderGraph, uint32_t texture) {
+    return ((RenderGraphImpl&)renderGraph).GetTexture(texture);
+}
+
+static Buffer* NRI_CALL GetRenderGraphBuffer(const RenderGraph& renderGraph, uint32_t buffer) {
+    return ((RenderGraphImpl&)renderGraph).GetBuffer(buffer);
+}
+
+static const char* NRI_CALL GetRenderGraphDump(const RenderGraph& renderGraph) {
+    return ((RenderGraphImpl&)renderGraph).GetDump();
+}
+
+static CommandBuffer* const* NRI_CALL ExecuteRenderGraph(RenderGraph& renderGraph, const RenderGraphExecuteDesc& renderGraphExecuteDesc, uint32_t& commandBufferNum) {
+    return ((RenderGraphImpl&)renderGraph).Execute(renderGraphExecuteDesc, commandBufferNum);
+}
+
+static Result NRI_CALL SubmitRenderGraph(RenderGraph& renderGraph, const RenderGraphSubmitDesc& renderGraphSubmitDesc) {
+    return ((RenderGraphImpl&)renderGraph).Submit(renderGraphSubmitDesc);
+}
+
+static void NRI_CALL GetRenderGraphStatistics(const RenderGraph& renderGraph, RenderGraphStatistics& renderGraphStatistics) {
+    ((RenderGraphImpl&)renderGraph).GetStatistics(renderGraphStatistics);
+}
+
+Result DeviceVal::FillFunctionTable(RenderGraphInterface& table) const {
+    table.CreateRenderGraph = ::CreateRenderGraph;
+    table.DestroyRenderGraph = ::DestroyRenderGraph;
+    table.BeginRenderGraph = ::BeginRenderGraph;
+    table.AddRenderGraphTexture = ::AddRenderGraphTexture;
+    table.AddRenderGraphBuffer = ::AddRenderGraphBuffer;
+    table.ImportRenderGraphTexture = ::ImportRenderGraphTexture;
+    table.ImportRenderGraphBuffer = ::ImportRenderGraphBuffer;
+    table.AddRenderGraphPass = ::AddRenderGraphPass;
+    table.CompileRenderGraph = ::CompileRenderGraph;
+    table.GetRenderGraphTexture = ::GetRenderGraphTexture;
+    table.GetRenderGraphBuffer = ::GetRenderGraphBuffer;
+    table.GetRenderGraphDump = ::GetRenderGraphDump;
+    table.ExecuteRenderGraph = ::ExecuteRenderGraph;
+    table.SubmitRenderGraph = ::SubmitRenderGraph;
+    table.GetRenderGraphStatistics = ::GetRenderGraphStatistics;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Residency  ]
+
+static Result NRI_CALL SetMemoryPriority(Memory& memory, float priority) {
+    MemoryVal& memoryVal = (MemoryVal&)memory;
+    DeviceVal& deviceVal = memoryVal.GetDevice();
+
+    RETURN_ON_FAILURE(&deviceVal, priority >= -1.0f && priority <= 1.0f, Result::INVALID_ARGUMENT, "'priority' must be in [-1; 1]");
+
+    return deviceVal.GetResidencyInterfaceImpl().SetMemoryPriority(*memoryVal.GetImpl(), priority);
+}
+
+static Result NRI_CALL SetBufferPriority(Buffer& buffer, float priority) {
+    BufferVal& bufferVal = (BufferVal&)buffer;
+    DeviceVal& deviceVal = bufferVal.GetDevice();
+
+    RETURN_ON_FAILURE(&deviceVal, priority >= -1.0f && priority <= 1.0f, Result::INVALID_ARGUMENT, "'priority' must be in [-1; 1]");
+
+    return deviceVal.GetResidencyInterfaceImpl().SetBufferPriority(*bufferVal.GetImpl(), priority);
+}
+
+static Result NRI_CALL SetTexturePriority(Texture& texture, float priority) {
+    TextureVal& textureVal = (TextureVal&)texture;
+    DeviceVal& deviceVal = textureVal.GetDevice();
+
+    RETURN_ON_FAILURE(&deviceVal, priority >= -1.0f && priority <= 1.0f, Result::INVALID_ARGUMENT, "'priority' must be in [-1; 1]");
+
+    return deviceVal.GetResidencyInterfaceImpl().SetTexturePriority(*textureVal.GetImpl(), priority);
+}
+
+static Result NRI_CALL CreateResidencyManager(Device& device, const ResidencyManagerDesc& residencyManagerDesc, ResidencyManager*& residencyManager) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+    ResidencyManagerImpl* impl = Allocate<ResidencyManagerImpl>(deviceVal.GetAllocationCallbacks(), device);
+    Result result = impl->Create(residencyManagerDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        residencyManager = nullptr;
+    } else
+        residencyManager = (ResidencyManager*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyResidencyManager(ResidencyManager* residencyManager) {
+    Destroy((ResidencyManagerImpl*)residencyManager);
+}
+
+static uint32_t NRI_CALL AddResidencyMemory(ResidencyManager& residencyManager, Memory& memory, float priority) {
+    return ((ResidencyManagerImpl&)residencyManager).Add(&memory, ResidencyObjectType::MEMORY, priority);
+}
+
+static uint32_t NRI_CALL AddResidencyBuffer(ResidencyManager& residencyManager, Buffer& buffer, float priority) {
+    return ((ResidencyManagerImpl&)residencyManager).Add(&buffer, ResidencyObjectType::BUFFER, priority);
+}
+
+static uint32_t NRI_CALL AddResidencyTexture(ResidencyManager& residencyManager, Texture& texture, float priority) {
+    return ((ResidencyManagerImpl&)residencyManager).Add(&texture, ResidencyObjectType::TEXTURE, priority);
+}
+
+static void NRI_CALL RemoveResidencyObject(ResidencyManager& residencyManager, uint32_t object) {
+    ((ResidencyManagerImpl&)residencyManager).Remove(object);
+}
+
+static void NRI_CALL MarkResidencyObjectUsed(ResidencyManager& residencyManager, uint32_t object) {
+    ((ResidencyManagerImpl&)residencyManager).MarkUsed(object);
+}
+
+static void NRI_CALL UpdateResidency(ResidencyManager& residencyManager) {
+    ((ResidencyManagerImpl&)residencyManager).Update();
+}
+
+static void NRI_CALL GetResidencyStatistics(const ResidencyManager& residencyManager, ResidencyStatistics& residencyStatistics) {
+    ((ResidencyManagerImpl&)residencyManager).GetStatistics(residencyStatistics);
+}
+
+Result DeviceVal::FillFunctionTable(ResidencyInterface& table) const {
+    if (!m_IsExtSupported.residency)
+        return Result::UNSUPPORTED;
+
+    table.SetMemoryPriority = ::SetMemoryPriority;
+    table.SetBufferPriority = ::SetBufferPriority;
+    table.SetTexturePriority = ::SetTexturePriority;
+    table.CreateResidencyManager = ::CreateResidencyManager;
+    table.DestroyResidencyManager = ::DestroyResidencyManager;
+    table.AddResidencyMemory = ::AddResidencyMemory;
+    table.AddResidencyBuffer = ::AddResidencyBuffer;
+    table.AddResidencyTexture = ::AddResidencyTexture;
+    table.RemoveResidencyObject = ::RemoveResidencyObject;
+    table.MarkResidencyObjectUsed = ::MarkResidencyObjectUsed;
+    table.UpdateResidency = ::UpdateResidency;
+    table.GetResidencyStatistics = ::GetResidencyStatistics;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  ResourceAllocator  ]
 
@@ -1128,11 +1644,100 @@ static Result NRI_CALL AllocateMicromap(Device& device, const AllocateMicromapDe
     return ((DeviceVal&)device).AllocateMicromap(allocateMicromapDesc, micromap);
 }
 
+static Result NRI_CALL GetResourceAllocatorStatistics(const Device& device, ResourceAllocatorHeapStatistics* heapStatistics, uint32_t& heapStatisticsNum) {
+    return ((DeviceVal&)device).GetResourceAllocatorStatistics(heapStatistics, heapStatisticsNum);
+}
+
+static Result NRI_CALL GetResourceAllocatorDump(const Device& device, char* dump, uint64_t& dumpSize) {
+    return ((DeviceVal&)device).GetResourceAllocatorDump(dump, dumpSize);
+}
+
 Result DeviceVal::FillFunctionTable(ResourceAllocatorInterface& table) const {
     table.AllocateBuffer = ::AllocateBuffer;
     table.AllocateTexture = ::AllocateTexture;
     table.AllocateAccelerationStructure = ::AllocateAccelerationStructure;
     table.AllocateMicromap = ::AllocateMicromap;
+    table.GetResourceAllocatorStatistics = ::GetResourceAllocatorStatistics;
+    table.GetResourceAllocatorDump = ::GetResourceAllocatorDump;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Sparse  ]
+
+static Result NRI_CALL CreateSparseBuffer(Device& device, const SparseBufferDesc& sparseBufferDesc, Buffer*& buffer) {
+    return ((DeviceVal&)device).CreateSparseBuffer(sparseBufferDesc, buffer);
+}
+
+static Result NRI_CALL CreateSparseTexture(Device& device, const SparseTextureDesc& sparseTextureDesc, Texture*& texture) {
+    return ((DeviceVal&)device).CreateSparseTexture(sparseTextureDesc, texture);
+}
+
+static void NRI_CALL GetSparseBufferTiling(const Buffer& buffer, SparseTiling& sparseTiling) {
+    const BufferVal& bufferVal = (BufferVal&)buffer;
+    DeviceVal& deviceVal = bufferVal.GetDevice();
+
+    deviceVal.GetSparseInterfaceImpl().GetSparseBufferTiling(*bufferVal.GetImpl(), sparseTiling);
+}
+
+static void NRI_CALL GetSparseTextureTiling(const Texture& texture, SparseTiling& sparseTiling) {
+    const TextureVal& textureVal = (TextureVal&)texture;
+    DeviceVal& deviceVal = textureVal.GetDevice();
+
+    deviceVal.GetSparseInterfaceImpl().GetSparseTextureTiling(*textureVal.GetImpl(), sparseTiling);
+}
+
+static Result NRI_CALL QueueBindSparse(Queue& queue, const QueueBindSparseDesc& queueBindSparseDesc) {
+    return ((QueueVal&)queue).BindSparse(queueBindSparseDesc);
+}
+
+static Result NRI_CALL CreateSparsePageTable(Device& device, const SparsePageTableDesc& sparsePageTableDesc, SparsePageTable*& sparsePageTable) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+    SparsePageTableImpl* impl = Allocate<SparsePageTableImpl>(deviceVal.GetAllocationCallbacks(), device);
+    Result result = impl->Create(sparsePageTableDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        sparsePageTable = nullptr;
+    } else
+        sparsePageTable = (SparsePageTable*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroySparsePageTable(SparsePageTable* sparsePageTable) {
+    Destroy((SparsePageTableImpl*)sparsePageTable);
+}
+
+static void NRI_CALL UpdateSparsePageTable(SparsePageTable& sparsePageTable, const SparseTileMapping* tileMappings, uint32_t tileMappingNum) {
+    ((SparsePageTableImpl&)sparsePageTable).Update(tileMappings, tileMappingNum);
+}
+
+static uint32_t NRI_CALL GetSparsePageTableMappedTileNum(const SparsePageTable& sparsePageTable) {
+    return ((SparsePageTableImpl&)sparsePageTable).GetMappedTileNum();
+}
+
+static void NRI_CALL GetSparsePageTableBinds(SparsePageTable& sparsePageTable, QueueBindSparseDesc& queueBindSparseDesc) {
+    ((SparsePageTableImpl&)sparsePageTable).GetBinds(queueBindSparseDesc);
+}
+
+Result DeviceVal::FillFunctionTable(SparseInterface& table) const {
+    if (!m_IsExtSupported.sparse)
+        return Result::UNSUPPORTED;
+
+    table.CreateSparseBuffer = ::CreateSparseBuffer;
+    table.CreateSparseTexture = ::CreateSparseTexture;
+    table.GetSparseBufferTiling = ::GetSparseBufferTiling;
+    table.GetSparseTextureTiling = ::GetSparseTextureTiling;
+    table.QueueBindSparse = ::QueueBindSparse;
+    table.CreateSparsePageTable = ::CreateSparsePageTable;
+    table.DestroySparsePageTable = ::DestroySparsePageTable;
+    table.UpdateSparsePageTable = ::UpdateSparsePageTable;
+    table.GetSparsePageTableMappedTileNum = ::GetSparsePageTableMappedTileNum;
+    table.GetSparsePageTableBinds = ::GetSparsePageTableBinds;
 
     return Result::SUCCESS;
 }
@@ -1205,6 +1810,27 @@ static uint32_t NRI_CALL StreamConstantData(Streamer& streamer, const void* data
     return streamerImpl->StreamConstantData(data, dataSize);
 }
 
+static uint64_t NRI_CALL StreamDeviceAddresses(Streamer& streamer, const BufferOffset* bufferOffsets, uint32_t bufferOffsetNum) {
+    DeviceVal& deviceVal = GetDeviceVal(streamer);
+    StreamerVal& streamerVal = (StreamerVal&)streamer;
+    StreamerImpl* streamerImpl = streamerVal.GetImpl();
+
+    RETURN_ON_FAILURE(&deviceVal, deviceVal.GetDesc().features.deviceAddress, 0, "'features.deviceAddress' is unsupported");
+    RETURN_ON_FAILURE(&deviceVal, streamerImpl->GetConstantBuffer(), 0, "'constantBufferSize' is 0");
+    RETURN_ON_FAILURE(&deviceVal, bufferOffsetNum, 0, "'bufferOffsetNum' is 0");
+    RETURN_ON_FAILURE(&deviceVal, bufferOffsets, 0, "'bufferOffsets' is NULL");
+
+    for (uint32_t i = 0; i < bufferOffsetNum; i++) {
+        const BufferOffset& bufferOffset = bufferOffsets[i];
+        RETURN_ON_FAILURE(&deviceVal, bufferOffset.buffer, 0, "'bufferOffsets[%u].buffer' is NULL", i);
+
+        const BufferDesc& bufferDesc = ((BufferVal*)bufferOffset.buffer)->GetDesc();
+        RETURN_ON_FAILURE(&deviceVal, bufferOffset.offset < bufferDesc.size, 0, "'bufferOffsets[%u].offset' is out of bounds", i);
+    }
+
+    return streamerImpl->StreamDeviceAddresses(bufferOffsets, bufferOffsetNum);
+}
+
 static BufferOffset NRI_CALL StreamBufferData(Streamer& streamer, const StreamBufferDataDesc& streamBufferDataDesc) {
     DeviceVal& deviceVal = GetDeviceVal(streamer);
     StreamerVal& streamerVal = (StreamerVal&)streamer;
@@ -1257,6 +1883,7 @@ Result DeviceVal::FillFunctionTable(StreamerInterface& table) const {
     table.StreamBufferData = ::StreamBufferData;
     table.StreamTextureData = ::StreamTextureData;
     table.StreamConstantData = ::StreamConstantData;
+    table.StreamDeviceAddresses = ::StreamDeviceAddresses;
     table.EndStreamerFrame = ::EndStreamerFrame;
     table.CmdCopyStreamedData = ::CmdCopyStreamedData;
 
@@ -1297,6 +1924,14 @@ static Result NRI_CALL QueuePresent(SwapChain& swapChain, Fence& releaseSemaphor
     return ((SwapChainVal&)swapChain).Present(releaseSemaphore);
 }
 
+static Result NRI_CALL GetSwapChainStatistics(SwapChain& swapChain, SwapChainStatistics& swapChainStatistics) {
+    return ((SwapChainVal&)swapChain).GetStatistics(swapChainStatistics);
+}
+
+static Result NRI_CALL GetPresentedFrame(SwapChain& swapChain, PresentedFrame& presentedFrame) {
+    return ((SwapChainVal&)swapChain).GetPresentedFrame(presentedFrame);
+}
+
 Result DeviceVal::FillFunctionTable(SwapChainInterface& table) const {
     if (!m_IsExtSupported.swapChain)
         return Result::UNSUPPORTED;
@@ -1308,6 +1943,44 @@ Result DeviceVal::FillFunctionTable(SwapChainInterface& table) const {
     table.AcquireNextTexture = ::AcquireNextTexture;
     table.WaitForPresent = ::WaitForPresent;
     table.QueuePresent = ::QueuePresent;
+    table.GetSwapChainStatistics = ::GetSwapChainStatistics;
+    table.GetPresentedFrame = ::GetPresentedFrame;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Trace  ]
+
+static Result NRI_CALL StartTrace(Device& device, const TraceDesc& traceDesc) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+    DeviceBase& deviceImpl = (DeviceBase&)deviceVal.GetImpl();
+
+    Result result = deviceImpl.StartTrace(traceDesc);
+    if (result == Result::SUCCESS)
+        deviceVal.ShareTrace(deviceImpl); // for events of shared extensions created on top of validation
+
+    return result;
+}
+
+static void NRI_CALL StopTrace(Device& device) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+    DeviceBase& deviceImpl = (DeviceBase&)deviceVal.GetImpl();
+
+    deviceVal.StopTrace();
+    deviceImpl.StopTrace();
+}
+
+static const char* NRI_CALL GetTraceJson(Device& device) {
+    return ((DeviceBase&)((DeviceVal&)device).GetImpl()).GetTraceJson();
+}
+
+Result DeviceVal::FillFunctionTable(TraceInterface& table) const {
+    table.StartTrace = ::StartTrace;
+    table.StopTrace = ::StopTrace;
+    table.GetTraceJson = ::GetTraceJson;
 
     return Result::SUCCESS;
 }
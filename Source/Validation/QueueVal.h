@@ -25,6 +25,7 @@ struct QueueVal final : public ObjectVal {
     void EndAnnotation();
     void Annotation(const char* name, uint32_t bgra);
     Result Submit(const QueueSubmitDesc& queueSubmitDesc);
+    Result BindSparse(const QueueBindSparseDesc& queueBindSparseDesc);
     Result WaitIdle();
 };
 
@@ -39,6 +39,112 @@ NRI_INLINE Result QueueVal::Submit(const QueueSubmitDesc& queueSubmitDesc) {
     return GetCoreInterfaceImpl().QueueSubmit(*GetImpl(), queueSubmitDescImpl);
 }
 
+NRI_INLINE Result QueueVal::BindSparse(const QueueBindSparseDesc& queueBindSparseDesc) {
+    const SparseInterface& sparseInterfaceImpl = m_Device.GetSparseInterfaceImpl();
+    auto queueBindSparseDescImpl = queueBindSparseDesc;
+
+    Scratch<FenceSubmitDesc> waitFences = AllocateScratch(m_Device, FenceSubmitDesc, queueBindSparseDesc.waitFenceNum);
+    for (uint32_t i = 0; i < queueBindSparseDesc.waitFenceNum; i++) {
+        waitFences[i] = queueBindSparseDesc.waitFences[i];
+        waitFences[i].fence = NRI_GET_IMPL(Fence, waitFences[i].fence);
+    }
+    queueBindSparseDescImpl.waitFences = waitFences;
+
+    Scratch<SparseBufferBindDesc> bufferBinds = AllocateScratch(m_Device, SparseBufferBindDesc, queueBindSparseDesc.bufferBindNum);
+    for (uint32_t i = 0; i < queueBindSparseDesc.bufferBindNum; i++) {
+        const SparseBufferBindDesc& bufferBind = queueBindSparseDesc.bufferBinds[i];
+        RETURN_ON_FAILURE(&m_Device, bufferBind.buffer, Result::INVALID_ARGUMENT, "'bufferBinds[%u].buffer' is NULL", i);
+        RETURN_ON_FAILURE(&m_Device, bufferBind.size, Result::INVALID_ARGUMENT, "'bufferBinds[%u].size' is 0", i);
+
+        const BufferVal& bufferVal = *(BufferVal*)bufferBind.buffer;
+        SparseTiling sparseTiling = {};
+        sparseInterfaceImpl.GetSparseBufferTiling(*bufferVal.GetImpl(), sparseTiling);
+
+        uint64_t tileSize = sparseTiling.tileSize;
+        RETURN_ON_FAILURE(&m_Device, bufferBind.offset % tileSize == 0 && bufferBind.size % tileSize == 0, Result::INVALID_ARGUMENT, "'bufferBinds[%u]': 'offset' and 'size' must be multiples of 'tileSize=%" PRIu64 "'", i, tileSize);
+        RETURN_ON_FAILURE(&m_Device, bufferBind.offset + bufferBind.size <= sparseTiling.tileNum * tileSize, Result::INVALID_ARGUMENT, "'bufferBinds[%u]': 'offset + size' is out of bounds", i);
+
+        if (bufferBind.memory) {
+            const MemoryVal& memoryVal = *(MemoryVal*)bufferBind.memory;
+            RETURN_ON_FAILURE(&m_Device, bufferBind.memoryOffset % tileSize == 0, Result::INVALID_ARGUMENT, "'bufferBinds[%u].memoryOffset' must be a multiple of 'tileSize=%" PRIu64 "'", i, tileSize);
+            RETURN_ON_FAILURE(&m_Device, bufferBind.memoryOffset + bufferBind.size <= memoryVal.GetSize(), Result::INVALID_ARGUMENT, "'bufferBinds[%u]': 'memoryOffset + size' is out of 'memory' bounds", i);
+        }
+
+        bufferBinds[i] = bufferBind;
+        bufferBinds[i].buffer = NRI_GET_IMPL(Buffer, bufferBind.buffer);
+        bufferBinds[i].memory = NRI_GET_IMPL(Memory, bufferBind.memory);
+    }
+    queueBindSparseDescImpl.bufferBinds = bufferBinds;
+
+    Scratch<SparseTextureBindDesc> textureBinds = AllocateScratch(m_Device, SparseTextureBindDesc, queueBindSparseDesc.textureBindNum);
+    for (uint32_t i = 0; i < queueBindSparseDesc.textureBindNum; i++) {
+        const SparseTextureBindDesc& textureBind = queueBindSparseDesc.textureBinds[i];
+        RETURN_ON_FAILURE(&m_Device, textureBind.texture, Result::INVALID_ARGUMENT, "'textureBinds[%u].texture' is NULL", i);
+        RETURN_ON_FAILURE(&m_Device, textureBind.region.width && textureBind.region.height && textureBind.region.depth, Result::INVALID_ARGUMENT, "'textureBinds[%u].region' is empty", i);
+
+        const TextureVal& textureVal = *(TextureVal*)textureBind.texture;
+        const TextureDesc& textureDesc = textureVal.GetDesc();
+        const TextureRegionDesc& region = textureBind.region;
+        SparseTiling sparseTiling = {};
+        sparseInterfaceImpl.GetSparseTextureTiling(*textureVal.GetImpl(), sparseTiling);
+
+        RETURN_ON_FAILURE(&m_Device, region.mipOffset < sparseTiling.mipTailFirst, Result::INVALID_ARGUMENT, "'textureBinds[%u].region.mipOffset=%u' must be < 'mipTailFirst=%u'", i, region.mipOffset, sparseTiling.mipTailFirst);
+        RETURN_ON_FAILURE(&m_Device, region.layerOffset < textureDesc.layerNum, Result::INVALID_ARGUMENT, "'textureBinds[%u].region.layerOffset=%u' is out of bounds", i, region.layerOffset);
+
+        uint32_t tileNumX = (std::max(textureDesc.width >> region.mipOffset, 1) + sparseTiling.tileWidth - 1) / sparseTiling.tileWidth;
+        uint32_t tileNumY = (std::max(textureDesc.height >> region.mipOffset, 1) + sparseTiling.tileHeight - 1) / sparseTiling.tileHeight;
+        uint32_t tileNumZ = (std::max(textureDesc.depth >> region.mipOffset, 1) + sparseTiling.tileDepth - 1) / sparseTiling.tileDepth;
+        RETURN_ON_FAILURE(&m_Device, (uint32_t)region.x + region.width <= tileNumX && (uint32_t)region.y + region.height <= tileNumY && (uint32_t)region.z + region.depth <= tileNumZ,
+            Result::INVALID_ARGUMENT, "'textureBinds[%u].region' is out of bounds (mip %u has %ux%ux%u tiles)", i, region.mipOffset, tileNumX, tileNumY, tileNumZ);
+
+        if (textureBind.memory) {
+            const MemoryVal& memoryVal = *(MemoryVal*)textureBind.memory;
+            uint64_t size = (uint64_t)region.width * region.height * region.depth * sparseTiling.tileSize;
+            RETURN_ON_FAILURE(&m_Device, textureBind.memoryOffset % sparseTiling.tileSize == 0, Result::INVALID_ARGUMENT, "'textureBinds[%u].memoryOffset' must be a multiple of 'tileSize=%" PRIu64 "'", i, sparseTiling.tileSize);
+            RETURN_ON_FAILURE(&m_Device, textureBind.memoryOffset + size <= memoryVal.GetSize(), Result::INVALID_ARGUMENT, "'textureBinds[%u]': mapped tiles are out of 'memory' bounds", i);
+        }
+
+        textureBinds[i] = textureBind;
+        textureBinds[i].texture = NRI_GET_IMPL(Texture, textureBind.texture);
+        textureBinds[i].memory = NRI_GET_IMPL(Memory, textureBind.memory);
+    }
+    queueBindSparseDescImpl.textureBinds = textureBinds;
+
+    Scratch<SparseMipTailBindDesc> mipTailBinds = AllocateScratch(m_Device, SparseMipTailBindDesc, queueBindSparseDesc.mipTailBindNum);
+    for (uint32_t i = 0; i < queueBindSparseDesc.mipTailBindNum; i++) {
+        const SparseMipTailBindDesc& mipTailBind = queueBindSparseDesc.mipTailBinds[i];
+        RETURN_ON_FAILURE(&m_Device, mipTailBind.texture, Result::INVALID_ARGUMENT, "'mipTailBinds[%u].texture' is NULL", i);
+
+        const TextureVal& textureVal = *(TextureVal*)mipTailBind.texture;
+        SparseTiling sparseTiling = {};
+        sparseInterfaceImpl.GetSparseTextureTiling(*textureVal.GetImpl(), sparseTiling);
+
+        RETURN_ON_FAILURE(&m_Device, sparseTiling.mipTailTileNum, Result::INVALID_ARGUMENT, "'mipTailBinds[%u].texture' doesn't have a mip tail", i);
+        RETURN_ON_FAILURE(&m_Device, sparseTiling.isMipTailShared || mipTailBind.layer < textureVal.GetDesc().layerNum, Result::INVALID_ARGUMENT, "'mipTailBinds[%u].layer=%u' is out of bounds", i, mipTailBind.layer);
+
+        if (mipTailBind.memory) {
+            const MemoryVal& memoryVal = *(MemoryVal*)mipTailBind.memory;
+            uint64_t size = sparseTiling.mipTailTileNum * sparseTiling.tileSize;
+            RETURN_ON_FAILURE(&m_Device, mipTailBind.memoryOffset % sparseTiling.tileSize == 0, Result::INVALID_ARGUMENT, "'mipTailBinds[%u].memoryOffset' must be a multiple of 'tileSize=%" PRIu64 "'", i, sparseTiling.tileSize);
+            RETURN_ON_FAILURE(&m_Device, mipTailBind.memoryOffset + size <= memoryVal.GetSize(), Result::INVALID_ARGUMENT, "'mipTailBinds[%u]': mip tail tiles are out of 'memory' bounds", i);
+        }
+
+        mipTailBinds[i] = mipTailBind;
+        mipTailBinds[i].texture = NRI_GET_IMPL(Texture, mipTailBind.texture);
+        mipTailBinds[i].memory = NRI_GET_IMPL(Memory, mipTailBind.memory);
+    }
+    queueBindSparseDescImpl.mipTailBinds = mipTailBinds;
+
+    Scratch<FenceSubmitDesc> signalFences = AllocateScratch(m_Device, FenceSubmitDesc, queueBindSparseDesc.signalFenceNum);
+    for (uint32_t i = 0; i < queueBindSparseDesc.signalFenceNum; i++) {
+        signalFences[i] = queueBindSparseDesc.signalFences[i];
+        signalFences[i].fence = NRI_GET_IMPL(Fence, signalFences[i].fence);
+    }
+    queueBindSparseDescImpl.signalFences = signalFences;
+
+    return m_Device.GetSparseInterfaceImpl().QueueBindSparse(*GetImpl(), queueBindSparseDescImpl);
+}
+
 NRI_INLINE Result QueueVal::WaitIdle() {
     return GetCoreInterfaceImpl().QueueWaitIdle(GetImpl());
 }
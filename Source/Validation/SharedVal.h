@@ -39,6 +39,10 @@ struct ObjectVal : public DebugNameBaseVal {
         return m_Device.GetHelperInterfaceImpl();
     }
 
+    inline const IndirectCommandsInterface& GetIndirectCommandsInterfaceImpl() const {
+        return m_Device.GetIndirectCommandsInterfaceImpl();
+    }
+
     inline const LowLatencyInterface& GetLowLatencyInterfaceImpl() const {
         return m_Device.GetLowLatencyInterfaceImpl();
     }
@@ -139,9 +143,9 @@ constexpr bool IsAccessMaskSupported(BufferUsageBits usage, AccessBits accessMas
     if (accessMask & AccessBits::SHADER_BINDING_TABLE)
         isSupported = isSupported && (usage & BufferUsageBits::SHADER_BINDING_TABLE) != 0;
     if (accessMask & AccessBits::SHADER_RESOURCE)
-        isSupported = isSupported && (usage & (BufferUsageBits::SHADER_RESOURCE | BufferUsageBits::ACCELERATION_STRUCTURE_BUILD_INPUT)) != 0;
+        isSupported = isSupported && (usage & (BufferUsageBits::SHADER_RESOURCE | BufferUsageBits::ACCELERATION_STRUCTURE_BUILD_INPUT | BufferUsageBits::DEVICE_ADDRESS)) != 0;
     if (accessMask & AccessBits::SHADER_RESOURCE_STORAGE)
-        isSupported = isSupported && (usage & BufferUsageBits::SHADER_RESOURCE_STORAGE) != 0;
+        isSupported = isSupported && (usage & (BufferUsageBits::SHADER_RESOURCE_STORAGE | BufferUsageBits::DEVICE_ADDRESS)) != 0;
     if (accessMask & (AccessBits::RESOLVE_SOURCE | AccessBits::RESOLVE_DESTINATION))
         isSupported = false;
 
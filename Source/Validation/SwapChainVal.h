@@ -28,6 +28,8 @@ struct SwapChainVal final : public ObjectVal {
     Result WaitForPresent();
     Result Present(Fence& releaseSemaphore);
     Result GetDisplayDesc(DisplayDesc& displayDesc) const;
+    Result GetStatistics(SwapChainStatistics& swapChainStatistics) const;
+    Result GetPresentedFrame(PresentedFrame& presentedFrame);
 
     Result SetLatencySleepMode(const LatencySleepMode& latencySleepMode);
     Result SetLatencyMarker(LatencyMarker latencyMarker);
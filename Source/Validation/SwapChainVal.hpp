@@ -28,7 +28,7 @@ NRI_INLINE Result SwapChainVal::WaitForPresent() {
     RETURN_ON_FAILURE(&m_Device, m_SwapChainDesc.flags & SwapChainBits::WAITABLE, Result::FAILURE, "Swap chain has not been created with 'WAITABLE' flag");
 
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
-    RETURN_ON_FAILURE(&m_Device, deviceDesc.features.waitableSwapChain, Result::FAILURE, "'features.waitableSwapChain' is false");
+    RETURN_ON_FAILURE(&m_Device, deviceDesc.features.waitableSwapChain || m_SwapChainDesc.window.headless.enable, Result::FAILURE, "'features.waitableSwapChain' is false");
 
     return GetSwapChainInterfaceImpl().WaitForPresent(*GetImpl());
 }
@@ -43,11 +43,22 @@ NRI_INLINE Result SwapChainVal::GetDisplayDesc(DisplayDesc& displayDesc) const {
     return GetSwapChainInterfaceImpl().GetDisplayDesc(*GetImpl(), displayDesc);
 }
 
+NRI_INLINE Result SwapChainVal::GetStatistics(SwapChainStatistics& swapChainStatistics) const {
+    return GetSwapChainInterfaceImpl().GetSwapChainStatistics(*GetImpl(), swapChainStatistics);
+}
+
+NRI_INLINE Result SwapChainVal::GetPresentedFrame(PresentedFrame& presentedFrame) {
+    RETURN_ON_FAILURE(&m_Device, m_SwapChainDesc.window.headless.enable, Result::FAILURE, "Swap chain is not headless");
+    RETURN_ON_FAILURE(&m_Device, m_SwapChainDesc.window.headless.allowReadback, Result::FAILURE, "Swap chain has not been created with 'allowReadback'");
+
+    return GetSwapChainInterfaceImpl().GetPresentedFrame(*GetImpl(), presentedFrame);
+}
+
 NRI_INLINE Result SwapChainVal::SetLatencySleepMode(const LatencySleepMode& latencySleepMode) {
     RETURN_ON_FAILURE(&m_Device, m_SwapChainDesc.flags & SwapChainBits::ALLOW_LOW_LATENCY, Result::FAILURE, "Swap chain has not been created with 'ALLOW_LOW_LATENCY' flag");
 
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
-    RETURN_ON_FAILURE(&m_Device, deviceDesc.features.lowLatency, Result::FAILURE, "'features.lowLatency' is false");
+    RETURN_ON_FAILURE(&m_Device, deviceDesc.features.lowLatency || m_SwapChainDesc.window.headless.enable, Result::FAILURE, "'features.lowLatency' is false");
 
     return GetLowLatencyInterfaceImpl().SetLatencySleepMode(*GetImpl(), latencySleepMode);
 }
@@ -56,7 +67,7 @@ NRI_INLINE Result SwapChainVal::SetLatencyMarker(LatencyMarker latencyMarker) {
     RETURN_ON_FAILURE(&m_Device, m_SwapChainDesc.flags & SwapChainBits::ALLOW_LOW_LATENCY, Result::FAILURE, "Swap chain has not been created with 'ALLOW_LOW_LATENCY' flag");
 
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
-    RETURN_ON_FAILURE(&m_Device, deviceDesc.features.lowLatency, Result::FAILURE, "'features.lowLatency' is false");
+    RETURN_ON_FAILURE(&m_Device, deviceDesc.features.lowLatency || m_SwapChainDesc.window.headless.enable, Result::FAILURE, "'features.lowLatency' is false");
 
     return GetLowLatencyInterfaceImpl().SetLatencyMarker(*GetImpl(), latencyMarker);
 }
@@ -65,7 +76,7 @@ NRI_INLINE Result SwapChainVal::LatencySleep() {
     RETURN_ON_FAILURE(&m_Device, m_SwapChainDesc.flags & SwapChainBits::ALLOW_LOW_LATENCY, Result::FAILURE, "Swap chain has not been created with 'ALLOW_LOW_LATENCY' flag");
 
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
-    RETURN_ON_FAILURE(&m_Device, deviceDesc.features.lowLatency, Result::FAILURE, "'features.lowLatency' is false");
+    RETURN_ON_FAILURE(&m_Device, deviceDesc.features.lowLatency || m_SwapChainDesc.window.headless.enable, Result::FAILURE, "'features.lowLatency' is false");
 
     return GetLowLatencyInterfaceImpl().LatencySleep(*GetImpl());
 }
@@ -74,7 +85,7 @@ NRI_INLINE Result SwapChainVal::GetLatencyReport(LatencyReport& latencyReport) {
     RETURN_ON_FAILURE(&m_Device, m_SwapChainDesc.flags & SwapChainBits::ALLOW_LOW_LATENCY, Result::FAILURE, "Swap chain has not been created with 'ALLOW_LOW_LATENCY' flag");
 
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
-    RETURN_ON_FAILURE(&m_Device, deviceDesc.features.lowLatency, Result::FAILURE, "'features.lowLatency' is false");
+    RETURN_ON_FAILURE(&m_Device, deviceDesc.features.lowLatency || m_SwapChainDesc.window.headless.enable, Result::FAILURE, "'features.lowLatency' is false");
 
     return GetLowLatencyInterfaceImpl().GetLatencyReport(*GetImpl(), latencyReport);
 }